@@ -0,0 +1,41 @@
+#include "BootProfile.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+
+typedef struct {
+  const char *phase;
+  int64_t at_us;
+} BootMark;
+
+static BootMark marks[BOOT_PROFILE_MAX];
+static uint32_t mark_count = 0;
+static bool reported = false;
+static portMUX_TYPE marks_lock = portMUX_INITIALIZER_UNLOCKED;
+
+void boot_mark(const char *phase) {
+  // Timestamp under the lock, so marks from different tasks stay in order
+  portENTER_CRITICAL(&marks_lock);
+  int64_t now = esp_timer_get_time();
+  bool late = reported;
+  if (!late && mark_count < BOOT_PROFILE_MAX) marks[mark_count++] = { phase, now };
+  portEXIT_CRITICAL(&marks_lock);
+  if (late) Serial.printf("BOOT: %-16s %6lu ms (after the report)\n", phase, (unsigned long)(now / 1000));
+}
+
+void boot_report(void) {
+  portENTER_CRITICAL(&marks_lock);
+  bool first = !reported;
+  reported = true;
+  portEXIT_CRITICAL(&marks_lock);
+  if (!first) return;
+
+  // No more marks are stored once reported is set, so the array is stable
+  Serial.printf("BOOT: %s boot, %lu phases (ms since boot, ms since the previous phase)\n",
+                FAST_BOOT ? "fast" : "normal", (unsigned long)mark_count);
+  int64_t prev_us = 0;
+  for (uint32_t i = 0; i < mark_count; i++) {
+    Serial.printf("BOOT: %-16s %6lu  +%lu\n", marks[i].phase, (unsigned long)(marks[i].at_us / 1000),
+                  (unsigned long)((marks[i].at_us - prev_us) / 1000));
+    prev_us = marks[i].at_us;
+  }
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <stdint.h>
+
+// ============================================================================
+// BOOT SEQUENCE
+// ----------------------------------------------------------------------------
+// FAST_BOOT 1: CAN starts at the top of setup(), on its own core while the
+// expander, panel and LVGL initialise on the UI core; the fixed settle delays
+// before the expander scan are gone (the scan polls for it instead); the boot
+// screen ends as soon as CAN values have arrived, but is shown at least
+// BOOT_SPLASH_MIN_MS. 0: the original sequence (CAN 5 s after setup, boot
+// screen 4 s), for comparison. Either way a button press skips the boot screen.
+// ============================================================================
+
+#define FAST_BOOT             1
+
+#if FAST_BOOT
+#define BOOT_CAN_DELAY_MS     0
+#define BOOT_SPLASH_MIN_MS    500
+#define BOOT_SPLASH_MAX_MS    1500   // Without CAN data
+#else
+#define BOOT_CAN_DELAY_MS     5000
+#define BOOT_SPLASH_MIN_MS    4000
+#define BOOT_SPLASH_MAX_MS    4000
+#endif
+#define BOOT_ICONS_MS         2000   // Status icons shown after the boot screen
+
+// ============================================================================
+// BOOT PROFILE
+// ----------------------------------------------------------------------------
+// Timestamps (esp_timer, from just after the bootloader) of the end of each
+// boot phase, from any task. The report lists them in time order once live
+// values are on screen; phases marked after that print as they happen.
+// ============================================================================
+
+#define BOOT_PROFILE_MAX      24
+
+// phase must be a string literal (only the pointer is kept)
+void boot_mark(const char *phase);
+// Print the phases marked so far; only the first call prints
+void boot_report(void);
@@ -0,0 +1,184 @@
+#include "Buttons.h"
+#include "I2C_Service.h"
+#include "TCA9554PWR.h"
+#include <freertos/queue.h>
+#include <esp_timer.h>
+
+#define BUTTON_COUNT     4
+#define BUTTON_FIRST_PIN EXIO_PIN5
+
+static const uint8_t gestures[BUTTON_COUNT] = {
+  BUTTONS_GESTURES_P5, BUTTONS_GESTURES_P6, BUTTONS_GESTURES_P7, BUTTONS_GESTURES_P8,
+};
+
+typedef struct {
+  bool raw;                    // Last level read, true = pressed (pulled low)
+  bool pressed;                // Debounced level
+  unsigned long raw_since;     // When raw last changed
+  unsigned long released_at;
+  unsigned long pressed_at;
+  bool long_sent;              // BUTTON_LONG already sent for this press
+  bool click_pending;          // Released once, waiting out BUTTONS_DOUBLE_MS
+  bool swallow_release;        // This press was the second of a double
+} ButtonState;
+
+static ButtonState buttons[BUTTON_COUNT];
+static QueueHandle_t event_queue = NULL;
+static TaskHandle_t notify_task = NULL;
+static uint32_t notify_bits = 0;
+static esp_timer_handle_t read_timer = NULL;
+static uint32_t events_dropped = 0;
+static const I2cTransfer port_read = { I2C_OP_READ, TCA9554_ADDRESS, TCA9554_INPUT_REG, 1, {} };
+
+static void emit(uint8_t index, ButtonEventType type) {
+  ButtonEvent event = { (uint8_t)(BUTTON_FIRST_PIN + index), type };
+  if (xQueueSend(event_queue, &event, 0) != pdTRUE) {
+    events_dropped++;
+    Serial.printf("Buttons: queue full, P%d %s dropped (%lu total)\n", event.pin,
+                  button_event_name(type), events_dropped);
+    return;
+  }
+  xTaskNotify(notify_task, notify_bits, eSetBits);
+}
+
+static void on_press(uint8_t i, unsigned long now) {
+  ButtonState *b = &buttons[i];
+  b->pressed_at = now;
+  b->long_sent = false;
+  if (b->click_pending) {
+    b->click_pending = false;
+    b->swallow_release = true;
+    emit(i, BUTTON_DOUBLE);
+  } else if (gestures[i] == 0) {
+    emit(i, BUTTON_CLICK);
+  }
+}
+
+static void on_release(uint8_t i, unsigned long now) {
+  ButtonState *b = &buttons[i];
+  if (b->swallow_release) {
+    b->swallow_release = false;
+  } else if (b->long_sent || gestures[i] == 0) {
+    // Already reported
+  } else if (gestures[i] & BUTTON_GESTURE_DOUBLE) {
+    b->click_pending = true;
+    b->released_at = now;
+  } else {
+    emit(i, BUTTON_CLICK);
+  }
+}
+
+// Feed one port read. Returns true while any input is still debouncing or
+// timing a gesture, so the caller keeps reading every BUTTONS_TICK_MS.
+static bool process_port(uint8_t port, unsigned long now) {
+  bool busy = false;
+  for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+    ButtonState *b = &buttons[i];
+    bool raw = (port & (1 << (BUTTON_FIRST_PIN - 1 + i))) == 0;
+    if (raw != b->raw) {
+      b->raw = raw;
+      b->raw_since = now;
+    }
+    if (b->raw != b->pressed && now - b->raw_since >= BUTTONS_DEBOUNCE_MS) {
+      b->pressed = b->raw;
+      if (b->pressed) on_press(i, now);
+      else on_release(i, now);
+    }
+
+    bool long_timing = b->pressed && (gestures[i] & BUTTON_GESTURE_LONG) && !b->long_sent && !b->swallow_release;
+    if (long_timing && now - b->pressed_at >= BUTTONS_LONG_MS) {
+      b->long_sent = true;
+      long_timing = false;
+      emit(i, BUTTON_LONG);
+    }
+    if (b->click_pending && now - b->released_at >= BUTTONS_DOUBLE_MS) {
+      b->click_pending = false;
+      emit(i, BUTTON_CLICK);
+    }
+    busy |= b->raw != b->pressed || long_timing || b->click_pending;
+  }
+  return busy;
+}
+
+static void schedule_read(uint32_t ms) {
+  esp_timer_stop(read_timer);  // Not running is fine
+  esp_timer_start_once(read_timer, (uint64_t)ms * 1000);
+}
+
+// On the I2C service task. Reading the port also releases INT.
+static void port_read_done(const I2cTransfer *transfer, I2cResult result, void *ctx) {
+  bool busy = result == I2C_RESULT_OK && process_port(transfer->data[0], millis());
+#if BUTTONS_INT_GPIO >= 0
+  schedule_read(busy ? BUTTONS_TICK_MS : BUTTONS_IDLE_MS);
+#else
+  schedule_read(busy ? BUTTONS_TICK_MS : BUTTONS_POLL_MS);
+#endif
+}
+
+static void read_timer_cb(void *arg) {
+  // Queue full: the bus is backed up, try again on the next poll
+  if (!i2c_submit(&port_read, port_read_done, NULL)) schedule_read(BUTTONS_POLL_MS);
+}
+
+#if BUTTONS_INT_GPIO >= 0
+static void IRAM_ATTR tca_int_isr(void) {
+  BaseType_t woken = pdFALSE;
+  i2c_submit_from_isr(&port_read, port_read_done, NULL, &woken);
+  if (woken) portYIELD_FROM_ISR();
+}
+#endif
+
+bool buttons_init(TaskHandle_t task, uint32_t bits) {
+  // Reads are queued to the I2C service; without it the timer would submit to nothing
+  if (!i2c_service_running()) {
+    Serial.println("Buttons: I2C service not running, input disabled");
+    return false;
+  }
+  notify_task = task;
+  notify_bits = bits;
+  event_queue = xQueueCreate(BUTTONS_QUEUE_LEN, sizeof(ButtonEvent));
+  if (event_queue == NULL) {
+    Serial.println("Buttons: out of memory, input disabled");
+    return false;
+  }
+
+  // Start from the current levels so a button held through boot is not a press
+  uint8_t port = 0xFF;
+  if (!i2c_read(TCA9554_ADDRESS, TCA9554_INPUT_REG, &port, 1)) {
+    Serial.println("Buttons: TCA9554 read failed, assuming released");
+  }
+  for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+    buttons[i] = {};
+    buttons[i].raw = buttons[i].pressed = (port & (1 << (BUTTON_FIRST_PIN - 1 + i))) == 0;
+  }
+
+  esp_timer_create_args_t timer_args = {};
+  timer_args.callback = read_timer_cb;
+  timer_args.name = "buttons";
+  if (esp_timer_create(&timer_args, &read_timer) != ESP_OK) {
+    Serial.println("Buttons: cannot create read timer, input disabled");
+    return false;
+  }
+  schedule_read(BUTTONS_POLL_MS);
+#if BUTTONS_INT_GPIO >= 0
+  pinMode(BUTTONS_INT_GPIO, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(BUTTONS_INT_GPIO), tca_int_isr, FALLING);
+  Serial.printf("Buttons: P5-P8 on TCA9554 INT (GPIO %d)\n", BUTTONS_INT_GPIO);
+#else
+  Serial.printf("Buttons: P5-P8 polled every %d ms\n", BUTTONS_POLL_MS);
+#endif
+  return true;
+}
+
+bool buttons_get_event(ButtonEvent *event) {
+  return event_queue != NULL && xQueueReceive(event_queue, event, 0) == pdTRUE;
+}
+
+const char *button_event_name(ButtonEventType type) {
+  switch (type) {
+    case BUTTON_CLICK:  return "click";
+    case BUTTON_DOUBLE: return "double";
+    case BUTTON_LONG:   return "long";
+  }
+  return "?";
+}
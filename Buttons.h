@@ -0,0 +1,54 @@
+#pragma once
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// ============================================================================
+// BUTTONS
+// ----------------------------------------------------------------------------
+// Debounced gesture input from TCA9554 P5-P8 (active low, pulled up). The
+// port is read with queued I2C service transfers (I2C_Service.h), never by
+// the UI: on the expander's INT line when BUTTONS_INT_GPIO is wired,
+// otherwise every BUTTONS_POLL_MS from a one-shot esp_timer that each
+// completed read re-arms. The completion runs the debounce and gesture logic
+// on the service task; gestures go into an event queue and the UI task is
+// woken with a task notification to drain it.
+// ============================================================================
+
+#define BUTTONS_INT_GPIO      -1    // ESP32 GPIO wired to TCA9554 INT (open drain), -1 = poll
+#define BUTTONS_POLL_MS       10    // Port read interval without INT
+#define BUTTONS_TICK_MS       5     // Read interval while a debounce or gesture is timing
+#define BUTTONS_IDLE_MS       1000  // With INT: re-read this often anyway (clears a missed INT)
+#define BUTTONS_DEBOUNCE_MS   20    // Level must hold this long to count
+#define BUTTONS_LONG_MS       800   // Held this long = BUTTON_LONG (sent while still held)
+#define BUTTONS_DOUBLE_MS     300   // Second press within this of the release = BUTTON_DOUBLE
+#define BUTTONS_QUEUE_LEN     8
+
+// Gestures each input reports besides a click. A button with neither reports
+// BUTTON_CLICK as soon as the press is debounced; LONG moves the click to the
+// release, DOUBLE to the end of the double-press window.
+#define BUTTON_GESTURE_LONG   (1 << 0)
+#define BUTTON_GESTURE_DOUBLE (1 << 1)
+
+#define BUTTONS_GESTURES_P5   BUTTON_GESTURE_LONG                            // Next / previous screen
+#define BUTTONS_GESTURES_P6   0                                              // Trip reset
+#define BUTTONS_GESTURES_P7   0                                              // Trip switch
+#define BUTTONS_GESTURES_P8   (BUTTON_GESTURE_LONG | BUTTON_GESTURE_DOUBLE)  // Reserved
+
+typedef enum : uint8_t {
+  BUTTON_CLICK,
+  BUTTON_DOUBLE,
+  BUTTON_LONG,
+} ButtonEventType;
+
+typedef struct {
+  uint8_t pin;           // EXIO_PIN5 .. EXIO_PIN8
+  ButtonEventType type;
+} ButtonEvent;
+
+// Start reading (TCA9554 already configured with P5-P8 as inputs, I2C service running).
+// Each queued event sets notify_bits on notify_task.
+bool buttons_init(TaskHandle_t notify_task, uint32_t notify_bits);
+// Next queued event; false when the queue is empty
+bool buttons_get_event(ButtonEvent *event);
+const char *button_event_name(ButtonEventType type);
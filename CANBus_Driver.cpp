@@ -1,24 +1,36 @@
 #include "Arduino.h"
 #include "CANBus_Driver.h"
+#include "CAN_Filter.h"
 #include <stdio.h>
 
+CanRxStats can_rx_stats = {};
+
 void canbus_init(void) {
 
   // Configure TWAI (CAN) with larger RX queue for high traffic
     twai_general_config_t g_config = TWAI_GENERAL_CONFIG_DEFAULT(CAN_TX_GPIO, CAN_RX_GPIO, TWAI_MODE_NORMAL);
-    g_config.rx_queue_len = 64;  // Increase from default 5 to handle bursts
+    g_config.rx_queue_len = CAN_RX_QUEUE_LEN;  // Increase from default 5 to handle bursts
     g_config.tx_queue_len = 10;
     g_config.alerts_enabled = TWAI_ALERT_RX_QUEUE_FULL | TWAI_ALERT_BUS_ERROR | TWAI_ALERT_ERR_PASS;
     
     twai_timing_config_t t_config = TWAI_TIMING_CONFIG_500KBITS();
 
-    // Hardware filter: accept all IDs (software filtering via switch statement)
-    // Needed because we listen to both 0x0B2 and 0x600-0x6FF ranges
-    twai_filter_config_t f_config = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+    // Hardware filter: tightest single/dual code+mask covering the decoder's IDs
+    // (CAN_HANDLED_IDS), computed and checked at compile time in CAN_Filter.h
+    twai_filter_config_t f_config;
+    f_config.acceptance_code = CAN_RX_FILTER.acceptance_code;
+    f_config.acceptance_mask = CAN_RX_FILTER.acceptance_mask;
+    f_config.single_filter = CAN_RX_FILTER.single_filter;
  
     // Install and start TWAI driver
     if (twai_driver_install(&g_config, &t_config, &f_config) == ESP_OK) {
         Serial.println("TWAI driver installed.");
+        Serial.printf("TWAI filter: %s, code 0x%08lX mask 0x%08lX\n",
+                      CAN_RX_FILTER.single_filter ? "single" : "dual",
+                      (unsigned long)CAN_RX_FILTER.acceptance_code, (unsigned long)CAN_RX_FILTER.acceptance_mask);
+        Serial.printf("TWAI filter: %u of %u IDs accepted for %u handled, %.1f%% of ID space rejected\n",
+                      CAN_RX_FILTER.accepted_ids, CAN_STD_ID_COUNT, (unsigned)CAN_HANDLED_ID_COUNT,
+                      100.0f * (CAN_STD_ID_COUNT - CAN_RX_FILTER.accepted_ids) / CAN_STD_ID_COUNT);
     } else {
         Serial.println("Failed to install TWAI driver.");
         return;
@@ -36,4 +48,38 @@ void canbus_init(void) {
     uint32_t flushed = 0;
     while (twai_receive(&dummy, 0) == ESP_OK) { flushed++; }
     Serial.printf("Flushed %lu stale CAN messages after init\n", flushed);
-}
\ No newline at end of file
+}
+
+void canbus_print_rx_stats(const CanRxStats *st, uint32_t window_ms) {
+    static uint32_t last_rx_missed = 0;
+    static uint32_t last_rx_overrun = 0;
+
+    twai_status_info_t status;
+    uint32_t missed = 0, overrun = 0;
+    if (twai_get_status_info(&status) == ESP_OK) {
+        missed = status.rx_missed_count - last_rx_missed;    // Driver queue was full
+        overrun = status.rx_overrun_count - last_rx_overrun; // Controller FIFO overran
+        last_rx_missed = status.rx_missed_count;
+        last_rx_overrun = status.rx_overrun_count;
+    }
+
+    uint32_t batch_frames = st->frames - st->overflow_frames;
+    Serial.printf("CAN: %lu frames/%lu s in %lu batches (avg %.1f, max %lu, %lu full), %lu overflows\n",
+                  st->frames, window_ms / 1000, st->batches,
+                  st->batches ? (float)batch_frames / st->batches : 0.0f,
+                  st->max_batch, st->full_batches, st->overflows);
+    if (st->overflows) {
+        Serial.printf("CAN: overflow drains took %lu frames (avg %.1f), decode %lu us max\n",
+                      st->overflow_frames, (float)st->overflow_frames / st->overflows, st->overflow_decode_us_max);
+    }
+    Serial.printf("CAN: lost %lu coalesced + %lu missed + %lu overrun; decode %lu us/batch avg, %lu us max\n",
+                  st->coalesced, missed, overrun,
+                  st->batches ? st->decode_us_total / st->batches : 0, st->decode_us_max);
+    if (st->coalesced) {
+        Serial.print("CAN: coalesced per ID:");
+        for (size_t i = 0; i < CAN_HANDLED_ID_COUNT; i++) {
+            if (st->superseded[i]) Serial.printf(" 0x%03lX=%lu", (unsigned long)CAN_HANDLED_IDS[i], st->superseded[i]);
+        }
+        Serial.println();
+    }
+}
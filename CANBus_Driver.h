@@ -1,9 +1,35 @@
 #pragma once
 #include "driver/twai.h"
+#include "CAN_Decoder.h"
 
 #define CAN_TX_GPIO     (gpio_num_t)5
 #define CAN_RX_GPIO     (gpio_num_t)4
 
 #define CANBUS_SPEED    500000   // 500kbps
 
-void canbus_init();
\ No newline at end of file
+#define CAN_RX_QUEUE_LEN  64  // Driver RX queue depth
+#define CAN_RX_BATCH_MAX  16  // Frames drained and decoded per RX wakeup
+#define CAN_RX_WAIT_MS    50  // Max block on an empty queue before re-checking alerts
+
+// RX task counters for the current stats window. Written only by the RX task.
+typedef struct {
+  uint32_t batches;          // Wakeups that decoded at least one frame (overflow drains not counted)
+  uint32_t frames;           // Frames drained from the queue, batches and overflow drains
+  uint32_t max_batch;        // Largest single batch
+  uint32_t full_batches;     // Batches that hit CAN_RX_BATCH_MAX (queue still backed up)
+  uint32_t overflows;        // RX_QUEUE_FULL alerts (queue drained into CanFrameSlots)
+  uint32_t overflow_frames;  // Frames taken by those drains
+  uint32_t overflow_decode_us_max; // Slowest decode of a drain's slots
+  uint32_t coalesced;        // Frames superseded by a newer frame of the same ID
+  uint32_t superseded[CAN_HANDLED_ID_COUNT]; // coalesced, per CAN_HANDLED_IDS entry
+  uint32_t decode_us_total;  // Time spent decoding, summed over batches
+  uint32_t decode_us_max;    // Slowest batch
+} CanRxStats;
+
+extern CanRxStats can_rx_stats;
+
+void canbus_init();
+// Print a copy of can_rx_stats taken by the RX task, plus the driver's
+// missed/overrun counts since the last call. Called from the background stats
+// task, never the RX task: the report is too long for RX to wait on serial.
+void canbus_print_rx_stats(const CanRxStats *st, uint32_t window_ms);
\ No newline at end of file
@@ -0,0 +1,500 @@
+#include "CAN_Decoder.h"
+#include "M1_Signals.h"
+#include "FixedFormat.h"
+#include <string.h>
+#include <atomic>
+
+volatile DisplayData display_data = {};
+volatile MaxValues max_values = {};
+
+// Seqlock sequence: odd while the RX task is mid-write
+static std::atomic<uint32_t> can_state_seq{0};
+
+// Status Icon Control
+volatile bool cruise_active = false;
+volatile bool tcs_active = false;
+volatile bool launch_active = false;
+volatile bool two_step_active = false;
+volatile bool exhaust_bypass_active = false;
+volatile unsigned long last_cruise_time = 0;
+volatile unsigned long last_tcs_time = 0;
+volatile unsigned long last_launch_time = 0;
+volatile unsigned long last_two_step_time = 0;
+volatile unsigned long last_exhaust_bypass_time = 0;
+
+// ECU Warning state (from 0x64C)
+volatile uint8_t ecu_warning_flags = 0;
+volatile unsigned long last_warning_time = 0;
+
+// Max recall state
+volatile bool max_recall_active = false;
+volatile bool max_clear_active = false;
+volatile unsigned long max_recall_start_time = 0;
+volatile unsigned long max_recall_button_press_start = 0;
+volatile bool max_recall_button_held = false;
+volatile bool max_recall_cleared_this_press = false;
+
+// Pending CAN_CHANGED_* bits, RX task only
+static uint32_t can_changes = 0;
+
+uint32_t can_take_changes(void) {
+  uint32_t changes = can_changes;
+  can_changes = 0;
+  return changes;
+}
+
+uint32_t can_screen_changed_bits(uint8_t mode) {
+  switch (mode) {
+    case 0: return CAN_CHANGED_COOLANT | CAN_CHANGED_OIL_PRESS;
+    case 1: return CAN_CHANGED_LAMBDA1 | CAN_CHANGED_LAMBDA2;
+    case 2: return CAN_CHANGED_MAP | CAN_CHANGED_SPEED;
+    case 3: return CAN_CHANGED_LS_FUEL | CAN_CHANGED_INJ_DUTY;
+    case 4: return CAN_CHANGED_ETHANOL | CAN_CHANGED_BATTERY;
+  }
+  return 0;
+}
+
+// Clear max values shown on the given screen
+static void clear_max_for_screen(uint8_t mode) {
+  can_changes |= CAN_CHANGED_MAX;
+  switch (mode) {
+    case 0:
+      max_values.coolant_temp_max = 0;
+      max_values.oil_press_max = 0;
+      break;
+    case 1:
+      max_values.lambda_bank1_max = 0;
+      max_values.lambda_bank2_max = 0;
+      break;
+    case 2:
+      max_values.map_max = 0;
+      max_values.speed_max = 0;
+      break;
+    case 3:
+      max_values.ls_fuel_press_max = 0;
+      max_values.inj_duty_cycle_max = 0;
+      break;
+    case 4:
+      max_values.ethanol_pct_max = 0;
+      max_values.battery_volts_max = 0;
+      break;
+  }
+}
+
+void can_state_write_begin(void) {
+  uint32_t seq = can_state_seq.load(std::memory_order_relaxed);
+  can_state_seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release); // Odd seq is visible before any data store
+}
+
+void can_state_write_end(void) {
+  uint32_t seq = can_state_seq.load(std::memory_order_relaxed);
+  can_state_seq.store(seq + 1, std::memory_order_release); // Data stores are visible before even seq
+}
+
+bool can_state_snapshot(DisplayData *data, MaxValues *max) {
+  DisplayData data_copy;
+  MaxValues max_copy;
+  for (int attempt = 0; attempt < CAN_SNAPSHOT_MAX_RETRIES; attempt++) {
+    uint32_t before = can_state_seq.load(std::memory_order_acquire);
+    if (before & 1) continue; // Writer mid-update
+    memcpy(&data_copy, (const void *)&display_data, sizeof(data_copy));
+    memcpy(&max_copy, (const void *)&max_values, sizeof(max_copy));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (can_state_seq.load(std::memory_order_relaxed) == before) {
+      *data = data_copy;
+      *max = max_copy;
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool can_timed_out(unsigned long last_update, unsigned long now) {
+  return last_update > 0 && now - last_update > CAN_DATA_TIMEOUT_MS;
+}
+
+// Unseen or timed out: the UI shows the timeout value, so the next frame is a change
+static bool can_stale(unsigned long last_update, unsigned long now) {
+  return last_update == 0 || now - last_update > CAN_DATA_TIMEOUT_MS;
+}
+
+static void note_channel(uint32_t old_raw, uint32_t new_raw, unsigned long last_update,
+                         unsigned long now, uint32_t bit) {
+  if (new_raw != old_raw || can_stale(last_update, now)) can_changes |= bit;
+}
+
+void can_apply_timeouts(DisplayData *data, unsigned long now) {
+  if (can_timed_out(data->last_update_0x649, now)) {
+    data->coolant_temp_raw = 40;
+    data->battery_volts_raw = 0;
+  }
+  if (can_timed_out(data->last_update_0x644, now)) data->oil_press_raw = 0;
+  if (can_timed_out(data->last_update_0x651, now)) {
+    data->lambda_bank1_raw = 0;
+    data->lambda_bank2_raw = 0;
+  }
+  if (can_timed_out(data->last_update_0x640, now)) data->map_raw = 0;
+  if (can_timed_out(data->last_update_0x659, now)) data->speed_raw = 0;
+  if (can_timed_out(data->last_update_0x641, now)) data->ls_fuel_press_raw = 0;
+  if (can_timed_out(data->last_update_0x641_duty, now)) data->inj_duty_cycle_raw = 0;
+  if (can_timed_out(data->last_update_0x670, now)) data->ethanol_pct_raw = 0;
+}
+
+uint32_t can_ms_to_next_timeout(const DisplayData *data, unsigned long now) {
+  const unsigned long updates[] = {
+    data->last_update_0x649, data->last_update_0x644, data->last_update_0x651, data->last_update_0x640,
+    data->last_update_0x659, data->last_update_0x641, data->last_update_0x641_duty, data->last_update_0x670,
+  };
+  uint32_t next = UINT32_MAX;
+  for (unsigned long last_update : updates) {
+    if (can_stale(last_update, now)) continue;
+    uint32_t ms = CAN_DATA_TIMEOUT_MS + 1 - (now - last_update);  // First ms can_timed_out() is true
+    if (ms < next) next = ms;
+  }
+  return next;
+}
+
+// ---- M1 ECU native messages (extractors generated from the DBC, see M1_Signals.h) ----
+
+static void decode_0x640(const uint8_t *data, unsigned long now_msg, uint8_t /*screen_mode*/) {
+  uint16_t map_raw = m1::msg_640::Inlet_Manifold_Pressure(data);
+  note_channel(display_data.map_raw, map_raw, display_data.last_update_0x640, now_msg, CAN_CHANGED_MAP);
+  display_data.map_raw = map_raw;
+  display_data.last_update_0x640 = now_msg;
+  if (map_raw > max_values.map_max) { max_values.map_max = map_raw; can_changes |= CAN_CHANGED_MAX; }
+}
+
+static void decode_0x641(const uint8_t *data, unsigned long now_msg, uint8_t /*screen_mode*/) {
+  uint16_t ls_raw = m1::msg_641::Fuel_Pressure_Sensor(data);
+  note_channel(display_data.ls_fuel_press_raw, ls_raw, display_data.last_update_0x641, now_msg, CAN_CHANGED_LS_FUEL);
+  display_data.ls_fuel_press_raw = ls_raw;
+  display_data.last_update_0x641 = now_msg;
+  if (ls_raw > max_values.ls_fuel_press_max) { max_values.ls_fuel_press_max = ls_raw; can_changes |= CAN_CHANGED_MAX; }
+  uint8_t duty_raw = m1::msg_641::Fuel_Injector_Primary_Duty_Cycle(data);
+  note_channel(display_data.inj_duty_cycle_raw, duty_raw, display_data.last_update_0x641_duty, now_msg, CAN_CHANGED_INJ_DUTY);
+  display_data.inj_duty_cycle_raw = duty_raw;
+  display_data.last_update_0x641_duty = now_msg;
+  if (duty_raw > max_values.inj_duty_cycle_max) { max_values.inj_duty_cycle_max = duty_raw; can_changes |= CAN_CHANGED_MAX; }
+}
+
+static void decode_0x644(const uint8_t *data, unsigned long now_msg, uint8_t /*screen_mode*/) {
+  uint16_t op_raw = m1::msg_644::Engine_Oil_Pressure(data);
+  note_channel(display_data.oil_press_raw, op_raw, display_data.last_update_0x644, now_msg, CAN_CHANGED_OIL_PRESS);
+  display_data.oil_press_raw = op_raw;
+  display_data.last_update_0x644 = now_msg;
+  if (op_raw > max_values.oil_press_max) { max_values.oil_press_max = op_raw; can_changes |= CAN_CHANGED_MAX; }
+}
+
+static void decode_0x649(const uint8_t *data, unsigned long now_msg, uint8_t /*screen_mode*/) {
+  uint8_t coolant_raw = m1::msg_649::Coolant_Temperature(data);
+  uint8_t battery_raw = m1::msg_649::ECU_Battery_Voltage(data);
+  note_channel(display_data.coolant_temp_raw, coolant_raw, display_data.last_update_0x649, now_msg, CAN_CHANGED_COOLANT);
+  note_channel(display_data.battery_volts_raw, battery_raw, display_data.last_update_0x649, now_msg, CAN_CHANGED_BATTERY);
+  display_data.coolant_temp_raw = coolant_raw;
+  display_data.battery_volts_raw = battery_raw;
+  display_data.last_update_0x649 = now_msg;
+  if (coolant_raw > max_values.coolant_temp_max) { max_values.coolant_temp_max = coolant_raw; can_changes |= CAN_CHANGED_MAX; }
+  if (battery_raw > max_values.battery_volts_max) { max_values.battery_volts_max = battery_raw; can_changes |= CAN_CHANGED_MAX; }
+}
+
+static void decode_0x64C(const uint8_t *data, unsigned long now_msg, uint8_t /*screen_mode*/) {
+  // ECU Warning flags from M1, remapped to our priority bit order
+  uint8_t flags = 0;
+  if (m1::msg_64C::Fuel_Pressure_Warning(data))          flags |= WARN_FUEL_PRESSURE;
+  if (m1::msg_64C::Crankcase_Pressure_Warning(data))     flags |= WARN_CRANKCASE_PRESS;
+  if (m1::msg_64C::Engine_Oil_Pressure_Warning(data))    flags |= WARN_OIL_PRESSURE;
+  if (m1::msg_64C::Engine_Oil_Temperature_Warning(data)) flags |= WARN_OIL_TEMP;
+  if (m1::msg_64C::Engine_Speed_Warning(data))           flags |= WARN_ENGINE_SPEED;
+  if (m1::msg_64C::Coolant_Pressure_Warning(data))       flags |= WARN_COOLANT_PRESSURE;
+  if (m1::msg_64C::Coolant_Temperature_Warning(data))    flags |= WARN_COOLANT_TEMP;
+  if (m1::msg_64C::Knock_Warning(data))                  flags |= WARN_KNOCK;
+  if (flags != ecu_warning_flags || last_warning_time == 0 || now_msg - last_warning_time > WARNING_TIMEOUT_MS) {
+    can_changes |= CAN_CHANGED_WARNINGS;
+  }
+  ecu_warning_flags = flags;
+  last_warning_time = now_msg;
+}
+
+// An icon is shown while active and refreshed within ICON_TIMEOUT_MS
+static void set_icon_active(volatile bool *active, volatile unsigned long *last_time, unsigned long now_msg) {
+  if (!*active || now_msg - *last_time >= ICON_TIMEOUT_MS) can_changes |= CAN_CHANGED_ICONS;
+  *active = true;
+  *last_time = now_msg;
+}
+
+static void decode_0x64E(const uint8_t *data, unsigned long now_msg, uint8_t /*screen_mode*/) {
+  if (m1::msg_64E::Launch_Switch(data)) set_icon_active(&launch_active, &last_launch_time, now_msg);
+  if (m1::msg_64E::Traction_Switch(data)) set_icon_active(&tcs_active, &last_tcs_time, now_msg);
+}
+
+static void decode_0x650(const uint8_t *data, unsigned long now_msg, uint8_t /*screen_mode*/) {
+  // 2-Step is wired to Driver_Switch_2
+  if (m1::msg_650::Driver_Switch_2(data)) set_icon_active(&two_step_active, &last_two_step_time, now_msg);
+}
+
+static void decode_0x651(const uint8_t *data, unsigned long now_msg, uint8_t /*screen_mode*/) {
+  uint8_t b1_raw = m1::msg_651::Exhaust_Lambda_Bank_1(data);
+  uint8_t b2_raw = m1::msg_651::Exhaust_Lambda_Bank_2(data);
+  note_channel(display_data.lambda_bank1_raw, b1_raw, display_data.last_update_0x651, now_msg, CAN_CHANGED_LAMBDA1);
+  note_channel(display_data.lambda_bank2_raw, b2_raw, display_data.last_update_0x651, now_msg, CAN_CHANGED_LAMBDA2);
+  display_data.lambda_bank1_raw = b1_raw;
+  display_data.lambda_bank2_raw = b2_raw;
+  display_data.last_update_0x651 = now_msg;
+  if (b1_raw > max_values.lambda_bank1_max) { max_values.lambda_bank1_max = b1_raw; can_changes |= CAN_CHANGED_MAX; }
+  if (b2_raw > max_values.lambda_bank2_max) { max_values.lambda_bank2_max = b2_raw; can_changes |= CAN_CHANGED_MAX; }
+}
+
+static void decode_0x659(const uint8_t *data, unsigned long now_msg, uint8_t /*screen_mode*/) {
+  uint16_t spd_raw = m1::msg_659::Vehicle_Speed(data);
+  note_channel(display_data.speed_raw, spd_raw, display_data.last_update_0x659, now_msg, CAN_CHANGED_SPEED);
+  display_data.speed_raw = spd_raw;
+  display_data.last_update_0x659 = now_msg;
+  if (spd_raw > max_values.speed_max) { max_values.speed_max = spd_raw; can_changes |= CAN_CHANGED_MAX; }
+}
+
+static void decode_0x670(const uint8_t *data, unsigned long now_msg, uint8_t /*screen_mode*/) {
+  uint8_t eth_raw = m1::msg_670::Fuel_Composition(data);
+  note_channel(display_data.ethanol_pct_raw, eth_raw, display_data.last_update_0x670, now_msg, CAN_CHANGED_ETHANOL);
+  display_data.ethanol_pct_raw = eth_raw;
+  display_data.last_update_0x670 = now_msg;
+  if (eth_raw > max_values.ethanol_pct_max) { max_values.ethanol_pct_max = eth_raw; can_changes |= CAN_CHANGED_MAX; }
+}
+
+// ---- Messages not in the M1 DBC ----
+
+static void decode_0x178(const uint8_t *data, unsigned long now_msg, uint8_t screen_mode) {
+  // Peak recall button: byte 1, bit 6 (1 = pressed, 0 = released)
+  bool button_now = (data[1] >> 6) & 0x01;
+  bool was_active = max_recall_active, was_clear = max_clear_active, was_held = max_recall_button_held;
+
+  if (button_now && !max_recall_button_held) {
+    // Button just pressed - start tracking
+    max_recall_button_held = true;
+    max_recall_button_press_start = now_msg;
+    max_recall_cleared_this_press = false;
+    // Immediately show max recall
+    max_recall_active = true;
+    max_clear_active = false;
+    max_recall_start_time = now_msg;
+  } else if (button_now && max_recall_button_held) {
+    // Button still held - check for 3-second clear threshold
+    if (!max_recall_cleared_this_press &&
+        (now_msg - max_recall_button_press_start >= MAX_CLEAR_HOLD_MS)) {
+      // 3 seconds held - clear max values for current screen
+      clear_max_for_screen(screen_mode);
+      max_clear_active = true;
+      max_recall_start_time = now_msg;
+      max_recall_cleared_this_press = true;
+    }
+    // Keep max_recall_active while held
+    max_recall_active = true;
+    max_recall_start_time = now_msg;
+  } else if (!button_now && max_recall_button_held) {
+    // Button released - show max recall for 2 more seconds then fade
+    max_recall_button_held = false;
+    max_recall_start_time = now_msg;
+    // max_recall_active stays true, will expire via MAX_RECALL_DISPLAY_MS
+  }
+  // Release matters too: it starts the MAX_RECALL_DISPLAY_MS countdown
+  if (max_recall_active != was_active || max_clear_active != was_clear || max_recall_button_held != was_held) {
+    can_changes |= CAN_CHANGED_MAX_RECALL;
+  }
+}
+
+static void decode_0x6A8(const uint8_t *data, unsigned long now_msg, uint8_t /*screen_mode*/) {
+  // Cruise (B3) and exhaust bypass (B5) are full-byte flags
+  if (data[3]) set_icon_active(&cruise_active, &last_cruise_time, now_msg);
+  if (data[5]) set_icon_active(&exhaust_bypass_active, &last_exhaust_bypass_time, now_msg);
+}
+
+// ---- Dispatch ----
+
+typedef void (*CanFrameHandler)(const uint8_t *data, unsigned long now_msg, uint8_t screen_mode);
+
+typedef struct {
+  uint32_t identifier;
+  CanFrameHandler handler;
+} CanDispatchEntry;
+
+// Must stay sorted by identifier (checked below) for the binary search
+static constexpr CanDispatchEntry can_dispatch[] = {
+  { 0x178,            decode_0x178 },
+  { m1::msg_640::ID,  decode_0x640 },
+  { m1::msg_641::ID,  decode_0x641 },
+  { m1::msg_644::ID,  decode_0x644 },
+  { m1::msg_649::ID,  decode_0x649 },
+  { m1::msg_64C::ID,  decode_0x64C },
+  { m1::msg_64E::ID,  decode_0x64E },
+  { m1::msg_650::ID,  decode_0x650 },
+  { m1::msg_651::ID,  decode_0x651 },
+  { m1::msg_659::ID,  decode_0x659 },
+  { m1::msg_670::ID,  decode_0x670 },
+  { 0x6A8,            decode_0x6A8 },
+};
+static constexpr int CAN_DISPATCH_COUNT = sizeof(can_dispatch) / sizeof(can_dispatch[0]);
+
+static constexpr bool can_dispatch_sorted() {
+  for (int i = 1; i < CAN_DISPATCH_COUNT; i++) {
+    if (can_dispatch[i - 1].identifier >= can_dispatch[i].identifier) return false;
+  }
+  return true;
+}
+static_assert(can_dispatch_sorted(), "can_dispatch must be sorted by identifier");
+
+static constexpr bool can_dispatch_matches_handled_ids() {
+  if (CAN_DISPATCH_COUNT != (int)CAN_HANDLED_ID_COUNT) return false;
+  for (int i = 0; i < CAN_DISPATCH_COUNT; i++) {
+    if (can_dispatch[i].identifier != CAN_HANDLED_IDS[i]) return false;
+  }
+  return true;
+}
+static_assert(can_dispatch_matches_handled_ids(), "CAN_HANDLED_IDS must list the can_dispatch IDs (the RX filter is built from it)");
+
+int can_handled_index(uint32_t identifier) {
+  int lo = 0, hi = CAN_DISPATCH_COUNT - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    uint32_t mid_id = can_dispatch[mid].identifier;
+    if (mid_id == identifier) return mid;
+    if (mid_id < identifier) lo = mid + 1; else hi = mid - 1;
+  }
+  return -1;
+}
+
+bool can_decode_frame(uint32_t identifier, const uint8_t *data, unsigned long now_msg, uint8_t screen_mode) {
+  int index = can_handled_index(identifier);
+  if (index < 0) return false;
+  can_dispatch[index].handler(data, now_msg, screen_mode);
+  return true;
+}
+
+bool can_slots_put(CanFrameSlots *slots, int index, const uint8_t *data) {
+  uint32_t bit = 1u << index;
+  bool superseded = (slots->pending & bit) != 0;
+  memcpy(slots->data[index], data, 8);
+  slots->pending |= bit;
+  return superseded;
+}
+
+uint32_t can_slots_decode(CanFrameSlots *slots, unsigned long now_msg, uint8_t screen_mode) {
+  uint32_t decoded = 0;
+  for (int i = 0; i < CAN_DISPATCH_COUNT; i++) {
+    if (!(slots->pending & (1u << i))) continue;
+    can_dispatch[i].handler(slots->data[i], now_msg, screen_mode);
+    decoded++;
+  }
+  slots->pending = 0;
+  return decoded;
+}
+
+void can_screen_raw_values(uint8_t mode, const volatile DisplayData *data, uint16_t *left, uint16_t *right) {
+  switch (mode) {
+    case 0: *left = data->coolant_temp_raw;   *right = data->oil_press_raw;      break;
+    case 1: *left = data->lambda_bank1_raw;   *right = data->lambda_bank2_raw;   break;
+    case 2: *left = data->map_raw;            *right = data->speed_raw;          break;
+    case 3: *left = data->ls_fuel_press_raw;  *right = data->inj_duty_cycle_raw; break;
+    case 4: *left = data->ethanol_pct_raw;    *right = data->battery_volts_raw;  break;
+  }
+}
+
+void can_screen_max_values(uint8_t mode, const volatile MaxValues *max, uint16_t *left, uint16_t *right) {
+  switch (mode) {
+    case 0: *left = max->coolant_temp_max;   *right = max->oil_press_max;      break;
+    case 1: *left = max->lambda_bank1_max;   *right = max->lambda_bank2_max;   break;
+    case 2: *left = max->map_max;            *right = max->speed_max;          break;
+    case 3: *left = max->ls_fuel_press_max;  *right = max->inj_duty_cycle_max; break;
+    case 4: *left = max->ethanol_pct_max;    *right = max->battery_volts_max;  break;
+  }
+}
+
+// ---- Display units ----
+
+// Imperial                                 raw     mul     add      div  dec  rounding
+static constexpr ChannelScale SCALE_COOLANT_F = { 0xFF,     9,    -200,       5, 0, CHANNEL_TRUNCATE }; // (raw - 40) * 9/5 + 32
+static constexpr ChannelScale SCALE_PSI       = { 0xFFFF, 100,       0,    6895, 0, CHANNEL_TRUNCATE }; // x0.1 kPa / 6.895
+static constexpr ChannelScale SCALE_MAP_PSI   = { 0xFFFF, 1000, -1050000,  6895, 1, CHANNEL_ROUND    }; // -105 kPa offset
+static constexpr ChannelScale SCALE_MPH       = { 0xFFFF, 10000,     0,  160934, 0, CHANNEL_TRUNCATE }; // x0.1 km/h / 1.60934
+// Metric
+static constexpr ChannelScale SCALE_COOLANT_C = { 0xFF,     1,     -40,       1, 0, CHANNEL_TRUNCATE };
+static constexpr ChannelScale SCALE_KPA       = { 0xFFFF,   1,       0,      10, 0, CHANNEL_TRUNCATE };
+static constexpr ChannelScale SCALE_MAP_KPA   = { 0xFFFF,   1,   -1050,      10, 0, CHANNEL_TRUNCATE };
+static constexpr ChannelScale SCALE_KPH       = { 0xFFFF,   1,       0,      10, 0, CHANNEL_TRUNCATE };
+// Both
+static constexpr ChannelScale SCALE_AFR       = { 0xFF,   147,       0,     100, 1, CHANNEL_ROUND    }; // x0.01 λ * 14.7
+static constexpr ChannelScale SCALE_PERCENT   = { 0xFF,     1,       0,       1, 0, CHANNEL_TRUNCATE };
+static constexpr ChannelScale SCALE_VOLTS     = { 0xFF,     1,       0,       1, 1, CHANNEL_TRUNCATE }; // x0.1 V
+
+#define SCREEN_CHANNEL(title, scale) { title, &scale, ChannelConverter<scale>::convert }
+
+static const ScreenChannel screen_channels[DISPLAY_UNITS_COUNT][CAN_SCREEN_MODES][2] = {
+  { // DISPLAY_UNITS_IMPERIAL
+    { SCREEN_CHANNEL("ECT °F", SCALE_COOLANT_F),     SCREEN_CHANNEL("Oil PSI", SCALE_PSI) },
+    { SCREEN_CHANNEL("AFR B1", SCALE_AFR),           SCREEN_CHANNEL("AFR B2", SCALE_AFR) },
+    { SCREEN_CHANNEL("MAP PSI", SCALE_MAP_PSI),      SCREEN_CHANNEL("Speed MPH", SCALE_MPH) },
+    { SCREEN_CHANNEL("LS Fuel PSI", SCALE_PSI),      SCREEN_CHANNEL("Inj Duty %", SCALE_PERCENT) },
+    { SCREEN_CHANNEL("Ethanol %", SCALE_PERCENT),    SCREEN_CHANNEL("Battery V", SCALE_VOLTS) },
+  },
+  { // DISPLAY_UNITS_METRIC (the title font has no '/', hence KPH)
+    { SCREEN_CHANNEL("ECT °C", SCALE_COOLANT_C),     SCREEN_CHANNEL("Oil kPa", SCALE_KPA) },
+    { SCREEN_CHANNEL("AFR B1", SCALE_AFR),           SCREEN_CHANNEL("AFR B2", SCALE_AFR) },
+    { SCREEN_CHANNEL("MAP kPa", SCALE_MAP_KPA),      SCREEN_CHANNEL("Speed KPH", SCALE_KPH) },
+    { SCREEN_CHANNEL("LS Fuel kPa", SCALE_KPA),      SCREEN_CHANNEL("Inj Duty %", SCALE_PERCENT) },
+    { SCREEN_CHANNEL("Ethanol %", SCALE_PERCENT),    SCREEN_CHANNEL("Battery V", SCALE_VOLTS) },
+  },
+};
+
+static volatile DisplayUnits display_units = DISPLAY_UNITS_DEFAULT;
+
+void can_set_display_units(DisplayUnits units) {
+  if (units < DISPLAY_UNITS_COUNT) display_units = units;
+}
+
+DisplayUnits can_display_units(void) {
+  return display_units;
+}
+
+const ScreenChannel *can_screen_channel(DisplayUnits units, uint8_t mode, uint8_t side) {
+  if (units >= DISPLAY_UNITS_COUNT || mode >= CAN_SCREEN_MODES || side > 1) return NULL;
+  return &screen_channels[units][mode][side];
+}
+
+const char *can_screen_title(uint8_t mode, uint8_t side) {
+  const ScreenChannel *ch = can_screen_channel(display_units, mode, side);
+  return ch ? ch->title : " ";
+}
+
+void can_screen_fixed_values(uint8_t mode, uint16_t left_raw, uint16_t right_raw, FixedValue *left, FixedValue *right) {
+  if (mode >= CAN_SCREEN_MODES) {
+    *left = *right = { 0, 0 };
+    return;
+  }
+  const ScreenChannel *ch = screen_channels[display_units][mode];
+  *left  = ch[0].convert(left_raw);
+  *right = ch[1].convert(right_raw);
+}
+
+void can_scale_screen_values(uint8_t mode, float *left, float *right) {
+  switch (mode) {
+    case 0:
+      *left  = ((*left - 40) * 9.0f / 5.0f) + 32.0f;
+      *right = *right * 0.1f / 6.895f;
+      break;
+    case 1:
+      *left  = *left * 0.01f * 14.7f;
+      *right = *right * 0.01f * 14.7f;
+      break;
+    case 2:
+      *left  = (*left * 0.1f - 105.0f) / 6.895f;  // MAP: x0.1 kPa, -105 kPa offset → PSI
+      *right = *right * 0.1f / 1.60934f;
+      break;
+    case 3:
+      *left  = *left * 0.1f / 6.895f;
+      // right already in % (x1), no conversion needed
+      break;
+    case 4:
+      // left (ethanol) needs no scaling
+      *right = *right * 0.1f;
+      break;
+  }
+}
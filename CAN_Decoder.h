@@ -0,0 +1,225 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "FixedFormat.h"
+#include "ChannelScale.h"
+
+// ============================================================================
+// CAN DECODER
+// ----------------------------------------------------------------------------
+// Platform-neutral decode of M1 ECU / gauge control frames into DisplayData,
+// MaxValues and the status icon / warning / max recall state. No Arduino,
+// FreeRTOS or TWAI dependencies so the same code runs in receive_can_task
+// and in the host replay tool (tools/can_replay). Concurrency is handled by
+// the seqlock below: the caller brackets each decode with write_begin/end.
+// ============================================================================
+
+#define CAN_DATA_TIMEOUT_MS 500 // Reset values after 500ms of no updates
+#define ICON_TIMEOUT_MS 500     // Hide icons after 500ms of no CAN data
+#define WARNING_TIMEOUT_MS 500  // Clear warning after 500ms of no updates
+#define MAX_RECALL_DISPLAY_MS 2000 // Show max values for 2 seconds after release
+#define MAX_CLEAR_HOLD_MS 3000     // Hold 3 seconds to clear
+
+// Warning flag bit positions
+#define WARN_FUEL_PRESSURE    (1 << 0)
+#define WARN_CRANKCASE_PRESS  (1 << 1)
+#define WARN_OIL_PRESSURE     (1 << 2)
+#define WARN_OIL_TEMP         (1 << 3)
+#define WARN_ENGINE_SPEED     (1 << 4)
+#define WARN_COOLANT_PRESSURE (1 << 5)
+#define WARN_COOLANT_TEMP     (1 << 6)
+#define WARN_KNOCK            (1 << 7)
+
+// Data passed from the CAN RX task to the UI, published through the seqlock below
+// Raw values stored as received from M1 ECU (pre-scaling)
+typedef struct {
+  // 0x649: Coolant temp (B0, x1 -40 offset, °C), Oil temp (B2), Battery volts (B5, x0.1 V)
+  uint8_t  coolant_temp_raw;    // x1, -40 offset → °C
+  uint8_t  battery_volts_raw;   // x0.1 → V
+  unsigned long last_update_0x649;
+
+  // 0x644: Engine oil pressure (B6-7, x0.1 kPa)
+  uint16_t oil_press_raw;       // x0.1 kPa → PSI (/6.895)
+  unsigned long last_update_0x644;
+
+  // 0x651: Lambda Bank 1 (B2, x0.01 LA), Lambda Bank 2 (B3, x0.01 LA)
+  uint8_t  lambda_bank1_raw;    // x0.01 → AFR (x14.7)
+  uint8_t  lambda_bank2_raw;    // x0.01 → AFR (x14.7)
+  unsigned long last_update_0x651;
+
+  // 0x640: Engine speed (B0-1, x1 RPM), MAP (B2-3, x0.1 kPa)
+  uint16_t map_raw;             // x0.1 kPa → PSI (/6.895)
+  unsigned long last_update_0x640;
+
+  // 0x659: Vehicle speed (B4-5, x0.1 km/h)
+  uint16_t speed_raw;           // x0.1 km/h → MPH (/1.60934)
+  unsigned long last_update_0x659;
+
+  // 0x641: Low side fuel pressure (B4-5, x0.1 kPa)
+  uint16_t ls_fuel_press_raw;   // x0.1 kPa → PSI (/6.895)
+  unsigned long last_update_0x641;
+
+  // 0x641: Fuel Injector Primary Duty Cycle (B6, x1 %)
+  uint8_t  inj_duty_cycle_raw;  // x1 → %
+  unsigned long last_update_0x641_duty;
+
+  // 0x670: Ethanol/fuel composition (B5, x1 %)
+  uint8_t  ethanol_pct_raw;     // x1 → %
+  unsigned long last_update_0x670;
+} DisplayData;
+
+// Max value tracking (same types as DisplayData raw values)
+typedef struct {
+  uint8_t  coolant_temp_max;
+  uint16_t oil_press_max;
+  uint8_t  lambda_bank1_max;
+  uint8_t  lambda_bank2_max;
+  uint16_t map_max;
+  uint16_t speed_max;
+  uint16_t ls_fuel_press_max;
+  uint8_t  inj_duty_cycle_max;
+  uint8_t  ethanol_pct_max;
+  uint8_t  battery_volts_max;
+} MaxValues;
+
+extern volatile DisplayData display_data;
+extern volatile MaxValues max_values;
+
+// Status Icon Control
+extern volatile bool cruise_active;
+extern volatile bool tcs_active;
+extern volatile bool launch_active;
+extern volatile bool two_step_active;
+extern volatile bool exhaust_bypass_active;
+extern volatile unsigned long last_cruise_time;
+extern volatile unsigned long last_tcs_time;
+extern volatile unsigned long last_launch_time;
+extern volatile unsigned long last_two_step_time;
+extern volatile unsigned long last_exhaust_bypass_time;
+
+// ECU Warning state (from 0x64C)
+extern volatile uint8_t ecu_warning_flags; // Bitmask of active warnings
+extern volatile unsigned long last_warning_time;
+
+// Max recall state (driven by 0x178)
+extern volatile bool max_recall_active;
+extern volatile bool max_clear_active; // Track if we're clearing (vs recalling)
+extern volatile unsigned long max_recall_start_time;
+extern volatile unsigned long max_recall_button_press_start; // When button was first pressed
+extern volatile bool max_recall_button_held; // Is the button currently held
+extern volatile bool max_recall_cleared_this_press; // Already cleared during this hold
+
+// Single-writer seqlock around display_data / max_values. Only the CAN RX task
+// writes, bracketing each decode with write_begin/write_end; it never waits.
+// Readers call can_state_snapshot() for a consistent copy without locking.
+#define CAN_SNAPSHOT_MAX_RETRIES 8
+
+void can_state_write_begin(void);
+void can_state_write_end(void);
+// Returns false (leaving the outputs untouched) if the writer kept the state busy
+// for CAN_SNAPSHOT_MAX_RETRIES attempts, e.g. when it was preempted mid-write
+bool can_state_snapshot(DisplayData *data, MaxValues *max);
+
+// Change bits. Each decode ORs in what it changed: a channel whose value
+// differs or that arrives after CAN_DATA_TIMEOUT_MS without updates (the UI
+// was showing its timeout value), a max that rose or was cleared, an icon
+// that went active, a new or returning warning mask, a max recall state
+// change. The RX task takes them after each batch and hands them to the UI
+// task as notification bits, so nothing is redrawn while the values hold.
+#define CAN_CHANGED_COOLANT    (1u << 0)
+#define CAN_CHANGED_BATTERY    (1u << 1)
+#define CAN_CHANGED_OIL_PRESS  (1u << 2)
+#define CAN_CHANGED_LAMBDA1    (1u << 3)
+#define CAN_CHANGED_LAMBDA2    (1u << 4)
+#define CAN_CHANGED_MAP        (1u << 5)
+#define CAN_CHANGED_SPEED      (1u << 6)
+#define CAN_CHANGED_LS_FUEL    (1u << 7)
+#define CAN_CHANGED_INJ_DUTY   (1u << 8)
+#define CAN_CHANGED_ETHANOL    (1u << 9)
+#define CAN_CHANGED_MAX        (1u << 10)
+#define CAN_CHANGED_ICONS      (1u << 11)
+#define CAN_CHANGED_WARNINGS   (1u << 12)
+#define CAN_CHANGED_MAX_RECALL (1u << 13)
+#define CAN_CHANGED_ALL        0x3FFFu
+
+// Changes since the last call, then cleared. Writer (RX task) side only.
+uint32_t can_take_changes(void);
+// The channel bits a screen mode shows
+uint32_t can_screen_changed_bits(uint8_t mode);
+
+// Every standard ID can_decode_frame() handles, sorted. CAN_Decoder.cpp checks
+// this against its dispatch table; canbus_init() derives the TWAI filter from it.
+constexpr uint32_t CAN_HANDLED_IDS[] = {
+  0x178, 0x640, 0x641, 0x644, 0x649, 0x64C, 0x64E, 0x650, 0x651, 0x659, 0x670, 0x6A8,
+};
+constexpr size_t CAN_HANDLED_ID_COUNT = sizeof(CAN_HANDLED_IDS) / sizeof(CAN_HANDLED_IDS[0]);
+
+// Reset channels not refreshed for CAN_DATA_TIMEOUT_MS (coolant to 0 °C, the
+// rest to 0) in a snapshot copy. Channels never received are left untouched.
+void can_apply_timeouts(DisplayData *data, unsigned long now);
+// Milliseconds until the next received channel in data times out, so the UI
+// can sleep until then; UINT32_MAX if every channel is timed out or unseen
+uint32_t can_ms_to_next_timeout(const DisplayData *data, unsigned long now);
+
+// Index of identifier in CAN_HANDLED_IDS, or -1 if the decoder ignores it
+int can_handled_index(uint32_t identifier);
+
+// Last-value-wins frame table for RX overload: one slot per handled ID, so a
+// burst costs at most one decode per ID and the newest value of every signal
+// (e.g. a 0x64C warning frame) survives instead of being flushed
+typedef struct {
+  uint8_t  data[CAN_HANDLED_ID_COUNT][8];
+  uint32_t pending;  // Bit i set = slot i holds an undecoded frame
+} CanFrameSlots;
+static_assert(CAN_HANDLED_ID_COUNT <= 32, "CanFrameSlots.pending is a 32-bit mask");
+
+// Store a frame in slot index (from can_handled_index). Returns true if it
+// replaced an older undecoded frame of the same ID.
+bool can_slots_put(CanFrameSlots *slots, int index, const uint8_t *data);
+// Decode every pending slot in ID order and empty the table. Returns frames decoded.
+uint32_t can_slots_decode(CanFrameSlots *slots, unsigned long now, uint8_t screen_mode);
+
+// Decode one frame into the shared state. Returns false for IDs we don't handle.
+// screen_mode selects which max values a 3 s peak recall hold clears.
+bool can_decode_frame(uint32_t identifier, const uint8_t *data, unsigned long now, uint8_t screen_mode);
+
+// Pick the raw left/right values shown on a screen mode
+void can_screen_raw_values(uint8_t mode, const volatile DisplayData *data, uint16_t *left, uint16_t *right);
+void can_screen_max_values(uint8_t mode, const volatile MaxValues *max, uint16_t *left, uint16_t *right);
+
+// Display unit system for the gauge values and titles. DISPLAY_UNITS_DEFAULT
+// is used from boot; can_set_display_units() switches at run time (the
+// conversion is a table lookup either way).
+typedef enum : uint8_t {
+  DISPLAY_UNITS_IMPERIAL,  // °F, PSI, MPH
+  DISPLAY_UNITS_METRIC,    // °C, kPa, km/h
+  DISPLAY_UNITS_COUNT,
+} DisplayUnits;
+
+#ifndef DISPLAY_UNITS_DEFAULT
+#define DISPLAY_UNITS_DEFAULT DISPLAY_UNITS_IMPERIAL
+#endif
+
+#define CAN_SCREEN_MODES 5
+
+// One side of a screen mode: title, descriptor and its generated converter
+typedef struct {
+  const char *title;
+  const ChannelScale *scale;
+  FixedValue (*convert)(uint16_t raw);
+} ScreenChannel;
+
+void can_set_display_units(DisplayUnits units);
+DisplayUnits can_display_units(void);
+// side: 0 = left, 1 = right. NULL for an unknown mode.
+const ScreenChannel *can_screen_channel(DisplayUnits units, uint8_t mode, uint8_t side);
+const char *can_screen_title(uint8_t mode, uint8_t side);
+
+// Convert raw left/right values to display units in the current unit system,
+// at the precision each label shows. Used by the display path.
+void can_screen_fixed_values(uint8_t mode, uint16_t left_raw, uint16_t right_raw, FixedValue *left, FixedValue *right);
+
+// Float reference for the imperial conversion, kept for host tools (replay
+// --dump, tools/fixed_format_check). Scales raw values in place.
+void can_scale_screen_values(uint8_t mode, float *left, float *right);
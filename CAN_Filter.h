@@ -0,0 +1,145 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "CAN_Decoder.h"
+
+// ============================================================================
+// CAN ACCEPTANCE FILTER
+// ----------------------------------------------------------------------------
+// Compile-time search for the TWAI acceptance filter that passes every ID in a
+// list while letting through as little of the rest of the 11-bit ID space as
+// possible. The controller matches code/mask pairs (mask bit 1 = don't care)
+// as one filter or as two in dual-filter mode, so the search tries the single
+// cover of all IDs and every split of the IDs into two covers. Only standard
+// data frames are accepted (RTR bit must be 0).
+//
+// Register layout for standard frames (ESP32 TWAI, see the IDF TWAI docs):
+//   single: ID 31:21, RTR 20, data bytes 1-2 in 15:0
+//   dual:   filter 1 = ID 31:21, RTR 20, data byte 1 in 19:16 + 3:0
+//           filter 2 = ID 15:5,  RTR 4
+// ============================================================================
+
+#define CAN_STD_ID_COUNT        2048  // Size of the 11-bit ID space
+#define CAN_FILTER_MAX_SPLIT_IDS 16   // Larger lists only get a single filter
+
+// IDs matching code on every bit that is not don't_care
+typedef struct {
+  uint16_t code;
+  uint16_t dont_care;
+} CanIdCover;
+
+typedef struct {
+  bool       single_filter;
+  CanIdCover first;
+  CanIdCover second;         // Same as first in single filter mode
+  uint16_t   accepted_ids;   // Distinct 11-bit IDs the hardware lets through
+  uint32_t   acceptance_code; // twai_filter_config_t register values
+  uint32_t   acceptance_mask;
+} CanFilterPlan;
+
+constexpr uint32_t can_filter_popcount(uint32_t v) {
+  uint32_t n = 0;
+  for (; v; v >>= 1) n += v & 1;
+  return n;
+}
+
+constexpr uint32_t can_cover_size(CanIdCover c) {
+  return 1u << can_filter_popcount(c.dont_care);
+}
+
+// Number of IDs both covers accept
+constexpr uint32_t can_cover_overlap(CanIdCover a, CanIdCover b) {
+  uint32_t fixed_in_both = ~(uint32_t)(a.dont_care | b.dont_care) & 0x7FF;
+  if ((a.code ^ b.code) & fixed_in_both) return 0;
+  return 1u << can_filter_popcount(a.dont_care & b.dont_care);
+}
+
+// Tightest cover of the IDs whose index bit is set in subset
+constexpr CanIdCover can_cover_of(const uint32_t *ids, size_t count, uint32_t subset) {
+  CanIdCover cover = { 0, 0 };
+  bool first = true;
+  for (size_t i = 0; i < count; i++) {
+    if (!(subset & (1u << i))) continue;
+    uint16_t id = (uint16_t)(ids[i] & 0x7FF);
+    if (first) {
+      cover.code = id;
+      first = false;
+    }
+    cover.dont_care |= (uint16_t)(id ^ cover.code);
+  }
+  cover.code &= (uint16_t)~cover.dont_care;
+  return cover;
+}
+
+constexpr CanFilterPlan can_single_filter_plan(CanIdCover cover) {
+  CanFilterPlan plan = {};
+  plan.single_filter = true;
+  plan.first = cover;
+  plan.second = cover;
+  plan.accepted_ids = (uint16_t)can_cover_size(cover);
+  plan.acceptance_code = (uint32_t)cover.code << 21;
+  plan.acceptance_mask = ((uint32_t)cover.dont_care << 21) | 0x000FFFFF;
+  return plan;
+}
+
+constexpr CanFilterPlan can_dual_filter_plan(CanIdCover first, CanIdCover second) {
+  CanFilterPlan plan = {};
+  plan.single_filter = false;
+  plan.first = first;
+  plan.second = second;
+  plan.accepted_ids = (uint16_t)(can_cover_size(first) + can_cover_size(second) - can_cover_overlap(first, second));
+  plan.acceptance_code = ((uint32_t)first.code << 21) | ((uint32_t)second.code << 5);
+  plan.acceptance_mask = ((uint32_t)first.dont_care << 21) | 0x000F000F | ((uint32_t)second.dont_care << 5);
+  return plan;
+}
+
+// Best filter for the ID list: fewest accepted IDs, single filter on a tie
+constexpr CanFilterPlan can_filter_plan(const uint32_t *ids, size_t count) {
+  const uint32_t all = count >= 32 ? 0xFFFFFFFFu : (1u << count) - 1;
+  CanFilterPlan best = can_single_filter_plan(can_cover_of(ids, count, all));
+  if (count < 2 || count > CAN_FILTER_MAX_SPLIT_IDS) return best;
+
+  // ids[0] always goes to the first filter so each split is tried once
+  for (uint32_t subset = 1; subset < all; subset += 2) {
+    CanFilterPlan plan = can_dual_filter_plan(can_cover_of(ids, count, subset),
+                                              can_cover_of(ids, count, all & ~subset));
+    if (plan.accepted_ids < best.accepted_ids) best = plan;
+  }
+  return best;
+}
+
+// Does the hardware accept a standard data frame with this ID? Works from the
+// register values, so it checks the encoding as well as the search.
+constexpr bool can_filter_accepts(const CanFilterPlan &plan, uint32_t id) {
+  uint32_t care = ~plan.acceptance_mask;
+  if (plan.single_filter) {
+    return ((((id & 0x7FF) << 21) ^ plan.acceptance_code) & care) == 0;
+  }
+  bool filter1 = ((((id & 0x7FF) << 21) ^ plan.acceptance_code) & care & 0xFFFF000F) == 0;
+  bool filter2 = ((((id & 0x7FF) << 5) ^ plan.acceptance_code) & care & 0x0000FFF0) == 0;
+  return filter1 || filter2;
+}
+
+constexpr bool can_filter_accepts_all(const CanFilterPlan &plan, const uint32_t *ids, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    if (!can_filter_accepts(plan, ids[i])) return false;
+  }
+  return true;
+}
+
+// Brute-force count over the whole ID space, independent of the cover maths
+constexpr uint32_t can_filter_count_accepted(const CanFilterPlan &plan) {
+  uint32_t n = 0;
+  for (uint32_t id = 0; id < CAN_STD_ID_COUNT; id++) {
+    if (can_filter_accepts(plan, id)) n++;
+  }
+  return n;
+}
+
+// Filter canbus_init() installs for the IDs the decoder handles. The asserts
+// run in every build of this header, firmware or host (tools/can_replay).
+constexpr CanFilterPlan CAN_RX_FILTER = can_filter_plan(CAN_HANDLED_IDS, CAN_HANDLED_ID_COUNT);
+static_assert(can_filter_accepts_all(CAN_RX_FILTER, CAN_HANDLED_IDS, CAN_HANDLED_ID_COUNT),
+              "CAN_RX_FILTER rejects an ID the decoder handles");
+static_assert(can_filter_count_accepted(CAN_RX_FILTER) == CAN_RX_FILTER.accepted_ids,
+              "CAN_RX_FILTER accepted ID count does not match the register encoding");
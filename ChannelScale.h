@@ -0,0 +1,106 @@
+#pragma once
+#include <stdint.h>
+#include "FixedFormat.h"
+
+// ============================================================================
+// CHANNEL SCALING
+// ----------------------------------------------------------------------------
+// Compile-time raw → display conversion for the gauge channels. A channel is
+// a constexpr ChannelScale: its raw type and the linear map
+//     display = (raw * mul + add) / div        (units of 10^-decimals)
+// truncated toward zero or rounded half away from zero. ChannelConverter<S>
+// turns a descriptor into code with no division and no float at run time:
+//   - 8-bit raw:  a 256-entry int16 table generated by the compiler
+//   - 16-bit raw: |raw * mul + add| * M >> S, with M and S chosen at compile
+//     time so the result equals the exact division for every raw value
+// channel_scale_exact() is the division itself, for host checks
+// (tools/fixed_format_check).
+// ============================================================================
+
+typedef enum : uint8_t {
+  CHANNEL_TRUNCATE,  // Toward zero, like an (int) cast
+  CHANNEL_ROUND,     // Half away from zero
+} ChannelRounding;
+
+typedef struct {
+  uint32_t raw_max;   // 0xFF (uint8_t channel) or 0xFFFF (uint16_t channel)
+  int32_t  mul;
+  int32_t  add;
+  int32_t  div;
+  uint8_t  decimals;  // 0 or 1, as FixedValue
+  ChannelRounding rounding;
+} ChannelScale;
+
+constexpr int64_t channel_numerator(const ChannelScale &s, uint32_t raw) {
+  return (int64_t)raw * s.mul + s.add;
+}
+
+constexpr uint32_t channel_round_bias(const ChannelScale &s) {
+  return s.rounding == CHANNEL_ROUND ? (uint32_t)s.div / 2 : 0;
+}
+
+// Largest |numerator| + rounding bias over the raw range (the map is linear,
+// so it is at one of the ends)
+constexpr uint64_t channel_max_magnitude(const ChannelScale &s) {
+  int64_t lo = channel_numerator(s, 0), hi = channel_numerator(s, s.raw_max);
+  uint64_t a = lo < 0 ? -lo : lo, b = hi < 0 ? -hi : hi;
+  return (a > b ? a : b) + channel_round_bias(s);
+}
+
+constexpr int32_t channel_scale_exact(const ChannelScale &s, uint32_t raw) {
+  int64_t n = channel_numerator(s, raw);
+  uint64_t q = ((uint64_t)(n < 0 ? -n : n) + channel_round_bias(s)) / (uint64_t)s.div;
+  return n < 0 ? -(int32_t)q : (int32_t)q;
+}
+
+// n / div == (n * mul) >> shift for every n <= max_n when mul = ceil(2^shift / div)
+// and n * (mul * div - 2^shift) < 2^shift. Smallest shift that also keeps the
+// product in 64 bits; mul == 0 if there is none.
+typedef struct {
+  uint64_t mul;
+  uint8_t  shift;
+} ChannelReciprocal;
+
+constexpr ChannelReciprocal channel_reciprocal(uint32_t div, uint64_t max_n) {
+  for (uint8_t shift = 0; shift < 63; shift++) {
+    uint64_t p = 1ull << shift;
+    uint64_t mul = (p + div - 1) / div;
+    if (mul != 0 && max_n > UINT64_MAX / mul) break;
+    if (max_n * (mul * div - p) < p) return { mul, shift };
+  }
+  return { 0, 0 };
+}
+
+template <const ChannelScale &S>
+struct ChannelTable {
+  int16_t v[256];
+  constexpr ChannelTable() : v() {
+    for (uint32_t raw = 0; raw < 256; raw++) v[raw] = (int16_t)channel_scale_exact(S, raw);
+  }
+};
+
+template <const ChannelScale &S>
+struct ChannelConverter {
+  static_assert(S.raw_max == 0xFF || S.raw_max == 0xFFFF, "raw type must be uint8_t or uint16_t");
+  static_assert(S.div > 0 && S.decimals <= 1, "bad channel descriptor");
+  static_assert(channel_max_magnitude(S) <= INT32_MAX, "numerator must fit in 32 bits");
+
+  static constexpr bool use_table = S.raw_max == 0xFF;
+  static constexpr ChannelReciprocal recip = channel_reciprocal(S.div, channel_max_magnitude(S));
+  static_assert(use_table || recip.mul != 0, "no exact multiply-shift for this divisor");
+  static_assert(!use_table || (channel_scale_exact(S, 0) >= INT16_MIN && channel_scale_exact(S, 0xFF) <= INT16_MAX &&
+                               channel_scale_exact(S, 0) <= INT16_MAX && channel_scale_exact(S, 0xFF) >= INT16_MIN),
+                "8-bit channel table holds int16_t");
+
+  static FixedValue convert(uint16_t raw) {
+    if constexpr (use_table) {
+      static constexpr ChannelTable<S> table{};
+      return { table.v[(uint8_t)raw], S.decimals };
+    } else {
+      int32_t n = (int32_t)raw * S.mul + S.add;
+      uint32_t mag = (n < 0 ? 0u - (uint32_t)n : (uint32_t)n) + channel_round_bias(S);
+      int32_t q = (int32_t)(((uint64_t)mag * recip.mul) >> recip.shift);
+      return { n < 0 ? -q : q, S.decimals };
+    }
+  }
+};
@@ -0,0 +1,330 @@
+#include "Arduino.h"
+#include "DataLogger.h"
+#include "CAN_Decoder.h"
+#include "CANBus_Driver.h"
+#include "TaskMonitor.h"
+#include <LittleFS.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <string.h>
+
+#define LOG_DIR            "/logs"
+#define LOG_MAX_RECORD     (5 + LOG_CHANNELS * 3)  // Worst-case varint sizes
+#define LOG_FREE_MARGIN    (4 * LOG_BLOCK_BYTES)   // Keep clear of a full filesystem
+
+LoggerStats logger_stats = {};
+
+static uint8_t *blocks[2] = { NULL, NULL };   // Double buffer (internal RAM)
+static volatile bool block_busy[2] = { false, false }; // Queued for / being written by the writer
+static uint8_t active = 0;
+static uint16_t used = 0;
+static uint32_t block_seq = 0;
+static uint32_t block_start_ms = 0;
+static uint32_t prev_time_ms = 0;
+static int32_t prev_values[LOG_CHANNELS];
+static QueueHandle_t write_queue = NULL;
+static volatile bool flush_requested = false;
+static volatile int8_t session_state = 0;     // 0 = waiting for CAN, 1 = open, -1 = failed
+static char session_path[32];
+
+// ---- Encoding ----
+
+static uint8_t *put_varint(uint8_t *p, uint32_t v) {
+  while (v >= 0x80) {
+    *p++ = (uint8_t)(v | 0x80);
+    v >>= 7;
+  }
+  *p++ = (uint8_t)v;
+  return p;
+}
+
+static uint32_t zigzag(int32_t v) {
+  return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static void put_u16(uint8_t *p, uint16_t v) { p[0] = v; p[1] = v >> 8; }
+static void put_u32(uint8_t *p, uint32_t v) { for (int i = 0; i < 4; i++) p[i] = v >> (8 * i); }
+
+static void begin_block(uint32_t now_ms) {
+  used = LOG_BLOCK_HEADER;
+  block_start_ms = now_ms;
+  prev_time_ms = now_ms;
+  memset(prev_values, 0, sizeof(prev_values)); // Keyframe: first record is absolute
+}
+
+// Due for the writer: full, open for LOGGER_FLUSH_MS, or logger_flush() called
+static bool block_due(uint32_t now_ms) {
+  if (used + LOG_MAX_RECORD > LOG_BLOCK_BYTES || flush_requested) return true;
+  return LOGGER_FLUSH_MS > 0 && now_ms - block_start_ms >= LOGGER_FLUSH_MS;
+}
+
+// Finish the active block and queue it for the writer; false if the other
+// block is still waiting on flash (the active block is then kept)
+static bool hand_off_block(void) {
+  uint8_t next = active ^ 1;
+  if (block_busy[next]) return false;
+  if (used + LOG_MAX_RECORD <= LOG_BLOCK_BYTES) logger_stats.blocks_partial++;
+
+  uint8_t *b = blocks[active];
+  memcpy(b, "M1LB", 4);
+  b[4] = LOG_VERSION;
+  b[5] = LOG_CHANNELS;
+  put_u16(b + 6, used);
+  put_u32(b + 8, block_seq++);
+  put_u32(b + 12, block_start_ms);
+  memset(b + used, 0, LOG_BLOCK_BYTES - used);
+
+  block_busy[active] = true;
+  xQueueSend(write_queue, &active, 0);
+  active = next;
+  return true;
+}
+
+// Channel order is the file format; keep tools/log2csv.py CHANNELS in sync
+static void encode_record(const DisplayData *d, uint8_t warnings, uint32_t now_ms) {
+  const int32_t values[LOG_CHANNELS] = {
+    d->coolant_temp_raw, d->oil_press_raw,
+    d->lambda_bank1_raw, d->lambda_bank2_raw,
+    d->map_raw, d->speed_raw,
+    d->ls_fuel_press_raw, d->inj_duty_cycle_raw,
+    d->ethanol_pct_raw, d->battery_volts_raw,
+    warnings,
+  };
+
+  uint8_t *p = blocks[active] + used;
+  p = put_varint(p, now_ms - prev_time_ms);
+  for (int c = 0; c < LOG_CHANNELS; c++) {
+    p = put_varint(p, zigzag(values[c] - prev_values[c]));
+    prev_values[c] = values[c];
+  }
+  prev_time_ms = now_ms;
+  used = (uint16_t)(p - blocks[active]);
+}
+
+// ---- Files ----
+
+static uint32_t logger_byte_budget(void) {
+  if (LOGGER_MAX_BYTES > 0) return LOGGER_MAX_BYTES;
+  size_t total = LittleFS.totalBytes();
+  return total > LOG_FREE_MARGIN ? total - LOG_FREE_MARGIN : 0;
+}
+
+// Delete the oldest session (lowest number) other than the one being written
+static bool delete_oldest_session(void) {
+  File dir = LittleFS.open(LOG_DIR);
+  if (!dir) return false;
+  char oldest[32] = "";
+  long oldest_num = -1;
+  for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+    long num = strtol(f.name(), NULL, 10);
+    char path[32];
+    snprintf(path, sizeof(path), LOG_DIR "/%s", f.name());
+    if (strcmp(path, session_path) != 0 && (oldest_num < 0 || num < oldest_num)) {
+      oldest_num = num;
+      strcpy(oldest, path);
+    }
+  }
+  if (oldest_num < 0) return false;
+  logger_stats.files_deleted++;
+  return LittleFS.remove(oldest);
+}
+
+static bool open_session(void) {
+  if (!LittleFS.exists(LOG_DIR)) LittleFS.mkdir(LOG_DIR);
+  long last = 0;
+  File dir = LittleFS.open(LOG_DIR);
+  for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+    long num = strtol(f.name(), NULL, 10);
+    if (num > last) last = num;
+  }
+  snprintf(session_path, sizeof(session_path), LOG_DIR "/%04ld.m1l", last + 1);
+  File f = LittleFS.open(session_path, "w");
+  if (!f) return false;
+  f.close();
+  return true;
+}
+
+#ifdef LOGGER_BENCHMARK
+// Append 64 blocks flat out while CAN is running, and report the RX load seen
+// during the run next to what the logger itself needs
+static void logger_benchmark(void) {
+  const int bench_blocks = 64;
+  uint8_t *buf = (uint8_t *)heap_caps_malloc(LOG_BLOCK_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  File f = LittleFS.open("/bench.tmp", "w");
+  if (buf == NULL || !f) {
+    free(buf);
+    return;
+  }
+  memset(buf, 0xA5, LOG_BLOCK_BYTES);
+
+  uint32_t frames_before = can_rx_stats.frames;
+  uint32_t t0 = millis(), worst = 0;
+  for (int i = 0; i < bench_blocks; i++) {
+    uint32_t t = millis();
+    f.write(buf, LOG_BLOCK_BYTES);
+    f.flush();
+    if (millis() - t > worst) worst = millis() - t;
+  }
+  uint32_t dt = millis() - t0;
+  uint32_t frames = can_rx_stats.frames - frames_before; // Approximate: RX resets its window every 10 s
+  f.close();
+  LittleFS.remove("/bench.tmp");
+  free(buf);
+
+  float kbps = dt ? (bench_blocks * LOG_BLOCK_BYTES / 1024.0f) / (dt / 1000.0f) : 0.0f;
+  float need_kbps = (float)LOG_MAX_RECORD * LOGGER_SAMPLE_HZ / 1024.0f; // Every channel changing every record
+  Serial.printf("Logger bench: %d x %d B in %lu ms = %.1f KB/s, worst block %lu ms, CAN %lu frames/s meanwhile\n",
+                bench_blocks, LOG_BLOCK_BYTES, dt, kbps, worst, dt ? frames * 1000 / dt : 0);
+  Serial.printf("Logger bench: worst-case need %.2f KB/s at %d Hz, max sustainable %.0f Hz\n",
+                need_kbps, LOGGER_SAMPLE_HZ, kbps * 1024.0f / LOG_MAX_RECORD);
+}
+#endif
+
+// ---- Tasks ----
+
+// True once any channel has been received and not timed out
+static bool can_live(void) {
+  static DisplayData data = {};
+  static MaxValues max_data = {};
+  can_state_snapshot(&data, &max_data);
+  return can_ms_to_next_timeout(&data, millis()) != UINT32_MAX;
+}
+
+static void logger_write_task(void *arg) {
+#ifdef LOGGER_BENCHMARK
+  vTaskDelay(pdMS_TO_TICKS(15000)); // Let CAN start so the run happens under bus load
+  logger_benchmark();
+#endif
+  // No session file until the ECU is talking: a boot with the ECU off writes nothing
+  while (!can_live()) {
+    vTaskDelay(pdMS_TO_TICKS(100));
+  }
+  if (!open_session()) {
+    Serial.println("Logger: cannot create session file, logging disabled");
+    session_state = -1;
+    task_monitor_exit();
+    vTaskDelete(NULL);
+    return;
+  }
+  Serial.printf("Logger: %s at %d Hz, %u/%u KB used\n", session_path, LOGGER_SAMPLE_HZ,
+                (unsigned)(LittleFS.usedBytes() / 1024), (unsigned)(LittleFS.totalBytes() / 1024));
+  session_state = 1;
+
+  File file = LittleFS.open(session_path, "a");
+  uint8_t index;
+  while (1) {
+    xQueueReceive(write_queue, &index, portMAX_DELAY);
+
+    while (LittleFS.usedBytes() + LOG_BLOCK_BYTES > logger_byte_budget()) {
+      if (!delete_oldest_session()) break;
+    }
+
+    uint32_t t0 = millis();
+    size_t written = file ? file.write(blocks[index], LOG_BLOCK_BYTES) : 0;
+    if (file) file.flush();
+    uint32_t dt = millis() - t0;
+
+    if (written != LOG_BLOCK_BYTES) logger_stats.write_errors++;
+    else logger_stats.blocks_written++;
+    logger_stats.write_ms_total += dt;
+    if (dt > logger_stats.write_ms_max) logger_stats.write_ms_max = dt;
+    block_busy[index] = false;
+  }
+}
+
+static void logger_sample_task(void *arg) {
+  static DisplayData data = {};
+  static MaxValues max_data = {};
+  while (session_state == 0) {
+    vTaskDelay(pdMS_TO_TICKS(100));
+  }
+  if (session_state < 0) {
+    task_monitor_exit();
+    vTaskDelete(NULL);
+    return;
+  }
+  begin_block(millis());
+
+  TickType_t last_wake = xTaskGetTickCount();
+  while (1) {
+    vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(1000 / LOGGER_SAMPLE_HZ));
+    uint32_t now = millis();
+
+    bool full = used + LOG_MAX_RECORD > LOG_BLOCK_BYTES;
+    if (block_due(now) && used > LOG_BLOCK_HEADER) {
+      if (hand_off_block()) {
+        begin_block(now);
+        flush_requested = false;
+      } else if (full) {
+        logger_stats.records_dropped++; // Writer still busy with the other block
+        continue;
+      }
+    }
+
+    can_state_snapshot(&data, &max_data); // On a busy retry, log the previous values
+    can_apply_timeouts(&data, now);
+    encode_record(&data, ecu_warning_flags, now);
+    logger_stats.records++;
+  }
+}
+
+// Undo logger_init() after a failure: buffers, queue and the LittleFS mount
+static void logger_free(void) {
+  heap_caps_free(blocks[0]);
+  heap_caps_free(blocks[1]);
+  if (write_queue != NULL) vQueueDelete(write_queue);
+  blocks[0] = blocks[1] = NULL;
+  write_queue = NULL;
+  LittleFS.end();
+}
+
+// ---- Public API ----
+
+bool logger_init(void) {
+#if LOGGER_ENABLED
+  // Never format here: a mount failure may be a damaged partition with sessions on it
+  if (!LittleFS.begin(false)) {
+    Serial.println("Logger: LittleFS mount failed (not formatted?), logging disabled");
+    return false;
+  }
+  blocks[0] = (uint8_t *)heap_caps_malloc(LOG_BLOCK_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  blocks[1] = (uint8_t *)heap_caps_malloc(LOG_BLOCK_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  write_queue = xQueueCreate(2, sizeof(uint8_t));
+  if (blocks[0] == NULL || blocks[1] == NULL || write_queue == NULL) {
+    Serial.println("Logger: out of memory, logging disabled");
+    logger_free();
+    return false;
+  }
+
+  // Sampler first: it touches nothing until the writer opens the session,
+  // so it can still be told to exit if the writer does not start
+  if (!task_start(logger_sample_task, "Log_Sample", 3072, TASK_PRIO_BG, TASK_CORE_BG)) {
+    Serial.println("Logger: sampler task not started, logging disabled");
+    logger_free();
+    return false;
+  }
+  if (!task_start(logger_write_task, "Log_Write", 4096, TASK_PRIO_BG, TASK_CORE_BG)) {
+    Serial.println("Logger: writer task not started, logging disabled");
+    session_state = -1; // The sampler sees this and exits
+    logger_free();
+    return false;
+  }
+  Serial.println("Logger: session starts with the first CAN data");
+  return true;
+#else
+  return false;
+#endif
+}
+
+void logger_flush(void) {
+  flush_requested = true;
+}
+
+void logger_print_stats(void) {
+  LoggerStats *st = &logger_stats;
+  Serial.printf("Logger: %lu records (%lu dropped), %lu blocks (%lu partial), %lu errors, write %lu ms avg / %lu ms max, %lu old files deleted\n",
+                st->records, st->records_dropped, st->blocks_written, st->blocks_partial, st->write_errors,
+                st->blocks_written ? st->write_ms_total / st->blocks_written : 0,
+                st->write_ms_max, st->files_deleted);
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// ============================================================================
+// DATA LOGGER
+// ----------------------------------------------------------------------------
+// Session logging of the decoded channels to LittleFS. A sampler task encodes
+// one record per tick into the active RAM block; a block is handed to a
+// writer task when it is full or LOGGER_FLUSH_MS old, and the writer appends
+// it to /logs/NNNN.m1l in one LOG_BLOCK_BYTES (sector-sized) write. A block
+// handed off early is padded, so files grow faster than the data. Two
+// blocks are double-buffered, so flash latency only stalls the writer and
+// never the sampler or receive_can_task. The session file is created when
+// CAN data first arrives, so a boot with the ECU off writes nothing;
+// LittleFS is never formatted by the logger.
+//
+// Block layout (little-endian), decoded on the host by tools/log2csv.py:
+//   "M1LB" | u8 version | u8 channels | u16 used | u32 seq | u32 start_ms
+//   records: varint dt_ms, then per channel zigzag varint delta
+// Every block is a keyframe: deltas start from 0 and dt from start_ms, so a
+// block decodes on its own even if the file was cut off by a power loss.
+// ============================================================================
+
+#define LOGGER_ENABLED     1     // Set to 0 to build without session logging
+#define LOGGER_SAMPLE_HZ   20    // Records per second
+#define LOGGER_MAX_BYTES   0     // Keep logs under this many bytes (0 = LittleFS size minus margin)
+#define LOGGER_FLUSH_MS    5000  // Hand a block to the writer at this age even if not full: the most
+                                 // lost at power-off. 0 = full blocks only (about 15-20 s each)
+// #define LOGGER_BENCHMARK      // Measure sustained LittleFS write throughput at boot
+
+#define LOG_BLOCK_BYTES    4096  // One flash sector per write
+#define LOG_BLOCK_HEADER   16
+#define LOG_VERSION        1
+#define LOG_CHANNELS       11    // See logger channel order in DataLogger.cpp / tools/log2csv.py
+
+typedef struct {
+  uint32_t records;          // Records encoded
+  uint32_t records_dropped;  // Records lost because both blocks were waiting on flash
+  uint32_t blocks_written;
+  uint32_t blocks_partial;   // Handed off before full (LOGGER_FLUSH_MS or logger_flush())
+  uint32_t write_errors;
+  uint32_t write_ms_max;     // Slowest block write (open file append + flush)
+  uint32_t write_ms_total;
+  uint32_t files_deleted;    // Oldest sessions removed to make room
+} LoggerStats;
+
+extern LoggerStats logger_stats;
+
+// Mount LittleFS and start the sampler/writer tasks; they open a new session
+// file once CAN data arrives. False if the partition does not mount.
+bool logger_init(void);
+// Hand the partially filled block to the writer at the next tick (called
+// when CAN goes silent, as the ECU does at key-off)
+void logger_flush(void);
+void logger_print_stats(void);
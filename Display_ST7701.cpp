@@ -1,36 +1,210 @@
 #include "Display_ST7701.h"  
 #include "driver/gpio.h"
+#include "freertos/semphr.h"
+#include <string.h>
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "BootProfile.h"
+#if LCD_BOUNCE_STATS
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#endif
       
 spi_device_handle_t SPI_handle = NULL;     
 esp_lcd_panel_handle_t panel_handle = NULL;            
-void st7701_write_command(uint8_t cmd) {
-  spi_transaction_t spi_tran = {
-    .cmd = 0,
-    .addr = cmd,
-    .length = 0,
-    .rxlength = 0,
-  };
-  spi_device_transmit(SPI_handle, &spi_tran);
+static SemaphoreHandle_t frame_done_sem = NULL;  // Given each time the panel finishes reading a frame
+
+// Reported once, with the first frame LVGL completes
+static struct {
+  uint32_t st7701_us;     // Register setup, including the panel's own sleep-out and display-on waits
+  int64_t lcd_ready_us;   // Since boot, when lcd_init() returned
+  bool reported;
+} boot_timing;
+
+#if LCD_WINDOW_FB
+// One window buffer for partial rendering, two to swap for direct rendering
+#define WINDOW_FB_NUM   (LVGL_RENDER_MODE == LVGL_RENDER_PARTIAL ? 1 : 2)
+#define WINDOW_FB_BYTES (LCD_WINDOW_WIDTH * LCD_WINDOW_HEIGHT * 2)
+
+static uint16_t *window_fbs[2] = { NULL, NULL };
+static uint16_t *volatile front_fb = NULL;  // Buffer the next frame scans out
+static uint16_t *scan_fb = NULL;            // Buffer the current frame scans out
+
+#if LCD_BOUNCE_STATS
+// Written by the fill ISR only; the print takes differences of the running totals
+static volatile uint32_t bounce_fills = 0, bounce_late = 0, bounce_busy_cycles = 0, bounce_max_cycles = 0;
+static uint32_t bounce_period_cycles = 0;   // Scan-out time of one bounce buffer
+static uint32_t last_fill_start = 0;
+static int last_fill_end_px = -1;
+#endif
+
+#if LCD_BOUNCE_SPAN_ONLY
+// The two bounce buffers the driver alternates between, once their border
+// columns have been cleared
+static void *bordered_bufs[2] = { NULL, NULL };
+#endif
+
+// The panel has no framebuffer: the driver asks for each bounce buffer's worth
+// of pixels in scan order. Rows outside the window and the columns either side
+// of it are black; window rows come from the window buffer.
+static bool IRAM_ATTR window_bounce_fill(esp_lcd_panel_handle_t panel, void *bounce_buf, int pos_px, int len_bytes, void *user_ctx) {
+#if LCD_BOUNCE_STATS
+  uint32_t t0 = esp_cpu_get_cycle_count();
+#endif
+  uint16_t *dst = (uint16_t *)bounce_buf;
+  int row = pos_px / ESP_PANEL_LCD_WIDTH;
+  int rows = len_bytes / (ESP_PANEL_LCD_WIDTH * 2);
+  if (pos_px == 0) scan_fb = front_fb;
+
+#if LCD_BOUNCE_SPAN_ONLY
+  // Border columns are black in every row and nothing else writes the bounce
+  // buffers, so each buffer is cleared once and afterwards only the 240 px
+  // span is touched: a quarter of the line
+  if (bounce_buf != bordered_bufs[0] && bounce_buf != bordered_bufs[1]) {
+    memset(bounce_buf, 0, len_bytes);
+    bordered_bufs[bordered_bufs[0] == NULL ? 0 : 1] = bounce_buf;
+  }
+  dst += LCD_WINDOW_X;
+  for (int r = row; r < row + rows; r++, dst += ESP_PANEL_LCD_WIDTH) {
+    int wr = r - LCD_WINDOW_Y;
+    if (wr < 0 || wr >= LCD_WINDOW_HEIGHT || scan_fb == NULL) memset(dst, 0, LCD_WINDOW_WIDTH * 2);
+    else memcpy(dst, scan_fb + wr * LCD_WINDOW_WIDTH, LCD_WINDOW_WIDTH * 2);
+  }
+#else
+  for (int r = row; r < row + rows; r++, dst += ESP_PANEL_LCD_WIDTH) {
+    int wr = r - LCD_WINDOW_Y;
+    if (wr < 0 || wr >= LCD_WINDOW_HEIGHT || scan_fb == NULL) {
+      memset(dst, 0, ESP_PANEL_LCD_WIDTH * 2);
+      continue;
+    }
+    memset(dst, 0, LCD_WINDOW_X * 2);
+    memcpy(dst + LCD_WINDOW_X, scan_fb + wr * LCD_WINDOW_WIDTH, LCD_WINDOW_WIDTH * 2);
+    memset(dst + LCD_WINDOW_X + LCD_WINDOW_WIDTH, 0, (ESP_PANEL_LCD_WIDTH - LCD_WINDOW_X - LCD_WINDOW_WIDTH) * 2);
+  }
+#endif
+
+#if LCD_BOUNCE_STATS
+  uint32_t t1 = esp_cpu_get_cycle_count();
+  bounce_fills = bounce_fills + 1;
+  bounce_busy_cycles = bounce_busy_cycles + (t1 - t0);
+  if (t1 - t0 > bounce_max_cycles) bounce_max_cycles = t1 - t0;
+  // While this buffer is filled the DMA reads the other one, which it started
+  // about when the previous fill was requested: a fill finishing more than two
+  // buffer periods after the previous one began was too late, and the panel
+  // showed stale lines. Frame starts (after vertical blanking) are not judged.
+  if (pos_px == last_fill_end_px && t1 - last_fill_start > 2 * bounce_period_cycles) bounce_late = bounce_late + 1;
+  last_fill_start = t0;
+  last_fill_end_px = pos_px + len_bytes / 2;
+#endif
+
+  BaseType_t woken = pdFALSE;
+  if (row + rows >= ESP_PANEL_LCD_HEIGHT) xSemaphoreGiveFromISR((SemaphoreHandle_t)user_ctx, &woken);
+  return woken == pdTRUE;
 }
+#endif
 
-void st7701_write_data(uint8_t data) {
-  spi_transaction_t spi_tran = {
-    .cmd = 1,
-    .addr = data,
-    .length = 0,
-    .rxlength = 0,
-  };
+// ST7701 register setup, in order. The panel is on a 3-wire SPI bus: every
+// byte goes out as a 9-bit word whose first bit is D/C (0 = command, 1 =
+// parameter), and the wait follows the command.
+typedef struct {
+  uint8_t cmd;
+  uint8_t len;        // Parameter bytes
+  uint8_t delay_ms;
+  uint8_t data[16];
+} St7701Command;
+
+static constexpr St7701Command st7701_init_cmds[] = {
+  { 0xFF,  5,   0, { 0x77, 0x01, 0x00, 0x00, 0x13 } },  // Command2 BK3
+  { 0xEF,  1,   0, { 0x08 } },
+  { 0xFF,  5,   0, { 0x77, 0x01, 0x00, 0x00, 0x10 } },  // Command2 BK0
+  { 0xC0,  2,   0, { 0x77, 0x00 } },
+  { 0xC1,  2,   0, { 0x11, 0x0C } },
+  { 0xC2,  2,   0, { 0x07, 0x02 } },
+  { 0xCC,  1,   0, { 0x30 } },
+  { 0xB0, 16,   0, { 0x06, 0xCF, 0x14, 0x0C, 0x0F, 0x03, 0x00, 0x0A, 0x07, 0x1B, 0x03, 0x12, 0x10, 0x25, 0x36, 0x1E } },
+  { 0xB1, 16,   0, { 0x0C, 0xD4, 0x18, 0x0C, 0x0E, 0x06, 0x03, 0x06, 0x08, 0x23, 0x06, 0x12, 0x10, 0x30, 0x2F, 0x1F } },
+  { 0xFF,  5,   0, { 0x77, 0x01, 0x00, 0x00, 0x11 } },  // Command2 BK1
+  { 0xB0,  1,   0, { 0x73 } },
+  { 0xB1,  1,   0, { 0x7C } },
+  { 0xB2,  1,   0, { 0x83 } },
+  { 0xB3,  1,   0, { 0x80 } },
+  { 0xB5,  1,   0, { 0x49 } },
+  { 0xB7,  1,   0, { 0x87 } },
+  { 0xB8,  1,   0, { 0x33 } },
+  { 0xB9,  2,   0, { 0x10, 0x1F } },
+  { 0xBB,  1,   0, { 0x03 } },
+  { 0xC1,  1,   0, { 0x08 } },
+  { 0xC2,  1,   0, { 0x08 } },
+  { 0xD0,  1,   0, { 0x88 } },
+  { 0xE0,  6,   0, { 0x00, 0x00, 0x02, 0x00, 0x00, 0x0C } },
+  { 0xE1, 11,   0, { 0x05, 0x96, 0x07, 0x96, 0x06, 0x96, 0x08, 0x96, 0x00, 0x44, 0x44 } },
+  { 0xE2, 12,   0, { 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00 } },
+  { 0xE3,  4,   0, { 0x00, 0x00, 0x33, 0x33 } },
+  { 0xE4,  2,   0, { 0x44, 0x44 } },
+  { 0xE5, 16,   0, { 0x0D, 0xD4, 0x28, 0x8C, 0x0F, 0xD6, 0x28, 0x8C, 0x09, 0xD0, 0x28, 0x8C, 0x0B, 0xD2, 0x28, 0x8C } },
+  { 0xE6,  4,   0, { 0x00, 0x00, 0x33, 0x33 } },
+  { 0xE7,  2,   0, { 0x44, 0x44 } },
+  { 0xE8, 16,   0, { 0x0E, 0xD5, 0x28, 0x8C, 0x10, 0xD7, 0x28, 0x8C, 0x0A, 0xD1, 0x28, 0x8C, 0x0C, 0xD3, 0x28, 0x8C } },
+  { 0xEB,  6,   0, { 0x00, 0x01, 0xE4, 0xE4, 0x44, 0x00 } },
+  { 0xED, 16,   0, { 0xF3, 0xC1, 0xBA, 0x0F, 0x66, 0x77, 0x44, 0x55, 0x55, 0x44, 0x77, 0x66, 0xF0, 0xAB, 0x1C, 0x3F } },
+  { 0xEF,  6,   0, { 0x10, 0x0D, 0x04, 0x08, 0x3F, 0x1F } },
+  { 0xFF,  5,   0, { 0x77, 0x01, 0x00, 0x00, 0x13 } },  // Command2 BK3
+  { 0xE8,  2,   0, { 0x00, 0x0E } },
+  { 0x11,  0, 120, {} },  // Sleep out
+  { 0xE8,  2,  10, { 0x00, 0x0C } },
+  { 0xE8,  2,   0, { 0x40, 0x00 } },
+  { 0xFF,  5,   0, { 0x77, 0x01, 0x00, 0x00, 0x00 } },  // Command2 off
+  { 0x36,  1,   0, { 0x00 } },  // MADCTL: no rotation
+  { 0x3A,  1,   0, { 0x66 } },  // COLMOD
+  { 0x29,  0,  20, {} },  // Display on
+};
+
+// Words packed MSB first, back to back. CS stays low for the whole sequence,
+// so to the panel a batch is the same as one word per transfer.
+typedef struct {
+  uint8_t bytes[ST7701_BATCH_BYTES];
+  uint16_t bits;
+} St7701Batch;
+
+static DMA_ATTR St7701Batch st7701_batch;
+static uint32_t st7701_transfers = 0, st7701_words = 0;
+
+static void st7701_flush(void) {
+  St7701Batch *b = &st7701_batch;
+  if (b->bits == 0) return;
+  spi_transaction_t spi_tran = {};
+  spi_tran.length = b->bits;
+  spi_tran.tx_buffer = b->bytes;
+#if ST7701_INIT_BATCHED
+  spi_device_polling_transmit(SPI_handle, &spi_tran);  // Tens of microseconds: not worth an interrupt
+#else
   spi_device_transmit(SPI_handle, &spi_tran);
+#endif
+  st7701_transfers++;
+  memset(b, 0, sizeof(*b));
 }
 
+static void st7701_put(bool param, uint8_t value) {
+  St7701Batch *b = &st7701_batch;
+  if (b->bits + 9 > ST7701_BATCH_BYTES * 8) st7701_flush();
+  uint16_t word = (param ? 0x100 : 0) | value;
+  for (int i = 8; i >= 0; i--, b->bits++) {
+    if (word & (1 << i)) b->bytes[b->bits >> 3] |= 0x80 >> (b->bits & 7);
+  }
+  st7701_words++;
+#if !ST7701_INIT_BATCHED
+  st7701_flush();
+#endif
+}
+
+// The expander write has completed (pin driven) when set_exio() returns,
+// so no settle delay is needed before the first SPI transfer
 void st7701_cs_en(){
   set_exio(EXIO_PIN3, Low);
-  delay(10);
 }
 
 void st7701_cs_dis(){
   set_exio(EXIO_PIN3, High);
-  delay(10);
 }
 
 void st7701_reset(){
@@ -41,19 +215,19 @@ void st7701_reset(){
 }
 
 void st7701_init() {
+  int64_t t0 = esp_timer_get_time();
   spi_bus_config_t buscfg = {
     .mosi_io_num = LCD_MOSI_PIN,
     .miso_io_num = -1,
     .sclk_io_num = LCD_CLK_PIN,
     .quadwp_io_num = -1,
     .quadhd_io_num = -1,
-    .max_transfer_sz = 64,
+    .max_transfer_sz = ST7701_BATCH_BYTES,
   };
 
   spi_bus_initialize(SPI2_HOST, &buscfg, SPI_DMA_CH_AUTO);
+  // No command or address phase: the D/C bit is packed into each word
   spi_device_interface_config_t devcfg = {
-    .command_bits = 1,
-    .address_bits = 8,
     .mode = SPI_MODE0,
     .clock_speed_hz = 40000000,
     .spics_io_num = -1,                      
@@ -65,253 +239,17 @@ void st7701_init() {
   // gpio_set_direction(LCD_CS_EX_PIN, GPIO_MODE_OUTPUT);
 
   st7701_cs_en();
-
-  st7701_write_command(0xff);
-  st7701_write_data(0x77);
-  st7701_write_data(0x01);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_data(0x13);
-  st7701_write_command(0xef);
-  st7701_write_data(0x08);
-  st7701_write_command(0xff);
-  st7701_write_data(0x77);
-  st7701_write_data(0x01);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_data(0x10);
-  st7701_write_command(0xc0);
-  st7701_write_data(0x77);
-  st7701_write_data(0x00);
-  st7701_write_command(0xc1);
-  st7701_write_data(0x11);
-  st7701_write_data(0x0c);
-  st7701_write_command(0xc2);
-  st7701_write_data(0x07);
-  st7701_write_data(0x02);
-  st7701_write_command(0xcc);
-  st7701_write_data(0x30);
-  st7701_write_command(0xB0);
-  st7701_write_data(0x06);
-  st7701_write_data(0xCF);
-  st7701_write_data(0x14);
-  st7701_write_data(0x0C);
-  st7701_write_data(0x0F);
-  st7701_write_data(0x03);
-  st7701_write_data(0x00);
-  st7701_write_data(0x0A);
-  st7701_write_data(0x07);
-  st7701_write_data(0x1B);
-  st7701_write_data(0x03);
-  st7701_write_data(0x12);
-  st7701_write_data(0x10);
-  st7701_write_data(0x25);
-  st7701_write_data(0x36);
-  st7701_write_data(0x1E);
-  st7701_write_command(0xB1);
-  st7701_write_data(0x0C);
-  st7701_write_data(0xD4);
-  st7701_write_data(0x18);
-  st7701_write_data(0x0C);
-  st7701_write_data(0x0E);
-  st7701_write_data(0x06);
-  st7701_write_data(0x03);
-  st7701_write_data(0x06);
-  st7701_write_data(0x08);
-  st7701_write_data(0x23);
-  st7701_write_data(0x06);
-  st7701_write_data(0x12);
-  st7701_write_data(0x10);
-  st7701_write_data(0x30);
-  st7701_write_data(0x2F);
-  st7701_write_data(0x1F);
-  st7701_write_command(0xff);
-  st7701_write_data(0x77);
-  st7701_write_data(0x01);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_data(0x11);
-  st7701_write_command(0xb0);
-  st7701_write_data(0x73);
-  st7701_write_command(0xb1);
-  st7701_write_data(0x7C);
-  st7701_write_command(0xb2);
-  st7701_write_data(0x83);
-  st7701_write_command(0xb3);
-  st7701_write_data(0x80);
-  st7701_write_command(0xb5);
-  st7701_write_data(0x49);
-  st7701_write_command(0xb7);
-  st7701_write_data(0x87);
-  st7701_write_command(0xb8);
-  st7701_write_data(0x33);
-  st7701_write_command(0xb9);
-  st7701_write_data(0x10);
-  st7701_write_data(0x1f);
-  st7701_write_command(0xbb);
-  st7701_write_data(0x03);
-  st7701_write_command(0xc1);
-  st7701_write_data(0x08);
-  st7701_write_command(0xc2);
-  st7701_write_data(0x08);
-  st7701_write_command(0xd0);
-  st7701_write_data(0x88);
-  st7701_write_command(0xe0);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_data(0x02);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_data(0x0c);
-  st7701_write_command(0xe1);
-  st7701_write_data(0x05);
-  st7701_write_data(0x96);
-  st7701_write_data(0x07);
-  st7701_write_data(0x96);
-  st7701_write_data(0x06);
-  st7701_write_data(0x96);
-  st7701_write_data(0x08);
-  st7701_write_data(0x96);
-  st7701_write_data(0x00);
-  st7701_write_data(0x44);
-  st7701_write_data(0x44);
-  st7701_write_command(0xe2);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_data(0x03);
-  st7701_write_data(0x03);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_data(0x02);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_data(0x02);
-  st7701_write_data(0x00);
-  st7701_write_command(0xe3);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_data(0x33);
-  st7701_write_data(0x33);
-  st7701_write_command(0xe4);
-  st7701_write_data(0x44);
-  st7701_write_data(0x44);
-  st7701_write_command(0xe5);
-  st7701_write_data(0x0d);
-  st7701_write_data(0xd4);
-  st7701_write_data(0x28);
-  st7701_write_data(0x8c);
-  st7701_write_data(0x0f);
-  st7701_write_data(0xd6);
-  st7701_write_data(0x28);
-  st7701_write_data(0x8c);
-  st7701_write_data(0x09);
-  st7701_write_data(0xd0);
-  st7701_write_data(0x28);
-  st7701_write_data(0x8c);
-  st7701_write_data(0x0b);
-  st7701_write_data(0xd2);
-  st7701_write_data(0x28);
-  st7701_write_data(0x8c);
-  st7701_write_command(0xe6);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_data(0x33);
-  st7701_write_data(0x33);
-  st7701_write_command(0xe7);
-  st7701_write_data(0x44);
-  st7701_write_data(0x44);
-  st7701_write_command(0xe8);
-  st7701_write_data(0x0e);
-  st7701_write_data(0xd5);
-  st7701_write_data(0x28);
-  st7701_write_data(0x8c);
-  st7701_write_data(0x10);
-  st7701_write_data(0xd7);
-  st7701_write_data(0x28);
-  st7701_write_data(0x8c);
-  st7701_write_data(0x0a);
-  st7701_write_data(0xd1);
-  st7701_write_data(0x28);
-  st7701_write_data(0x8c);
-  st7701_write_data(0x0c);
-  st7701_write_data(0xd3);
-  st7701_write_data(0x28);
-  st7701_write_data(0x8c);
-  st7701_write_command(0xeb);
-  st7701_write_data(0x00);
-  st7701_write_data(0x01);
-  st7701_write_data(0xe4);
-  st7701_write_data(0xe4);
-  st7701_write_data(0x44);
-  st7701_write_data(0x00);
-  st7701_write_command(0xed);
-  st7701_write_data(0xf3);
-  st7701_write_data(0xc1);
-  st7701_write_data(0xba);
-  st7701_write_data(0x0f);
-  st7701_write_data(0x66);
-  st7701_write_data(0x77);
-  st7701_write_data(0x44);
-  st7701_write_data(0x55);
-  st7701_write_data(0x55);
-  st7701_write_data(0x44);
-  st7701_write_data(0x77);
-  st7701_write_data(0x66);
-  st7701_write_data(0xf0);
-  st7701_write_data(0xab);
-  st7701_write_data(0x1c);
-  st7701_write_data(0x3f);
-  st7701_write_command(0xef);
-  st7701_write_data(0x10);
-  st7701_write_data(0x0d);
-  st7701_write_data(0x04);
-  st7701_write_data(0x08);
-  st7701_write_data(0x3f);
-  st7701_write_data(0x1f);
-  st7701_write_command(0xff);
-  st7701_write_data(0x77);
-  st7701_write_data(0x01);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_data(0x13);
-  st7701_write_command(0xe8);
-  st7701_write_data(0x00);
-  st7701_write_data(0x0e);
-  st7701_write_command(0x11);
-  delay(120);
-  st7701_write_command(0xe8);
-  st7701_write_data(0x00);
-  st7701_write_data(0x0c);
-  delay(10);
-  st7701_write_command(0xe8);
-  st7701_write_data(0x40);
-  st7701_write_data(0x00);
-  st7701_write_command(0xff);
-  st7701_write_data(0x77);
-  st7701_write_data(0x01);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_command(0x36);  // MADCTL - Memory Access Control
-  st7701_write_data(0x00);     // 0x00 = no rotation (default)
-  st7701_write_command(0x3A);
-  st7701_write_data(0x66);
-  st7701_write_command(0x29);
-  delay(20);
-  
- /* 
-  st7701_write_command(0xff);
-  st7701_write_data(0x77);
-  st7701_write_data(0x01);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-  st7701_write_data(0x10);
-  st7701_write_command(0xe5);
-  st7701_write_data(0x00);
-  st7701_write_data(0x00);
-*/
+  for (const St7701Command &c : st7701_init_cmds) {
+    st7701_put(false, c.cmd);
+    for (uint8_t i = 0; i < c.len; i++) st7701_put(true, c.data[i]);
+    if (c.delay_ms) {
+      st7701_flush();
+      delay(c.delay_ms);
+    }
+  }
+  st7701_flush();
   st7701_cs_dis();
+  boot_timing.st7701_us = (uint32_t)(esp_timer_get_time() - t0);
 
   //  RGB
   esp_lcd_rgb_panel_config_t rgb_config = {
@@ -336,7 +274,11 @@ void st7701_init() {
     },
     .data_width = ESP_PANEL_LCD_RGB_DATA_WIDTH,
     .bits_per_pixel = ESP_PANEL_LCD_RGB_PIXEL_BITS,
+#if LCD_WINDOW_FB
+    .num_fbs = 0,
+#else
     .num_fbs = ESP_PANEL_LCD_RGB_FRAME_BUF_NUM,
+#endif
     .bounce_buffer_size_px = ESP_PANEL_LCD_RGB_BOUNCE_BUF_SIZE,
     .psram_trans_align = 64,
     .hsync_gpio_num = ESP_PANEL_LCD_PIN_NUM_RGB_HSYNC,
@@ -365,13 +307,34 @@ void st7701_init() {
     .flags = {
       .disp_active_low = 0,
       .refresh_on_demand = 0,
+#if LCD_WINDOW_FB
+      .fb_in_psram = false,
+      .double_fb = false,
+      .no_fb = 1,
+#else
       .fb_in_psram = true,
       .double_fb = true,
       .no_fb = 0,
+#endif
       .bb_invalidate_cache = 0,
     },
   };
   esp_lcd_new_rgb_panel(&rgb_config, &panel_handle); 
+#if LCD_WINDOW_FB
+  // Buffers and fill callback must be in place before init starts the scan-out
+  for (int i = 0; i < WINDOW_FB_NUM; i++) {
+    window_fbs[i] = (uint16_t *)heap_caps_calloc(1, WINDOW_FB_BYTES, MALLOC_CAP_SPIRAM);
+    if (window_fbs[i] == NULL) printf("LCD window buffer allocation failed!\n");
+  }
+  front_fb = scan_fb = window_fbs[0];
+  frame_done_sem = xSemaphoreCreateBinary();
+  esp_lcd_rgb_panel_event_callbacks_t cbs = {};
+  cbs.on_bounce_empty = window_bounce_fill;
+#if LCD_BOUNCE_STATS
+  bounce_period_cycles = (uint32_t)((uint64_t)esp_rom_get_cpu_ticks_per_us() * LCD_BOUNCE_PERIOD_NS / 1000);
+#endif
+  esp_lcd_rgb_panel_register_event_callbacks(panel_handle, &cbs, frame_done_sem);
+#endif
   esp_lcd_panel_reset(panel_handle);
   esp_lcd_panel_init(panel_handle);
 }
@@ -380,7 +343,76 @@ void lcd_init() {
   st7701_reset();
   st7701_init();
   backlight_init();
+  boot_timing.lcd_ready_us = esp_timer_get_time();
+}
+
+void lcd_first_frame_flushed(void) {
+  if (boot_timing.reported) return;
+  boot_timing.reported = true;
+  int64_t now = esp_timer_get_time();
+  boot_mark("first frame");
+  printf("LCD: first frame %lu ms after boot, panel ready at %lu ms (ST7701 setup %lu us: %lu words in %lu transfers)\n",
+         (unsigned long)(now / 1000), (unsigned long)(boot_timing.lcd_ready_us / 1000),
+         (unsigned long)boot_timing.st7701_us, (unsigned long)st7701_words, (unsigned long)st7701_transfers);
+}
+
+#if LCD_WINDOW_FB
+
+void lcd_add_window(uint16_t Xstart, uint16_t Xend, uint16_t Ystart, uint16_t Yend, uint8_t *color) {
+  // Panel coordinates, inclusive; only the part inside the window is stored
+  int x0 = Xstart < LCD_WINDOW_X ? LCD_WINDOW_X : Xstart;
+  int x1 = Xend >= LCD_WINDOW_X + LCD_WINDOW_WIDTH ? LCD_WINDOW_X + LCD_WINDOW_WIDTH - 1 : Xend;
+  int y0 = Ystart < LCD_WINDOW_Y ? LCD_WINDOW_Y : Ystart;
+  int y1 = Yend >= LCD_WINDOW_Y + LCD_WINDOW_HEIGHT ? LCD_WINDOW_Y + LCD_WINDOW_HEIGHT - 1 : Yend;
+  if (x0 > x1 || y0 > y1 || window_fbs[0] == NULL) return;
+
+  size_t src_stride = (size_t)(Xend - Xstart + 1) * 2;
+  const uint8_t *src = color + (size_t)(y0 - Ystart) * src_stride + (x0 - Xstart) * 2;
+  uint16_t *dst = window_fbs[0] + (size_t)(y0 - LCD_WINDOW_Y) * LCD_WINDOW_WIDTH + (x0 - LCD_WINDOW_X);
+  for (int y = y0; y <= y1; y++) {
+    memcpy(dst, src, (x1 - x0 + 1) * 2);
+    src += src_stride;
+    dst += LCD_WINDOW_WIDTH;
+  }
+}
+
+bool lcd_get_window_buffers(void **win0, void **win1, uint32_t *stride, uint32_t *rows) {
+  if (window_fbs[0] == NULL || window_fbs[1] == NULL) return false;
+  *win0 = window_fbs[0];
+  *win1 = window_fbs[1];
+  *stride = LCD_WINDOW_WIDTH * 2;
+  *rows = LCD_WINDOW_HEIGHT;
+  return true;
+}
+
+void lcd_swap_window_buffer(void *win) {
+  front_fb = (uint16_t *)win; // Latched by the fill at the start of the next frame
+  // A frame that ended around the store may still have latched the old buffer,
+  // so only a frame finishing after this point proves it is free
+  xSemaphoreTake(frame_done_sem, 0);
+  xSemaphoreTake(frame_done_sem, pdMS_TO_TICKS(200));
+}
+
+#if LCD_BOUNCE_STATS
+void lcd_print_bounce_stats(uint32_t window_ms) {
+  static uint32_t last_fills = 0, last_late = 0, last_busy = 0;
+  uint32_t fills = bounce_fills, late = bounce_late, busy = bounce_busy_cycles;
+  uint32_t max_cycles = bounce_max_cycles;
+  bounce_max_cycles = 0;
+  uint32_t n = fills - last_fills;
+  uint32_t tpu = esp_rom_get_cpu_ticks_per_us();
+  printf("LCD: %lu bounce fills/%lu s, %lu us avg, %lu us max of %lu us, %lu late (%s)\n",
+         (unsigned long)n, (unsigned long)(window_ms / 1000),
+         (unsigned long)(n ? (busy - last_busy) / n / tpu : 0), (unsigned long)(max_cycles / tpu),
+         (unsigned long)(LCD_BOUNCE_PERIOD_NS / 1000), (unsigned long)(late - last_late),
+         LCD_BOUNCE_SPAN_ONLY ? "span only" : "full lines");
+  last_fills = fills;
+  last_late = late;
+  last_busy = busy;
 }
+#endif
+
+#else
 
 void lcd_add_window(uint16_t Xstart, uint16_t Xend, uint16_t Ystart, uint16_t Yend, uint8_t *color) {
   Xend = Xend + 1;
@@ -398,6 +430,53 @@ void lcd_add_window(uint16_t Xstart, uint16_t Xend, uint16_t Ystart, uint16_t Ye
   esp_lcd_panel_draw_bitmap(panel_handle, Xstart, Ystart, Xend, Yend, color);
 }
 
+// The window inside a full panel framebuffer starts at this byte offset and
+// steps by the panel's row stride; lv_draw_buf wants stride * rows to fit,
+// which costs the last panel row
+#define PANEL_FB_STRIDE     (ESP_PANEL_LCD_WIDTH * 2)
+#define PANEL_FB_BYTES      (ESP_PANEL_LCD_WIDTH * ESP_PANEL_LCD_HEIGHT * 2)
+#define PANEL_FB_WINDOW_OFS (LCD_WINDOW_Y * PANEL_FB_STRIDE + LCD_WINDOW_X * 2)
+
+// With bounce buffers the framebuffer is read ahead of the scan-out, so "done
+// with this buffer" is the last bounce fill of the frame rather than vsync
+static bool IRAM_ATTR frame_done_cb(esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx) {
+  BaseType_t woken = pdFALSE;
+  xSemaphoreGiveFromISR((SemaphoreHandle_t)user_ctx, &woken);
+  return woken == pdTRUE;
+}
+
+bool lcd_get_window_buffers(void **win0, void **win1, uint32_t *stride, uint32_t *rows) {
+  void *fb0, *fb1;
+  if (esp_lcd_rgb_panel_get_frame_buffer(panel_handle, 2, &fb0, &fb1) != ESP_OK) return false;
+  if (frame_done_sem == NULL) {
+    frame_done_sem = xSemaphoreCreateBinary();
+    esp_lcd_rgb_panel_event_callbacks_t cbs = {};
+#if ESP_PANEL_LCD_RGB_BOUNCE_BUF_SIZE > 0
+    cbs.on_bounce_frame_finish = frame_done_cb;
+#else
+    cbs.on_vsync = frame_done_cb;
+#endif
+    esp_lcd_rgb_panel_register_event_callbacks(panel_handle, &cbs, frame_done_sem);
+  }
+  *win0 = (uint8_t *)fb0 + PANEL_FB_WINDOW_OFS;
+  *win1 = (uint8_t *)fb1 + PANEL_FB_WINDOW_OFS;
+  *stride = PANEL_FB_STRIDE;
+  *rows = (PANEL_FB_BYTES - PANEL_FB_WINDOW_OFS) / PANEL_FB_STRIDE;
+  return true;
+}
+
+void lcd_swap_window_buffer(void *win) {
+  // The framebuffer is one of the panel's own, so this only selects it (no copy)
+  esp_lcd_panel_draw_bitmap(panel_handle, 0, 0, ESP_PANEL_LCD_WIDTH, ESP_PANEL_LCD_HEIGHT,
+                            (uint8_t *)win - PANEL_FB_WINDOW_OFS);
+  // A frame that ended around the call may still have latched the old buffer,
+  // so only a frame finishing after this point proves it is free
+  xSemaphoreTake(frame_done_sem, 0);
+  xSemaphoreTake(frame_done_sem, pdMS_TO_TICKS(200));
+}
+
+#endif
+
 void backlight_init() {
   ledcAttach(LCD_BACKLIGHT_PIN, frequency, resolution);  
 }
@@ -82,12 +82,56 @@
 
 #define EXAMPLE_ENABLE_PRINT_LCD_FPS            (0)
 
+// ST7701 register setup (st7701_init_cmds in Display_ST7701.cpp): 1 = the
+// 9-bit words are packed into transfers of up to ST7701_BATCH_BYTES, sent by
+// polling; 0 = one interrupt-driven transfer per word, for comparison. The
+// boot report gives the setup time either way.
+#define ST7701_INIT_BATCHED       1
+#define ST7701_BATCH_BYTES        64
+
+// The gauge only uses a 240 px wide window of the 960x960 panel
+#define LCD_WINDOW_X              632   // ((960 - 120 pixel offset) - (240 display size))
+#define LCD_WINDOW_Y              26
+#define LCD_WINDOW_WIDTH          240
+#define LCD_WINDOW_HEIGHT         (ESP_PANEL_LCD_HEIGHT - LCD_WINDOW_Y)  // Rows on the panel
+// 1 = the panel has no framebuffer: only the window is stored in PSRAM
+// (450 KB per buffer instead of 1.8 MB) and the bounce-buffer fill draws the
+// rest black. 0 = two full panel framebuffers, as esp_lcd allocates them.
+#define LCD_WINDOW_FB             1
+// With LCD_WINDOW_FB: 1 = the fill only writes the 240 px span of each line
+// (borders are cleared once per bounce buffer); 0 = it rewrites whole lines
+#define LCD_BOUNCE_SPAN_ONLY      1
+// Bounce fill timing and late fills (lines the panel scanned out before they
+// were written), printed with the CAN stats. Costs two cycle-counter reads per fill.
+#define LCD_BOUNCE_STATS          0
+// Scan-out time of one bounce buffer: its rows including horizontal blanking
+#define LCD_BOUNCE_PERIOD_NS      ((uint64_t)ESP_PANEL_LCD_RGB_BOUNCE_BUF_SIZE / ESP_PANEL_LCD_WIDTH * \
+                                   (ESP_PANEL_LCD_WIDTH + ESP_PANEL_LCD_RGB_TIMING_HPW + ESP_PANEL_LCD_RGB_TIMING_HBP + \
+                                    ESP_PANEL_LCD_RGB_TIMING_HFP) * 1000000000ull / ESP_PANEL_LCD_RGB_TIMING_FREQ_HZ)
+#if LCD_WINDOW_FB && (ESP_PANEL_LCD_RGB_BOUNCE_BUF_SIZE == 0 || ESP_PANEL_LCD_RGB_BOUNCE_BUF_SIZE % ESP_PANEL_LCD_WIDTH)
+#error "LCD_WINDOW_FB fills whole rows from the bounce buffer callback"
+#endif
+
 extern uint8_t LCD_Backlight;
 extern esp_lcd_panel_handle_t panel_handle;
 void st7701_init();
 
 void lcd_init();
+// Called by the flush once a frame is complete; the first call prints time
+// from boot to panel ready and to that frame
+void lcd_first_frame_flushed(void);
 void lcd_add_window(uint16_t Xstart, uint16_t Xend, uint16_t Ystart, uint16_t Yend, uint8_t *color);
+// Direct rendering (LVGL_RENDER_DIRECT / _FULL): the window inside each of
+// the two scan-out buffers, with its row stride in bytes and usable rows
+bool lcd_get_window_buffers(void **win0, void **win1, uint32_t *stride, uint32_t *rows);
+// Scan out win (one of the above) from the next frame on; returns once the panel
+// has stopped reading the other one, so it can be drawn into
+void lcd_swap_window_buffer(void *win);
+#if LCD_WINDOW_FB && LCD_BOUNCE_STATS
+// Bounce fills since the last call: average / worst fill time against the
+// scan-out time of one buffer, and fills that finished too late
+void lcd_print_bounce_stats(uint32_t window_ms);
+#endif
 
 // backlight
 void backlight_init();
@@ -0,0 +1,78 @@
+#include "FixedFormat.h"
+
+// "00" "01" ... "99": two digits per lookup, one division by 100 per pair
+static const char digit_pairs[201] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+// ---- Text ----
+
+// Write the digits of v (< 10^10) ending just before end; returns the start
+static char *put_digits(char *end, uint32_t v) {
+  while (v >= 100) {
+    uint32_t pair = (v % 100) * 2;
+    v /= 100;
+    *--end = digit_pairs[pair + 1];
+    *--end = digit_pairs[pair];
+  }
+  if (v >= 10) {
+    *--end = digit_pairs[v * 2 + 1];
+    *--end = digit_pairs[v * 2];
+  } else {
+    *--end = (char)('0' + v);
+  }
+  return end;
+}
+
+// Copy [start, end) to buf right-aligned in width
+static int emit(char *buf, const char *start, const char *end, uint8_t width) {
+  int len = (int)(end - start);
+  int pad = width > len ? width - len : 0;
+  for (int i = 0; i < pad; i++) buf[i] = ' ';
+  for (int i = 0; i < len; i++) buf[pad + i] = start[i];
+  buf[pad + len] = '\0';
+  return pad + len;
+}
+
+int fx_format_int(char *buf, int32_t value, uint8_t width) {
+  char tmp[12];
+  char *end = tmp + sizeof(tmp);
+  uint32_t mag = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+  char *p = put_digits(end, mag);
+  if (value < 0) *--p = '-';
+  return emit(buf, p, end, width);
+}
+
+int fx_format_tenths(char *buf, int32_t tenths, uint8_t width) {
+  char tmp[14];
+  char *end = tmp + sizeof(tmp);
+  uint32_t mag = tenths < 0 ? 0u - (uint32_t)tenths : (uint32_t)tenths;
+  char *p = end;
+  *--p = (char)('0' + mag % 10);
+  *--p = '.';
+  p = put_digits(p, mag / 10);
+  if (tenths < 0) *--p = '-';
+  return emit(buf, p, end, width);
+}
+
+int fx_format_value(char *buf, FixedValue v) {
+  return v.decimals ? fx_format_tenths(buf, v.value, 5) : fx_format_int(buf, v.value, 4);
+}
+
+int fx_format_miles(char *buf, uint32_t hundredths) {
+  return fx_format_tenths(buf, (int32_t)((hundredths + 5) / 10), 0);
+}
+
+int fx_format_km(char *buf, uint32_t hundredths_of_mile) {
+  // 0.01 mi = 0.01609344 km = 0.1609344 tenths of a km
+  uint64_t tenths = ((uint64_t)hundredths_of_mile * 1609344 + 5000000) / 10000000;
+  return fx_format_tenths(buf, (int32_t)tenths, 0);
+}
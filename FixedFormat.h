@@ -0,0 +1,30 @@
+#pragma once
+#include <stdint.h>
+
+// ============================================================================
+// FIXED-POINT FORMATTING
+// ----------------------------------------------------------------------------
+// Integer-only text formatting through a two-digit LUT, so the display path
+// never touches newlib's float printf. A FixedValue carries the display value
+// as an integer in units of 10^-decimals (e.g. 147 with 1 decimal = "14.7");
+// the raw → FixedValue conversions are generated from the channel descriptors
+// in ChannelScale.h. tools/fixed_format_check compares every raw value against
+// the old float + sprintf path.
+// ============================================================================
+
+typedef struct {
+  int32_t value;     // Display value x 10^decimals
+  uint8_t decimals;  // 0 or 1
+} FixedValue;
+
+// ---- Text ----
+// Right-align in width characters (no padding if the text is longer); buf
+// needs width + 1 bytes, or 12 for values that may overflow width.
+// Returns the string length.
+int fx_format_int(char *buf, int32_t value, uint8_t width);
+int fx_format_tenths(char *buf, int32_t tenths, uint8_t width);
+// Gauge value labels: integers in 4 columns, one decimal in 5 (" 14.7")
+int fx_format_value(char *buf, FixedValue v);
+// Odometer/trip: hundredths of a mile → "%.1f" miles or km, rounded half up
+int fx_format_miles(char *buf, uint32_t hundredths);
+int fx_format_km(char *buf, uint32_t hundredths_of_mile);
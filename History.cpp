@@ -0,0 +1,230 @@
+#include "Arduino.h"
+#include "History.h"
+#include "TaskMonitor.h"
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <algorithm>
+
+typedef struct {
+  uint16_t base;                              // First sample, stored exactly
+  uint8_t  shift;                             // Deltas are scaled by 2^shift
+  int8_t   delta[HISTORY_BLOCK_SAMPLES - 1];  // Against the reconstructed previous sample
+} HistoryBlock;
+
+typedef struct {
+  HistoryBlock *blocks;                       // Ring of HISTORY_BLOCKS closed blocks (PSRAM)
+  uint16_t      open[HISTORY_BLOCK_SAMPLES];  // Block being filled, kept raw
+} HistoryColumn;
+
+#define HISTORY_SCRATCH_SAMPLES ((HISTORY_BLOCKS + 1) * HISTORY_BLOCK_SAMPLES) // Ring + open block
+
+static HistoryColumn columns[HIST_SIGNAL_COUNT];
+static uint16_t *scratch = NULL;      // Decoded window for queries (PSRAM)
+static uint32_t total_samples = 0;    // Samples recorded since boot (same for every column)
+static SemaphoreHandle_t history_mutex = NULL;
+
+// ---- Block codec ----
+
+static int32_t clamp_u16(int32_t v) {
+  return v < 0 ? 0 : (v > 0xFFFF ? 0xFFFF : v);
+}
+
+// Pick the smallest shift whose rounded deltas fit in int8. Each delta is taken
+// against the reconstructed sample so rounding errors never accumulate.
+static void encode_block(HistoryBlock *block, const uint16_t *raw) {
+  for (uint8_t shift = 0; shift <= 16; shift++) {
+    int32_t half = shift ? (1 << (shift - 1)) : 0;
+    int32_t prev = raw[0];
+    bool fits = true;
+    for (int i = 1; i < HISTORY_BLOCK_SAMPLES; i++) {
+      int32_t d = (int32_t)raw[i] - prev;
+      int32_t q = (d >= 0 ? d + half : d - half) / (1 << shift);
+      if (q > 127 || q < -127) {
+        fits = false;
+        break;
+      }
+      block->delta[i - 1] = (int8_t)q;
+      prev = clamp_u16(prev + q * (1 << shift));
+    }
+    if (fits) {
+      block->base = raw[0];
+      block->shift = shift;
+      return;
+    }
+  }
+}
+
+static void decode_block(const HistoryBlock *block, uint16_t *out) {
+  int32_t prev = block->base;
+  out[0] = (uint16_t)prev;
+  for (int i = 1; i < HISTORY_BLOCK_SAMPLES; i++) {
+    prev = clamp_u16(prev + block->delta[i - 1] * (1 << block->shift));
+    out[i] = (uint16_t)prev;
+  }
+}
+
+// ---- Ring access ----
+
+static uint32_t oldest_sample(void) {
+  uint32_t closed = total_samples / HISTORY_BLOCK_SAMPLES;
+  return closed > HISTORY_BLOCKS ? (closed - HISTORY_BLOCKS) * HISTORY_BLOCK_SAMPLES : 0;
+}
+
+// Decode samples [first, total_samples) of a column into scratch; returns count
+static uint32_t decode_window(HistorySignal signal, uint32_t seconds) {
+  uint32_t oldest = oldest_sample();
+  uint32_t wanted = seconds * HISTORY_SAMPLE_HZ;
+  uint32_t first = total_samples - oldest > wanted ? total_samples - wanted : oldest;
+  const HistoryColumn *col = &columns[signal];
+  uint32_t open_start = total_samples - total_samples % HISTORY_BLOCK_SAMPLES;
+
+  uint32_t n = 0;
+  uint16_t block_samples[HISTORY_BLOCK_SAMPLES];
+  uint32_t index = first;
+  while (index < open_start) {
+    uint32_t block = index / HISTORY_BLOCK_SAMPLES;
+    decode_block(&col->blocks[block % HISTORY_BLOCKS], block_samples);
+    uint32_t end = std::min(open_start, (block + 1) * HISTORY_BLOCK_SAMPLES);
+    for (; index < end; index++) scratch[n++] = block_samples[index % HISTORY_BLOCK_SAMPLES];
+  }
+  for (; index < total_samples; index++) scratch[n++] = col->open[index % HISTORY_BLOCK_SAMPLES];
+  return n;
+}
+
+// Undo a partial history_init(); scratch == NULL marks history as disabled
+static void history_free(void) {
+  for (int s = 0; s < HIST_SIGNAL_COUNT; s++) {
+    heap_caps_free(columns[s].blocks);
+    columns[s].blocks = NULL;
+  }
+  heap_caps_free(scratch);
+  scratch = NULL;
+  if (history_mutex != NULL) vSemaphoreDelete(history_mutex);
+  history_mutex = NULL;
+}
+
+// ---- Public API ----
+
+bool history_init(void) {
+  size_t ring_bytes = sizeof(HistoryBlock) * HISTORY_BLOCKS;
+  for (int s = 0; s < HIST_SIGNAL_COUNT; s++) {
+    columns[s].blocks = (HistoryBlock *)heap_caps_malloc(ring_bytes, MALLOC_CAP_SPIRAM);
+    if (columns[s].blocks == NULL) {
+      history_free();
+      return false;
+    }
+  }
+  scratch = (uint16_t *)heap_caps_malloc(sizeof(uint16_t) * HISTORY_SCRATCH_SAMPLES, MALLOC_CAP_SPIRAM);
+  history_mutex = xSemaphoreCreateMutex();
+  if (scratch == NULL || history_mutex == NULL) {
+    history_free();
+    return false;
+  }
+
+  Serial.printf("History: %d signals x %d min at %d Hz, %u bytes PSRAM\n",
+                HIST_SIGNAL_COUNT, HISTORY_MINUTES, HISTORY_SAMPLE_HZ,
+                (unsigned)(ring_bytes * HIST_SIGNAL_COUNT + sizeof(uint16_t) * HISTORY_SCRATCH_SAMPLES));
+  return true;
+}
+
+void history_record(const DisplayData *data) {
+  const uint16_t values[HIST_SIGNAL_COUNT] = {
+    data->coolant_temp_raw, data->oil_press_raw,
+    data->lambda_bank1_raw, data->lambda_bank2_raw,
+    data->map_raw, data->speed_raw,
+    data->ls_fuel_press_raw, data->inj_duty_cycle_raw,
+    data->ethanol_pct_raw, data->battery_volts_raw,
+  };
+  if (scratch == NULL) return;  // history_init() failed
+
+  xSemaphoreTake(history_mutex, portMAX_DELAY);
+  uint32_t slot = total_samples % HISTORY_BLOCK_SAMPLES;
+  for (int s = 0; s < HIST_SIGNAL_COUNT; s++) {
+    columns[s].open[slot] = values[s];
+  }
+  if (slot == HISTORY_BLOCK_SAMPLES - 1) {
+    uint32_t block = (total_samples / HISTORY_BLOCK_SAMPLES) % HISTORY_BLOCKS;
+    for (int s = 0; s < HIST_SIGNAL_COUNT; s++) {
+      encode_block(&columns[s].blocks[block], columns[s].open);
+    }
+  }
+  total_samples++;
+  xSemaphoreGive(history_mutex);
+}
+
+uint32_t history_seconds_available(void) {
+  return (total_samples - oldest_sample()) / HISTORY_SAMPLE_HZ;
+}
+
+bool history_stats(HistorySignal signal, uint32_t seconds, HistoryStats *out) {
+  if (scratch == NULL || signal >= HIST_SIGNAL_COUNT) return false;
+  xSemaphoreTake(history_mutex, portMAX_DELAY);
+  uint32_t n = decode_window(signal, seconds);
+  uint32_t sum = 0;
+  uint16_t lo = 0xFFFF, hi = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    sum += scratch[i];
+    lo = std::min(lo, scratch[i]);
+    hi = std::max(hi, scratch[i]);
+  }
+  xSemaphoreGive(history_mutex);
+
+  if (n == 0) return false;
+  out->samples = n;
+  out->min = lo;
+  out->max = hi;
+  out->avg = (float)sum / n;
+  return true;
+}
+
+bool history_percentile(HistorySignal signal, uint32_t seconds, uint8_t pct, uint16_t *out) {
+  if (scratch == NULL || signal >= HIST_SIGNAL_COUNT || pct > 100) return false;
+  xSemaphoreTake(history_mutex, portMAX_DELAY);
+  uint32_t n = decode_window(signal, seconds);
+  if (n > 0) {
+    uint32_t k = (uint32_t)(((uint64_t)(n - 1) * pct + 50) / 100);
+    std::nth_element(scratch, scratch + k, scratch + n);
+    *out = scratch[k];
+  }
+  xSemaphoreGive(history_mutex);
+  return n > 0;
+}
+
+uint32_t history_read(HistorySignal signal, uint32_t seconds, uint16_t *out, uint32_t max_points) {
+  if (scratch == NULL || signal >= HIST_SIGNAL_COUNT || max_points == 0) return 0;
+  xSemaphoreTake(history_mutex, portMAX_DELAY);
+  uint32_t n = decode_window(signal, seconds);
+  uint32_t points = std::min(n, max_points);
+  for (uint32_t p = 0; p < points; p++) {
+    // Bucket p covers samples [p*n/points, (p+1)*n/points)
+    uint32_t start = (uint32_t)((uint64_t)p * n / points);
+    uint32_t end = (uint32_t)((uint64_t)(p + 1) * n / points);
+    uint32_t sum = 0;
+    for (uint32_t i = start; i < end; i++) sum += scratch[i];
+    out[p] = (uint16_t)((sum + (end - start) / 2) / (end - start));
+  }
+  xSemaphoreGive(history_mutex);
+  return points;
+}
+
+void history_task(void *arg) {
+  if (scratch == NULL) {
+    Serial.println("History: not initialised, sampler not started");
+    task_monitor_exit();
+    vTaskDelete(NULL);
+    return;
+  }
+
+  static DisplayData data = {};
+  static MaxValues max_data = {};
+  TickType_t last_wake = xTaskGetTickCount();
+  while (1) {
+    vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(1000 / HISTORY_SAMPLE_HZ));
+
+    // Keep the sample clock steady: if RX was mid-write, repeat the last sample
+    can_state_snapshot(&data, &max_data);
+    can_apply_timeouts(&data, millis());
+    history_record(&data);
+  }
+}
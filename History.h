@@ -0,0 +1,68 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "CAN_Decoder.h"
+
+// ============================================================================
+// SIGNAL HISTORY
+// ----------------------------------------------------------------------------
+// Fixed-memory columnar history of the decoded channels: one ring per signal
+// in PSRAM, all sampled together at HISTORY_SAMPLE_HZ so they share one time
+// axis. Samples are stored in blocks of HISTORY_BLOCK_SAMPLES as a uint16 base
+// plus int8 deltas (~1.06 bytes/sample instead of 2). A block whose deltas do
+// not fit in int8 stores them shifted right, so only fast transients lose the
+// low bits (max error 2^(shift-1) raw units). The open block is kept raw.
+// All memory is allocated once in history_init(); recording never allocates.
+// Values are raw, in the units of DisplayData.
+// ============================================================================
+
+#define HISTORY_SAMPLE_HZ     10   // Samples per second per signal
+#define HISTORY_MINUTES       10   // Minutes of history kept
+#define HISTORY_BLOCK_SAMPLES 32   // Samples per delta block (1 base + 31 deltas)
+
+#define HISTORY_CAPACITY (HISTORY_SAMPLE_HZ * 60 * HISTORY_MINUTES)
+#define HISTORY_BLOCKS   ((HISTORY_CAPACITY + HISTORY_BLOCK_SAMPLES - 1) / HISTORY_BLOCK_SAMPLES)
+
+typedef enum {
+  HIST_COOLANT,      // coolant_temp_raw
+  HIST_OIL_PRESS,    // oil_press_raw
+  HIST_LAMBDA1,      // lambda_bank1_raw
+  HIST_LAMBDA2,      // lambda_bank2_raw
+  HIST_MAP,          // map_raw
+  HIST_SPEED,        // speed_raw
+  HIST_FUEL_PRESS,   // ls_fuel_press_raw
+  HIST_INJ_DUTY,     // inj_duty_cycle_raw
+  HIST_ETHANOL,      // ethanol_pct_raw
+  HIST_BATTERY,      // battery_volts_raw
+  HIST_SIGNAL_COUNT
+} HistorySignal;
+
+typedef struct {
+  uint32_t samples;
+  uint16_t min;
+  uint16_t max;
+  float    avg;
+} HistoryStats;
+
+// Allocate the rings and query scratch in PSRAM. Returns false if out of
+// memory; nothing stays allocated and recording and queries do nothing.
+bool history_init(void);
+
+// Append one sample of every signal (called by history_task)
+void history_record(const DisplayData *data);
+
+// Seconds of history currently held (grows to HISTORY_MINUTES * 60)
+uint32_t history_seconds_available(void);
+
+// Min/max/average of a signal over the last `seconds`. False if no samples.
+bool history_stats(HistorySignal signal, uint32_t seconds, HistoryStats *out);
+
+// pct-th percentile (0-100) of a signal over the last `seconds`
+bool history_percentile(HistorySignal signal, uint32_t seconds, uint8_t pct, uint16_t *out);
+
+// Last `seconds` of a signal for graphing, oldest first, averaged down to at
+// most max_points values. Returns the number of points written.
+uint32_t history_read(HistorySignal signal, uint32_t seconds, uint16_t *out, uint32_t max_points);
+
+// Samples the CAN snapshot at HISTORY_SAMPLE_HZ
+void history_task(void *arg);
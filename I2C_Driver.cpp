@@ -1,59 +1,106 @@
 #include "I2C_Driver.h"
+#include "BootProfile.h"
 
-bool wait_for_expander(uint8_t addr, uint16_t timeout_ms = 500) {
+I2cResult (*i2c_transfer_hook)(I2cTransfer *transfer) = NULL;
+
+bool wait_for_expander(uint8_t addr, uint16_t timeout_ms) {
   uint32_t start = millis();
   while (millis() - start < timeout_ms) {
-    Wire.beginTransmission(addr);
-    if (Wire.endTransmission() == 0) return true;
+    if (i2c_scan_address(addr)) return true;
     delay(10);
   }
   return false;
 }
 
+// Wire endTransmission(): 2 = address NACK, 3 = data NACK, 5 = timeout
+static I2cResult result_of(uint8_t error) {
+  switch (error) {
+    case 0:  return I2C_RESULT_OK;
+    case 2:
+    case 3:  return I2C_RESULT_NACK;
+    case 5:  return I2C_RESULT_TIMEOUT;
+    default: return I2C_RESULT_ERROR;
+  }
+}
+
+I2cResult i2c_transfer(I2cTransfer *t, uint16_t timeout_ms) {
+  Wire.setTimeOut(timeout_ms);
+  Wire.beginTransmission(t->addr);
+  if (t->op == I2C_OP_PROBE) return result_of(Wire.endTransmission(true));
+
+  Wire.write(t->reg);
+  if (t->op == I2C_OP_WRITE) {
+    for (uint8_t i = 0; i < t->length; i++) {
+      Wire.write(t->data[i]);
+    }
+    return result_of(Wire.endTransmission(true));
+  }
+
+  I2cResult result = result_of(Wire.endTransmission(true));
+  if (result != I2C_RESULT_OK) return result;
+  if (Wire.requestFrom(t->addr, t->length) != t->length) return I2C_RESULT_NACK;
+  for (uint8_t i = 0; i < t->length; i++) {
+    t->data[i] = Wire.read();
+  }
+  return I2C_RESULT_OK;
+}
+
+static I2cResult run(I2cTransfer *t) {
+  return i2c_transfer_hook != NULL ? i2c_transfer_hook(t) : i2c_transfer(t, I2C_DEFAULT_TIMEOUT_MS);
+}
+
 bool i2c_scan_address(uint8_t address) {
-  Wire.beginTransmission(address);
-  uint8_t error = Wire.endTransmission();
-  return error == 0;
+  I2cTransfer t = {};
+  t.op = I2C_OP_PROBE;
+  t.addr = address;
+  return run(&t) == I2C_RESULT_OK;
 }
 
 void i2c_init(void) {
   Wire.begin(I2C_SDA_PIN, I2C_SCL_PIN);
-
-  delay(300);
+#if !FAST_BOOT
+  delay(300);  // With FAST_BOOT the expander scan polls until it answers instead
+#endif
 }
 
 bool i2c_read(uint8_t driver_addr, uint8_t reg_addr, uint8_t *reg_data, uint32_t length) {
-  Wire.beginTransmission(driver_addr);
-  Wire.write(reg_addr); 
-  
-  if ( Wire.endTransmission(true)){
-    printf("The I2C transmission fails. - I2C Read\r\n");
+  if (length > I2C_MAX_DATA) {
+    printf("I2C read of %lu bytes, max %d\r\n", (unsigned long)length, I2C_MAX_DATA);
     return I2C_FAIL;
   }
-
-  if (Wire.requestFrom(driver_addr, length) != length) {
-    printf("I2C read length mismatch\r\n");
+  I2cTransfer t = {};
+  t.op = I2C_OP_READ;
+  t.addr = driver_addr;
+  t.reg = reg_addr;
+  t.length = (uint8_t)length;
+  if (run(&t) != I2C_RESULT_OK) {
+    printf("The I2C transmission fails. - I2C Read\r\n");
     return I2C_FAIL;
   }
-
-  for (int i = 0; i < length; i++) {
-    *reg_data++ = Wire.read();
+  for (uint32_t i = 0; i < length; i++) {
+    *reg_data++ = t.data[i];
   }
 
   return I2C_OK;
 }
 
 bool i2c_write(uint8_t driver_addr, uint8_t reg_addr, const uint8_t *reg_data, uint32_t length) {
-  Wire.beginTransmission(driver_addr);
-  Wire.write(reg_addr);
-
-  for (int i = 0; i < length; i++) {
-    Wire.write(*reg_data++);
+  if (length > I2C_MAX_DATA) {
+    printf("I2C write of %lu bytes, max %d\r\n", (unsigned long)length, I2C_MAX_DATA);
+    return I2C_FAIL;
+  }
+  I2cTransfer t = {};
+  t.op = I2C_OP_WRITE;
+  t.addr = driver_addr;
+  t.reg = reg_addr;
+  t.length = (uint8_t)length;
+  for (uint32_t i = 0; i < length; i++) {
+    t.data[i] = *reg_data++;
   }
 
-  if ( Wire.endTransmission(true)) {
+  if (run(&t) != I2C_RESULT_OK) {
     printf("The I2C transmission fails. - I2C Write\r\n");
     return I2C_FAIL;
   }
   return I2C_OK;
-}
\ No newline at end of file
+}
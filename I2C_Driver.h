@@ -1,5 +1,5 @@
 #pragma once
-#include <Wire.h> 
+#include <Wire.h>
 
 #define I2C_SCL_PIN       7
 #define I2C_SDA_PIN       15
@@ -7,8 +7,43 @@
 #define I2C_OK            true
 #define I2C_FAIL          false
 
+#define I2C_MAX_DATA            16   // Longest register read/write in one transfer
+#define I2C_DEFAULT_TIMEOUT_MS  20   // Wire timeout for devices without a policy (I2C_Service.h)
+
+// One register transfer. Executed on the calling task by i2c_transfer(), or
+// queued to the I2C service task (I2C_Service.h). A read returns its bytes in data.
+typedef enum : uint8_t {
+  I2C_OP_WRITE,   // reg, then length bytes of data
+  I2C_OP_READ,    // reg, then read length bytes into data
+  I2C_OP_PROBE,   // Address only: is anything there
+} I2cOp;
+
+typedef enum : uint8_t {
+  I2C_RESULT_OK,
+  I2C_RESULT_NACK,
+  I2C_RESULT_TIMEOUT,
+  I2C_RESULT_ERROR,
+} I2cResult;
+
+typedef struct {
+  I2cOp op;
+  uint8_t addr;
+  uint8_t reg;
+  uint8_t length;
+  uint8_t data[I2C_MAX_DATA];
+} I2cTransfer;
+
 bool i2c_scan_address(uint8_t address);
+// Probe every 10 ms until the device answers; false after timeout_ms
+bool wait_for_expander(uint8_t addr, uint16_t timeout_ms = 500);
 void i2c_init(void);
 
+// Blocking register access. While the I2C service runs these queue to it and
+// wait, so every transfer is made by one task; keep them off the UI task.
 bool i2c_read(uint8_t driver_addr, uint8_t reg_addr, uint8_t *reg_data, uint32_t length);
-bool i2c_write(uint8_t driver_addr, uint8_t reg_addr, const uint8_t *reg_data, uint32_t length);
\ No newline at end of file
+bool i2c_write(uint8_t driver_addr, uint8_t reg_addr, const uint8_t *reg_data, uint32_t length);
+
+// Run one transfer on Wire from the calling task
+I2cResult i2c_transfer(I2cTransfer *transfer, uint16_t timeout_ms);
+// Set by the I2C service while it runs: the blocking calls above go through it
+extern I2cResult (*i2c_transfer_hook)(I2cTransfer *transfer);
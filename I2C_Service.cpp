@@ -0,0 +1,206 @@
+#include "I2C_Service.h"
+#include "TaskMonitor.h"
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <esp_timer.h>
+#include <string.h>
+
+typedef struct {
+  I2cTransfer transfer;
+  I2cDoneCallback done;
+  void *ctx;
+  int64_t queued_us;
+} I2cRequest;
+
+typedef struct {
+  uint8_t addr;               // 0 = unused
+  uint16_t timeout_ms;
+  uint8_t retries;
+} I2cDevicePolicy;
+
+// Counters for the current stats window, written by the service task (and
+// rejected by submitters). Read and reset from the stats task without a lock:
+// a count racing the reset may be lost, which a report can live with.
+typedef struct {
+  uint32_t transfers;         // Completed requests
+  uint32_t failed;            // Requests that failed after all retries
+  uint32_t retries;
+  uint32_t nacks;             // Per attempt
+  uint32_t timeouts;
+  uint32_t errors;
+  uint32_t rejected;          // i2c_submit() on a full queue (blocking calls wait instead)
+  uint32_t busy_us;           // Time on the bus
+  uint32_t wait_us_max;       // Longest submit-to-start
+  uint32_t max_depth;
+} I2cStats;
+
+static QueueHandle_t request_queue = NULL;
+static TaskHandle_t service_task = NULL;
+static I2cDevicePolicy policies[I2C_DEVICE_POLICIES];
+static I2cStats stats;
+
+// Blocking callers wait here, one at a time
+static SemaphoreHandle_t sync_mutex = NULL;
+static SemaphoreHandle_t sync_done = NULL;
+static I2cResult sync_result;
+
+static const I2cDevicePolicy *policy_for(uint8_t addr) {
+  static const I2cDevicePolicy fallback = { 0, I2C_DEFAULT_TIMEOUT_MS, I2C_DEFAULT_RETRIES };
+  for (uint8_t i = 0; i < I2C_DEVICE_POLICIES; i++) {
+    if (policies[i].addr == addr) return &policies[i];
+  }
+  return &fallback;
+}
+
+static void count_failure(I2cResult result) {
+  if (result == I2C_RESULT_NACK) stats.nacks++;
+  else if (result == I2C_RESULT_TIMEOUT) stats.timeouts++;
+  else stats.errors++;
+}
+
+// Run a request with its device's policy; a failed attempt is retried after a
+// millisecond (a busy device usually NACKs only briefly)
+static I2cResult execute(I2cTransfer *t) {
+  const I2cDevicePolicy *policy = policy_for(t->addr);
+  uint8_t attempts = t->op == I2C_OP_PROBE ? 1 : 1 + policy->retries;
+  I2cTransfer request = *t;
+  I2cResult result = I2C_RESULT_ERROR;
+  for (uint8_t attempt = 0; attempt < attempts; attempt++) {
+    if (attempt > 0) {
+      stats.retries++;
+      vTaskDelay(pdMS_TO_TICKS(1));
+      *t = request;
+    }
+    int64_t t0 = esp_timer_get_time();
+    result = i2c_transfer(t, policy->timeout_ms);
+    stats.busy_us += (uint32_t)(esp_timer_get_time() - t0);
+    if (result == I2C_RESULT_OK) break;
+    if (t->op != I2C_OP_PROBE) count_failure(result);  // A probe NACK is an answer
+  }
+  return result;
+}
+
+static void i2c_service_task(void *arg) {
+  I2cRequest request;
+  while (1) {
+    if (xQueueReceive(request_queue, &request, portMAX_DELAY) != pdTRUE) continue;
+    uint32_t depth = uxQueueMessagesWaiting(request_queue) + 1;
+    if (depth > stats.max_depth) stats.max_depth = depth;
+    uint32_t wait_us = (uint32_t)(esp_timer_get_time() - request.queued_us);
+    if (wait_us > stats.wait_us_max) stats.wait_us_max = wait_us;
+
+    I2cResult result = execute(&request.transfer);
+    stats.transfers++;
+    if (result != I2C_RESULT_OK && request.transfer.op != I2C_OP_PROBE) stats.failed++;
+    if (request.done != NULL) request.done(&request.transfer, result, request.ctx);
+  }
+}
+
+static void sync_done_cb(const I2cTransfer *transfer, I2cResult result, void *ctx) {
+  *(I2cTransfer *)ctx = *transfer;
+  sync_result = result;
+  xSemaphoreGive(sync_done);
+}
+
+// Queue a request, waiting up to wait ticks for room
+static bool enqueue(const I2cTransfer *transfer, I2cDoneCallback done, void *ctx, TickType_t wait) {
+  I2cRequest request = { *transfer, done, ctx, esp_timer_get_time() };
+  return xQueueSend(request_queue, &request, wait) == pdTRUE;
+}
+
+// i2c_transfer_hook: the blocking API queues and waits for the result. The
+// service always completes a request (each attempt is bounded by the Wire
+// timeout), so neither the wait for queue room nor the wait for the result
+// needs a timeout of its own. A full queue only delays a blocking call.
+static I2cResult transfer_and_wait(I2cTransfer *t) {
+  if (xTaskGetCurrentTaskHandle() == service_task) {
+    return execute(t);  // From a completion callback: already on the bus owner
+  }
+  xSemaphoreTake(sync_mutex, portMAX_DELAY);
+  I2cResult result;
+  if (enqueue(t, sync_done_cb, t, portMAX_DELAY)) {
+    xSemaphoreTake(sync_done, portMAX_DELAY);
+    result = sync_result;
+  } else {
+    result = I2C_RESULT_ERROR;
+  }
+  xSemaphoreGive(sync_mutex);
+  return result;
+}
+
+// Undo a failed start: request_queue == NULL makes i2c_submit() refuse
+static void service_free(void) {
+  if (request_queue != NULL) vQueueDelete(request_queue);
+  if (sync_mutex != NULL) vSemaphoreDelete(sync_mutex);
+  if (sync_done != NULL) vSemaphoreDelete(sync_done);
+  request_queue = NULL;
+  sync_mutex = NULL;
+  sync_done = NULL;
+}
+
+bool i2c_service_start(void) {
+  request_queue = xQueueCreate(I2C_QUEUE_LEN, sizeof(I2cRequest));
+  sync_mutex = xSemaphoreCreateMutex();
+  sync_done = xSemaphoreCreateBinary();
+  if (request_queue == NULL || sync_mutex == NULL || sync_done == NULL) {
+    Serial.println("I2C: out of memory, transfers stay on the calling task");
+    service_free();
+    return false;
+  }
+  if (!task_start(i2c_service_task, "I2C", 3072, TASK_PRIO_I2C, TASK_CORE_BG, &service_task)) {
+    Serial.println("I2C: service task not started, transfers stay on the calling task");
+    service_free();
+    return false;
+  }
+  i2c_transfer_hook = transfer_and_wait;
+  return true;
+}
+
+bool i2c_service_running(void) {
+  return request_queue != NULL;
+}
+
+void i2c_set_device_policy(uint8_t addr, uint16_t timeout_ms, uint8_t retries) {
+  I2cDevicePolicy *slot = NULL;
+  for (uint8_t i = 0; i < I2C_DEVICE_POLICIES && slot == NULL; i++) {
+    if (policies[i].addr == addr || policies[i].addr == 0) slot = &policies[i];
+  }
+  if (slot == NULL) {
+    Serial.printf("I2C: no policy slot for 0x%02X, raise I2C_DEVICE_POLICIES\n", addr);
+    return;
+  }
+  slot->timeout_ms = timeout_ms;
+  slot->retries = retries;
+  slot->addr = addr;
+}
+
+bool i2c_submit(const I2cTransfer *transfer, I2cDoneCallback done, void *ctx) {
+  if (request_queue == NULL) return false;
+  if (!enqueue(transfer, done, ctx, 0)) {
+    stats.rejected++;
+    return false;
+  }
+  return true;
+}
+
+bool i2c_submit_from_isr(const I2cTransfer *transfer, I2cDoneCallback done, void *ctx, BaseType_t *woken) {
+  if (request_queue == NULL) return false;
+  I2cRequest request = { *transfer, done, ctx, esp_timer_get_time() };
+  if (xQueueSendFromISR(request_queue, &request, woken) != pdTRUE) {
+    stats.rejected++;
+    return false;
+  }
+  return true;
+}
+
+void i2c_print_stats(uint32_t window_ms) {
+  I2cStats st = stats;
+  memset(&stats, 0, sizeof(stats));
+  Serial.printf("I2C: %lu transfers, bus busy %lu ms (%.1f%%), wait max %lu us, queue max %lu, %lu rejected\n",
+                st.transfers, st.busy_us / 1000, window_ms ? st.busy_us / (10.0f * window_ms) : 0.0f,
+                st.wait_us_max, st.max_depth, st.rejected);
+  if (st.failed || st.retries) {
+    Serial.printf("I2C: %lu failed, %lu retries (%lu NACK, %lu timeout, %lu other)\n",
+                  st.failed, st.retries, st.nacks, st.timeouts, st.errors);
+  }
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include "I2C_Driver.h"
+
+// ============================================================================
+// I2C SERVICE
+// ----------------------------------------------------------------------------
+// One task owns Wire. Callers queue transfers with i2c_submit() and return at
+// once; the service runs them in order with the device's timeout and retry
+// policy and reports each through a completion callback, called on the
+// service task (keep it short; it may submit the next transfer). The blocking
+// i2c_read / i2c_write / i2c_scan_address queue here too and wait (for room
+// as well, if the queue is full), so the bus is never driven from two tasks. Until i2c_service_start() they run on the
+// calling task.
+// ============================================================================
+
+#define I2C_QUEUE_LEN          8
+#define I2C_DEVICE_POLICIES    4     // Devices with their own timeout / retries
+#define I2C_DEFAULT_RETRIES    1     // Extra attempts after a NACK, timeout or error
+#define I2C_STATS              1     // 1 = print bus stats with the CAN RX stats
+
+// result is the last attempt's; transfer->data holds what a read returned
+typedef void (*I2cDoneCallback)(const I2cTransfer *transfer, I2cResult result, void *ctx);
+
+// False if the queue or task could not be created; the blocking calls then
+// stay on the calling task and i2c_submit() refuses every transfer
+bool i2c_service_start(void);
+bool i2c_service_running(void);
+// Timeout per attempt and retries for one address (probes are never retried)
+void i2c_set_device_policy(uint8_t addr, uint16_t timeout_ms, uint8_t retries);
+// Queue a transfer; false if the queue is full or the service is not running. done may be NULL.
+bool i2c_submit(const I2cTransfer *transfer, I2cDoneCallback done, void *ctx);
+bool i2c_submit_from_isr(const I2cTransfer *transfer, I2cDoneCallback done, void *ctx, BaseType_t *woken);
+// Bus busy time, transfers, retries and errors since the last call
+void i2c_print_stats(uint32_t window_ms);
@@ -0,0 +1,129 @@
+#include "ImageCache.h"
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <stdio.h>
+
+typedef struct {
+  const ImageAsset *asset;   // NULL = slot free
+  lv_image_dsc_t dsc;        // Decoded RGB565A8 in PSRAM
+  uint32_t last_use;
+  uint16_t refs;             // lv_image objects showing it
+} CacheEntry;
+
+static CacheEntry entries[IMAGE_CACHE_SLOTS];
+static uint32_t cache_bytes = 0;
+static uint32_t use_clock = 0;
+
+static CacheEntry *entry_for_src(const void *src) {
+  for (uint8_t i = 0; i < IMAGE_CACHE_SLOTS; i++) {
+    if (entries[i].asset != NULL && src == &entries[i].dsc) return &entries[i];
+  }
+  return NULL;
+}
+
+static void evict(CacheEntry *e) {
+#if IMAGE_CACHE_LOG
+  printf("IMG: evicted %s (%lu bytes)\n", e->asset->name, (unsigned long)e->asset->raw_size);
+#endif
+  // The dsc slot is reused for the next asset; drop anything LVGL keyed on it
+  lv_image_cache_drop(&e->dsc);
+  cache_bytes -= e->asset->raw_size;
+  heap_caps_free((void *)e->dsc.data);
+  e->asset = NULL;
+}
+
+static CacheEntry *least_recent_unpinned(void) {
+  CacheEntry *lru = NULL;
+  for (uint8_t i = 0; i < IMAGE_CACHE_SLOTS; i++) {
+    CacheEntry *e = &entries[i];
+    if (e->asset == NULL || e->refs > 0) continue;
+    if (lru == NULL || (int32_t)(e->last_use - lru->last_use) < 0) lru = e;
+  }
+  return lru;
+}
+
+static CacheEntry *acquire(const ImageAsset *asset) {
+  for (uint8_t i = 0; i < IMAGE_CACHE_SLOTS; i++) {
+    if (entries[i].asset == asset) {
+      entries[i].last_use = ++use_clock;
+      return &entries[i];
+    }
+  }
+
+  // Make room in the budget, then find a free slot
+  CacheEntry *victim;
+  while (cache_bytes + asset->raw_size > IMAGE_CACHE_BYTES && (victim = least_recent_unpinned()) != NULL) {
+    evict(victim);
+  }
+  CacheEntry *e = NULL;
+  for (uint8_t i = 0; i < IMAGE_CACHE_SLOTS && e == NULL; i++) {
+    if (entries[i].asset == NULL) e = &entries[i];
+  }
+  if (e == NULL) {
+    e = least_recent_unpinned();
+    if (e == NULL) {
+      printf("IMG: no free cache slot for %s\n", asset->name);
+      return NULL;
+    }
+    evict(e);
+  }
+
+  uint8_t *pixels = (uint8_t *)heap_caps_malloc(asset->raw_size, MALLOC_CAP_SPIRAM);
+  if (pixels == NULL) {
+    printf("IMG: %s allocation failed (%lu bytes)\n", asset->name, (unsigned long)asset->raw_size);
+    return NULL;
+  }
+  int64_t t0 = esp_timer_get_time();
+  if (!image_decode(asset, pixels)) {
+    printf("IMG: %s is corrupt\n", asset->name);
+    heap_caps_free(pixels);
+    return NULL;
+  }
+#if IMAGE_CACHE_LOG
+  printf("IMG: decoded %s, %lu -> %lu bytes in %lu us (cache %lu/%lu bytes)\n", asset->name,
+         (unsigned long)asset->data_size, (unsigned long)asset->raw_size,
+         (unsigned long)(esp_timer_get_time() - t0),
+         (unsigned long)(cache_bytes + asset->raw_size), (unsigned long)IMAGE_CACHE_BYTES);
+#else
+  (void)t0;
+#endif
+
+  e->asset = asset;
+  e->refs = 0;
+  e->last_use = ++use_clock;
+  e->dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+  e->dsc.header.cf = LV_COLOR_FORMAT_RGB565A8;
+  e->dsc.header.flags = 0;
+  e->dsc.header.w = asset->w;
+  e->dsc.header.h = asset->h;
+  e->dsc.header.stride = asset->w * 2;  // RGB565 plane; the A8 plane follows at stride / 2
+  e->dsc.header.reserved_2 = 0;
+  e->dsc.data_size = asset->raw_size;
+  e->dsc.data = pixels;
+  e->dsc.reserved = NULL;
+  cache_bytes += asset->raw_size;
+  return e;
+}
+
+static void delete_cb(lv_event_t *e) {
+  lv_obj_t *img = (lv_obj_t *)lv_event_get_target(e);
+  CacheEntry *entry = entry_for_src(lv_image_get_src(img));
+  if (entry != NULL && entry->refs > 0) entry->refs--;
+}
+
+void image_cache_set_src(lv_obj_t *img, const ImageAsset *asset) {
+  CacheEntry *prev = entry_for_src(lv_image_get_src(img));
+  if (prev != NULL && prev->asset == asset) {
+    prev->last_use = ++use_clock;
+    return;
+  }
+
+  // The previous entry stays pinned while this one is decoded, so it cannot
+  // be freed under the image if the decode fails
+  CacheEntry *entry = acquire(asset);
+  if (entry == NULL) return;
+  if (prev != NULL) prev->refs--;
+  else lv_obj_add_event_cb(img, delete_cb, LV_EVENT_DELETE, NULL);  // First cached src of this object
+  entry->refs++;
+  lv_image_set_src(img, &entry->dsc);
+}
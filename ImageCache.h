@@ -0,0 +1,23 @@
+#pragma once
+#include <lvgl.h>
+#include <stdint.h>
+#include "ImageCodec.h"
+
+// ============================================================================
+// IMAGE CACHE
+// ----------------------------------------------------------------------------
+// The logos and status icons are stored run-length coded in flash
+// (images/*_rle.h, see ImageCodec.h) and decoded on first use into PSRAM,
+// where they stay in a small LRU cache keyed by asset. An entry shown by an
+// lv_image is pinned until the image object shows something else or is
+// deleted; only unpinned entries are evicted to make room, least recently
+// used first. If every entry is pinned the budget is exceeded rather than
+// leaving an image blank. Call from the LVGL task only, like lv_image_*.
+// ============================================================================
+
+#define IMAGE_CACHE_BYTES (160 * 1024)  // Boot logo (88 KB) + main screen icons (46 KB)
+#define IMAGE_CACHE_SLOTS 12
+#define IMAGE_CACHE_LOG   1             // Print each decode and eviction
+
+// lv_image_set_src() for a compressed asset; a no-op if it already shows it
+void image_cache_set_src(lv_obj_t *img, const ImageAsset *asset);
@@ -0,0 +1,95 @@
+#include "ImageCodec.h"
+#include <string.h>
+
+// RLE packet: control byte c, then one token (c & 0x80: run of (c & 0x7F) + 1)
+// or c + 1 literal tokens.
+
+static bool decode_palette(const ImageAsset *asset, uint8_t *dst) {
+  const uint8_t *p = asset->data;
+  const uint8_t *end = p + asset->data_size;
+  const uint32_t n = (uint32_t)asset->w * asset->h;
+  uint16_t *colors = (uint16_t *)dst;
+  uint8_t *alpha = dst + 2 * n;
+
+  uint16_t pal_color[256];
+  uint8_t pal_alpha[256];
+  if (p >= end) return false;
+  uint32_t count = (uint32_t)*p++ + 1;
+  if ((uint32_t)(end - p) < count * 3) return false;
+  for (uint32_t i = 0; i < count; i++, p += 3) {
+    pal_color[i] = (uint16_t)(p[0] | (p[1] << 8));
+    pal_alpha[i] = p[2];
+  }
+
+  uint32_t o = 0;
+  while (o < n) {
+    if (p >= end) return false;
+    uint8_t c = *p++;
+    uint32_t len = (uint32_t)(c & 0x7F) + 1;
+    if (len > n - o) return false;
+    if (c & 0x80) {
+      if (p >= end || *p >= count) return false;
+      uint16_t color = pal_color[*p];
+      memset(alpha + o, pal_alpha[*p], len);
+      p++;
+      for (uint32_t i = 0; i < len; i++) colors[o + i] = color;
+    } else {
+      if ((uint32_t)(end - p) < len) return false;
+      for (uint32_t i = 0; i < len; i++) {
+        uint8_t index = p[i];
+        if (index >= count) return false;
+        colors[o + i] = pal_color[index];
+        alpha[o + i] = pal_alpha[index];
+      }
+      p += len;
+    }
+    o += len;
+  }
+  return p == end;
+}
+
+// One plane of size-byte tokens; returns the end of its stream or NULL
+static const uint8_t *decode_plane(const uint8_t *p, const uint8_t *end, uint8_t *dst, uint32_t n, uint8_t size) {
+  uint32_t o = 0;
+  while (o < n) {
+    if (p >= end) return NULL;
+    uint8_t c = *p++;
+    uint32_t len = (uint32_t)(c & 0x7F) + 1;
+    if (len > n - o) return NULL;
+    if (c & 0x80) {
+      if ((uint32_t)(end - p) < size) return NULL;
+      if (size == 1) {
+        memset(dst + o, p[0], len);
+      } else {
+        uint16_t v = (uint16_t)(p[0] | (p[1] << 8));
+        uint16_t *d = (uint16_t *)dst + o;
+        for (uint32_t i = 0; i < len; i++) d[i] = v;
+      }
+      p += size;
+    } else {
+      if ((uint32_t)(end - p) < len * size) return NULL;
+      memcpy(dst + o * size, p, len * size);
+      p += len * size;
+    }
+    o += len;
+  }
+  return p;
+}
+
+static bool decode_planar(const ImageAsset *asset, uint8_t *dst) {
+  const uint8_t *end = asset->data + asset->data_size;
+  const uint32_t n = (uint32_t)asset->w * asset->h;
+  const uint8_t *p = decode_plane(asset->data, end, dst, n, 2);
+  if (p == NULL) return false;
+  p = decode_plane(p, end, dst + 2 * n, n, 1);
+  return p == end;
+}
+
+bool image_decode(const ImageAsset *asset, uint8_t *dst) {
+  if (asset->raw_size != (uint32_t)asset->w * asset->h * 3) return false;
+  switch (asset->codec) {
+    case IMAGE_CODEC_RLE_PALETTE: return decode_palette(asset, dst);
+    case IMAGE_CODEC_RLE_PLANAR:  return decode_planar(asset, dst);
+    default:                      return false;
+  }
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <stdint.h>
+
+// ============================================================================
+// IMAGE CODEC
+// ----------------------------------------------------------------------------
+// Run-length coded RGB565A8 images, generated from images/<name>.h by
+// tools/compress_images.py into images/<name>_rle.h. Two lossless encodings:
+// palette (up to 256 distinct colour + alpha pixels, RLE coded 1-byte
+// indices) and planar (RLE coded RGB565 plane, then RLE coded alpha plane);
+// the generator keeps the smaller. No LVGL or ESP dependencies, so
+// tools/image_codec_check builds it on the host to verify every asset and
+// time the decoder. ImageCache.h keeps the decoded images in PSRAM.
+// ============================================================================
+
+#define IMAGE_CODEC_RLE_PALETTE 1
+#define IMAGE_CODEC_RLE_PLANAR  2
+
+typedef struct {
+  const char *name;
+  const uint8_t *data;   // Compressed stream
+  uint32_t data_size;
+  uint32_t raw_size;     // Decoded bytes: w * h * 3 (RGB565 plane, then A8 plane)
+  uint32_t crc32;        // Of the decoded image (zlib CRC-32)
+  uint16_t w;
+  uint16_t h;
+  uint8_t codec;         // IMAGE_CODEC_*
+} ImageAsset;
+
+// As LV_IMAGE_DECLARE, for the assets in images/*_rle.h
+#define IMAGE_ASSET_DECLARE(name) extern const ImageAsset name##_asset
+
+// Decode into dst (raw_size bytes). False if the stream is malformed; dst
+// is then partly written.
+bool image_decode(const ImageAsset *asset, uint8_t *dst);
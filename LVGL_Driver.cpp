@@ -5,23 +5,157 @@
     The provided LVGL library file must be installed first
 ******************************************************************************/
 #include "LVGL_Driver.h"
+#if LVGL_FLUSH_STATS
+#include <esp_timer.h>
+#include <string.h>
+#endif
 
 // Virtual display size (what LVGL uses - smaller to save memory)
 #define LVGL_WIDTH  240
 #define LVGL_HEIGHT 960
 
 // Physical display offset (where to position the virtual display on the physical panel)
-#define DISPLAY_OFFSET_X 632  // ((960 - 120 pixel offset) - (240 display size))
-#define DISPLAY_OFFSET_Y 26
+#define DISPLAY_OFFSET_X LCD_WINDOW_X
+#define DISPLAY_OFFSET_Y LCD_WINDOW_Y
 
+#if LVGL_RENDER_MODE == LVGL_RENDER_PARTIAL
 static lv_color_t* buf1 = (lv_color_t*)heap_caps_aligned_alloc(32, (LVGL_WIDTH * LVGL_HEIGHT * 2) / BUFFER_FACTOR, MALLOC_CAP_DMA);
 static lv_color_t* buf2 = (lv_color_t*)heap_caps_aligned_alloc(32, (LVGL_WIDTH * LVGL_HEIGHT * 2) / BUFFER_FACTOR, MALLOC_CAP_DMA);
+#else
+#if !LCD_WINDOW_FB && ESP_PANEL_LCD_RGB_FRAME_BUF_NUM < 2
+#error "LVGL_RENDER_DIRECT / _FULL need ESP_PANEL_LCD_RGB_FRAME_BUF_NUM 2"
+#endif
+// The window inside each scan-out buffer (see lcd_get_window_buffers())
+static void *window_buffers[2];
+static lv_draw_buf_t fb_draw_bufs[2];
+#endif
+
+#if LVGL_FLUSH_STATS
+// log2 buckets: [0] = 0, [i] = 2^(i-1) .. 2^i - 1, the last one open-ended
+#define FLUSH_HIST_BUCKETS 22
+
+typedef struct {
+  uint32_t count[FLUSH_HIST_BUCKETS];
+  uint32_t max;
+  uint64_t sum;
+} FlushHistogram;
+
+typedef struct {
+  uint32_t frames;            // Refreshes that flushed at least one area
+  uint32_t multi_buffer;      // Frames that pushed more pixels than one draw buffer holds
+  FlushHistogram invalidated; // Areas invalidated per frame (before LVGL joins them)
+  FlushHistogram areas;       // Areas flushed per frame (joined, split to the buffer)
+  FlushHistogram pixels;      // Pixels flushed per frame
+  FlushHistogram render_us;   // Frame time outside the flush callback
+  FlushHistogram flush_us;    // Time inside the flush callback
+  lv_area_t largest;          // Largest single invalidation in the window
+  uint32_t largest_px;
+} FlushStats;
+
+static FlushStats flush_stats;
+
+// Current frame
+static int64_t frame_start_us;
+static uint32_t frame_invalidated, frame_areas, frame_pixels, frame_flush_us;
+
+static void hist_add(FlushHistogram *h, uint32_t v) {
+  uint32_t b = v == 0 ? 0 : 32 - __builtin_clz(v);
+  if (b >= FLUSH_HIST_BUCKETS) b = FLUSH_HIST_BUCKETS - 1;
+  h->count[b]++;
+  h->sum += v;
+  if (v > h->max) h->max = v;
+}
+
+static void hist_print(const char *name, const FlushHistogram *h, uint32_t frames) {
+  printf("LVGL %-12s avg %lu max %lu |", name,
+         (unsigned long)(frames ? h->sum / frames : 0), (unsigned long)h->max);
+  for (uint32_t b = 0; b < FLUSH_HIST_BUCKETS; b++) {
+    if (h->count[b] == 0) continue;
+    if (b == 0) printf(" 0:%lu", (unsigned long)h->count[b]);
+    else if (b == 1) printf(" 1:%lu", (unsigned long)h->count[b]);
+    else printf(" %lu-%lu:%lu", 1ul << (b - 1), (1ul << b) - 1, (unsigned long)h->count[b]);
+  }
+  printf("\n");
+}
+
+static void flush_stats_event_cb(lv_event_t *e) {
+  lv_event_code_t code = lv_event_get_code(e);
+  if (code == LV_EVENT_INVALIDATE_AREA) {
+    const lv_area_t *a = (const lv_area_t *)lv_event_get_param(e);
+    uint32_t px = lv_area_get_size(a);
+    frame_invalidated++;
+    if (px > flush_stats.largest_px) {
+      flush_stats.largest_px = px;
+      flush_stats.largest = *a;
+    }
+  } else if (code == LV_EVENT_REFR_START) {
+    frame_start_us = esp_timer_get_time();
+    frame_areas = frame_pixels = frame_flush_us = 0;
+  } else if (code == LV_EVENT_REFR_READY) {
+    // Invalidations arrive between refreshes, so they are charged to the next frame
+    if (frame_areas == 0) return;
+    uint32_t total_us = (uint32_t)(esp_timer_get_time() - frame_start_us);
+    flush_stats.frames++;
+    if (frame_pixels > (LVGL_WIDTH * LVGL_HEIGHT) / BUFFER_FACTOR) flush_stats.multi_buffer++;
+    hist_add(&flush_stats.invalidated, frame_invalidated);
+    hist_add(&flush_stats.areas, frame_areas);
+    hist_add(&flush_stats.pixels, frame_pixels);
+    hist_add(&flush_stats.flush_us, frame_flush_us);
+    hist_add(&flush_stats.render_us, total_us > frame_flush_us ? total_us - frame_flush_us : 0);
+    frame_invalidated = 0;
+  }
+}
+
+void lvgl_print_flush_stats(uint32_t window_ms) {
+  FlushStats *st = &flush_stats;
+#if LVGL_RENDER_MODE == LVGL_RENDER_PARTIAL
+  printf("LVGL: %lu frames/%lu s, %lu over one buffer (%d px, BUFFER_FACTOR %d)\n",
+         (unsigned long)st->frames, (unsigned long)(window_ms / 1000), (unsigned long)st->multi_buffer,
+         (LVGL_WIDTH * LVGL_HEIGHT) / BUFFER_FACTOR, BUFFER_FACTOR);
+#else
+  // "flush us" is the wait for the panel to release the previous framebuffer
+  printf("LVGL: %lu frames/%lu s, direct to framebuffer\n",
+         (unsigned long)st->frames, (unsigned long)(window_ms / 1000));
+#endif
+  hist_print("invalidated", &st->invalidated, st->frames);
+  hist_print("areas", &st->areas, st->frames);
+  hist_print("pixels", &st->pixels, st->frames);
+  hist_print("render us", &st->render_us, st->frames);
+  hist_print("flush us", &st->flush_us, st->frames);
+  if (st->largest_px) {
+    printf("LVGL largest invalidation %lu px: x %ld-%ld, y %ld-%ld\n", (unsigned long)st->largest_px,
+           (long)st->largest.x1, (long)st->largest.x2, (long)st->largest.y1, (long)st->largest.y2);
+  }
+  memset(st, 0, sizeof(*st));
+}
+
+static void flush_stats_timer_cb(lv_timer_t *t) {
+  lvgl_print_flush_stats(LVGL_FLUSH_STATS_PERIOD_MS);
+}
+#endif
 
 /* Flush callback: Transfers LVGL-rendered area to the actual LCD with offset */
 void lvgl_flush_callback(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p) {
+#if LVGL_FLUSH_STATS
+  int64_t t0 = esp_timer_get_time();
+#endif
+#if LVGL_RENDER_MODE == LVGL_RENDER_PARTIAL
   // Add offset to position the virtual display on the physical display
   lcd_add_window(area->x1 + DISPLAY_OFFSET_X, area->x2 + DISPLAY_OFFSET_X, 
                  area->y1 + DISPLAY_OFFSET_Y, area->y2 + DISPLAY_OFFSET_Y, color_p);
+#else
+  // Already in the framebuffer; once the frame is complete, show it and wait
+  // until the other one is free to draw into
+  if (lv_display_flush_is_last(disp)) {
+    lcd_swap_window_buffer(color_p);
+  }
+#endif
+  if (lv_display_flush_is_last(disp)) lcd_first_frame_flushed();
+#if LVGL_FLUSH_STATS
+  frame_areas++;
+  frame_pixels += lv_area_get_size(area);
+  frame_flush_us += (uint32_t)(esp_timer_get_time() - t0);
+#endif
   lv_display_flush_ready(disp);
 }
 
@@ -30,6 +164,7 @@ void lvgl_init(void) {
   lv_init();
   lv_tick_set_cb(xTaskGetTickCount);
   
+#if LVGL_RENDER_MODE == LVGL_RENDER_PARTIAL
   if (!buf1) {
     printf("LVGL buffer allocation failed!\n");
     return;
@@ -43,7 +178,35 @@ void lvgl_init(void) {
   /* Set the display resolution to virtual size only - don't set physical resolution */
   lv_display_set_resolution(disp_drv, LVGL_WIDTH, LVGL_HEIGHT);
   // Physical resolution not set - we handle offset in flush callback
+#else
+  uint32_t stride, rows;
+  if (!lcd_get_window_buffers(&window_buffers[0], &window_buffers[1], &stride, &rows)) {
+    printf("LVGL: panel window buffers unavailable!\n");
+    return;
+  }
+  // Rows past the bottom of the panel were clipped by lcd_add_window();
+  // here they must not exist at all
+  if (rows > LVGL_HEIGHT) rows = LVGL_HEIGHT;
+
+  lv_display_t *disp_drv = lv_display_create(LVGL_WIDTH, rows);
+
+  /* Both scan-out buffers, seen through the window */
+  for (int i = 0; i < 2; i++) {
+    lv_draw_buf_init(&fb_draw_bufs[i], LVGL_WIDTH, rows, LV_COLOR_FORMAT_RGB565, stride,
+                     window_buffers[i], stride * rows);
+  }
+  lv_display_set_draw_buffers(disp_drv, &fb_draw_bufs[0], &fb_draw_bufs[1]);
+  lv_display_set_render_mode(disp_drv, LVGL_RENDER_MODE == LVGL_RENDER_FULL ? LV_DISPLAY_RENDER_MODE_FULL
+                                                                            : LV_DISPLAY_RENDER_MODE_DIRECT);
+#endif
 
   /* Set flush callback */
   lv_display_set_flush_cb(disp_drv, lvgl_flush_callback);
-}
\ No newline at end of file
+
+#if LVGL_FLUSH_STATS
+  lv_display_add_event_cb(disp_drv, flush_stats_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+  lv_display_add_event_cb(disp_drv, flush_stats_event_cb, LV_EVENT_REFR_START, NULL);
+  lv_display_add_event_cb(disp_drv, flush_stats_event_cb, LV_EVENT_REFR_READY, NULL);
+  lv_timer_create(flush_stats_timer_cb, LVGL_FLUSH_STATS_PERIOD_MS, NULL);
+#endif
+}
@@ -9,5 +9,29 @@
 #define BUFFER_FACTOR                 5                        // Larger buffer = smoother rendering (was 10)
                                                                 // 5 = ~46KB per buffer, 8 = ~29KB, 10 = ~23KB
 
+// Where LVGL renders:
+//   LVGL_RENDER_PARTIAL  strips in two internal DMA buffers (BUFFER_FACTOR above),
+//                        copied into the panel framebuffer by lcd_add_window()
+//   LVGL_RENDER_DIRECT   dirty areas straight into the panel's two PSRAM
+//                        framebuffers (window offset and panel stride baked into
+//                        the draw buffers), swapped once the panel has finished
+//                        the previous frame: no copy, no tearing, no DMA buffers
+//   LVGL_RENDER_FULL     as DIRECT, but the whole window is redrawn every frame
+#define LVGL_RENDER_PARTIAL           0
+#define LVGL_RENDER_DIRECT            1
+#define LVGL_RENDER_FULL              2
+#define LVGL_RENDER_MODE              LVGL_RENDER_PARTIAL
+
+// Per-frame invalidation / flush accounting, printed as histograms over serial
+// every LVGL_FLUSH_STATS_PERIOD_MS. Costs two timer reads per flushed area.
+#define LVGL_FLUSH_STATS              0                        // 1 = collect and print
+#define LVGL_FLUSH_STATS_PERIOD_MS    10000
+
 void lvgl_flush_callback(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p);
-void lvgl_init(void);
\ No newline at end of file
+void lvgl_init(void);
+
+#if LVGL_FLUSH_STATS
+// Print the histograms for the frames since the last call and reset them.
+// Called from an LVGL timer; only call it from the LVGL task.
+void lvgl_print_flush_stats(uint32_t window_ms);
+#endif
@@ -0,0 +1,1302 @@
+// AUTO-GENERATED by tools/dbc_codegen.py from "M1 General 0x640 0x650 0x670 Ver5.dbc" - do not edit.
+// Regenerate with: python3 tools/dbc_codegen.py
+#pragma once
+#include <stdint.h>
+
+// Each signal X of message 0xNNN is m1::msg_NNN::X(data), returning the raw
+// (unscaled) value. Physical value = raw * X_scale + X_offset.
+namespace m1 {
+
+// ---- 0x118 M1_GPR_to_PDM_0x118 (8 signals) ----
+namespace msg_118 {
+constexpr uint32_t ID = 0x118;
+constexpr uint8_t DLC = 8;
+// Transmission_Temperature_PDM: 55|8@0+ (1,0) [0|255] "C"
+constexpr uint8_t Transmission_Temperature_PDM(const uint8_t *d) { return (uint8_t)d[6]; }
+constexpr float Transmission_Temperature_PDM_scale = 1.0f;
+constexpr float Transmission_Temperature_PDM_offset = 0.0f;
+// Differential_Temperature_PDM: 63|8@0+ (1,0) [0|255] "C"
+constexpr uint8_t Differential_Temperature_PDM(const uint8_t *d) { return (uint8_t)d[7]; }
+constexpr float Differential_Temperature_PDM_scale = 1.0f;
+constexpr float Differential_Temperature_PDM_offset = 0.0f;
+// Fuel_Temperature_PDM: 47|8@0+ (1,0) [0|255] "C"
+constexpr uint8_t Fuel_Temperature_PDM(const uint8_t *d) { return (uint8_t)d[5]; }
+constexpr float Fuel_Temperature_PDM_scale = 1.0f;
+constexpr float Fuel_Temperature_PDM_offset = 0.0f;
+// Engine_Oil_Temperature_PDM: 39|8@0+ (1,0) [0|255] "C"
+constexpr uint8_t Engine_Oil_Temperature_PDM(const uint8_t *d) { return (uint8_t)d[4]; }
+constexpr float Engine_Oil_Temperature_PDM_scale = 1.0f;
+constexpr float Engine_Oil_Temperature_PDM_offset = 0.0f;
+// Coolant_Temperature_PDM: 31|8@0+ (1,0) [0|255] "C"
+constexpr uint8_t Coolant_Temperature_PDM(const uint8_t *d) { return (uint8_t)d[3]; }
+constexpr float Coolant_Temperature_PDM_scale = 1.0f;
+constexpr float Coolant_Temperature_PDM_offset = 0.0f;
+// Vehicle_Speed_PDM: 23|8@0+ (1,0) [0|255] "km/h"
+constexpr uint8_t Vehicle_Speed_PDM(const uint8_t *d) { return (uint8_t)d[2]; }
+constexpr float Vehicle_Speed_PDM_scale = 1.0f;
+constexpr float Vehicle_Speed_PDM_offset = 0.0f;
+// Throttle_Position_PDM: 15|8@0+ (1,0) [0|255] "%"
+constexpr uint8_t Throttle_Position_PDM(const uint8_t *d) { return (uint8_t)d[1]; }
+constexpr float Throttle_Position_PDM_scale = 1.0f;
+constexpr float Throttle_Position_PDM_offset = 0.0f;
+// Engine_Speed_PDM: 7|8@0+ (100,0) [0|25500] "RPM"
+constexpr uint8_t Engine_Speed_PDM(const uint8_t *d) { return (uint8_t)d[0]; }
+constexpr float Engine_Speed_PDM_scale = 100.0f;
+constexpr float Engine_Speed_PDM_offset = 0.0f;
+}  // namespace msg_118
+
+// ---- 0x119 M1_GPR_to_PDM_0x119 (12 signals) ----
+namespace msg_119 {
+constexpr uint32_t ID = 0x119;
+constexpr uint8_t DLC = 8;
+// Engine_State_PDM: 32|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Engine_State_PDM(const uint8_t *d) { return (uint8_t)(d[4] & 0x1); }
+constexpr float Engine_State_PDM_scale = 1.0f;
+constexpr float Engine_State_PDM_offset = 0.0f;
+// Warning_Source_PDM: 33|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Warning_Source_PDM(const uint8_t *d) { return (uint8_t)((d[4] >> 1) & 0x1); }
+constexpr float Warning_Source_PDM_scale = 1.0f;
+constexpr float Warning_Source_PDM_offset = 0.0f;
+// Driver_Switch_2: 41|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Driver_Switch_2(const uint8_t *d) { return (uint8_t)((d[5] >> 1) & 0x1); }
+constexpr float Driver_Switch_2_scale = 1.0f;
+constexpr float Driver_Switch_2_offset = 0.0f;
+// Driver_Switch_1: 40|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Driver_Switch_1(const uint8_t *d) { return (uint8_t)(d[5] & 0x1); }
+constexpr float Driver_Switch_1_scale = 1.0f;
+constexpr float Driver_Switch_1_offset = 0.0f;
+// Engine_Run_Switch: 39|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Engine_Run_Switch(const uint8_t *d) { return (uint8_t)(d[4] >> 7); }
+constexpr float Engine_Run_Switch_scale = 1.0f;
+constexpr float Engine_Run_Switch_offset = 0.0f;
+// Pit_Switch: 38|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Pit_Switch(const uint8_t *d) { return (uint8_t)((d[4] >> 6) & 0x1); }
+constexpr float Pit_Switch_scale = 1.0f;
+constexpr float Pit_Switch_offset = 0.0f;
+// Clutch_State: 37|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Clutch_State(const uint8_t *d) { return (uint8_t)((d[4] >> 5) & 0x1); }
+constexpr float Clutch_State_scale = 1.0f;
+constexpr float Clutch_State_offset = 0.0f;
+// Clutch_Switch: 36|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Clutch_Switch(const uint8_t *d) { return (uint8_t)((d[4] >> 4) & 0x1); }
+constexpr float Clutch_Switch_scale = 1.0f;
+constexpr float Clutch_Switch_offset = 0.0f;
+// Neutral_Switch: 35|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Neutral_Switch(const uint8_t *d) { return (uint8_t)((d[4] >> 3) & 0x1); }
+constexpr float Neutral_Switch_scale = 1.0f;
+constexpr float Neutral_Switch_offset = 0.0f;
+// Brake_State: 34|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Brake_State(const uint8_t *d) { return (uint8_t)((d[4] >> 2) & 0x1); }
+constexpr float Brake_State_scale = 1.0f;
+constexpr float Brake_State_offset = 0.0f;
+// Steering_Angle_PDM: 23|16@0- (0.1,0) [-3276|3276] "deg"
+constexpr int16_t Steering_Angle_PDM(const uint8_t *d) { return (int16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Steering_Angle_PDM_scale = 0.1f;
+constexpr float Steering_Angle_PDM_offset = 0.0f;
+// Fuel_Pressure_PDM: 7|8@0+ (10,0) [0|2550] "kPa"
+constexpr uint8_t Fuel_Pressure_PDM(const uint8_t *d) { return (uint8_t)d[0]; }
+constexpr float Fuel_Pressure_PDM_scale = 10.0f;
+constexpr float Fuel_Pressure_PDM_offset = 0.0f;
+}  // namespace msg_119
+
+// ---- 0x11A M1_GPR_to_PDM_0x11A (24 signals) ----
+namespace msg_11A {
+constexpr uint32_t ID = 0x11A;
+constexpr uint8_t DLC = 3;
+// PDM_Byte_2_Mask_80: 23|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_2_Mask_80(const uint8_t *d) { return (uint8_t)(d[2] >> 7); }
+constexpr float PDM_Byte_2_Mask_80_scale = 1.0f;
+constexpr float PDM_Byte_2_Mask_80_offset = 0.0f;
+// PDM_Byte_2_Mask_40: 22|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_2_Mask_40(const uint8_t *d) { return (uint8_t)((d[2] >> 6) & 0x1); }
+constexpr float PDM_Byte_2_Mask_40_scale = 1.0f;
+constexpr float PDM_Byte_2_Mask_40_offset = 0.0f;
+// PDM_Byte_2_Mask_20: 21|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_2_Mask_20(const uint8_t *d) { return (uint8_t)((d[2] >> 5) & 0x1); }
+constexpr float PDM_Byte_2_Mask_20_scale = 1.0f;
+constexpr float PDM_Byte_2_Mask_20_offset = 0.0f;
+// PDM_Byte_2_Mask_10: 20|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_2_Mask_10(const uint8_t *d) { return (uint8_t)((d[2] >> 4) & 0x1); }
+constexpr float PDM_Byte_2_Mask_10_scale = 1.0f;
+constexpr float PDM_Byte_2_Mask_10_offset = 0.0f;
+// PDM_Byte_2_Mask_08: 19|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_2_Mask_08(const uint8_t *d) { return (uint8_t)((d[2] >> 3) & 0x1); }
+constexpr float PDM_Byte_2_Mask_08_scale = 1.0f;
+constexpr float PDM_Byte_2_Mask_08_offset = 0.0f;
+// PDM_Byte_2_Mask_04: 18|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_2_Mask_04(const uint8_t *d) { return (uint8_t)((d[2] >> 2) & 0x1); }
+constexpr float PDM_Byte_2_Mask_04_scale = 1.0f;
+constexpr float PDM_Byte_2_Mask_04_offset = 0.0f;
+// PDM_Byte_2_Mask_02: 17|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_2_Mask_02(const uint8_t *d) { return (uint8_t)((d[2] >> 1) & 0x1); }
+constexpr float PDM_Byte_2_Mask_02_scale = 1.0f;
+constexpr float PDM_Byte_2_Mask_02_offset = 0.0f;
+// PDM_Byte_2_Mask_01: 16|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_2_Mask_01(const uint8_t *d) { return (uint8_t)(d[2] & 0x1); }
+constexpr float PDM_Byte_2_Mask_01_scale = 1.0f;
+constexpr float PDM_Byte_2_Mask_01_offset = 0.0f;
+// PDM_Byte_1_Mask_80: 15|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_1_Mask_80(const uint8_t *d) { return (uint8_t)(d[1] >> 7); }
+constexpr float PDM_Byte_1_Mask_80_scale = 1.0f;
+constexpr float PDM_Byte_1_Mask_80_offset = 0.0f;
+// PDM_Byte_1_Mask_40: 14|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_1_Mask_40(const uint8_t *d) { return (uint8_t)((d[1] >> 6) & 0x1); }
+constexpr float PDM_Byte_1_Mask_40_scale = 1.0f;
+constexpr float PDM_Byte_1_Mask_40_offset = 0.0f;
+// PDM_Byte_1_Mask_20: 13|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_1_Mask_20(const uint8_t *d) { return (uint8_t)((d[1] >> 5) & 0x1); }
+constexpr float PDM_Byte_1_Mask_20_scale = 1.0f;
+constexpr float PDM_Byte_1_Mask_20_offset = 0.0f;
+// PDM_Byte_1_Mask_10: 12|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_1_Mask_10(const uint8_t *d) { return (uint8_t)((d[1] >> 4) & 0x1); }
+constexpr float PDM_Byte_1_Mask_10_scale = 1.0f;
+constexpr float PDM_Byte_1_Mask_10_offset = 0.0f;
+// PDM_Byte_1_Mask_08: 11|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_1_Mask_08(const uint8_t *d) { return (uint8_t)((d[1] >> 3) & 0x1); }
+constexpr float PDM_Byte_1_Mask_08_scale = 1.0f;
+constexpr float PDM_Byte_1_Mask_08_offset = 0.0f;
+// PDM_Byte_1_Mask_04: 10|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_1_Mask_04(const uint8_t *d) { return (uint8_t)((d[1] >> 2) & 0x1); }
+constexpr float PDM_Byte_1_Mask_04_scale = 1.0f;
+constexpr float PDM_Byte_1_Mask_04_offset = 0.0f;
+// PDM_Byte_1_Mask_02: 9|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_1_Mask_02(const uint8_t *d) { return (uint8_t)((d[1] >> 1) & 0x1); }
+constexpr float PDM_Byte_1_Mask_02_scale = 1.0f;
+constexpr float PDM_Byte_1_Mask_02_offset = 0.0f;
+// PDM_Byte_1_Mask_01: 8|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_1_Mask_01(const uint8_t *d) { return (uint8_t)(d[1] & 0x1); }
+constexpr float PDM_Byte_1_Mask_01_scale = 1.0f;
+constexpr float PDM_Byte_1_Mask_01_offset = 0.0f;
+// PDM_Byte_0_Mask_80: 7|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_0_Mask_80(const uint8_t *d) { return (uint8_t)(d[0] >> 7); }
+constexpr float PDM_Byte_0_Mask_80_scale = 1.0f;
+constexpr float PDM_Byte_0_Mask_80_offset = 0.0f;
+// PDM_Byte_0_Mask_40: 6|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_0_Mask_40(const uint8_t *d) { return (uint8_t)((d[0] >> 6) & 0x1); }
+constexpr float PDM_Byte_0_Mask_40_scale = 1.0f;
+constexpr float PDM_Byte_0_Mask_40_offset = 0.0f;
+// PDM_Byte_0_Mask_20: 5|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_0_Mask_20(const uint8_t *d) { return (uint8_t)((d[0] >> 5) & 0x1); }
+constexpr float PDM_Byte_0_Mask_20_scale = 1.0f;
+constexpr float PDM_Byte_0_Mask_20_offset = 0.0f;
+// PDM_Byte_0_Mask_10: 4|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_0_Mask_10(const uint8_t *d) { return (uint8_t)((d[0] >> 4) & 0x1); }
+constexpr float PDM_Byte_0_Mask_10_scale = 1.0f;
+constexpr float PDM_Byte_0_Mask_10_offset = 0.0f;
+// PDM_Byte_0_Mask_08: 3|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_0_Mask_08(const uint8_t *d) { return (uint8_t)((d[0] >> 3) & 0x1); }
+constexpr float PDM_Byte_0_Mask_08_scale = 1.0f;
+constexpr float PDM_Byte_0_Mask_08_offset = 0.0f;
+// PDM_Byte_0_Mask_04: 2|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_0_Mask_04(const uint8_t *d) { return (uint8_t)((d[0] >> 2) & 0x1); }
+constexpr float PDM_Byte_0_Mask_04_scale = 1.0f;
+constexpr float PDM_Byte_0_Mask_04_offset = 0.0f;
+// PDM_Byte_0_Mask_02: 1|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_0_Mask_02(const uint8_t *d) { return (uint8_t)((d[0] >> 1) & 0x1); }
+constexpr float PDM_Byte_0_Mask_02_scale = 1.0f;
+constexpr float PDM_Byte_0_Mask_02_offset = 0.0f;
+// PDM_Byte_0_Mask_01: 0|1@0+ (1,0) [0|0] ""
+constexpr uint8_t PDM_Byte_0_Mask_01(const uint8_t *d) { return (uint8_t)(d[0] & 0x1); }
+constexpr float PDM_Byte_0_Mask_01_scale = 1.0f;
+constexpr float PDM_Byte_0_Mask_01_offset = 0.0f;
+}  // namespace msg_11A
+
+// ---- 0x640 M1_General_0x640 (4 signals) ----
+namespace msg_640 {
+constexpr uint32_t ID = 0x640;
+constexpr uint8_t DLC = 8;
+// Throttle_Position: 55|16@0+ (0.1,0) [0|100] "%"
+constexpr uint16_t Throttle_Position(const uint8_t *d) { return (uint16_t)(((uint32_t)d[6] << 8) | d[7]); }
+constexpr float Throttle_Position_scale = 0.1f;
+constexpr float Throttle_Position_offset = 0.0f;
+// Inlet_Air_Temperature: 39|16@0- (0.1,0) [-40|120] "C"
+constexpr int16_t Inlet_Air_Temperature(const uint8_t *d) { return (int16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Inlet_Air_Temperature_scale = 0.1f;
+constexpr float Inlet_Air_Temperature_offset = 0.0f;
+// Inlet_Manifold_Pressure: 23|16@0+ (0.1,0) [0|500] "kPa"
+constexpr uint16_t Inlet_Manifold_Pressure(const uint8_t *d) { return (uint16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Inlet_Manifold_Pressure_scale = 0.1f;
+constexpr float Inlet_Manifold_Pressure_offset = 0.0f;
+// Engine_Speed: 7|16@0+ (1,0) [0|16000] "RPM"
+constexpr uint16_t Engine_Speed(const uint8_t *d) { return (uint16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Engine_Speed_scale = 1.0f;
+constexpr float Engine_Speed_offset = 0.0f;
+}  // namespace msg_640
+
+// ---- 0x641 M1_General_0x641 (5 signals) ----
+namespace msg_641 {
+constexpr uint32_t ID = 0x641;
+constexpr uint8_t DLC = 8;
+// Fuel_Injector_Primary_Duty_Cycle: 55|8@0+ (1,0) [0|100] "%"
+constexpr uint8_t Fuel_Injector_Primary_Duty_Cycle(const uint8_t *d) { return (uint8_t)d[6]; }
+constexpr float Fuel_Injector_Primary_Duty_Cycle_scale = 1.0f;
+constexpr float Fuel_Injector_Primary_Duty_Cycle_offset = 0.0f;
+// Engine_Efficiency: 63|8@0+ (1,0) [0|160] "%"
+constexpr uint8_t Engine_Efficiency(const uint8_t *d) { return (uint8_t)d[7]; }
+constexpr float Engine_Efficiency_scale = 1.0f;
+constexpr float Engine_Efficiency_offset = 0.0f;
+// Fuel_Pressure_Sensor: 39|16@0+ (0.1,0) [0|1000] "kPa"
+constexpr uint16_t Fuel_Pressure_Sensor(const uint8_t *d) { return (uint16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Fuel_Pressure_Sensor_scale = 0.1f;
+constexpr float Fuel_Pressure_Sensor_offset = 0.0f;
+// Fuel_Mixture_Aim: 23|16@0+ (0.01,0) [0|2] "LA"
+constexpr uint16_t Fuel_Mixture_Aim(const uint8_t *d) { return (uint16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Fuel_Mixture_Aim_scale = 0.01f;
+constexpr float Fuel_Mixture_Aim_offset = 0.0f;
+// Fuel_Volume: 7|16@0+ (1,0) [0|500] "ul"
+constexpr uint16_t Fuel_Volume(const uint8_t *d) { return (uint16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Fuel_Volume_scale = 1.0f;
+constexpr float Fuel_Volume_offset = 0.0f;
+}  // namespace msg_641
+
+// ---- 0x642 M1_General_0x642 (4 signals) ----
+namespace msg_642 {
+constexpr uint32_t ID = 0x642;
+constexpr uint8_t DLC = 8;
+// Fuel_Timing_Primary: 55|16@0- (0.1,0) [-720|720] "deg"
+constexpr int16_t Fuel_Timing_Primary(const uint8_t *d) { return (int16_t)(((uint32_t)d[6] << 8) | d[7]); }
+constexpr float Fuel_Timing_Primary_scale = 0.1f;
+constexpr float Fuel_Timing_Primary_offset = 0.0f;
+// Ignition_Timing: 39|16@0- (0.1,0) [-100|100] "deg"
+constexpr int16_t Ignition_Timing(const uint8_t *d) { return (int16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Ignition_Timing_scale = 0.1f;
+constexpr float Ignition_Timing_offset = 0.0f;
+// Engine_Load: 23|16@0+ (1,0) [0|1000] "mg"
+constexpr uint16_t Engine_Load(const uint8_t *d) { return (uint16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Engine_Load_scale = 1.0f;
+constexpr float Engine_Load_offset = 0.0f;
+// Throttle_Pedal: 7|16@0+ (0.1,0) [0|100] "%"
+constexpr uint16_t Throttle_Pedal(const uint8_t *d) { return (uint16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Throttle_Pedal_scale = 0.1f;
+constexpr float Throttle_Pedal_offset = 0.0f;
+}  // namespace msg_642
+
+// ---- 0x643 M1_General_0x643 (8 signals) ----
+namespace msg_643 {
+constexpr uint32_t ID = 0x643;
+constexpr uint8_t DLC = 8;
+// Ignition_Cylinder_8_Knock_Level: 63|8@0+ (1,0) [0|200] "%"
+constexpr uint8_t Ignition_Cylinder_8_Knock_Level(const uint8_t *d) { return (uint8_t)d[7]; }
+constexpr float Ignition_Cylinder_8_Knock_Level_scale = 1.0f;
+constexpr float Ignition_Cylinder_8_Knock_Level_offset = 0.0f;
+// Ignition_Cylinder_7_Knock_Level: 55|8@0+ (1,0) [0|200] "%"
+constexpr uint8_t Ignition_Cylinder_7_Knock_Level(const uint8_t *d) { return (uint8_t)d[6]; }
+constexpr float Ignition_Cylinder_7_Knock_Level_scale = 1.0f;
+constexpr float Ignition_Cylinder_7_Knock_Level_offset = 0.0f;
+// Ignition_Cylinder_6_Knock_Level: 47|8@0+ (1,0) [0|200] "%"
+constexpr uint8_t Ignition_Cylinder_6_Knock_Level(const uint8_t *d) { return (uint8_t)d[5]; }
+constexpr float Ignition_Cylinder_6_Knock_Level_scale = 1.0f;
+constexpr float Ignition_Cylinder_6_Knock_Level_offset = 0.0f;
+// Ignition_Cylinder_5_Knock_Level: 39|8@0+ (1,0) [0|200] "%"
+constexpr uint8_t Ignition_Cylinder_5_Knock_Level(const uint8_t *d) { return (uint8_t)d[4]; }
+constexpr float Ignition_Cylinder_5_Knock_Level_scale = 1.0f;
+constexpr float Ignition_Cylinder_5_Knock_Level_offset = 0.0f;
+// Ignition_Cylinder_4_Knock_Level: 31|8@0+ (1,0) [0|200] "%"
+constexpr uint8_t Ignition_Cylinder_4_Knock_Level(const uint8_t *d) { return (uint8_t)d[3]; }
+constexpr float Ignition_Cylinder_4_Knock_Level_scale = 1.0f;
+constexpr float Ignition_Cylinder_4_Knock_Level_offset = 0.0f;
+// Ignition_Cylinder_3_Knock_Level: 23|8@0+ (1,0) [0|200] "%"
+constexpr uint8_t Ignition_Cylinder_3_Knock_Level(const uint8_t *d) { return (uint8_t)d[2]; }
+constexpr float Ignition_Cylinder_3_Knock_Level_scale = 1.0f;
+constexpr float Ignition_Cylinder_3_Knock_Level_offset = 0.0f;
+// Ignition_Cylinder_2_Knock_Level: 15|8@0+ (1,0) [0|200] "%"
+constexpr uint8_t Ignition_Cylinder_2_Knock_Level(const uint8_t *d) { return (uint8_t)d[1]; }
+constexpr float Ignition_Cylinder_2_Knock_Level_scale = 1.0f;
+constexpr float Ignition_Cylinder_2_Knock_Level_offset = 0.0f;
+// Ignition_Cylinder_1_Knock_Level: 7|8@0+ (1,0) [0|200] "%"
+constexpr uint8_t Ignition_Cylinder_1_Knock_Level(const uint8_t *d) { return (uint8_t)d[0]; }
+constexpr float Ignition_Cylinder_1_Knock_Level_scale = 1.0f;
+constexpr float Ignition_Cylinder_1_Knock_Level_offset = 0.0f;
+}  // namespace msg_643
+
+// ---- 0x644 M1_General_0x644 (8 signals) ----
+namespace msg_644 {
+constexpr uint32_t ID = 0x644;
+constexpr uint8_t DLC = 8;
+// Engine_Oil_Pressure: 55|16@0+ (0.1,0) [0|0] "kPa"
+constexpr uint16_t Engine_Oil_Pressure(const uint8_t *d) { return (uint16_t)(((uint32_t)d[6] << 8) | d[7]); }
+constexpr float Engine_Oil_Pressure_scale = 0.1f;
+constexpr float Engine_Oil_Pressure_offset = 0.0f;
+// Ignition_Cut_State: 43|4@0+ (1,0) [0|15] ""
+constexpr uint8_t Ignition_Cut_State(const uint8_t *d) { return (uint8_t)(d[5] & 0xF); }
+constexpr float Ignition_Cut_State_scale = 1.0f;
+constexpr float Ignition_Cut_State_offset = 0.0f;
+// Ignition_Timing_State: 47|4@0+ (1,0) [0|15] ""
+constexpr uint8_t Ignition_Timing_State(const uint8_t *d) { return (uint8_t)(d[5] >> 4); }
+constexpr float Ignition_Timing_State_scale = 1.0f;
+constexpr float Ignition_Timing_State_offset = 0.0f;
+// Fuel_Cyl_1_Prim_Output_Pls_Wdth: 39|8@0+ (0.1,0) [0|25.5] "ms"
+constexpr uint8_t Fuel_Cyl_1_Prim_Output_Pls_Wdth(const uint8_t *d) { return (uint8_t)d[4]; }
+constexpr float Fuel_Cyl_1_Prim_Output_Pls_Wdth_scale = 0.1f;
+constexpr float Fuel_Cyl_1_Prim_Output_Pls_Wdth_offset = 0.0f;
+// Fuel_Output_Cut_Average: 31|8@0+ (1,0) [0|100] "%"
+constexpr uint8_t Fuel_Output_Cut_Average(const uint8_t *d) { return (uint8_t)d[3]; }
+constexpr float Fuel_Output_Cut_Average_scale = 1.0f;
+constexpr float Fuel_Output_Cut_Average_offset = 0.0f;
+// Ignition_Output_Cut_Average: 23|8@0+ (1,0) [0|100] "%"
+constexpr uint8_t Ignition_Output_Cut_Average(const uint8_t *d) { return (uint8_t)d[2]; }
+constexpr float Ignition_Output_Cut_Average_scale = 1.0f;
+constexpr float Ignition_Output_Cut_Average_offset = 0.0f;
+// Fuel_Output_Cut_Count: 15|8@0+ (1,0) [0|255] ""
+constexpr uint8_t Fuel_Output_Cut_Count(const uint8_t *d) { return (uint8_t)d[1]; }
+constexpr float Fuel_Output_Cut_Count_scale = 1.0f;
+constexpr float Fuel_Output_Cut_Count_offset = 0.0f;
+// Ignition_Output_Cut_Count: 7|8@0+ (1,0) [0|255] ""
+constexpr uint8_t Ignition_Output_Cut_Count(const uint8_t *d) { return (uint8_t)d[0]; }
+constexpr float Ignition_Output_Cut_Count_scale = 1.0f;
+constexpr float Ignition_Output_Cut_Count_offset = 0.0f;
+}  // namespace msg_644
+
+// ---- 0x645 M1_General_0x645 (4 signals) ----
+namespace msg_645 {
+constexpr uint32_t ID = 0x645;
+constexpr uint8_t DLC = 8;
+// Gear_Lever_Force_Sensor: 63|8@0- (5,0) [-635|635] "N"
+constexpr int8_t Gear_Lever_Force_Sensor(const uint8_t *d) { return (int8_t)d[7]; }
+constexpr float Gear_Lever_Force_Sensor_scale = 5.0f;
+constexpr float Gear_Lever_Force_Sensor_offset = 0.0f;
+// Boost_Actuator_Output_Duty_Cycle: 55|8@0+ (1,0) [0|100] "%"
+constexpr uint8_t Boost_Actuator_Output_Duty_Cycle(const uint8_t *d) { return (uint8_t)d[6]; }
+constexpr float Boost_Actuator_Output_Duty_Cycle_scale = 1.0f;
+constexpr float Boost_Actuator_Output_Duty_Cycle_offset = 0.0f;
+// Boost_Aim: 23|16@0+ (0.1,0) [0|1000] "kPa"
+constexpr uint16_t Boost_Aim(const uint8_t *d) { return (uint16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Boost_Aim_scale = 0.1f;
+constexpr float Boost_Aim_offset = 0.0f;
+// Boost_Pressure: 7|16@0- (0.1,0) [0|1000] "kPa"
+constexpr int16_t Boost_Pressure(const uint8_t *d) { return (int16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Boost_Pressure_scale = 0.1f;
+constexpr float Boost_Pressure_offset = 0.0f;
+}  // namespace msg_645
+
+// ---- 0x646 M1_General_0x646 (5 signals) ----
+namespace msg_646 {
+constexpr uint32_t ID = 0x646;
+constexpr uint8_t DLC = 8;
+// Inlet_Cam_Bk_2_Output_Duty_Cycle: 63|8@0+ (1,0) [0|100] "%"
+constexpr uint8_t Inlet_Cam_Bk_2_Output_Duty_Cycle(const uint8_t *d) { return (uint8_t)d[7]; }
+constexpr float Inlet_Cam_Bk_2_Output_Duty_Cycle_scale = 1.0f;
+constexpr float Inlet_Cam_Bk_2_Output_Duty_Cycle_offset = 0.0f;
+// Inlet_Cam_Bk_1_Output_Duty_Cycle: 55|8@0+ (1,0) [0|100] "%"
+constexpr uint8_t Inlet_Cam_Bk_1_Output_Duty_Cycle(const uint8_t *d) { return (uint8_t)d[6]; }
+constexpr float Inlet_Cam_Bk_1_Output_Duty_Cycle_scale = 1.0f;
+constexpr float Inlet_Cam_Bk_1_Output_Duty_Cycle_offset = 0.0f;
+// Inlet_Camshaft_Bank_2_Position: 39|16@0- (0.1,0) [-60|60] "deg"
+constexpr int16_t Inlet_Camshaft_Bank_2_Position(const uint8_t *d) { return (int16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Inlet_Camshaft_Bank_2_Position_scale = 0.1f;
+constexpr float Inlet_Camshaft_Bank_2_Position_offset = 0.0f;
+// Inlet_Camshaft_Bank_1_Position: 23|16@0- (0.1,0) [-60|60] "deg"
+constexpr int16_t Inlet_Camshaft_Bank_1_Position(const uint8_t *d) { return (int16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Inlet_Camshaft_Bank_1_Position_scale = 0.1f;
+constexpr float Inlet_Camshaft_Bank_1_Position_offset = 0.0f;
+// Inlet_Camshaft_Aim: 7|16@0- (0.1,0) [-60|60] "deg"
+constexpr int16_t Inlet_Camshaft_Aim(const uint8_t *d) { return (int16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Inlet_Camshaft_Aim_scale = 0.1f;
+constexpr float Inlet_Camshaft_Aim_offset = 0.0f;
+}  // namespace msg_646
+
+// ---- 0x647 M1_General_0x647 (5 signals) ----
+namespace msg_647 {
+constexpr uint32_t ID = 0x647;
+constexpr uint8_t DLC = 8;
+// Exh_Cam_Bk_2_Output_Duty_Cycle: 63|8@0+ (1,0) [0|100] "%"
+constexpr uint8_t Exh_Cam_Bk_2_Output_Duty_Cycle(const uint8_t *d) { return (uint8_t)d[7]; }
+constexpr float Exh_Cam_Bk_2_Output_Duty_Cycle_scale = 1.0f;
+constexpr float Exh_Cam_Bk_2_Output_Duty_Cycle_offset = 0.0f;
+// Exh_Cam_Bk_1_Output_Duty_Cycle: 55|8@0+ (1,0) [0|100] "%"
+constexpr uint8_t Exh_Cam_Bk_1_Output_Duty_Cycle(const uint8_t *d) { return (uint8_t)d[6]; }
+constexpr float Exh_Cam_Bk_1_Output_Duty_Cycle_scale = 1.0f;
+constexpr float Exh_Cam_Bk_1_Output_Duty_Cycle_offset = 0.0f;
+// Exhaust_Camshaft_Bank_2_Position: 39|16@0- (0.1,0) [-60|60] "deg"
+constexpr int16_t Exhaust_Camshaft_Bank_2_Position(const uint8_t *d) { return (int16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Exhaust_Camshaft_Bank_2_Position_scale = 0.1f;
+constexpr float Exhaust_Camshaft_Bank_2_Position_offset = 0.0f;
+// Exhaust_Camshaft_Bank_1_Position: 23|16@0- (0.1,0) [-60|60] "deg"
+constexpr int16_t Exhaust_Camshaft_Bank_1_Position(const uint8_t *d) { return (int16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Exhaust_Camshaft_Bank_1_Position_scale = 0.1f;
+constexpr float Exhaust_Camshaft_Bank_1_Position_offset = 0.0f;
+// Exhaust_Camshaft_Aim: 7|16@0- (0.1,0) [-60|60] "deg"
+constexpr int16_t Exhaust_Camshaft_Aim(const uint8_t *d) { return (int16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Exhaust_Camshaft_Aim_scale = 0.1f;
+constexpr float Exhaust_Camshaft_Aim_offset = 0.0f;
+}  // namespace msg_647
+
+// ---- 0x648 M1_General_0x648 (4 signals) ----
+namespace msg_648 {
+constexpr uint32_t ID = 0x648;
+constexpr uint8_t DLC = 8;
+// Wheel_Speed_Rear_Right: 55|16@0+ (0.1,0) [0|340] "km/h"
+constexpr uint16_t Wheel_Speed_Rear_Right(const uint8_t *d) { return (uint16_t)(((uint32_t)d[6] << 8) | d[7]); }
+constexpr float Wheel_Speed_Rear_Right_scale = 0.1f;
+constexpr float Wheel_Speed_Rear_Right_offset = 0.0f;
+// Wheel_Speed_Rear_Left: 39|16@0+ (0.1,0) [0|340] "km/h"
+constexpr uint16_t Wheel_Speed_Rear_Left(const uint8_t *d) { return (uint16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Wheel_Speed_Rear_Left_scale = 0.1f;
+constexpr float Wheel_Speed_Rear_Left_offset = 0.0f;
+// Wheel_Speed_Front_Right: 23|16@0+ (0.1,0) [0|340] "km/h"
+constexpr uint16_t Wheel_Speed_Front_Right(const uint8_t *d) { return (uint16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Wheel_Speed_Front_Right_scale = 0.1f;
+constexpr float Wheel_Speed_Front_Right_offset = 0.0f;
+// Wheel_Speed_Front_Left: 7|16@0+ (0.1,0) [0|340] "km/h"
+constexpr uint16_t Wheel_Speed_Front_Left(const uint8_t *d) { return (uint16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Wheel_Speed_Front_Left_scale = 0.1f;
+constexpr float Wheel_Speed_Front_Left_offset = 0.0f;
+}  // namespace msg_648
+
+// ---- 0x649 M1_General_0x649 (7 signals) ----
+namespace msg_649 {
+constexpr uint32_t ID = 0x649;
+constexpr uint8_t DLC = 8;
+// Fuel_Used: 55|16@0+ (0.01,0) [0|655.35] "l"
+constexpr uint16_t Fuel_Used(const uint8_t *d) { return (uint16_t)(((uint32_t)d[6] << 8) | d[7]); }
+constexpr float Fuel_Used_scale = 0.01f;
+constexpr float Fuel_Used_offset = 0.0f;
+// ECU_Battery_Voltage: 47|8@0+ (0.1,0) [0|25.5] "V"
+constexpr uint8_t ECU_Battery_Voltage(const uint8_t *d) { return (uint8_t)d[5]; }
+constexpr float ECU_Battery_Voltage_scale = 0.1f;
+constexpr float ECU_Battery_Voltage_offset = 0.0f;
+// Airbox_Temperature: 39|8@0+ (1,-40) [-40|215] "C"
+constexpr uint8_t Airbox_Temperature(const uint8_t *d) { return (uint8_t)d[4]; }
+constexpr float Airbox_Temperature_scale = 1.0f;
+constexpr float Airbox_Temperature_offset = -40.0f;
+// Ambient_Temperature: 31|8@0+ (1,-40) [-40|215] "C"
+constexpr uint8_t Ambient_Temperature(const uint8_t *d) { return (uint8_t)d[3]; }
+constexpr float Ambient_Temperature_scale = 1.0f;
+constexpr float Ambient_Temperature_offset = -40.0f;
+// Fuel_Temperature: 23|8@0+ (1,-40) [-40|215] "C"
+constexpr uint8_t Fuel_Temperature(const uint8_t *d) { return (uint8_t)d[2]; }
+constexpr float Fuel_Temperature_scale = 1.0f;
+constexpr float Fuel_Temperature_offset = -40.0f;
+// Engine_Oil_Temperature: 15|8@0+ (1,-40) [-40|215] "C"
+constexpr uint8_t Engine_Oil_Temperature(const uint8_t *d) { return (uint8_t)d[1]; }
+constexpr float Engine_Oil_Temperature_scale = 1.0f;
+constexpr float Engine_Oil_Temperature_offset = -40.0f;
+// Coolant_Temperature: 7|8@0+ (1,-40) [-40|215] "C"
+constexpr uint8_t Coolant_Temperature(const uint8_t *d) { return (uint8_t)d[0]; }
+constexpr float Coolant_Temperature_scale = 1.0f;
+constexpr float Coolant_Temperature_offset = -40.0f;
+}  // namespace msg_649
+
+// ---- 0x64A M1_General_0x64A (4 signals) ----
+namespace msg_64A {
+constexpr uint32_t ID = 0x64A;
+constexpr uint8_t DLC = 8;
+// Ambient_Pressure: 55|16@0- (0.1,0) [60|110] "kPa"
+constexpr int16_t Ambient_Pressure(const uint8_t *d) { return (int16_t)(((uint32_t)d[6] << 8) | d[7]); }
+constexpr float Ambient_Pressure_scale = 0.1f;
+constexpr float Ambient_Pressure_offset = 0.0f;
+// Engine_Speed_Limit: 39|16@0+ (1,0) [0|16000] "RPM"
+constexpr uint16_t Engine_Speed_Limit(const uint8_t *d) { return (uint16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Engine_Speed_Limit_scale = 1.0f;
+constexpr float Engine_Speed_Limit_offset = 0.0f;
+// Engine_Load_Average: 23|16@0+ (0.1,0) [0|100] "%"
+constexpr uint16_t Engine_Load_Average(const uint8_t *d) { return (uint16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Engine_Load_Average_scale = 0.1f;
+constexpr float Engine_Load_Average_offset = 0.0f;
+// Exhaust_Temperature: 7|16@0+ (0.1,0) [0|1200] "C"
+constexpr uint16_t Exhaust_Temperature(const uint8_t *d) { return (uint16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Exhaust_Temperature_scale = 0.1f;
+constexpr float Exhaust_Temperature_offset = 0.0f;
+}  // namespace msg_64A
+
+// ---- 0x64B M1_General_0x64B (8 signals) ----
+namespace msg_64B {
+constexpr uint32_t ID = 0x64B;
+constexpr uint8_t DLC = 8;
+// Ignition_Cyl_8_Trim_Knock: 63|8@0+ (0.1,0) [0|25.5] "deg"
+constexpr uint8_t Ignition_Cyl_8_Trim_Knock(const uint8_t *d) { return (uint8_t)d[7]; }
+constexpr float Ignition_Cyl_8_Trim_Knock_scale = 0.1f;
+constexpr float Ignition_Cyl_8_Trim_Knock_offset = 0.0f;
+// Ignition_Cyl_7_Trim_Knock: 55|8@0+ (0.1,0) [0|25.5] "deg"
+constexpr uint8_t Ignition_Cyl_7_Trim_Knock(const uint8_t *d) { return (uint8_t)d[6]; }
+constexpr float Ignition_Cyl_7_Trim_Knock_scale = 0.1f;
+constexpr float Ignition_Cyl_7_Trim_Knock_offset = 0.0f;
+// Ignition_Cyl_6_Trim_Knock: 47|8@0+ (0.1,0) [0|25.5] "deg"
+constexpr uint8_t Ignition_Cyl_6_Trim_Knock(const uint8_t *d) { return (uint8_t)d[5]; }
+constexpr float Ignition_Cyl_6_Trim_Knock_scale = 0.1f;
+constexpr float Ignition_Cyl_6_Trim_Knock_offset = 0.0f;
+// Ignition_Cyl_5_Trim_Knock: 39|8@0+ (0.1,0) [0|25.5] "deg"
+constexpr uint8_t Ignition_Cyl_5_Trim_Knock(const uint8_t *d) { return (uint8_t)d[4]; }
+constexpr float Ignition_Cyl_5_Trim_Knock_scale = 0.1f;
+constexpr float Ignition_Cyl_5_Trim_Knock_offset = 0.0f;
+// Ignition_Cyl_4_Trim_Knock: 31|8@0+ (0.1,0) [0|25.5] "deg"
+constexpr uint8_t Ignition_Cyl_4_Trim_Knock(const uint8_t *d) { return (uint8_t)d[3]; }
+constexpr float Ignition_Cyl_4_Trim_Knock_scale = 0.1f;
+constexpr float Ignition_Cyl_4_Trim_Knock_offset = 0.0f;
+// Ignition_Cyl_3_Trim_Knock: 23|8@0+ (0.1,0) [0|25.5] "deg"
+constexpr uint8_t Ignition_Cyl_3_Trim_Knock(const uint8_t *d) { return (uint8_t)d[2]; }
+constexpr float Ignition_Cyl_3_Trim_Knock_scale = 0.1f;
+constexpr float Ignition_Cyl_3_Trim_Knock_offset = 0.0f;
+// Ignition_Cyl_2_Trim_Knock: 15|8@0+ (0.1,0) [0|25.5] "deg"
+constexpr uint8_t Ignition_Cyl_2_Trim_Knock(const uint8_t *d) { return (uint8_t)d[1]; }
+constexpr float Ignition_Cyl_2_Trim_Knock_scale = 0.1f;
+constexpr float Ignition_Cyl_2_Trim_Knock_offset = 0.0f;
+// Ignition_Cyl_1_Trim_Knock: 7|8@0+ (0.1,0) [0|25.5] "deg"
+constexpr uint8_t Ignition_Cyl_1_Trim_Knock(const uint8_t *d) { return (uint8_t)d[0]; }
+constexpr float Ignition_Cyl_1_Trim_Knock_scale = 0.1f;
+constexpr float Ignition_Cyl_1_Trim_Knock_offset = 0.0f;
+}  // namespace msg_64B
+
+// ---- 0x64C M1_General_0x64C (11 signals) ----
+namespace msg_64C {
+constexpr uint32_t ID = 0x64C;
+constexpr uint8_t DLC = 8;
+// Knock_Warning: 55|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Knock_Warning(const uint8_t *d) { return (uint8_t)(d[6] >> 7); }
+constexpr float Knock_Warning_scale = 1.0f;
+constexpr float Knock_Warning_offset = 0.0f;
+// Fuel_Pressure_Warning: 40|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Fuel_Pressure_Warning(const uint8_t *d) { return (uint8_t)(d[5] & 0x1); }
+constexpr float Fuel_Pressure_Warning_scale = 1.0f;
+constexpr float Fuel_Pressure_Warning_offset = 0.0f;
+// Crankcase_Pressure_Warning: 41|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Crankcase_Pressure_Warning(const uint8_t *d) { return (uint8_t)((d[5] >> 1) & 0x1); }
+constexpr float Crankcase_Pressure_Warning_scale = 1.0f;
+constexpr float Crankcase_Pressure_Warning_offset = 0.0f;
+// Engine_Oil_Pressure_Warning: 43|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Engine_Oil_Pressure_Warning(const uint8_t *d) { return (uint8_t)((d[5] >> 3) & 0x1); }
+constexpr float Engine_Oil_Pressure_Warning_scale = 1.0f;
+constexpr float Engine_Oil_Pressure_Warning_offset = 0.0f;
+// Engine_Oil_Temperature_Warning: 44|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Engine_Oil_Temperature_Warning(const uint8_t *d) { return (uint8_t)((d[5] >> 4) & 0x1); }
+constexpr float Engine_Oil_Temperature_Warning_scale = 1.0f;
+constexpr float Engine_Oil_Temperature_Warning_offset = 0.0f;
+// Engine_Speed_Warning: 45|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Engine_Speed_Warning(const uint8_t *d) { return (uint8_t)((d[5] >> 5) & 0x1); }
+constexpr float Engine_Speed_Warning_scale = 1.0f;
+constexpr float Engine_Speed_Warning_offset = 0.0f;
+// Coolant_Pressure_Warning: 46|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Coolant_Pressure_Warning(const uint8_t *d) { return (uint8_t)((d[5] >> 6) & 0x1); }
+constexpr float Coolant_Pressure_Warning_scale = 1.0f;
+constexpr float Coolant_Pressure_Warning_offset = 0.0f;
+// Coolant_Temperature_Warning: 47|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Coolant_Temperature_Warning(const uint8_t *d) { return (uint8_t)(d[5] >> 7); }
+constexpr float Coolant_Temperature_Warning_scale = 1.0f;
+constexpr float Coolant_Temperature_Warning_offset = 0.0f;
+// Warning_Source: 39|8@0+ (1,0) [0|0] ""
+constexpr uint8_t Warning_Source(const uint8_t *d) { return (uint8_t)d[4]; }
+constexpr float Warning_Source_scale = 1.0f;
+constexpr float Warning_Source_offset = 0.0f;
+// ECU_Up_Time: 23|16@0+ (1,0) [0|65535] "s"
+constexpr uint16_t ECU_Up_Time(const uint8_t *d) { return (uint16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float ECU_Up_Time_scale = 1.0f;
+constexpr float ECU_Up_Time_offset = 0.0f;
+// Engine_Run_Time: 7|16@0+ (1,0) [0|65535] "s"
+constexpr uint16_t Engine_Run_Time(const uint8_t *d) { return (uint16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Engine_Run_Time_scale = 1.0f;
+constexpr float Engine_Run_Time_offset = 0.0f;
+}  // namespace msg_64C
+
+// ---- 0x64D M1_General_0x64D (13 signals) ----
+namespace msg_64D {
+constexpr uint32_t ID = 0x64D;
+constexpr uint8_t DLC = 8;
+// Engine_Speed_Limit_State: 63|8@0+ (1,0) [0|255] ""
+constexpr uint8_t Engine_Speed_Limit_State(const uint8_t *d) { return (uint8_t)d[7]; }
+constexpr float Engine_Speed_Limit_State_scale = 1.0f;
+constexpr float Engine_Speed_Limit_State_offset = 0.0f;
+// Fuel_State: 27|4@0+ (1,0) [0|15] ""
+constexpr uint8_t Fuel_State(const uint8_t *d) { return (uint8_t)(d[3] & 0xF); }
+constexpr float Fuel_State_scale = 1.0f;
+constexpr float Fuel_State_offset = 0.0f;
+// Gear: 51|4@0- (1,0) [-8|7] ""
+constexpr int8_t Gear(const uint8_t *d) { return (int8_t)((int32_t)((uint32_t)(d[6] & 0xF) << 28) >> 28); }
+constexpr float Gear_scale = 1.0f;
+constexpr float Gear_offset = 0.0f;
+// Engine_Speed_Reference_State: 55|4@0+ (1,0) [0|15] ""
+constexpr uint8_t Engine_Speed_Reference_State(const uint8_t *d) { return (uint8_t)(d[6] >> 4); }
+constexpr float Engine_Speed_Reference_State_scale = 1.0f;
+constexpr float Engine_Speed_Reference_State_offset = 0.0f;
+// Fuel_Closed_Loop_State: 43|4@0+ (1,0) [0|15] ""
+constexpr uint8_t Fuel_Closed_Loop_State(const uint8_t *d) { return (uint8_t)(d[5] & 0xF); }
+constexpr float Fuel_Closed_Loop_State_scale = 1.0f;
+constexpr float Fuel_Closed_Loop_State_offset = 0.0f;
+// Throttle_Aim_State: 47|4@0+ (1,0) [0|15] ""
+constexpr uint8_t Throttle_Aim_State(const uint8_t *d) { return (uint8_t)(d[5] >> 4); }
+constexpr float Throttle_Aim_State_scale = 1.0f;
+constexpr float Throttle_Aim_State_offset = 0.0f;
+// Knock_State: 35|4@0+ (1,0) [0|15] ""
+constexpr uint8_t Knock_State(const uint8_t *d) { return (uint8_t)(d[4] & 0xF); }
+constexpr float Knock_State_scale = 1.0f;
+constexpr float Knock_State_offset = 0.0f;
+// Engine_Overrun_State: 31|4@0+ (1,0) [0|15] ""
+constexpr uint8_t Engine_Overrun_State(const uint8_t *d) { return (uint8_t)(d[3] >> 4); }
+constexpr float Engine_Overrun_State_scale = 1.0f;
+constexpr float Engine_Overrun_State_offset = 0.0f;
+// Boost_Aim_State: 23|4@0+ (1,0) [0|15] ""
+constexpr uint8_t Boost_Aim_State(const uint8_t *d) { return (uint8_t)(d[2] >> 4); }
+constexpr float Boost_Aim_State_scale = 1.0f;
+constexpr float Boost_Aim_State_offset = 0.0f;
+// Launch_State: 11|4@0+ (1,0) [0|15] ""
+constexpr uint8_t Launch_State(const uint8_t *d) { return (uint8_t)(d[1] & 0xF); }
+constexpr float Launch_State_scale = 1.0f;
+constexpr float Launch_State_offset = 0.0f;
+// Anti_Lag_State: 15|4@0+ (1,0) [0|15] ""
+constexpr uint8_t Anti_Lag_State(const uint8_t *d) { return (uint8_t)(d[1] >> 4); }
+constexpr float Anti_Lag_State_scale = 1.0f;
+constexpr float Anti_Lag_State_offset = 0.0f;
+// Fuel_Pump_State: 3|4@0+ (1,0) [0|15] ""
+constexpr uint8_t Fuel_Pump_State(const uint8_t *d) { return (uint8_t)(d[0] & 0xF); }
+constexpr float Fuel_Pump_State_scale = 1.0f;
+constexpr float Fuel_Pump_State_offset = 0.0f;
+// Engine_State: 7|4@0+ (1,0) [0|15] ""
+constexpr uint8_t Engine_State(const uint8_t *d) { return (uint8_t)(d[0] >> 4); }
+constexpr float Engine_State_scale = 1.0f;
+constexpr float Engine_State_offset = 0.0f;
+}  // namespace msg_64D
+
+// ---- 0x64E M1_General_0x64E (25 signals) ----
+namespace msg_64E {
+constexpr uint32_t ID = 0x64E;
+constexpr uint8_t DLC = 8;
+// Driver_Wheel_Circumference_Sw: 43|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Wheel_Circumference_Sw(const uint8_t *d) { return (uint8_t)((d[5] >> 3) & 0x1); }
+constexpr float Driver_Wheel_Circumference_Sw_scale = 1.0f;
+constexpr float Driver_Wheel_Circumference_Sw_offset = 0.0f;
+// Driver_Trans_Brake_Bump_Sw: 44|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Trans_Brake_Bump_Sw(const uint8_t *d) { return (uint8_t)((d[5] >> 4) & 0x1); }
+constexpr float Driver_Trans_Brake_Bump_Sw_scale = 1.0f;
+constexpr float Driver_Trans_Brake_Bump_Sw_offset = 0.0f;
+// Driver_Throttle_Pedal_Trans_Sw: 45|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Throttle_Pedal_Trans_Sw(const uint8_t *d) { return (uint8_t)((d[5] >> 5) & 0x1); }
+constexpr float Driver_Throttle_Pedal_Trans_Sw_scale = 1.0f;
+constexpr float Driver_Throttle_Pedal_Trans_Sw_offset = 0.0f;
+// Driver_Race_Time_Rest_Sw: 46|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Race_Time_Rest_Sw(const uint8_t *d) { return (uint8_t)((d[5] >> 6) & 0x1); }
+constexpr float Driver_Race_Time_Rest_Sw_scale = 1.0f;
+constexpr float Driver_Race_Time_Rest_Sw_offset = 0.0f;
+// Driver_Ign_Timing_Main_Sw: 47|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Ign_Timing_Main_Sw(const uint8_t *d) { return (uint8_t)(d[5] >> 7); }
+constexpr float Driver_Ign_Timing_Main_Sw_scale = 1.0f;
+constexpr float Driver_Ign_Timing_Main_Sw_offset = 0.0f;
+// Driver_Gear_Shift_Sw: 33|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Gear_Shift_Sw(const uint8_t *d) { return (uint8_t)((d[4] >> 1) & 0x1); }
+constexpr float Driver_Gear_Shift_Sw_scale = 1.0f;
+constexpr float Driver_Gear_Shift_Sw_offset = 0.0f;
+// Driver_Gear_Shift_Auto_Drag_Sw: 32|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Gear_Shift_Auto_Drag_Sw(const uint8_t *d) { return (uint8_t)(d[4] & 0x1); }
+constexpr float Driver_Gear_Shift_Auto_Drag_Sw_scale = 1.0f;
+constexpr float Driver_Gear_Shift_Auto_Drag_Sw_offset = 0.0f;
+// Driver_Fuel_Mix_Aim_Main_Sw: 34|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Fuel_Mix_Aim_Main_Sw(const uint8_t *d) { return (uint8_t)((d[4] >> 2) & 0x1); }
+constexpr float Driver_Fuel_Mix_Aim_Main_Sw_scale = 1.0f;
+constexpr float Driver_Fuel_Mix_Aim_Main_Sw_offset = 0.0f;
+// Driver_Eng_Spd_Limit_Max_Sw: 35|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Eng_Spd_Limit_Max_Sw(const uint8_t *d) { return (uint8_t)((d[4] >> 3) & 0x1); }
+constexpr float Driver_Eng_Spd_Limit_Max_Sw_scale = 1.0f;
+constexpr float Driver_Eng_Spd_Limit_Max_Sw_offset = 0.0f;
+// Driver_Boost_Limit_Disable_Sw: 36|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Boost_Limit_Disable_Sw(const uint8_t *d) { return (uint8_t)((d[4] >> 4) & 0x1); }
+constexpr float Driver_Boost_Limit_Disable_Sw_scale = 1.0f;
+constexpr float Driver_Boost_Limit_Disable_Sw_offset = 0.0f;
+// Driver_Aux_Time_Switch: 37|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Aux_Time_Switch(const uint8_t *d) { return (uint8_t)((d[4] >> 5) & 0x1); }
+constexpr float Driver_Aux_Time_Switch_scale = 1.0f;
+constexpr float Driver_Aux_Time_Switch_offset = 0.0f;
+// Driver_Anti_Lag_Mode_Sw: 39|2@0- (1,0) [0|0] ""
+constexpr int8_t Driver_Anti_Lag_Mode_Sw(const uint8_t *d) { return (int8_t)((int32_t)((uint32_t)(d[4] >> 6) << 30) >> 30); }
+constexpr float Driver_Anti_Lag_Mode_Sw_scale = 1.0f;
+constexpr float Driver_Anti_Lag_Mode_Sw_offset = 0.0f;
+// Fuel_Cut_State: 11|4@0+ (1,0) [0|15] ""
+constexpr uint8_t Fuel_Cut_State(const uint8_t *d) { return (uint8_t)(d[1] & 0xF); }
+constexpr float Fuel_Cut_State_scale = 1.0f;
+constexpr float Fuel_Cut_State_offset = 0.0f;
+// Brake_State: 27|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Brake_State(const uint8_t *d) { return (uint8_t)((d[3] >> 3) & 0x1); }
+constexpr float Brake_State_scale = 1.0f;
+constexpr float Brake_State_offset = 0.0f;
+// Neutral_Switch: 24|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Neutral_Switch(const uint8_t *d) { return (uint8_t)(d[3] & 0x1); }
+constexpr float Neutral_Switch_scale = 1.0f;
+constexpr float Neutral_Switch_offset = 0.0f;
+// Engine_Run_Switch: 25|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Engine_Run_Switch(const uint8_t *d) { return (uint8_t)((d[3] >> 1) & 0x1); }
+constexpr float Engine_Run_Switch_scale = 1.0f;
+constexpr float Engine_Run_Switch_offset = 0.0f;
+// Anti_Lag_Switch: 26|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Anti_Lag_Switch(const uint8_t *d) { return (uint8_t)((d[3] >> 2) & 0x1); }
+constexpr float Anti_Lag_Switch_scale = 1.0f;
+constexpr float Anti_Lag_Switch_offset = 0.0f;
+// Traction_Switch: 28|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Traction_Switch(const uint8_t *d) { return (uint8_t)((d[3] >> 4) & 0x1); }
+constexpr float Traction_Switch_scale = 1.0f;
+constexpr float Traction_Switch_offset = 0.0f;
+// Launch_Switch: 29|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Launch_Switch(const uint8_t *d) { return (uint8_t)((d[3] >> 5) & 0x1); }
+constexpr float Launch_Switch_scale = 1.0f;
+constexpr float Launch_Switch_offset = 0.0f;
+// Pit_Switch: 30|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Pit_Switch(const uint8_t *d) { return (uint8_t)((d[3] >> 6) & 0x1); }
+constexpr float Pit_Switch_scale = 1.0f;
+constexpr float Pit_Switch_offset = 0.0f;
+// Engine_Oil_Pressure_Low_Switch: 31|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Engine_Oil_Pressure_Low_Switch(const uint8_t *d) { return (uint8_t)(d[3] >> 7); }
+constexpr float Engine_Oil_Pressure_Low_Switch_scale = 1.0f;
+constexpr float Engine_Oil_Pressure_Low_Switch_offset = 0.0f;
+// Fuel_Closed_Loop_Diagnostic: 23|4@0- (1,0) [-8|7] ""
+constexpr int8_t Fuel_Closed_Loop_Diagnostic(const uint8_t *d) { return (int8_t)((int32_t)((uint32_t)(d[2] >> 4) << 28) >> 28); }
+constexpr float Fuel_Closed_Loop_Diagnostic_scale = 1.0f;
+constexpr float Fuel_Closed_Loop_Diagnostic_offset = 0.0f;
+// Boost_Control_Diagnostic: 15|4@0- (1,0) [-8|7] ""
+constexpr int8_t Boost_Control_Diagnostic(const uint8_t *d) { return (int8_t)((int32_t)((uint32_t)(d[1] >> 4) << 28) >> 28); }
+constexpr float Boost_Control_Diagnostic_scale = 1.0f;
+constexpr float Boost_Control_Diagnostic_offset = 0.0f;
+// Launch_Diagnostic: 3|4@0- (1,0) [-8|7] ""
+constexpr int8_t Launch_Diagnostic(const uint8_t *d) { return (int8_t)((int32_t)((uint32_t)(d[0] & 0xF) << 28) >> 28); }
+constexpr float Launch_Diagnostic_scale = 1.0f;
+constexpr float Launch_Diagnostic_offset = 0.0f;
+// Anti_Lag_Diagnostic: 7|4@0- (1,0) [-8|7] ""
+constexpr int8_t Anti_Lag_Diagnostic(const uint8_t *d) { return (int8_t)((int32_t)((uint32_t)(d[0] >> 4) << 28) >> 28); }
+constexpr float Anti_Lag_Diagnostic_scale = 1.0f;
+constexpr float Anti_Lag_Diagnostic_offset = 0.0f;
+}  // namespace msg_64E
+
+// ---- 0x64F M1_General_0x64F (6 signals) ----
+namespace msg_64F {
+constexpr uint32_t ID = 0x64F;
+constexpr uint8_t DLC = 8;
+// M1_General_0x640_Version: 63|8@0+ (1,0) [0|0] ""
+constexpr uint8_t M1_General_0x640_Version(const uint8_t *d) { return (uint8_t)d[7]; }
+constexpr float M1_General_0x640_Version_scale = 1.0f;
+constexpr float M1_General_0x640_Version_offset = 0.0f;
+// Fuel_Tank_Level: 47|8@0+ (1,0) [0|255] "l"
+constexpr uint8_t Fuel_Tank_Level(const uint8_t *d) { return (uint8_t)d[5]; }
+constexpr float Fuel_Tank_Level_scale = 1.0f;
+constexpr float Fuel_Tank_Level_offset = 0.0f;
+// Gearbox_Temperature: 39|8@0+ (1,-40) [-40|215] "C"
+constexpr uint8_t Gearbox_Temperature(const uint8_t *d) { return (uint8_t)d[4]; }
+constexpr float Gearbox_Temperature_scale = 1.0f;
+constexpr float Gearbox_Temperature_offset = -40.0f;
+// Fuel_Closed_Loop_Ctrl_Bk_2_Trim: 31|8@0+ (0.005,0) [0|1.275] "ratio"
+constexpr uint8_t Fuel_Closed_Loop_Ctrl_Bk_2_Trim(const uint8_t *d) { return (uint8_t)d[3]; }
+constexpr float Fuel_Closed_Loop_Ctrl_Bk_2_Trim_scale = 0.005f;
+constexpr float Fuel_Closed_Loop_Ctrl_Bk_2_Trim_offset = 0.0f;
+// Fuel_Closed_Loop_Ctrl_Bk_1_Trim: 23|8@0+ (0.005,0) [0|1.275] "ratio"
+constexpr uint8_t Fuel_Closed_Loop_Ctrl_Bk_1_Trim(const uint8_t *d) { return (uint8_t)d[2]; }
+constexpr float Fuel_Closed_Loop_Ctrl_Bk_1_Trim_scale = 0.005f;
+constexpr float Fuel_Closed_Loop_Ctrl_Bk_1_Trim_offset = 0.0f;
+// Engine_Run_Time_Total: 7|16@0+ (0.1,0) [0|6553.5] "hour"
+constexpr uint16_t Engine_Run_Time_Total(const uint8_t *d) { return (uint16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Engine_Run_Time_Total_scale = 0.1f;
+constexpr float Engine_Run_Time_Total_offset = 0.0f;
+}  // namespace msg_64F
+
+// ---- 0x650 M1_General_0x650 (14 signals) ----
+namespace msg_650 {
+constexpr uint32_t ID = 0x650;
+constexpr uint8_t DLC = 8;
+// Driver_Switch_8: 56|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Switch_8(const uint8_t *d) { return (uint8_t)(d[7] & 0x1); }
+constexpr float Driver_Switch_8_scale = 1.0f;
+constexpr float Driver_Switch_8_offset = 0.0f;
+// Driver_Switch_7: 57|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Switch_7(const uint8_t *d) { return (uint8_t)((d[7] >> 1) & 0x1); }
+constexpr float Driver_Switch_7_scale = 1.0f;
+constexpr float Driver_Switch_7_offset = 0.0f;
+// Driver_Switch_6: 58|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Switch_6(const uint8_t *d) { return (uint8_t)((d[7] >> 2) & 0x1); }
+constexpr float Driver_Switch_6_scale = 1.0f;
+constexpr float Driver_Switch_6_offset = 0.0f;
+// Driver_Switch_5: 59|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Switch_5(const uint8_t *d) { return (uint8_t)((d[7] >> 3) & 0x1); }
+constexpr float Driver_Switch_5_scale = 1.0f;
+constexpr float Driver_Switch_5_offset = 0.0f;
+// Driver_Rotary_Switch_6: 47|8@0- (1,0) [0|0] ""
+constexpr int8_t Driver_Rotary_Switch_6(const uint8_t *d) { return (int8_t)d[5]; }
+constexpr float Driver_Rotary_Switch_6_scale = 1.0f;
+constexpr float Driver_Rotary_Switch_6_offset = 0.0f;
+// Driver_Rotary_Switch_5: 39|8@0- (1,0) [0|0] ""
+constexpr int8_t Driver_Rotary_Switch_5(const uint8_t *d) { return (int8_t)d[4]; }
+constexpr float Driver_Rotary_Switch_5_scale = 1.0f;
+constexpr float Driver_Rotary_Switch_5_offset = 0.0f;
+// Driver_Switch_4: 60|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Switch_4(const uint8_t *d) { return (uint8_t)((d[7] >> 4) & 0x1); }
+constexpr float Driver_Switch_4_scale = 1.0f;
+constexpr float Driver_Switch_4_offset = 0.0f;
+// Driver_Switch_3: 61|1@0+ (1,0) [0|0] ""
+constexpr uint8_t Driver_Switch_3(const uint8_t *d) { return (uint8_t)((d[7] >> 5) & 0x1); }
+constexpr float Driver_Switch_3_scale = 1.0f;
+constexpr float Driver_Switch_3_offset = 0.0f;
+// Driver_Switch_2: 62|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Driver_Switch_2(const uint8_t *d) { return (uint8_t)((d[7] >> 6) & 0x1); }
+constexpr float Driver_Switch_2_scale = 1.0f;
+constexpr float Driver_Switch_2_offset = 0.0f;
+// Driver_Switch_1: 63|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Driver_Switch_1(const uint8_t *d) { return (uint8_t)(d[7] >> 7); }
+constexpr float Driver_Switch_1_scale = 1.0f;
+constexpr float Driver_Switch_1_offset = 0.0f;
+// Driver_Rotary_Switch_4: 31|8@0- (1,0) [0|0] ""
+constexpr int8_t Driver_Rotary_Switch_4(const uint8_t *d) { return (int8_t)d[3]; }
+constexpr float Driver_Rotary_Switch_4_scale = 1.0f;
+constexpr float Driver_Rotary_Switch_4_offset = 0.0f;
+// Driver_Rotary_Switch_3: 23|8@0- (1,0) [0|0] ""
+constexpr int8_t Driver_Rotary_Switch_3(const uint8_t *d) { return (int8_t)d[2]; }
+constexpr float Driver_Rotary_Switch_3_scale = 1.0f;
+constexpr float Driver_Rotary_Switch_3_offset = 0.0f;
+// Driver_Rotary_Switch_2: 15|8@0- (1,0) [0|0] ""
+constexpr int8_t Driver_Rotary_Switch_2(const uint8_t *d) { return (int8_t)d[1]; }
+constexpr float Driver_Rotary_Switch_2_scale = 1.0f;
+constexpr float Driver_Rotary_Switch_2_offset = 0.0f;
+// Driver_Rotary_Switch_1: 7|8@0- (1,0) [0|0] ""
+constexpr int8_t Driver_Rotary_Switch_1(const uint8_t *d) { return (int8_t)d[0]; }
+constexpr float Driver_Rotary_Switch_1_scale = 1.0f;
+constexpr float Driver_Rotary_Switch_1_offset = 0.0f;
+}  // namespace msg_650
+
+// ---- 0x651 M1_General_0x651 (5 signals) ----
+namespace msg_651 {
+constexpr uint32_t ID = 0x651;
+constexpr uint8_t DLC = 8;
+// Exhaust_Temperature_Bank_2: 55|16@0+ (0.1,0) [0|1200] "C"
+constexpr uint16_t Exhaust_Temperature_Bank_2(const uint8_t *d) { return (uint16_t)(((uint32_t)d[6] << 8) | d[7]); }
+constexpr float Exhaust_Temperature_Bank_2_scale = 0.1f;
+constexpr float Exhaust_Temperature_Bank_2_offset = 0.0f;
+// Exhaust_Temperature_Bank_1: 39|16@0+ (0.1,0) [0|1200] "C"
+constexpr uint16_t Exhaust_Temperature_Bank_1(const uint8_t *d) { return (uint16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Exhaust_Temperature_Bank_1_scale = 0.1f;
+constexpr float Exhaust_Temperature_Bank_1_offset = 0.0f;
+// Exhaust_Lambda_Bank_2: 31|8@0+ (0.01,0) [0|0] "LA"
+constexpr uint8_t Exhaust_Lambda_Bank_2(const uint8_t *d) { return (uint8_t)d[3]; }
+constexpr float Exhaust_Lambda_Bank_2_scale = 0.01f;
+constexpr float Exhaust_Lambda_Bank_2_offset = 0.0f;
+// Exhaust_Lambda_Bank_1: 23|8@0+ (0.01,0) [0|0] "LA"
+constexpr uint8_t Exhaust_Lambda_Bank_1(const uint8_t *d) { return (uint8_t)d[2]; }
+constexpr float Exhaust_Lambda_Bank_1_scale = 0.01f;
+constexpr float Exhaust_Lambda_Bank_1_offset = 0.0f;
+// Exhaust_Lambda: 7|8@0+ (0.01,0) [0|0] "LA"
+constexpr uint8_t Exhaust_Lambda(const uint8_t *d) { return (uint8_t)d[0]; }
+constexpr float Exhaust_Lambda_scale = 0.01f;
+constexpr float Exhaust_Lambda_offset = 0.0f;
+}  // namespace msg_651
+
+// ---- 0x652 M1_General_0x652 (3 signals) ----
+namespace msg_652 {
+constexpr uint32_t ID = 0x652;
+constexpr uint8_t DLC = 8;
+// Fuel_Injector_Sec_Contribution: 7|16@0+ (0.1,0) [0|100] "%"
+constexpr uint16_t Fuel_Injector_Sec_Contribution(const uint8_t *d) { return (uint16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Fuel_Injector_Sec_Contribution_scale = 0.1f;
+constexpr float Fuel_Injector_Sec_Contribution_offset = 0.0f;
+// Fuel_Injector_Duty_Cycle_Secdry: 39|8@0+ (1,0) [0|100] "%"
+constexpr uint8_t Fuel_Injector_Duty_Cycle_Secdry(const uint8_t *d) { return (uint8_t)d[4]; }
+constexpr float Fuel_Injector_Duty_Cycle_Secdry_scale = 1.0f;
+constexpr float Fuel_Injector_Duty_Cycle_Secdry_offset = 0.0f;
+// Fuel_Timing_Secondary: 23|16@0- (0.1,0) [-720|720] "deg"
+constexpr int16_t Fuel_Timing_Secondary(const uint8_t *d) { return (int16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Fuel_Timing_Secondary_scale = 0.1f;
+constexpr float Fuel_Timing_Secondary_offset = 0.0f;
+}  // namespace msg_652
+
+// ---- 0x653 M1_General_0x653 (6 signals) ----
+namespace msg_653 {
+constexpr uint32_t ID = 0x653;
+constexpr uint8_t DLC = 8;
+// Fuel_Pressure_Direct_B1_Integral: 63|8@0- (1,0) [-128|127] "%"
+constexpr int8_t Fuel_Pressure_Direct_B1_Integral(const uint8_t *d) { return (int8_t)d[7]; }
+constexpr float Fuel_Pressure_Direct_B1_Integral_scale = 1.0f;
+constexpr float Fuel_Pressure_Direct_B1_Integral_offset = 0.0f;
+// Fuel_Pressure_Direct_B1_Prop: 55|8@0- (1,0) [-128|127] "%"
+constexpr int8_t Fuel_Pressure_Direct_B1_Prop(const uint8_t *d) { return (int8_t)d[6]; }
+constexpr float Fuel_Pressure_Direct_B1_Prop_scale = 1.0f;
+constexpr float Fuel_Pressure_Direct_B1_Prop_offset = 0.0f;
+// Fuel_Pressure_Direct_B1_Feed_Fwd: 47|8@0- (1,0) [-128|127] "%"
+constexpr int8_t Fuel_Pressure_Direct_B1_Feed_Fwd(const uint8_t *d) { return (int8_t)d[5]; }
+constexpr float Fuel_Pressure_Direct_B1_Feed_Fwd_scale = 1.0f;
+constexpr float Fuel_Pressure_Direct_B1_Feed_Fwd_offset = 0.0f;
+// Fuel_Pressure_Direct_B1_Control: 39|8@0+ (0.5,0) [0|100] "%"
+constexpr uint8_t Fuel_Pressure_Direct_B1_Control(const uint8_t *d) { return (uint8_t)d[4]; }
+constexpr float Fuel_Pressure_Direct_B1_Control_scale = 0.5f;
+constexpr float Fuel_Pressure_Direct_B1_Control_offset = 0.0f;
+// Fuel_Pressure_Direct_B1_Aim: 23|16@0+ (1,0) [0|24000] "kPa"
+constexpr uint16_t Fuel_Pressure_Direct_B1_Aim(const uint8_t *d) { return (uint16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Fuel_Pressure_Direct_B1_Aim_scale = 1.0f;
+constexpr float Fuel_Pressure_Direct_B1_Aim_offset = 0.0f;
+// Fuel_Pressure_Direct_B1: 7|16@0+ (1,0) [0|24000] "kPa"
+constexpr uint16_t Fuel_Pressure_Direct_B1(const uint8_t *d) { return (uint16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Fuel_Pressure_Direct_B1_scale = 1.0f;
+constexpr float Fuel_Pressure_Direct_B1_offset = 0.0f;
+}  // namespace msg_653
+
+// ---- 0x654 M1_General_0x654 (6 signals) ----
+namespace msg_654 {
+constexpr uint32_t ID = 0x654;
+constexpr uint8_t DLC = 8;
+// Fuel_Pressure_Direct_B2_Integral: 63|8@0- (1,0) [-128|127] "%"
+constexpr int8_t Fuel_Pressure_Direct_B2_Integral(const uint8_t *d) { return (int8_t)d[7]; }
+constexpr float Fuel_Pressure_Direct_B2_Integral_scale = 1.0f;
+constexpr float Fuel_Pressure_Direct_B2_Integral_offset = 0.0f;
+// Fuel_Pressure_Direct_B2_Prop: 55|8@0- (1,0) [-128|127] "%"
+constexpr int8_t Fuel_Pressure_Direct_B2_Prop(const uint8_t *d) { return (int8_t)d[6]; }
+constexpr float Fuel_Pressure_Direct_B2_Prop_scale = 1.0f;
+constexpr float Fuel_Pressure_Direct_B2_Prop_offset = 0.0f;
+// Fuel_Pressure_Direct_B2_Feed_Fwd: 47|8@0- (1,0) [-128|127] "%"
+constexpr int8_t Fuel_Pressure_Direct_B2_Feed_Fwd(const uint8_t *d) { return (int8_t)d[5]; }
+constexpr float Fuel_Pressure_Direct_B2_Feed_Fwd_scale = 1.0f;
+constexpr float Fuel_Pressure_Direct_B2_Feed_Fwd_offset = 0.0f;
+// Fuel_Pressure_Direct_B2_Control: 39|8@0+ (0.5,0) [0|100] "%"
+constexpr uint8_t Fuel_Pressure_Direct_B2_Control(const uint8_t *d) { return (uint8_t)d[4]; }
+constexpr float Fuel_Pressure_Direct_B2_Control_scale = 0.5f;
+constexpr float Fuel_Pressure_Direct_B2_Control_offset = 0.0f;
+// Fuel_Pressure_Direct_B2_Aim: 23|16@0+ (1,0) [0|24000] "kPa"
+constexpr uint16_t Fuel_Pressure_Direct_B2_Aim(const uint8_t *d) { return (uint16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Fuel_Pressure_Direct_B2_Aim_scale = 1.0f;
+constexpr float Fuel_Pressure_Direct_B2_Aim_offset = 0.0f;
+// Fuel_Pressure_Direct_B2: 7|16@0+ (1,0) [0|24000] "kPa"
+constexpr uint16_t Fuel_Pressure_Direct_B2(const uint8_t *d) { return (uint16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Fuel_Pressure_Direct_B2_scale = 1.0f;
+constexpr float Fuel_Pressure_Direct_B2_offset = 0.0f;
+}  // namespace msg_654
+
+// ---- 0x655 M1_General_0x655 (4 signals) ----
+namespace msg_655 {
+constexpr uint32_t ID = 0x655;
+constexpr uint8_t DLC = 8;
+// Steering_Pressure: 55|16@0- (1,0) [-32768|32767] "kPa"
+constexpr int16_t Steering_Pressure(const uint8_t *d) { return (int16_t)(((uint32_t)d[6] << 8) | d[7]); }
+constexpr float Steering_Pressure_scale = 1.0f;
+constexpr float Steering_Pressure_offset = 0.0f;
+// Coolant_Pressure: 39|16@0- (0.1,0) [-3276.8|3276.7] "kPa"
+constexpr int16_t Coolant_Pressure(const uint8_t *d) { return (int16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Coolant_Pressure_scale = 0.1f;
+constexpr float Coolant_Pressure_offset = 0.0f;
+// Brake_Pressure_Rear: 23|16@0- (1,0) [-32768|32767] "kPa"
+constexpr int16_t Brake_Pressure_Rear(const uint8_t *d) { return (int16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Brake_Pressure_Rear_scale = 1.0f;
+constexpr float Brake_Pressure_Rear_offset = 0.0f;
+// Brake_Pressure_Front: 7|16@0- (1,0) [-32768|32767] "kPa"
+constexpr int16_t Brake_Pressure_Front(const uint8_t *d) { return (int16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Brake_Pressure_Front_scale = 1.0f;
+constexpr float Brake_Pressure_Front_offset = 0.0f;
+}  // namespace msg_655
+
+// ---- 0x656 M1_General_0x656 (4 signals) ----
+namespace msg_656 {
+constexpr uint32_t ID = 0x656;
+constexpr uint8_t DLC = 8;
+// Fuel_Flow: 55|16@0+ (0.01,0) [0|0] "ml/s"
+constexpr uint16_t Fuel_Flow(const uint8_t *d) { return (uint16_t)(((uint32_t)d[6] << 8) | d[7]); }
+constexpr float Fuel_Flow_scale = 0.01f;
+constexpr float Fuel_Flow_offset = 0.0f;
+// Airbox_Mass_Flow: 39|16@0+ (0.1,0) [0|0] "g/s"
+constexpr uint16_t Airbox_Mass_Flow(const uint8_t *d) { return (uint16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Airbox_Mass_Flow_scale = 0.1f;
+constexpr float Airbox_Mass_Flow_offset = 0.0f;
+// Inlet_Mass_Flow: 23|16@0+ (0.1,0) [0|0] "g/s"
+constexpr uint16_t Inlet_Mass_Flow(const uint8_t *d) { return (uint16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Inlet_Mass_Flow_scale = 0.1f;
+constexpr float Inlet_Mass_Flow_offset = 0.0f;
+// Steering_Angle: 7|16@0- (0.1,0) [0|0] "deg"
+constexpr int16_t Steering_Angle(const uint8_t *d) { return (int16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Steering_Angle_scale = 0.1f;
+constexpr float Steering_Angle_offset = 0.0f;
+}  // namespace msg_656
+
+// ---- 0x657 M1_General_0x657 (4 signals) ----
+namespace msg_657 {
+constexpr uint32_t ID = 0x657;
+constexpr uint8_t DLC = 8;
+// Gear_Output_Shaft_Speed: 55|16@0+ (1,0) [0|0] "RPM"
+constexpr uint16_t Gear_Output_Shaft_Speed(const uint8_t *d) { return (uint16_t)(((uint32_t)d[6] << 8) | d[7]); }
+constexpr float Gear_Output_Shaft_Speed_scale = 1.0f;
+constexpr float Gear_Output_Shaft_Speed_offset = 0.0f;
+// Gear_Input_Shaft_Speed: 39|16@0+ (1,0) [0|0] "RPM"
+constexpr uint16_t Gear_Input_Shaft_Speed(const uint8_t *d) { return (uint16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Gear_Input_Shaft_Speed_scale = 1.0f;
+constexpr float Gear_Input_Shaft_Speed_offset = 0.0f;
+// Fuel_Injector_Secondary_Pressure: 23|16@0- (0.1,0) [0|24000] "kPa"
+constexpr int16_t Fuel_Injector_Secondary_Pressure(const uint8_t *d) { return (int16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Fuel_Injector_Secondary_Pressure_scale = 0.1f;
+constexpr float Fuel_Injector_Secondary_Pressure_offset = 0.0f;
+// Fuel_Injector_Primary_Pressure: 7|16@0- (0.1,0) [0|24000] "kPa"
+constexpr int16_t Fuel_Injector_Primary_Pressure(const uint8_t *d) { return (int16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Fuel_Injector_Primary_Pressure_scale = 0.1f;
+constexpr float Fuel_Injector_Primary_Pressure_offset = 0.0f;
+}  // namespace msg_657
+
+// ---- 0x658 M1_General_0x658 (3 signals) ----
+namespace msg_658 {
+constexpr uint32_t ID = 0x658;
+constexpr uint8_t DLC = 8;
+// Vehicle_Accel_Vertical: 39|16@0- (0.001,0) [0|0] "g"
+constexpr int16_t Vehicle_Accel_Vertical(const uint8_t *d) { return (int16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Vehicle_Accel_Vertical_scale = 0.001f;
+constexpr float Vehicle_Accel_Vertical_offset = 0.0f;
+// Vehicle_Accel_Longitudinal: 23|16@0- (0.001,0) [0|0] "g"
+constexpr int16_t Vehicle_Accel_Longitudinal(const uint8_t *d) { return (int16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Vehicle_Accel_Longitudinal_scale = 0.001f;
+constexpr float Vehicle_Accel_Longitudinal_offset = 0.0f;
+// Vehicle_Accel_Lateral: 7|16@0- (0.001,0) [0|0] "g"
+constexpr int16_t Vehicle_Accel_Lateral(const uint8_t *d) { return (int16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Vehicle_Accel_Lateral_scale = 0.001f;
+constexpr float Vehicle_Accel_Lateral_offset = 0.0f;
+}  // namespace msg_658
+
+// ---- 0x659 M1_General_0x659 (5 signals) ----
+namespace msg_659 {
+constexpr uint32_t ID = 0x659;
+constexpr uint8_t DLC = 8;
+// Vehicle_Speed: 39|16@0+ (0.1,0) [0|6553.5] "km/h"
+constexpr uint16_t Vehicle_Speed(const uint8_t *d) { return (uint16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Vehicle_Speed_scale = 0.1f;
+constexpr float Vehicle_Speed_offset = 0.0f;
+// Ignition_Cylinder_12_Knock_Level: 31|8@0+ (1,0) [0|200] "%"
+constexpr uint8_t Ignition_Cylinder_12_Knock_Level(const uint8_t *d) { return (uint8_t)d[3]; }
+constexpr float Ignition_Cylinder_12_Knock_Level_scale = 1.0f;
+constexpr float Ignition_Cylinder_12_Knock_Level_offset = 0.0f;
+// Ignition_Cylinder_11_Knock_Level: 23|8@0+ (1,0) [0|200] "%"
+constexpr uint8_t Ignition_Cylinder_11_Knock_Level(const uint8_t *d) { return (uint8_t)d[2]; }
+constexpr float Ignition_Cylinder_11_Knock_Level_scale = 1.0f;
+constexpr float Ignition_Cylinder_11_Knock_Level_offset = 0.0f;
+// Ignition_Cylinder_10_Knock_Level: 15|8@0+ (1,0) [0|200] "%"
+constexpr uint8_t Ignition_Cylinder_10_Knock_Level(const uint8_t *d) { return (uint8_t)d[1]; }
+constexpr float Ignition_Cylinder_10_Knock_Level_scale = 1.0f;
+constexpr float Ignition_Cylinder_10_Knock_Level_offset = 0.0f;
+// Ignition_Cylinder_9_Knock_Level: 7|8@0+ (1,0) [0|200] "%"
+constexpr uint8_t Ignition_Cylinder_9_Knock_Level(const uint8_t *d) { return (uint8_t)d[0]; }
+constexpr float Ignition_Cylinder_9_Knock_Level_scale = 1.0f;
+constexpr float Ignition_Cylinder_9_Knock_Level_offset = 0.0f;
+}  // namespace msg_659
+
+// ---- 0x65A M1_General_0x65A (5 signals) ----
+namespace msg_65A {
+constexpr uint32_t ID = 0x65A;
+constexpr uint8_t DLC = 8;
+// M1_General_0x650_Version: 39|8@0+ (1,0) [0|0] ""
+constexpr uint8_t M1_General_0x650_Version(const uint8_t *d) { return (uint8_t)d[4]; }
+constexpr float M1_General_0x650_Version_scale = 1.0f;
+constexpr float M1_General_0x650_Version_offset = 0.0f;
+// Ignition_Cyl_12_Trim_Knock: 31|8@0+ (0.1,0) [0|25.5] "deg"
+constexpr uint8_t Ignition_Cyl_12_Trim_Knock(const uint8_t *d) { return (uint8_t)d[3]; }
+constexpr float Ignition_Cyl_12_Trim_Knock_scale = 0.1f;
+constexpr float Ignition_Cyl_12_Trim_Knock_offset = 0.0f;
+// Ignition_Cyl_11_Trim_Knock: 23|8@0+ (0.1,0) [0|25.5] "deg"
+constexpr uint8_t Ignition_Cyl_11_Trim_Knock(const uint8_t *d) { return (uint8_t)d[2]; }
+constexpr float Ignition_Cyl_11_Trim_Knock_scale = 0.1f;
+constexpr float Ignition_Cyl_11_Trim_Knock_offset = 0.0f;
+// Ignition_Cyl_10_Trim_Knock: 15|8@0+ (0.1,0) [0|25.5] "deg"
+constexpr uint8_t Ignition_Cyl_10_Trim_Knock(const uint8_t *d) { return (uint8_t)d[1]; }
+constexpr float Ignition_Cyl_10_Trim_Knock_scale = 0.1f;
+constexpr float Ignition_Cyl_10_Trim_Knock_offset = 0.0f;
+// Ignition_Cyl_9_Trim_Knock: 7|8@0+ (0.1,0) [0|25.5] "deg"
+constexpr uint8_t Ignition_Cyl_9_Trim_Knock(const uint8_t *d) { return (uint8_t)d[0]; }
+constexpr float Ignition_Cyl_9_Trim_Knock_scale = 0.1f;
+constexpr float Ignition_Cyl_9_Trim_Knock_offset = 0.0f;
+}  // namespace msg_65A
+
+// ---- 0x65B M1_General_0x65B (4 signals) ----
+namespace msg_65B {
+constexpr uint32_t ID = 0x65B;
+constexpr uint8_t DLC = 8;
+// Lap_Distance: 55|16@0+ (1,0) [0|0] "m"
+constexpr uint16_t Lap_Distance(const uint8_t *d) { return (uint16_t)(((uint32_t)d[6] << 8) | d[7]); }
+constexpr float Lap_Distance_scale = 1.0f;
+constexpr float Lap_Distance_offset = 0.0f;
+// Lap_Number: 39|16@0+ (1,0) [0|0] ""
+constexpr uint16_t Lap_Number(const uint8_t *d) { return (uint16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Lap_Number_scale = 1.0f;
+constexpr float Lap_Number_offset = 0.0f;
+// Lap_Time_Running: 23|16@0+ (0.01,0) [0|0] "s"
+constexpr uint16_t Lap_Time_Running(const uint8_t *d) { return (uint16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Lap_Time_Running_scale = 0.01f;
+constexpr float Lap_Time_Running_offset = 0.0f;
+// Lap_Time: 7|16@0+ (0.01,0) [0|0] "s"
+constexpr uint16_t Lap_Time(const uint8_t *d) { return (uint16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Lap_Time_scale = 0.01f;
+constexpr float Lap_Time_offset = 0.0f;
+}  // namespace msg_65B
+
+// ---- 0x65C M1_General_0x65C (3 signals) ----
+namespace msg_65C {
+constexpr uint32_t ID = 0x65C;
+constexpr uint8_t DLC = 8;
+// Differential_Temperature: 7|16@0- (0.1,0) [-30|160] "C"
+constexpr int16_t Differential_Temperature(const uint8_t *d) { return (int16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Differential_Temperature_scale = 0.1f;
+constexpr float Differential_Temperature_offset = 0.0f;
+// Driver_Rotary_Switch_8: 31|8@0- (1,0) [0|0] ""
+constexpr int8_t Driver_Rotary_Switch_8(const uint8_t *d) { return (int8_t)d[3]; }
+constexpr float Driver_Rotary_Switch_8_scale = 1.0f;
+constexpr float Driver_Rotary_Switch_8_offset = 0.0f;
+// Driver_Rotary_Switch_7: 23|8@0- (1,0) [0|0] ""
+constexpr int8_t Driver_Rotary_Switch_7(const uint8_t *d) { return (int8_t)d[2]; }
+constexpr float Driver_Rotary_Switch_7_scale = 1.0f;
+constexpr float Driver_Rotary_Switch_7_offset = 0.0f;
+}  // namespace msg_65C
+
+// ---- 0x65E M1_General_0x65E (3 signals) ----
+namespace msg_65E {
+constexpr uint32_t ID = 0x65E;
+constexpr uint8_t DLC = 8;
+// Engine_Crank_Case_Pressure: 39|16@0- (0.1,0) [0|24000] "kPa"
+constexpr int16_t Engine_Crank_Case_Pressure(const uint8_t *d) { return (int16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Engine_Crank_Case_Pressure_scale = 0.1f;
+constexpr float Engine_Crank_Case_Pressure_offset = 0.0f;
+// Exhaust_Pressure_Bank_2: 23|16@0- (0.1,0) [0|24000] "kPa"
+constexpr int16_t Exhaust_Pressure_Bank_2(const uint8_t *d) { return (int16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Exhaust_Pressure_Bank_2_scale = 0.1f;
+constexpr float Exhaust_Pressure_Bank_2_offset = 0.0f;
+// Exhaust_Pressure_Bank_1: 7|16@0- (0.1,0) [0|24000] "kPa"
+constexpr int16_t Exhaust_Pressure_Bank_1(const uint8_t *d) { return (int16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Exhaust_Pressure_Bank_1_scale = 0.1f;
+constexpr float Exhaust_Pressure_Bank_1_offset = 0.0f;
+}  // namespace msg_65E
+
+// ---- 0x65F M1_General_0x65F (3 signals) ----
+namespace msg_65F {
+constexpr uint32_t ID = 0x65F;
+constexpr uint8_t DLC = 8;
+// Vehicle_Speed_Limit: 39|16@0+ (0.1,0) [0|6553.5] "km/h"
+constexpr uint16_t Vehicle_Speed_Limit(const uint8_t *d) { return (uint16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Vehicle_Speed_Limit_scale = 0.1f;
+constexpr float Vehicle_Speed_Limit_offset = 0.0f;
+// Logging_System_1_Used: 23|16@0+ (0.1,0) [0|0] "%"
+constexpr uint16_t Logging_System_1_Used(const uint8_t *d) { return (uint16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Logging_System_1_Used_scale = 0.1f;
+constexpr float Logging_System_1_Used_offset = 0.0f;
+// Knock_Threshold: 7|16@0+ (0.1,0) [0|200] "%"
+constexpr uint16_t Knock_Threshold(const uint8_t *d) { return (uint16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Knock_Threshold_scale = 0.1f;
+constexpr float Knock_Threshold_offset = 0.0f;
+}  // namespace msg_65F
+
+// ---- 0x670 M1_Flex_Fuel_0x670 (8 signals) ----
+namespace msg_670 {
+constexpr uint32_t ID = 0x670;
+constexpr uint8_t DLC = 8;
+// Fuel_Composition_Sensor_Diag: 3|4@0- (1,0) [-8|7] ""
+constexpr int8_t Fuel_Composition_Sensor_Diag(const uint8_t *d) { return (int8_t)((int32_t)((uint32_t)(d[0] & 0xF) << 28) >> 28); }
+constexpr float Fuel_Composition_Sensor_Diag_scale = 1.0f;
+constexpr float Fuel_Composition_Sensor_Diag_offset = 0.0f;
+// Alt_Fuel_Ignition_Timing: 55|8@0- (0.5,0) [0|0] "deg"
+constexpr int8_t Alt_Fuel_Ignition_Timing(const uint8_t *d) { return (int8_t)d[6]; }
+constexpr float Alt_Fuel_Ignition_Timing_scale = 0.5f;
+constexpr float Alt_Fuel_Ignition_Timing_offset = 0.0f;
+// Fuel_Composition: 47|8@0+ (1,0) [0|0] "%"
+constexpr uint8_t Fuel_Composition(const uint8_t *d) { return (uint8_t)d[5]; }
+constexpr float Fuel_Composition_scale = 1.0f;
+constexpr float Fuel_Composition_offset = 0.0f;
+// Alt_Fuel_Mixture_Aim_Blend: 39|8@0+ (1,0) [0|0] "%"
+constexpr uint8_t Alt_Fuel_Mixture_Aim_Blend(const uint8_t *d) { return (uint8_t)d[4]; }
+constexpr float Alt_Fuel_Mixture_Aim_Blend_scale = 1.0f;
+constexpr float Alt_Fuel_Mixture_Aim_Blend_offset = 0.0f;
+// Alt_Fuel_Ignition_Timing_Blend: 31|8@0+ (1,0) [0|0] "%"
+constexpr uint8_t Alt_Fuel_Ignition_Timing_Blend(const uint8_t *d) { return (uint8_t)d[3]; }
+constexpr float Alt_Fuel_Ignition_Timing_Blend_scale = 1.0f;
+constexpr float Alt_Fuel_Ignition_Timing_Blend_offset = 0.0f;
+// Alt_Fuel_Timing_Secondary_Blend: 23|8@0+ (1,0) [0|0] "%"
+constexpr uint8_t Alt_Fuel_Timing_Secondary_Blend(const uint8_t *d) { return (uint8_t)d[2]; }
+constexpr float Alt_Fuel_Timing_Secondary_Blend_scale = 1.0f;
+constexpr float Alt_Fuel_Timing_Secondary_Blend_offset = 0.0f;
+// Alt_Fuel_Timing_Primary_Blend: 15|8@0+ (1,0) [0|0] "%"
+constexpr uint8_t Alt_Fuel_Timing_Primary_Blend(const uint8_t *d) { return (uint8_t)d[1]; }
+constexpr float Alt_Fuel_Timing_Primary_Blend_scale = 1.0f;
+constexpr float Alt_Fuel_Timing_Primary_Blend_offset = 0.0f;
+// Alternative_Fuel_Mode: 7|4@0- (1,0) [0|0] ""
+constexpr int8_t Alternative_Fuel_Mode(const uint8_t *d) { return (int8_t)((int32_t)((uint32_t)(d[0] >> 4) << 28) >> 28); }
+constexpr float Alternative_Fuel_Mode_scale = 1.0f;
+constexpr float Alternative_Fuel_Mode_offset = 0.0f;
+}  // namespace msg_670
+
+// ---- 0x671 M1_Flex_Fuel_0x671 (3 signals) ----
+namespace msg_671 {
+constexpr uint32_t ID = 0x671;
+constexpr uint8_t DLC = 8;
+// Alt_Fuel_Mixture_Aim: 39|16@0+ (0.01,0) [0|2] "LA"
+constexpr uint16_t Alt_Fuel_Mixture_Aim(const uint8_t *d) { return (uint16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Alt_Fuel_Mixture_Aim_scale = 0.01f;
+constexpr float Alt_Fuel_Mixture_Aim_offset = 0.0f;
+// Alt_Fuel_Timing_Secondary: 23|16@0- (0.1,0) [-720|720] "deg"
+constexpr int16_t Alt_Fuel_Timing_Secondary(const uint8_t *d) { return (int16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Alt_Fuel_Timing_Secondary_scale = 0.1f;
+constexpr float Alt_Fuel_Timing_Secondary_offset = 0.0f;
+// Alt_Fuel_Timing_Primary: 7|16@0- (0.1,0) [-720|720] "deg"
+constexpr int16_t Alt_Fuel_Timing_Primary(const uint8_t *d) { return (int16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Alt_Fuel_Timing_Primary_scale = 0.1f;
+constexpr float Alt_Fuel_Timing_Primary_offset = 0.0f;
+}  // namespace msg_671
+
+// ---- 0x672 M1_Flex_Fuel_0x672 (6 signals) ----
+namespace msg_672 {
+constexpr uint32_t ID = 0x672;
+constexpr uint8_t DLC = 8;
+// Alt_Fuel_Pressure_Warning: 33|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Alt_Fuel_Pressure_Warning(const uint8_t *d) { return (uint8_t)((d[4] >> 1) & 0x1); }
+constexpr float Alt_Fuel_Pressure_Warning_scale = 1.0f;
+constexpr float Alt_Fuel_Pressure_Warning_offset = 0.0f;
+// Alt_Fuel_Pump_State: 39|4@0- (1,0) [-8|7] ""
+constexpr int8_t Alt_Fuel_Pump_State(const uint8_t *d) { return (int8_t)((int32_t)((uint32_t)(d[4] >> 4) << 28) >> 28); }
+constexpr float Alt_Fuel_Pump_State_scale = 1.0f;
+constexpr float Alt_Fuel_Pump_State_offset = 0.0f;
+// Alt_Fuel_Pump_On: 32|1@0+ (1,0) [0|1] ""
+constexpr uint8_t Alt_Fuel_Pump_On(const uint8_t *d) { return (uint8_t)(d[4] & 0x1); }
+constexpr float Alt_Fuel_Pump_On_scale = 1.0f;
+constexpr float Alt_Fuel_Pump_On_offset = 0.0f;
+// Alt_Fuel_Contribution_Efficiency: 31|8@0+ (1,0) [0|0] "%"
+constexpr uint8_t Alt_Fuel_Contribution_Efficiency(const uint8_t *d) { return (uint8_t)d[3]; }
+constexpr float Alt_Fuel_Contribution_Efficiency_scale = 1.0f;
+constexpr float Alt_Fuel_Contribution_Efficiency_offset = 0.0f;
+// Alt_Fuel_Temperature: 23|8@0+ (1,-40) [-40|215] "C"
+constexpr uint8_t Alt_Fuel_Temperature(const uint8_t *d) { return (uint8_t)d[2]; }
+constexpr float Alt_Fuel_Temperature_scale = 1.0f;
+constexpr float Alt_Fuel_Temperature_offset = -40.0f;
+// Alt_Fuel_Pressure_Sensor: 7|16@0+ (0.1,0) [0|1000] "kPa"
+constexpr uint16_t Alt_Fuel_Pressure_Sensor(const uint8_t *d) { return (uint16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Alt_Fuel_Pressure_Sensor_scale = 0.1f;
+constexpr float Alt_Fuel_Pressure_Sensor_offset = 0.0f;
+}  // namespace msg_672
+
+// ---- 0x6A0 M1_General_0x6A0 (4 signals) ----
+namespace msg_6A0 {
+constexpr uint32_t ID = 0x6A0;
+constexpr uint8_t DLC = 8;
+// Auxillary_Output_4_Duty_Cycle: 55|16@0- (0.1,0) [0|0] "%"
+constexpr int16_t Auxillary_Output_4_Duty_Cycle(const uint8_t *d) { return (int16_t)(((uint32_t)d[6] << 8) | d[7]); }
+constexpr float Auxillary_Output_4_Duty_Cycle_scale = 0.1f;
+constexpr float Auxillary_Output_4_Duty_Cycle_offset = 0.0f;
+// Auxillary_Output_3_Duty_Cycle: 39|16@0- (0.1,0) [0|0] "%"
+constexpr int16_t Auxillary_Output_3_Duty_Cycle(const uint8_t *d) { return (int16_t)(((uint32_t)d[4] << 8) | d[5]); }
+constexpr float Auxillary_Output_3_Duty_Cycle_scale = 0.1f;
+constexpr float Auxillary_Output_3_Duty_Cycle_offset = 0.0f;
+// Auxillary_Output_2_Duty_Cycle: 23|16@0- (0.1,0) [0|0] "%"
+constexpr int16_t Auxillary_Output_2_Duty_Cycle(const uint8_t *d) { return (int16_t)(((uint32_t)d[2] << 8) | d[3]); }
+constexpr float Auxillary_Output_2_Duty_Cycle_scale = 0.1f;
+constexpr float Auxillary_Output_2_Duty_Cycle_offset = 0.0f;
+// Auxillary_Output_1_Duty_Cycle: 7|16@0- (0.1,0) [0|0] "%"
+constexpr int16_t Auxillary_Output_1_Duty_Cycle(const uint8_t *d) { return (int16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Auxillary_Output_1_Duty_Cycle_scale = 0.1f;
+constexpr float Auxillary_Output_1_Duty_Cycle_offset = 0.0f;
+}  // namespace msg_6A0
+
+// ---- 0x6A1 M1_General_0x6A1 (1 signals) ----
+namespace msg_6A1 {
+constexpr uint32_t ID = 0x6A1;
+constexpr uint8_t DLC = 8;
+// Auxillary_Output_5_Duty_Cycle: 7|16@0+ (0.1,0) [0|0] "%"
+constexpr uint16_t Auxillary_Output_5_Duty_Cycle(const uint8_t *d) { return (uint16_t)(((uint32_t)d[0] << 8) | d[1]); }
+constexpr float Auxillary_Output_5_Duty_Cycle_scale = 0.1f;
+constexpr float Auxillary_Output_5_Duty_Cycle_offset = 0.0f;
+}  // namespace msg_6A1
+
+// Sorted ID dispatch table: message_index() maps an ID to 0..MESSAGE_COUNT-1
+constexpr uint32_t MESSAGE_IDS[] = {
+  0x118, 0x119, 0x11A, 0x640, 0x641, 0x642, 0x643, 0x644,
+  0x645, 0x646, 0x647, 0x648, 0x649, 0x64A, 0x64B, 0x64C,
+  0x64D, 0x64E, 0x64F, 0x650, 0x651, 0x652, 0x653, 0x654,
+  0x655, 0x656, 0x657, 0x658, 0x659, 0x65A, 0x65B, 0x65C,
+  0x65E, 0x65F, 0x670, 0x671, 0x672, 0x6A0, 0x6A1,
+};
+constexpr int MESSAGE_COUNT = 39;
+constexpr int SIGNAL_COUNT = 259;
+
+// Binary search over MESSAGE_IDS; -1 when the ID is not in the DBC
+constexpr int message_index(uint32_t id) {
+  int lo = 0, hi = MESSAGE_COUNT - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    if (MESSAGE_IDS[mid] == id) return mid;
+    if (MESSAGE_IDS[mid] < id) lo = mid + 1; else hi = mid - 1;
+  }
+  return -1;
+}
+
+}  // namespace m1
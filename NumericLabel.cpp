@@ -0,0 +1,268 @@
+#include "NumericLabel.h"
+#include <esp_heap_caps.h>
+#include <string.h>
+
+// Tiles: '0'-'9', then '-' (both in digit cells) and '.' (its own pitch)
+#define TILE_MINUS 10
+#define TILE_DOT   11
+#define TILE_COUNT 12
+#define TILE_NONE  0xFF
+
+typedef struct {
+  const RotatedGlyph *glyph[TILE_COUNT];
+  int16_t pitch[TILE_COUNT];     // Cell length along the text
+  int16_t shift[TILE_COUNT];     // Glyph offset that centres it in its cell
+  int16_t x0[TILE_COUNT];        // Tile columns [x0, x0 + w) across the line
+  int16_t w[TILE_COUNT];
+} NumericMetrics;
+
+typedef struct {
+  const RotatedFont *font;       // NULL = slot free
+  lv_color_t fg;
+  lv_color_t bg;
+  uint8_t refs;
+  uint16_t *pixels;
+  size_t pixel_bytes;
+  lv_image_dsc_t tiles[TILE_COUNT];
+} NumericTileSet;
+
+typedef struct {
+  const RotatedFont *font;
+  NumericMetrics m;
+  NumericTileSet *set;
+  lv_color_t fg;
+  lv_color_t bg;
+  lv_obj_t *cells[NUMERIC_LABEL_CELLS];
+  uint8_t tile[NUMERIC_LABEL_CELLS];   // TILE_NONE = blank
+  int16_t pos[NUMERIC_LABEL_CELLS];    // Cell start along the text
+} NumericLabel;
+
+static NumericTileSet tile_sets[NUMERIC_LABEL_TILE_SETS];
+
+static uint8_t tile_index(char c) {
+  if (c >= '0' && c <= '9') return (uint8_t)(c - '0');
+  if (c == '-') return TILE_MINUS;
+  if (c == '.') return TILE_DOT;
+  return TILE_NONE;
+}
+
+static const RotatedGlyph *find_glyph(const RotatedFont *font, uint16_t cp) {
+  for (uint16_t i = 0; i < font->glyph_count; i++) {
+    if (font->glyphs[i].codepoint == cp) return &font->glyphs[i];
+  }
+  return NULL;
+}
+
+// Cell pitches use RotatedLabel's rounded advances, so a field of digits lands
+// exactly where the proportional label put it
+static void measure(const RotatedFont *font, NumericMetrics *m) {
+  static const char chars[TILE_COUNT + 1] = "0123456789-.";
+  int16_t digit_pitch = 0;
+  memset(m, 0, sizeof(*m));
+  for (uint8_t t = 0; t < TILE_COUNT; t++) {
+    m->glyph[t] = find_glyph(font, (uint8_t)chars[t]);
+    if (t <= 9 && m->glyph[t] != NULL) {
+      int16_t adv = (int16_t)((m->glyph[t]->adv16 + 8) >> 4);
+      if (adv > digit_pitch) digit_pitch = adv;
+    }
+  }
+
+  // Digit cells share one column range so any tile overwrites any other
+  int16_t lo = INT16_MAX, hi = INT16_MIN;
+  for (uint8_t t = 0; t < TILE_COUNT; t++) {
+    const RotatedGlyph *g = m->glyph[t];
+    m->pitch[t] = t == TILE_DOT && g != NULL ? (int16_t)((g->adv16 + 8) >> 4) : digit_pitch;
+    if (g == NULL || g->image == NULL) continue;
+    m->shift[t] = t == TILE_DOT ? 0 : (int16_t)((digit_pitch - ((g->adv16 + 8) >> 4)) / 2);
+    if (t == TILE_DOT) {
+      m->x0[t] = g->x;
+      m->w[t] = (int16_t)g->image->header.w;
+    } else {
+      if (g->x < lo) lo = g->x;
+      if (g->x + (int16_t)g->image->header.w > hi) hi = (int16_t)(g->x + g->image->header.w);
+    }
+  }
+  for (uint8_t t = 0; t < TILE_DOT; t++) {
+    m->x0[t] = lo < hi ? lo : 0;
+    m->w[t] = lo < hi ? (int16_t)(hi - lo) : 0;
+  }
+}
+
+// Blend every glyph over the background; anything outside its cell is clipped
+static void render_tiles(NumericTileSet *set, const NumericMetrics *m) {
+  uint16_t bg = lv_color_to_u16(set->bg);
+  uint16_t *px = set->pixels;
+  for (uint8_t t = 0; t < TILE_COUNT; t++) {
+    lv_image_dsc_t *dsc = &set->tiles[t];
+    int32_t w = m->w[t], h = m->pitch[t];
+    memset(dsc, 0, sizeof(*dsc));
+    dsc->header.magic = LV_IMAGE_HEADER_MAGIC;
+    dsc->header.cf = LV_COLOR_FORMAT_RGB565;
+    dsc->header.w = w;
+    dsc->header.h = h;
+    dsc->header.stride = w * 2;
+    dsc->data_size = w * h * 2;
+    dsc->data = (const uint8_t *)px;
+
+    for (int32_t i = 0; i < w * h; i++) px[i] = bg;
+    const RotatedGlyph *g = m->glyph[t];
+    if (g != NULL && g->image != NULL) {
+      const lv_image_dsc_t *a8 = g->image;
+      for (int32_t r = 0; r < (int32_t)a8->header.h; r++) {
+        int32_t y = g->y + m->shift[t] + r;
+        if (y < 0 || y >= h) continue;
+        const uint8_t *src = a8->data + r * a8->header.stride;
+        for (int32_t c = 0; c < (int32_t)a8->header.w; c++) {
+          int32_t x = g->x - m->x0[t] + c;
+          if (x < 0 || x >= w || src[c] == 0) continue;
+          px[y * w + x] = lv_color_to_u16(lv_color_mix(set->fg, set->bg, src[c]));
+        }
+      }
+    }
+    lv_image_cache_drop(dsc);
+    px += w * h;
+  }
+}
+
+static void release_tiles(NumericTileSet *set) {
+  if (set != NULL && set->refs > 0) set->refs--;
+}
+
+// Shared set for these colours, rendering one into a free slot if needed
+static NumericTileSet *acquire_tiles(const RotatedFont *font, const NumericMetrics *m, lv_color_t fg, lv_color_t bg) {
+  NumericTileSet *free_set = NULL;
+  for (uint8_t i = 0; i < NUMERIC_LABEL_TILE_SETS; i++) {
+    NumericTileSet *set = &tile_sets[i];
+    if (set->font == font && lv_color_eq(set->fg, fg) && lv_color_eq(set->bg, bg)) {
+      set->refs++;
+      return set;
+    }
+    // Reuse an allocated slot before growing into an empty one
+    if (set->refs == 0 && (free_set == NULL || free_set->pixels == NULL)) free_set = set;
+  }
+  if (free_set == NULL) {
+    LV_LOG_WARN("numeric label: no free tile set");
+    return NULL;
+  }
+
+  size_t bytes = 0;
+  for (uint8_t t = 0; t < TILE_COUNT; t++) bytes += (size_t)m->w[t] * m->pitch[t] * 2;
+  if (free_set->pixel_bytes < bytes) {
+    if (free_set->pixels != NULL) heap_caps_free(free_set->pixels);
+    free_set->pixels = (uint16_t *)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    free_set->pixel_bytes = free_set->pixels != NULL ? bytes : 0;
+    if (free_set->pixels == NULL) {
+      free_set->font = NULL;
+      LV_LOG_WARN("numeric label: no internal RAM for %u byte tile set", (unsigned)bytes);
+      return NULL;
+    }
+  }
+  free_set->font = font;
+  free_set->fg = fg;
+  free_set->bg = bg;
+  free_set->refs = 1;
+  render_tiles(free_set, m);
+  return free_set;
+}
+
+// Point every visible cell at the current set
+static void apply_tiles(lv_obj_t *obj, NumericLabel *st) {
+  // Release first so the label's own slot can be re-rendered in place
+  release_tiles(st->set);
+  NumericTileSet *set = acquire_tiles(st->font, &st->m, st->fg, st->bg);
+  if (set == NULL) {
+    if (st->set != NULL) st->set->refs++; // Keep the old colours rather than drawing nothing
+    return;
+  }
+  st->set = set;
+  for (uint8_t i = 0; i < NUMERIC_LABEL_CELLS; i++) {
+    if (st->tile[i] != TILE_NONE) lv_image_set_src(st->cells[i], &set->tiles[st->tile[i]]);
+  }
+  // The slot may have been re-rendered at the same address
+  lv_obj_invalidate(obj);
+}
+
+static void delete_cb(lv_event_t *e) {
+  lv_obj_t *obj = (lv_obj_t *)lv_event_get_target(e);
+  NumericLabel *st = (NumericLabel *)lv_obj_get_user_data(obj);
+  if (st == NULL) return;
+  release_tiles(st->set);
+  lv_free(st);
+}
+
+lv_obj_t *numeric_label_create(lv_obj_t *parent, const RotatedFont *font, lv_color_t color, lv_color_t bg) {
+  lv_obj_t *obj = lv_obj_create(parent);
+  lv_obj_remove_style_all(obj);
+  lv_obj_clear_flag(obj, (lv_obj_flag_t)(LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE));
+  lv_obj_add_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+  lv_obj_set_size(obj, font->line_height, 0);
+
+  NumericLabel *st = (NumericLabel *)lv_malloc(sizeof(NumericLabel));
+  LV_ASSERT_MALLOC(st);
+  memset(st, 0, sizeof(*st));
+  st->font = font;
+  measure(font, &st->m);
+  st->fg = color;
+  st->bg = bg;
+  for (uint8_t i = 0; i < NUMERIC_LABEL_CELLS; i++) {
+    lv_obj_t *cell = lv_image_create(obj);
+    lv_obj_clear_flag(cell, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_flag(cell, LV_OBJ_FLAG_HIDDEN);
+    st->cells[i] = cell;
+    st->tile[i] = TILE_NONE;
+    st->pos[i] = INT16_MIN;
+  }
+  st->set = acquire_tiles(font, &st->m, color, bg);
+  lv_obj_set_user_data(obj, st);
+  lv_obj_add_event_cb(obj, delete_cb, LV_EVENT_DELETE, NULL);
+  return obj;
+}
+
+void numeric_label_set_pos(lv_obj_t *obj, int32_t x, int32_t y) {
+  NumericLabel *st = (NumericLabel *)lv_obj_get_user_data(obj);
+  lv_obj_set_pos(obj, x - st->font->line_height, y);
+}
+
+void numeric_label_set_text(lv_obj_t *obj, const char *text) {
+  NumericLabel *st = (NumericLabel *)lv_obj_get_user_data(obj);
+  int32_t pen = 0;
+  for (uint8_t i = 0; i < NUMERIC_LABEL_CELLS; i++) {
+    char c = *text;
+    if (c) text++;
+    uint8_t t = c ? tile_index(c) : TILE_NONE;
+    lv_obj_t *cell = st->cells[i];
+
+    if (t == TILE_NONE || st->set == NULL) {
+      // Blank: hiding the cell lets the parent's background show through
+      if (st->tile[i] != TILE_NONE) lv_obj_add_flag(cell, LV_OBJ_FLAG_HIDDEN);
+      st->tile[i] = TILE_NONE;
+    } else {
+      if (st->tile[i] != t || st->pos[i] != pen) {
+        // '.' tiles are narrower than digit tiles, so the column can change too
+        lv_obj_set_pos(cell, st->m.x0[t], pen);
+        st->pos[i] = (int16_t)pen;
+      }
+      if (st->tile[i] != t) {
+        lv_image_set_src(cell, &st->set->tiles[t]);
+        if (st->tile[i] == TILE_NONE) lv_obj_clear_flag(cell, LV_OBJ_FLAG_HIDDEN);
+        st->tile[i] = t;
+      }
+    }
+    if (c) pen += st->m.pitch[t == TILE_NONE ? 0 : t];
+  }
+  if (lv_obj_get_height(obj) != pen) lv_obj_set_height(obj, pen);
+}
+
+void numeric_label_set_color(lv_obj_t *obj, lv_color_t color) {
+  NumericLabel *st = (NumericLabel *)lv_obj_get_user_data(obj);
+  if (lv_color_eq(st->fg, color)) return;
+  st->fg = color;
+  apply_tiles(obj, st);
+}
+
+void numeric_label_set_bg_color(lv_obj_t *obj, lv_color_t bg) {
+  NumericLabel *st = (NumericLabel *)lv_obj_get_user_data(obj);
+  if (lv_color_eq(st->bg, bg)) return;
+  st->bg = bg;
+  apply_tiles(obj, st);
+}
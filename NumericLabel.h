@@ -0,0 +1,33 @@
+#pragma once
+#include <lvgl.h>
+#include <stdint.h>
+#include "RotatedLabel.h"
+
+// ============================================================================
+// NUMERIC LABEL
+// ----------------------------------------------------------------------------
+// Fixed-width field for the 48 px gauge values, which only ever show
+// "0-9", '.', '-' and spaces (fx_format_value(): 4 or 5 columns). Each
+// column is a cell of fixed pitch: digits, '-' and spaces take the digit
+// advance, '.' its own, so a value's right edge never moves and a changed
+// digit never shifts its neighbours.
+//
+// The glyphs of a RotatedFont are blended once against the foreground and
+// background colour into opaque RGB565 tiles in internal RAM, each covering
+// its whole cell. A cell is one lv_image: a new digit is a src swap that
+// invalidates that cell only, and drawing it is a straight copy with no
+// alpha blend or recolor. Tile sets are shared by labels with the same
+// colours and re-rendered when a colour changes, so the background colour
+// must be kept in step with whatever is behind the label.
+// ============================================================================
+
+#define NUMERIC_LABEL_CELLS     5  // Widest fx_format_value() field ("100.0")
+#define NUMERIC_LABEL_TILE_SETS 2  // Colour pairs held at once, one per value label
+
+lv_obj_t *numeric_label_create(lv_obj_t *parent, const RotatedFont *font, lv_color_t color, lv_color_t bg);
+// Same anchor as rotated_label_set_pos()
+void numeric_label_set_pos(lv_obj_t *obj, int32_t x, int32_t y);
+// ASCII; characters outside the tile set draw as blank cells
+void numeric_label_set_text(lv_obj_t *obj, const char *text);
+void numeric_label_set_color(lv_obj_t *obj, lv_color_t color);
+void numeric_label_set_bg_color(lv_obj_t *obj, lv_color_t bg);
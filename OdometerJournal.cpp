@@ -0,0 +1,119 @@
+#include "OdometerJournal.h"
+#include <string.h>
+
+#define ODO_MAGIC    0x4F44  // "OD"
+#define ODO_VERSION  1
+
+// One slot, little-endian as stored
+typedef struct {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t screen_mode;
+  uint32_t sequence;     // 1, 2, ...; never 0 or 0xFFFFFFFF
+  uint32_t odometer;
+  uint32_t trip;
+  uint32_t trip2;
+  uint8_t reserved[8];   // 0xFF
+  uint32_t crc;          // Of everything before it
+} OdoRecord;
+
+static_assert(sizeof(OdoRecord) == ODO_RECORD_BYTES, "OdoRecord must fill one slot");
+static_assert(ODO_SECTOR_BYTES % ODO_RECORD_BYTES == 0, "Records must not straddle sectors");
+
+uint32_t odo_crc32(const void *data, size_t len) {
+  const uint8_t *p = (const uint8_t *)data;
+  uint32_t crc = 0xFFFFFFFFu;
+  while (len--) {
+    crc ^= *p++;
+    for (int i = 0; i < 8; i++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+  }
+  return ~crc;
+}
+
+static bool record_valid(const OdoRecord *r) {
+  return r->magic == ODO_MAGIC && r->version == ODO_VERSION && r->sequence != 0 &&
+         r->sequence != 0xFFFFFFFFu && r->crc == odo_crc32(r, offsetof(OdoRecord, crc));
+}
+
+static bool slot_blank(const OdoRecord *r) {
+  const uint8_t *p = (const uint8_t *)r;
+  for (size_t i = 0; i < sizeof(*r); i++) {
+    if (p[i] != 0xFF) return false;
+  }
+  return true;
+}
+
+static void advance(OdoJournal *j) {
+  j->next_offset += ODO_RECORD_BYTES;
+  if (j->next_offset >= j->flash.size) j->next_offset = 0;
+  if (j->next_offset % ODO_SECTOR_BYTES == 0) j->erase_next = true;
+}
+
+bool odo_journal_mount(OdoJournal *j, const OdoFlash *flash, OdoState *state) {
+  memset(j, 0, sizeof(*j));
+  j->flash = *flash;
+
+  OdoRecord r, newest = {};
+  uint32_t newest_offset = 0;
+  for (uint32_t offset = 0; offset + ODO_RECORD_BYTES <= flash->size; offset += ODO_RECORD_BYTES) {
+    if (!flash->read(flash->ctx, offset, &r, sizeof(r)) || !record_valid(&r)) continue;
+    if (j->sequence == 0 || r.sequence > j->sequence) {
+      j->sequence = r.sequence;
+      newest = r;
+      newest_offset = offset;
+    }
+  }
+
+  if (j->sequence == 0) {
+    // Blank or unreadable: start at the first sector, erased before use
+    j->next_offset = 0;
+    j->erase_next = true;
+    return false;
+  }
+  j->next_offset = newest_offset;
+  advance(j);
+  state->odometer = newest.odometer;
+  state->trip = newest.trip;
+  state->trip2 = newest.trip2;
+  state->screen_mode = newest.screen_mode;
+  return true;
+}
+
+bool odo_journal_commit(OdoJournal *j, const OdoState *state) {
+  OdoRecord r;
+  memset(&r, 0xFF, sizeof(r));
+  r.magic = ODO_MAGIC;
+  r.version = ODO_VERSION;
+  r.screen_mode = state->screen_mode;
+  r.sequence = j->sequence + 1;  // 2^32 - 2 commits is ~270 years at one per 2 s
+  r.odometer = state->odometer;
+  r.trip = state->trip;
+  r.trip2 = state->trip2;
+  r.crc = odo_crc32(&r, offsetof(OdoRecord, crc));
+
+  // Skip slots a torn write left behind, and slots whose write fails to read
+  // back; give up after a full sector of them
+  for (uint32_t tries = 0; tries <= ODO_RECORDS_PER_SECTOR; tries++) {
+    if (j->erase_next) {
+      if (!j->flash.erase_sector(j->flash.ctx, j->next_offset)) return false;
+      j->erase_next = false;
+      j->erases++;
+    }
+    OdoRecord slot;
+    if (!j->flash.read(j->flash.ctx, j->next_offset, &slot, sizeof(slot))) return false;
+    if (!slot_blank(&slot)) {
+      advance(j);
+      continue;
+    }
+    bool written = j->flash.write(j->flash.ctx, j->next_offset, &r, sizeof(r)) &&
+                   j->flash.read(j->flash.ctx, j->next_offset, &slot, sizeof(slot)) &&
+                   memcmp(&slot, &r, sizeof(r)) == 0;
+    advance(j);
+    if (written) {
+      j->sequence = r.sequence;
+      j->records++;
+      return true;
+    }
+  }
+  return false;
+}
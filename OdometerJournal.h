@@ -0,0 +1,64 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================================
+// ODOMETER JOURNAL
+// ----------------------------------------------------------------------------
+// Odometer, trips and screen mode as an append-only log of 32-byte records in
+// a raw flash partition (label "odometer"), instead of rewriting NVS keys.
+// Each record carries a sequence number and a CRC-32; mounting scans the
+// partition and takes the valid record with the highest sequence, so a power
+// cut during a write or an erase costs at most the record in flight.
+//
+// The partition is a ring of 4 KB sectors. Records fill a sector in order;
+// the next sector is erased only when the write position reaches it, so the
+// newest records always survive an interrupted erase. A slot that is not
+// blank (a torn write) is skipped, never written over. Each sector is erased
+// once per trip around the ring: see tools/odometer_journal_check for the
+// power-cut simulation and the wear estimate.
+//
+// No Arduino or ESP-IDF dependencies: flash access goes through OdoFlash,
+// backed by esp_partition_* in the sketch and by a NOR model on the host.
+// ============================================================================
+
+#define ODO_JOURNAL_LABEL        "odometer"  // partitions.csv: odometer, data, 0x40, , 0x8000
+#define ODO_JOURNAL_COMMIT_MS    2000        // Commit interval while the values change
+#define ODO_SECTOR_BYTES         4096
+#define ODO_RECORD_BYTES         32
+#define ODO_RECORDS_PER_SECTOR   (ODO_SECTOR_BYTES / ODO_RECORD_BYTES)
+
+typedef struct {
+  uint32_t odometer;     // Hundredths of miles
+  uint32_t trip;
+  uint32_t trip2;
+  uint8_t screen_mode;
+} OdoState;
+
+// Erased flash reads 0xFF; writes can only clear bits
+typedef struct {
+  bool (*read)(void *ctx, uint32_t offset, void *dst, uint32_t len);
+  bool (*write)(void *ctx, uint32_t offset, const void *src, uint32_t len);
+  bool (*erase_sector)(void *ctx, uint32_t offset);
+  void *ctx;
+  uint32_t size;         // Whole sectors, at least 2
+} OdoFlash;
+
+typedef struct {
+  OdoFlash flash;
+  uint32_t next_offset;  // Slot the next record is written to
+  uint32_t sequence;     // Of the newest record, 0 = none
+  bool erase_next;       // next_offset starts a sector that must be erased first
+  uint32_t records;      // Written since mount
+  uint32_t erases;       // Sectors erased since mount
+} OdoJournal;
+
+// Scan flash for the newest valid record. True with *state filled if there
+// is one; false for a blank (or wholly corrupt) journal, *state untouched.
+// Either way the journal is ready for commits.
+bool odo_journal_mount(OdoJournal *journal, const OdoFlash *flash, OdoState *state);
+// Append a record, erasing the next sector first when the write position
+// reaches it. False if no slot could be written.
+bool odo_journal_commit(OdoJournal *journal, const OdoState *state);
+// zlib CRC-32
+uint32_t odo_crc32(const void *data, size_t len);
@@ -0,0 +1,204 @@
+#include "RotatedLabel.h"
+#include <string.h>
+
+#if ROTATED_LABEL_PREROTATED
+
+typedef struct {
+  const RotatedFont *font;
+  lv_style_t style;                                // Glyph colour (image recolor), shared by the children
+  lv_obj_t *children[ROTATED_LABEL_MAX_CHARS];     // Created on first use
+  const lv_image_dsc_t *src[ROTATED_LABEL_MAX_CHARS];
+  int16_t pos[ROTATED_LABEL_MAX_CHARS];            // Child y (along the text); INT16_MIN = hidden
+  uint16_t text[ROTATED_LABEL_MAX_CHARS];          // Codepoints last laid out
+  uint8_t text_len;
+  uint8_t child_count;
+  int32_t length;                                  // 0 = fit the text
+  lv_text_align_t align;
+} RotatedLabel;
+
+static const RotatedGlyph *find_glyph(const RotatedFont *font, uint32_t cp) {
+  int lo = 0, hi = font->glyph_count - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    if (font->glyphs[mid].codepoint == cp) return &font->glyphs[mid];
+    if (font->glyphs[mid].codepoint < cp) lo = mid + 1;
+    else hi = mid - 1;
+  }
+  return NULL;
+}
+
+static int32_t find_kern(const RotatedFont *font, uint32_t left, uint32_t right) {
+  uint32_t key = (left << 16) | right;
+  int lo = 0, hi = font->kern_count - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    const RotatedKern *k = &font->kerning[mid];
+    uint32_t mid_key = ((uint32_t)k->left << 16) | k->right;
+    if (mid_key == key) return k->value;
+    if (mid_key < key) lo = mid + 1;
+    else hi = mid - 1;
+  }
+  return 0;
+}
+
+// Decode up to max codepoints (1-3 byte UTF-8 is all the fonts cover)
+static uint8_t decode_utf8(const char *text, uint16_t *out, uint8_t max) {
+  const uint8_t *p = (const uint8_t *)text;
+  uint8_t n = 0;
+  while (*p && n < max) {
+    uint32_t cp = *p++;
+    if (cp >= 0xE0 && p[0] && p[1])      { cp = ((cp & 0x0F) << 12) | ((p[0] & 0x3F) << 6) | (p[1] & 0x3F); p += 2; }
+    else if (cp >= 0xC0 && p[0])         { cp = ((cp & 0x1F) << 6) | (p[0] & 0x3F); p += 1; }
+    out[n++] = (uint16_t)cp;
+  }
+  return n;
+}
+
+static void delete_cb(lv_event_t *e) {
+  lv_obj_t *obj = (lv_obj_t *)lv_event_get_target(e);
+  RotatedLabel *st = (RotatedLabel *)lv_obj_get_user_data(obj);
+  if (st == NULL) return;
+  lv_style_reset(&st->style);
+  lv_free(st);
+}
+
+// Place every glyph; children whose image and position are unchanged are not touched
+static void layout(lv_obj_t *obj, RotatedLabel *st) {
+  const RotatedFont *font = st->font;
+  const RotatedGlyph *glyphs[ROTATED_LABEL_MAX_CHARS];
+  int32_t pen[ROTATED_LABEL_MAX_CHARS];
+  int32_t total = 0;
+
+  // Advances are rounded per glyph, kerning with the next glyph included, as LVGL does
+  for (uint8_t i = 0; i < st->text_len; i++) {
+    glyphs[i] = find_glyph(font, st->text[i]);
+    pen[i] = total;
+    if (glyphs[i] == NULL) continue;
+    int32_t adv16 = glyphs[i]->adv16;
+    if (i + 1 < st->text_len) adv16 += find_kern(font, st->text[i], st->text[i + 1]);
+    total += (adv16 + 8) >> 4;
+  }
+
+  int32_t start = 0;
+  if (st->length > 0) {
+    if (st->align == LV_TEXT_ALIGN_CENTER) start = (st->length - total) / 2;
+    else if (st->align == LV_TEXT_ALIGN_RIGHT) start = st->length - total;
+  } else if (lv_obj_get_height(obj) != total) {
+    lv_obj_set_height(obj, total);
+  }
+
+  for (uint8_t i = 0; i < ROTATED_LABEL_MAX_CHARS; i++) {
+    const RotatedGlyph *g = i < st->text_len ? glyphs[i] : NULL;
+    if (g == NULL || g->image == NULL) {
+      if (i < st->child_count && st->pos[i] != INT16_MIN) {
+        lv_obj_add_flag(st->children[i], LV_OBJ_FLAG_HIDDEN);
+        st->pos[i] = INT16_MIN;
+      }
+      continue;
+    }
+
+    if (i >= st->child_count) {
+      // Children are created in order, so every slot below i exists
+      lv_obj_t *child = lv_image_create(obj);
+      lv_obj_clear_flag(child, LV_OBJ_FLAG_CLICKABLE);
+      lv_obj_add_style(child, &st->style, 0);
+      lv_obj_add_flag(child, LV_OBJ_FLAG_HIDDEN);
+      st->children[i] = child;
+      st->src[i] = NULL;
+      st->pos[i] = INT16_MIN;
+      st->child_count = i + 1;
+    }
+
+    lv_obj_t *child = st->children[i];
+    int16_t y = (int16_t)(start + pen[i] + g->y);
+    if (st->src[i] != g->image) {
+      lv_image_set_src(child, g->image);
+      st->src[i] = g->image;
+    }
+    if (st->pos[i] != y) {
+      lv_obj_set_pos(child, g->x, y);
+      if (st->pos[i] == INT16_MIN) lv_obj_clear_flag(child, LV_OBJ_FLAG_HIDDEN);
+      st->pos[i] = y;
+    }
+  }
+}
+
+lv_obj_t *rotated_label_create(lv_obj_t *parent, const RotatedFont *font, lv_color_t color) {
+  lv_obj_t *obj = lv_obj_create(parent);
+  lv_obj_remove_style_all(obj);
+  lv_obj_clear_flag(obj, (lv_obj_flag_t)(LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE));
+  lv_obj_add_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE); // Glyph boxes may overhang the line
+  lv_obj_set_size(obj, font->line_height, 0);
+
+  RotatedLabel *st = (RotatedLabel *)lv_malloc(sizeof(RotatedLabel));
+  LV_ASSERT_MALLOC(st);
+  memset(st, 0, sizeof(*st));
+  st->font = font;
+  st->align = LV_TEXT_ALIGN_LEFT;
+  lv_style_init(&st->style);
+  lv_style_set_image_recolor(&st->style, color);
+  lv_style_set_image_recolor_opa(&st->style, LV_OPA_COVER);
+  lv_obj_set_user_data(obj, st);
+  lv_obj_add_event_cb(obj, delete_cb, LV_EVENT_DELETE, NULL);
+  return obj;
+}
+
+void rotated_label_set_pos(lv_obj_t *obj, int32_t x, int32_t y) {
+  RotatedLabel *st = (RotatedLabel *)lv_obj_get_user_data(obj);
+  lv_obj_set_pos(obj, x - st->font->line_height, y);
+}
+
+void rotated_label_set_length(lv_obj_t *obj, int32_t length, lv_text_align_t align) {
+  RotatedLabel *st = (RotatedLabel *)lv_obj_get_user_data(obj);
+  st->length = length;
+  st->align = align;
+  if (length > 0) lv_obj_set_height(obj, length);
+  layout(obj, st);
+}
+
+void rotated_label_set_text(lv_obj_t *obj, const char *text) {
+  RotatedLabel *st = (RotatedLabel *)lv_obj_get_user_data(obj);
+  uint16_t cps[ROTATED_LABEL_MAX_CHARS];
+  uint8_t len = decode_utf8(text, cps, ROTATED_LABEL_MAX_CHARS);
+  if (len == st->text_len && memcmp(cps, st->text, len * sizeof(cps[0])) == 0) return;
+  memcpy(st->text, cps, len * sizeof(cps[0]));
+  st->text_len = len;
+  layout(obj, st);
+}
+
+void rotated_label_set_color(lv_obj_t *obj, lv_color_t color) {
+  RotatedLabel *st = (RotatedLabel *)lv_obj_get_user_data(obj);
+  lv_style_set_image_recolor(&st->style, color);
+  lv_obj_report_style_change(&st->style);
+}
+
+#else // Old path: lv_label rotated by LVGL at draw time
+
+lv_obj_t *rotated_label_create(lv_obj_t *parent, const RotatedFont *font, lv_color_t color) {
+  lv_obj_t *obj = lv_label_create(parent);
+  lv_label_set_text_static(obj, "");
+  lv_obj_set_style_text_font(obj, font->source, 0);
+  lv_obj_set_style_text_color(obj, color, 0);
+  lv_obj_set_style_transform_angle(obj, 900, 0);
+  lv_obj_set_style_text_opa(obj, LV_OPA_COVER, 0);
+  return obj;
+}
+
+void rotated_label_set_pos(lv_obj_t *obj, int32_t x, int32_t y) {
+  lv_obj_set_pos(obj, x, y);
+}
+
+void rotated_label_set_length(lv_obj_t *obj, int32_t length, lv_text_align_t align) {
+  lv_obj_set_width(obj, length);
+  lv_obj_set_style_text_align(obj, align, 0);
+}
+
+void rotated_label_set_text(lv_obj_t *obj, const char *text) {
+  lv_label_set_text(obj, text);
+}
+
+void rotated_label_set_color(lv_obj_t *obj, lv_color_t color) {
+  lv_obj_set_style_text_color(obj, color, 0);
+}
+
+#endif
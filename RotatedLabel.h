@@ -0,0 +1,59 @@
+#pragma once
+#include <lvgl.h>
+#include <stdint.h>
+
+// ============================================================================
+// ROTATED LABEL
+// ----------------------------------------------------------------------------
+// Text drawn along the long axis of the panel. The fonts are pre-rotated 90°
+// clockwise at build time (tools/rotate_font.py → fonts/*_r90.h) and every
+// character is an A8 image child placed at its final position, so drawing
+// text is a plain alpha blit and changing one digit only invalidates that
+// digit. This replaces lv_label + transform_angle 900, which rendered the
+// whole label into a layer and rotated it in software on every invalidation.
+//
+// Geometry matches the old rotated label: set_pos() takes the same anchor the
+// lv_label had (the text runs down from y, glyph tops toward +x, the line
+// occupying [x - line_height, x]).
+// ============================================================================
+
+#define ROTATED_LABEL_PREROTATED 1   // 0 = old lv_label + transform_angle 900, for A/B frame timing
+#define ROTATED_LABEL_MAX_CHARS  24  // Longest text (warnings: "Crankcase PSI High")
+
+typedef struct {
+  uint16_t codepoint;
+  uint16_t adv16;      // Advance along the text in 1/16 px (as lv_font_fmt_txt)
+  int8_t   x;          // Image column, from the bottom of the line
+  int8_t   y;          // Image row offset from the pen position
+  const lv_image_dsc_t *image;  // NULL for blank glyphs (space)
+} RotatedGlyph;
+
+typedef struct {
+  uint16_t left;
+  uint16_t right;
+  int16_t  value;      // 1/16 px added to the left glyph's advance
+} RotatedKern;
+
+typedef struct {
+  const RotatedGlyph *glyphs;   // Sorted by codepoint
+  uint16_t glyph_count;
+  const RotatedKern *kerning;   // Sorted by (left, right)
+  uint16_t kern_count;
+  uint8_t  line_height;
+  const lv_font_t *source;      // Unrotated font, for ROTATED_LABEL_PREROTATED 0
+} RotatedFont;
+
+#if ROTATED_LABEL_PREROTATED
+#define ROTATED_LABEL_SOURCE(font) NULL
+#else
+#define ROTATED_LABEL_SOURCE(font) (&font)
+#endif
+
+lv_obj_t *rotated_label_create(lv_obj_t *parent, const RotatedFont *font, lv_color_t color);
+// Anchor of the old transformed label (see above)
+void rotated_label_set_pos(lv_obj_t *obj, int32_t x, int32_t y);
+// Fixed extent along the text with the text aligned inside it (default: fit the text)
+void rotated_label_set_length(lv_obj_t *obj, int32_t length, lv_text_align_t align);
+// UTF-8; only glyphs whose image changed or moved are invalidated
+void rotated_label_set_text(lv_obj_t *obj, const char *text);
+void rotated_label_set_color(lv_obj_t *obj, lv_color_t color);
@@ -1,21 +1,17 @@
 #include "Screens.h"
-#include "images/AstonLogo.h"
-#include "images/CruiseControl.h"
-#include "images/tcs.h"
-#include "images/flag.h"
-#include "images/ExhaustBypass.h"
-#include "images/TwoStep.h"
-#include "images/PeakRecall.h"
-#include "images/ClearPeakRecall.h"
-
-LV_IMG_DECLARE(AstonLogo);
-LV_IMG_DECLARE(CruiseControl);
-LV_IMG_DECLARE(tcs);
-LV_IMG_DECLARE(flag);
-LV_IMG_DECLARE(ExhaustBypass);
-LV_IMG_DECLARE(TwoStep);
-LV_IMG_DECLARE(PeakRecall);
-LV_IMG_DECLARE(ClearPeakRecall);
+#include "CAN_Decoder.h"
+#include "RotatedLabel.h"
+#include "NumericLabel.h"
+#include "fonts/aston_28_r90.h"
+#include "fonts/aston_48_r90.h"
+#include "images/AstonLogo_rle.h"
+#include "images/CruiseControl_rle.h"
+#include "images/tcs_rle.h"
+#include "images/flag_rle.h"
+#include "images/ExhaustBypass_rle.h"
+#include "images/TwoStep_rle.h"
+#include "images/PeakRecall_rle.h"
+#include "images/ClearPeakRecall_rle.h"
 
 // Single main screen
 lv_obj_t *main_scr = NULL;
@@ -48,53 +44,32 @@ lv_obj_t *warning_label_right = NULL;
 lv_obj_t *left_gauge_container = NULL;
 lv_obj_t *right_gauge_container = NULL;
 
-// Reusable style objects
-static lv_style_t style_label_title;
-static lv_style_t style_label_value;
-static lv_style_t style_label_warning;
-static bool styles_initialized = false;
+#define COLOR_WHITE lv_color_make(255, 255, 255)
+#define COLOR_RED   lv_color_make(255, 0, 0)
+#define COLOR_BLACK lv_color_make(0, 0, 0)
 
 // Current screen mode
 static uint8_t current_screen_mode = 0; // 0=temp/oil, 1=AFR, 2=pressures, 3=fuel, 4=ethanol/battery
 
-void init_styles(void) {
-  if (styles_initialized) return;
-  
-  // Style for title labels (28pt custom font, white text, rotated)
-  lv_style_init(&style_label_title);
-  lv_style_set_text_font(&style_label_title, &aston_28);
-  lv_style_set_text_color(&style_label_title, lv_color_make(255, 255, 255));
-  lv_style_set_transform_angle(&style_label_title, 900);
-  lv_style_set_text_opa(&style_label_title, LV_OPA_COVER); // Full opacity for smoother rendering
-  
-  // Style for value labels (48pt custom font, white text, rotated)
-  lv_style_init(&style_label_value);
-  lv_style_set_text_font(&style_label_value, &aston_48);
-  lv_style_set_text_color(&style_label_value, lv_color_make(255, 255, 255));
-  lv_style_set_transform_angle(&style_label_value, 900);
-  lv_style_set_text_opa(&style_label_value, LV_OPA_COVER); // Full opacity for smoother rendering
-  
-  // Style for warning labels (28pt custom font, red text, rotated, centered)
-  lv_style_init(&style_label_warning);
-  lv_style_set_text_font(&style_label_warning, &aston_28);
-  lv_style_set_text_color(&style_label_warning, lv_color_make(255, 0, 0));
-  lv_style_set_transform_angle(&style_label_warning, 900);
-  lv_style_set_text_opa(&style_label_warning, LV_OPA_COVER);
-  lv_style_set_text_align(&style_label_warning, LV_TEXT_ALIGN_CENTER);
-  
-  styles_initialized = true;
+// Text along the long axis of the panel, pre-rotated (see RotatedLabel.h).
+// x, y is the anchor the old transform_angle 900 labels were placed at.
+static lv_obj_t *create_text(lv_obj_t *parent, const RotatedFont *font, lv_color_t color,
+                             const char *text, int32_t x, int32_t y) {
+  lv_obj_t *obj = rotated_label_create(parent, font, color);
+  rotated_label_set_pos(obj, x, y);
+  rotated_label_set_text(obj, text);
+  return obj;
 }
 
-void boot_scr1_loaded_cb(lv_event_t *e)
+static void boot_scr1_deleted_cb(lv_event_t *e)
 {
-  /* load default screen after 4000ms */
-  lv_screen_load_anim(main_scr, LV_SCR_LOAD_ANIM_NONE, 0, 4000, false);
+  boot_scr1 = NULL;
 }
 
 // Callback when main screen is loaded (after boot screen)
 void main_scr_loaded_cb(lv_event_t *e)
 {
-  // Main screen loaded - restore task will handle mode restoration
+  // Main screen loaded - loop() restores the saved mode as it ends the boot screen
 }
 
 // Helper function to create gauge containers (adjusted for 240px width)
@@ -126,29 +101,20 @@ void boot_scr1_init(void)
   create_gauge_containers(boot_scr1, false);
 
   lv_obj_t *aston_img = lv_image_create(boot_scr1);
-  lv_image_set_src(aston_img, &AstonLogo);
+  image_cache_set_src(aston_img, &AstonLogo_asset);
   lv_obj_set_pos(aston_img, 70, 20);
   lv_obj_fade_in(aston_img, 1000, 0);
 
-  lv_obj_t *power_label = lv_label_create(boot_scr1);
-  lv_label_set_text_static(power_label, "Power");
-  lv_obj_set_pos(power_label, 185, 640);
-  lv_obj_add_style(power_label, &style_label_title, 0);
+  lv_obj_t *power_label = create_text(boot_scr1, &aston_28_r90, COLOR_WHITE, "Power", 185, 640);
   lv_obj_fade_in(power_label, 1000, 0);
 
-  lv_obj_t *beauty_label = lv_label_create(boot_scr1);
-  lv_label_set_text_static(beauty_label, "Beauty");
-  lv_obj_set_pos(beauty_label, 135, 700);
-  lv_obj_add_style(beauty_label, &style_label_title, 0);
+  lv_obj_t *beauty_label = create_text(boot_scr1, &aston_28_r90, COLOR_WHITE, "Beauty", 135, 700);
   lv_obj_fade_in(beauty_label, 1000, 800);
 
-  lv_obj_t *soul_label = lv_label_create(boot_scr1);
-  lv_label_set_text_static(soul_label, "Soulless");
-  lv_obj_set_pos(soul_label, 85, 755);
-  lv_obj_add_style(soul_label, &style_label_title, 0);
+  lv_obj_t *soul_label = create_text(boot_scr1, &aston_28_r90, COLOR_WHITE, "Soulless", 85, 755);
   lv_obj_fade_in(soul_label, 1000, 1600);  
 
-  lv_obj_add_event_cb(boot_scr1, boot_scr1_loaded_cb, LV_EVENT_SCREEN_LOADED, NULL);
+  lv_obj_add_event_cb(boot_scr1, boot_scr1_deleted_cb, LV_EVENT_DELETE, NULL);
 }
 
 // Create the single main screen with reusable labels (adjusted for 240x960)
@@ -159,90 +125,61 @@ void main_scr_init(void) {
   create_gauge_containers(main_scr, true);
 
   // Title labels for left and right gauges
-  left_title_label = lv_label_create(main_scr);
-  lv_label_set_text(left_title_label, " ");
-  lv_obj_set_pos(left_title_label, 210, 30);
-  lv_obj_add_style(left_title_label, &style_label_title, 0);
-
-  right_title_label = lv_label_create(main_scr);
-  lv_label_set_text(right_title_label, " ");
-  lv_obj_set_pos(right_title_label, 210, 612);
-  lv_obj_add_style(right_title_label, &style_label_title, 0);
+  left_title_label = create_text(main_scr, &aston_28_r90, COLOR_WHITE, " ", 210, 30);
+  right_title_label = create_text(main_scr, &aston_28_r90, COLOR_WHITE, " ", 210, 612);
 
   //Cruise Control Status Icon
   cruise_control_img = lv_image_create(main_scr);
-  lv_image_set_src(cruise_control_img, &CruiseControl);
+  image_cache_set_src(cruise_control_img, &CruiseControl_asset);
   lv_obj_set_pos(cruise_control_img, 175, 870);
 
   //Traction Control Status Icon
   tcs_img = lv_image_create(main_scr);
-  lv_image_set_src(tcs_img, &tcs);
+  image_cache_set_src(tcs_img, &tcs_asset);
   lv_obj_set_pos(tcs_img, 175, 820);
 
   //Launch Control Status Icon
   launch_img = lv_image_create(main_scr);
-  lv_image_set_src(launch_img, &flag);
+  image_cache_set_src(launch_img, &flag_asset);
   lv_obj_set_pos(launch_img, 175, 762);
 
   //Two Step Status Icon
   two_step_img = lv_image_create(main_scr);
-  lv_image_set_src(two_step_img, &TwoStep);
+  image_cache_set_src(two_step_img, &TwoStep_asset);
   lv_obj_set_pos(two_step_img, 170, 282);
 
   //Exhaust Bypass Status Icon
   exhaust_bypass_img = lv_image_create(main_scr);
-  lv_image_set_src(exhaust_bypass_img, &ExhaustBypass);
+  image_cache_set_src(exhaust_bypass_img, &ExhaustBypass_asset);
   lv_obj_set_pos(exhaust_bypass_img, 175, 234);
 
   //Peak Recall Status Icon
   peak_recall_img = lv_image_create(main_scr);
-  lv_image_set_src(peak_recall_img, &PeakRecall);
+  image_cache_set_src(peak_recall_img, &PeakRecall_asset);
   lv_obj_set_pos(peak_recall_img, 180, 182);
 
   // Value labels (adjusted for 240px width)
-  left_label_value = lv_label_create(main_scr);
-  lv_label_set_text_static(left_label_value, "   0");
-  lv_obj_set_pos(left_label_value, 130, 125);
-  lv_obj_add_style(left_label_value, &style_label_value, 0);
-
-  right_label_value = lv_label_create(main_scr);
-  lv_label_set_text_static(right_label_value, "   0");
-  lv_obj_set_pos(right_label_value, 130, 715);
-  lv_obj_add_style(right_label_value, &style_label_value, 0);
-
-  odometer_label = lv_label_create(main_scr);
-  lv_label_set_text_static(odometer_label, "Miles");
-  lv_obj_set_pos(odometer_label, 35, 210);
-  lv_obj_add_style(odometer_label, &style_label_title, 0);
-
-  odometer_value = lv_label_create(main_scr);
-  lv_label_set_text(odometer_value, "0.0");
-  lv_obj_set_pos(odometer_value, 35, 80);
-  lv_obj_add_style(odometer_value, &style_label_title, 0);
-
-  trip_label = lv_label_create(main_scr);
-  lv_label_set_text_static(trip_label, "Trip 1");
-  lv_obj_set_pos(trip_label, 35, 682);
-  lv_obj_add_style(trip_label, &style_label_title, 0);
-
-  trip_value = lv_label_create(main_scr);
-  lv_label_set_text(trip_value, "0.0");
-  lv_obj_set_pos(trip_value, 35, 782);
-  lv_obj_add_style(trip_value, &style_label_title, 0);
+  // Value fields: fixed digit cells drawn from RGB565 tiles (see NumericLabel.h)
+  left_label_value = numeric_label_create(main_scr, &aston_48_r90, COLOR_WHITE, COLOR_BLACK);
+  numeric_label_set_pos(left_label_value, 130, 125);
+  numeric_label_set_text(left_label_value, "   0");
+  right_label_value = numeric_label_create(main_scr, &aston_48_r90, COLOR_WHITE, COLOR_BLACK);
+  numeric_label_set_pos(right_label_value, 130, 715);
+  numeric_label_set_text(right_label_value, "   0");
+
+  // Odometer and trip
+  odometer_label = create_text(main_scr, &aston_28_r90, COLOR_WHITE, "Miles", 35, 210);
+  odometer_value = create_text(main_scr, &aston_28_r90, COLOR_WHITE, "0.0", 35, 80);
+  trip_label = create_text(main_scr, &aston_28_r90, COLOR_WHITE, "Trip 1", 35, 682);
+  trip_value = create_text(main_scr, &aston_28_r90, COLOR_WHITE, "0.0", 35, 782);
 
   // ECU Warning labels - positioned between data value (x=130) and odometer/trip (x=35)
-  warning_label_left = lv_label_create(main_scr);
-  lv_label_set_text(warning_label_left, "");
-  lv_obj_set_pos(warning_label_left, 80, 0);
-  lv_obj_set_width(warning_label_left, 348);
-  lv_obj_add_style(warning_label_left, &style_label_warning, 0);
+  warning_label_left = create_text(main_scr, &aston_28_r90, COLOR_RED, "", 80, 0);
+  rotated_label_set_length(warning_label_left, 348, LV_TEXT_ALIGN_CENTER);
   lv_obj_add_flag(warning_label_left, LV_OBJ_FLAG_HIDDEN);
 
-  warning_label_right = lv_label_create(main_scr);
-  lv_label_set_text(warning_label_right, "");
-  lv_obj_set_pos(warning_label_right, 80, 582);
-  lv_obj_set_width(warning_label_right, 348);
-  lv_obj_add_style(warning_label_right, &style_label_warning, 0);
+  warning_label_right = create_text(main_scr, &aston_28_r90, COLOR_RED, "", 80, 582);
+  rotated_label_set_length(warning_label_right, 348, LV_TEXT_ALIGN_CENTER);
   lv_obj_add_flag(warning_label_right, LV_OBJ_FLAG_HIDDEN);
   
   // Add callback for when main screen is loaded
@@ -253,36 +190,18 @@ void main_scr_init(void) {
 void update_screen_labels(uint8_t mode) {
   current_screen_mode = mode;
   
-  switch (mode) {
-    case 0:
-      lv_label_set_text(left_title_label, "ECT °F");
-      lv_label_set_text(right_title_label, "Oil PSI");
-      break;
-    case 1:
-      lv_label_set_text(left_title_label, "AFR B1");
-      lv_label_set_text(right_title_label, "AFR B2");
-      break;
-    case 2:
-      lv_label_set_text(left_title_label, "MAP PSI");
-      lv_label_set_text(right_title_label, "Speed MPH");
-      break;
-    case 3:
-      lv_label_set_text(left_title_label, "LS Fuel PSI");
-      lv_label_set_text(right_title_label, "Inj Duty %");
-      break;
-    case 4:
-      lv_label_set_text(left_title_label, "Ethanol %");
-      lv_label_set_text(right_title_label, "Battery V");
-      break;
-  }
+  // Titles follow the display unit system (see can_set_display_units())
+  rotated_label_set_text(left_title_label, can_screen_title(mode, 0));
+  rotated_label_set_text(right_title_label, can_screen_title(mode, 1));
+  rotated_label_set_text(odometer_label, can_display_units() == DISPLAY_UNITS_METRIC ? "Km" : "Miles");
   
   // Reset value labels to 0 when changing modes
-  lv_label_set_text(left_label_value, "   0");
-  lv_label_set_text(right_label_value, "   0");
+  numeric_label_set_text(left_label_value, "   0");
+  numeric_label_set_text(right_label_value, "   0");
   
   // Reset colors to white
-  lv_obj_set_style_text_color(left_label_value, lv_color_make(255, 255, 255), LV_PART_MAIN);
-  lv_obj_set_style_text_color(right_label_value, lv_color_make(255, 255, 255), LV_PART_MAIN);
+  numeric_label_set_color(left_label_value, COLOR_WHITE);
+  numeric_label_set_color(right_label_value, COLOR_WHITE);
 }
 
 // Get pointers to value labels for updating
@@ -358,9 +277,19 @@ lv_obj_t* get_right_gauge_container(void) {
   return right_gauge_container;
 }
 
+bool boot_screen_active(void) {
+  return boot_scr1 != NULL;
+}
+
+void boot_screen_end(void) {
+  if (boot_scr1 == NULL) return;
+  // Load the main screen now; the boot screen is deleted, which unpins the
+  // logo in the image cache
+  lv_screen_load_anim(main_scr, LV_SCR_LOAD_ANIM_NONE, 0, 0, true);
+}
+
 // build the screens
 void screens_init(void) {
-  init_styles();  // Initialize reusable styles first
   main_scr_init();
   boot_scr1_init();
   lv_screen_load(boot_scr1);
@@ -1,9 +1,10 @@
 #pragma once
 #include <lvgl.h>
+#include "ImageCache.h"
 
-// Image declarations
-LV_IMG_DECLARE(PeakRecall);
-LV_IMG_DECLARE(ClearPeakRecall);
+// Image declarations (compressed, see ImageCache.h)
+IMAGE_ASSET_DECLARE(PeakRecall);
+IMAGE_ASSET_DECLARE(ClearPeakRecall);
 
 // Screen objects
 extern lv_obj_t *main_scr;
@@ -13,7 +14,9 @@ extern lv_obj_t *boot_scr1;
 void boot_scr1_init(void);
 void main_scr_init(void);
 void screens_init(void);
-void init_styles(void);
+// The boot screen is up until boot_screen_end(); loop() decides when (BootProfile.h)
+bool boot_screen_active(void);
+void boot_screen_end(void);
 
 // Screen mode management
 void update_screen_labels(uint8_t mode);
@@ -37,5 +40,4 @@ lv_obj_t* get_right_gauge_container(void);
 uint8_t get_current_screen_mode(void);
 
 // Callback functions
-void boot_scr1_loaded_cb(lv_event_t *e);
 void main_scr_loaded_cb(lv_event_t *e);
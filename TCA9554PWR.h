@@ -31,6 +31,12 @@
 #define EXIO_PIN7   7
 #define EXIO_PIN8   8
 
+// Output, polarity and configuration are shadowed in RAM: writes that change
+// nothing are skipped, single-pin writes need no read first, and reading them
+// back (read_exios(TCA9554_OUTPUT_REG)) does not touch the bus. Only the input
+// register is read from the chip. Nothing is printed unless a transfer fails.
+// Not locked: call from one task at a time.
+
 /*****************************************************  Operation register REG   ****************************************************/   
 uint8_t i2c_read_exio(uint8_t REG);                         // Read the value of the TCA9554PWR register REG
 uint8_t i2c_write_exio(uint8_t REG,uint8_t Data);           // Write Data to the REG register of the TCA9554PWR
@@ -43,6 +49,7 @@ uint8_t read_exios(uint8_t REG);                            // Read the level of
 /********************************************************** Set the EXIO output status **********************************************************/  
 void set_exio(uint8_t Pin,uint8_t State);                   // Sets the level state of the Pin without affecting the other pins
 void set_exios(uint8_t PinState);                           // Set 7 pins to the PinState state such as :PinState=0x23, 0010 0011 state (the highest bit is not used)
+void set_exios_masked(uint8_t Mask,uint8_t PinState);       // Set only the pins in Mask to their bits in PinState, coalesced into one write
 /********************************************************** Flip EXIO state **********************************************************/  
 void set_toggle(uint8_t Pin);                               // Flip the level of the TCA9554PWR Pin
 /********************************************************* TCA9554PWR Initializes the device ***********************************************************/  
@@ -0,0 +1,191 @@
+#include "TaskMonitor.h"
+#include <string.h>
+
+// Per-task CPU needs both; without them only the stack column is reported
+#define TASK_MONITOR_RUNTIME_STATS (configUSE_TRACE_FACILITY && configGENERATE_RUN_TIME_STATS)
+
+typedef struct {
+  const char *name;
+  TaskHandle_t handle;     // NULL while being created
+  uint32_t stack_bytes;
+  UBaseType_t priority;
+  BaseType_t core;
+  uint32_t exit_free;      // High-water mark recorded by task_monitor_exit()
+  bool exited;             // handle must no longer be dereferenced
+} MonitoredTask;
+
+static MonitoredTask tasks[TASK_MONITOR_MAX];
+static uint8_t task_count = 0;
+static portMUX_TYPE monitor_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static MonitoredTask *reserve(const char *name, uint32_t stack_bytes, UBaseType_t priority, BaseType_t core) {
+  MonitoredTask *t = NULL;
+  portENTER_CRITICAL(&monitor_mux);
+  if (task_count < TASK_MONITOR_MAX) {
+    t = &tasks[task_count++];
+    t->name = name;
+    t->handle = NULL;
+    t->stack_bytes = stack_bytes;
+    t->priority = priority;
+    t->core = core;
+    t->exit_free = 0;
+    t->exited = false;
+  }
+  portEXIT_CRITICAL(&monitor_mux);
+  return t;
+}
+
+bool task_start(TaskFunction_t fn, const char *name, uint32_t stack_bytes, UBaseType_t priority, BaseType_t core,
+                TaskHandle_t *handle_out) {
+  // The slot exists before the task does, so a task that exits straight away
+  // (History with no PSRAM) is matched by name in task_monitor_exit()
+  MonitoredTask *t = reserve(name, stack_bytes, priority, core);
+  TaskHandle_t handle = NULL;
+  if (xTaskCreatePinnedToCore(fn, name, stack_bytes, NULL, priority, &handle, core) != pdPASS) {
+    Serial.printf("TASK: cannot create %s (%lu byte stack)\n", name, (unsigned long)stack_bytes);
+    if (t != NULL) t->exited = true;
+    return false;
+  }
+  if (t != NULL) {
+    portENTER_CRITICAL(&monitor_mux);
+    if (!t->exited) t->handle = handle;
+    portEXIT_CRITICAL(&monitor_mux);
+  }
+  if (handle_out != NULL) *handle_out = handle;
+  return true;
+}
+
+uint32_t task_start_all(const TaskSpec *specs, size_t count) {
+  uint32_t failed = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (!task_start(specs[i].fn, specs[i].name, specs[i].stack_bytes, specs[i].priority, specs[i].core)) failed++;
+  }
+  return failed;
+}
+
+void task_monitor_add(TaskHandle_t handle, const char *name, uint32_t stack_bytes, UBaseType_t priority, BaseType_t core) {
+  MonitoredTask *t = reserve(name, stack_bytes, priority, core);
+  if (t == NULL) return;
+  portENTER_CRITICAL(&monitor_mux);
+  t->handle = handle;
+  portEXIT_CRITICAL(&monitor_mux);
+}
+
+void task_monitor_exit(void) {
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  const char *name = pcTaskGetName(NULL);
+  uint32_t free_bytes = uxTaskGetStackHighWaterMark(NULL);
+  portENTER_CRITICAL(&monitor_mux);
+  for (uint8_t i = 0; i < task_count; i++) {
+    MonitoredTask *t = &tasks[i];
+    if (t->exited) continue;
+    if (t->handle == self || (t->handle == NULL && strcmp(t->name, name) == 0)) {
+      t->exit_free = free_bytes;
+      t->exited = true;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&monitor_mux);
+}
+
+#if TASK_MONITOR_RUNTIME_STATS
+typedef configRUN_TIME_COUNTER_TYPE RunTime;
+
+static TaskStatus_t status[TASK_MONITOR_SYSTEM_MAX];
+static RunTime run_delta[TASK_MONITOR_SYSTEM_MAX];
+static struct {
+  TaskHandle_t handle;
+  RunTime run;
+} last_run[TASK_MONITOR_SYSTEM_MAX];
+static UBaseType_t last_run_count = 0;
+static RunTime last_total = 0;
+
+// Run time of every task since the previous call into run_delta[]; returns
+// the task count (0 if status[] is too small) and the elapsed time
+static UBaseType_t sample_run_times(RunTime *elapsed) {
+  RunTime total = 0;
+  UBaseType_t n = uxTaskGetSystemState(status, TASK_MONITOR_SYSTEM_MAX, &total);
+  if (n == 0) return 0;
+  for (UBaseType_t i = 0; i < n; i++) {
+    RunTime prev = 0;  // Tasks new since the last report count from their start
+    for (UBaseType_t j = 0; j < last_run_count; j++) {
+      if (last_run[j].handle == status[i].xHandle) {
+        prev = last_run[j].run;
+        break;
+      }
+    }
+    run_delta[i] = status[i].ulRunTimeCounter - prev;
+  }
+  for (UBaseType_t i = 0; i < n; i++) {
+    last_run[i].handle = status[i].xHandle;
+    last_run[i].run = status[i].ulRunTimeCounter;
+  }
+  last_run_count = n;
+  *elapsed = total - last_total;
+  last_total = total;
+  return n;
+}
+
+static int find_status(TaskHandle_t handle, UBaseType_t n) {
+  for (UBaseType_t i = 0; i < n; i++) {
+    if (status[i].xHandle == handle) return (int)i;
+  }
+  return -1;
+}
+#endif
+
+void task_monitor_print(uint32_t window_ms) {
+#if TASK_MONITOR_RUNTIME_STATS
+  RunTime elapsed = 0;
+  UBaseType_t n = sample_run_times(&elapsed);
+  if (n == 0) {
+    Serial.printf("TASK: more than %d tasks, raise TASK_MONITOR_SYSTEM_MAX\n", TASK_MONITOR_SYSTEM_MAX);
+    return;
+  }
+  if (elapsed == 0) elapsed = 1;
+  Serial.printf("TASK: %lu tasks over %lu s, core load", (unsigned long)n, (unsigned long)(window_ms / 1000));
+  for (BaseType_t core = 0; core < portNUM_PROCESSORS; core++) {
+    int idle = find_status(xTaskGetIdleTaskHandleForCore(core), n);
+    float idle_pct = idle >= 0 ? 100.0f * run_delta[idle] / elapsed : 0.0f;
+    Serial.printf(" %ld: %.1f%%", (long)core, 100.0f - idle_pct);
+  }
+  Serial.println();
+#else
+  Serial.printf("TASK: %lu s window (no FreeRTOS run-time stats, CPU column omitted)\n",
+                (unsigned long)(window_ms / 1000));
+#endif
+
+  for (uint8_t i = 0; i < task_count; i++) {
+    portENTER_CRITICAL(&monitor_mux);
+    MonitoredTask t = tasks[i];
+    uint32_t free_bytes = t.exit_free;
+#if !TASK_MONITOR_RUNTIME_STATS
+    // Under the lock: a task cannot pass task_monitor_exit() while we read its stack
+    if (!t.exited && t.handle != NULL) free_bytes = uxTaskGetStackHighWaterMark(t.handle);
+#endif
+    portEXIT_CRITICAL(&monitor_mux);
+    if (t.handle == NULL && !t.exited) continue;
+
+    const char *warn = free_bytes < TASK_MONITOR_STACK_WARN ? "  LOW" : "";
+    if (t.exited) {
+      Serial.printf("TASK: %-12s core %ld prio %lu  exited, stack %lu of %lu bytes free%s\n", t.name,
+                    (long)t.core, (unsigned long)t.priority, (unsigned long)free_bytes,
+                    (unsigned long)t.stack_bytes, warn);
+      continue;
+    }
+#if TASK_MONITOR_RUNTIME_STATS
+    // From the snapshot, not the handle: the task may have exited since
+    int s = find_status(t.handle, n);
+    if (s < 0) continue;
+    free_bytes = status[s].usStackHighWaterMark;
+    warn = free_bytes < TASK_MONITOR_STACK_WARN ? "  LOW" : "";
+    Serial.printf("TASK: %-12s core %ld prio %lu  cpu %5.1f%%  stack %lu of %lu bytes free%s\n", t.name,
+                  (long)t.core, (unsigned long)status[s].uxCurrentPriority, 100.0f * run_delta[s] / elapsed,
+                  (unsigned long)free_bytes, (unsigned long)t.stack_bytes, warn);
+#else
+    Serial.printf("TASK: %-12s core %ld prio %lu  stack %lu of %lu bytes free%s\n", t.name,
+                  (long)t.core, (unsigned long)t.priority, (unsigned long)free_bytes,
+                  (unsigned long)t.stack_bytes, warn);
+#endif
+  }
+}
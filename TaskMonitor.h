@@ -0,0 +1,67 @@
+#pragma once
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// ============================================================================
+// TASK TOPOLOGY
+// ----------------------------------------------------------------------------
+// Which core and priority each task runs at. The Arduino loop task (setup(),
+// loop(), LVGL and the panel's bounce-buffer ISR, which is allocated from
+// setup()) runs on ARDUINO_RUNNING_CORE. CAN receive/decode gets the other
+// core to itself at a priority above everything else we start there, so a
+// full-screen redraw never delays a batch and the background tasks (NVS save,
+// odometer, history, logger, one-shot init) only use the time RX leaves idle.
+// ============================================================================
+
+#define TASK_CORE_UI  ARDUINO_RUNNING_CORE
+#define TASK_CORE_RX  (1 - ARDUINO_RUNNING_CORE)
+#define TASK_CORE_BG  TASK_CORE_RX
+
+#define TASK_PRIO_UI  1   // loop(); the Arduino default
+#define TASK_PRIO_RX  5   // Preempts the background tasks as soon as a frame is queued
+#define TASK_PRIO_I2C 3   // I2C service (I2C_Service.h): above the background tasks it serves
+#define TASK_PRIO_BG  1
+
+#if TASK_CORE_RX == TASK_CORE_UI
+#error "CAN receive must not share the LVGL core"
+#endif
+
+// One entry of a task table started by task_start_all()
+typedef struct {
+  TaskFunction_t fn;
+  const char *name;
+  uint32_t stack_bytes;
+  UBaseType_t priority;
+  BaseType_t core;
+} TaskSpec;
+
+// ============================================================================
+// TASK MONITOR
+// ----------------------------------------------------------------------------
+// Every task started through task_start()/task_start_all() is registered for
+// the periodic report: CPU share of its core over the window (needs FreeRTOS
+// run-time stats, on in the Arduino-ESP32 sdkconfig; the column is left out
+// otherwise) and the stack high-water mark against its size. Printed with the
+// CAN RX stats, so the same window shows whether frames were lost.
+// ============================================================================
+
+#define TASK_MONITOR_STATS        1   // 1 = print the task report with the RX stats
+#define TASK_MONITOR_MAX          16  // Registered tasks
+#define TASK_MONITOR_SYSTEM_MAX   32  // Tasks in the system incl. IDF ones (run-time stats only)
+#define TASK_MONITOR_STACK_WARN   512 // Flag tasks with less free stack than this (bytes)
+// Invalidate the whole active screen every this many ms to load the LVGL core
+// while the report runs (0 = off). For checking RX isolation on the bench.
+#define TASK_MONITOR_FULL_REDRAW_MS 0
+
+// xTaskCreatePinnedToCore() plus registration; false if the task could not be created
+bool task_start(TaskFunction_t fn, const char *name, uint32_t stack_bytes, UBaseType_t priority, BaseType_t core,
+                TaskHandle_t *handle_out = NULL);
+// Start every entry of a table; returns how many failed
+uint32_t task_start_all(const TaskSpec *specs, size_t count);
+// Register a task started elsewhere (the Arduino loop task)
+void task_monitor_add(TaskHandle_t handle, const char *name, uint32_t stack_bytes, UBaseType_t priority, BaseType_t core);
+// A registered task about to vTaskDelete(NULL) records its final high-water mark
+void task_monitor_exit(void);
+// Print per-task CPU and stack use since the last call
+void task_monitor_print(uint32_t window_ms);
@@ -1,13 +1,27 @@
 #include <Arduino.h>
 #include <Preferences.h>
 #include "CANBus_Driver.h"
+#include "CAN_Decoder.h"
+#include "History.h"
+#include "DataLogger.h"
+#include "FixedFormat.h"
 #include "LVGL_Driver.h"
 #include "I2C_Driver.h"
+#include "I2C_Service.h"
 #include "Screens.h"
+#include "RotatedLabel.h"
+#include "NumericLabel.h"
+#include "TaskMonitor.h"
+#include "Buttons.h"
+#include "BootProfile.h"
+#include "OdometerJournal.h"
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include "freertos/queue.h"
+#include <freertos/semphr.h>
+#include "esp_timer.h"
+#include "esp_partition.h"
 
 // ============================================================================
 // GLOBAL VARIABLES AND CONFIGURATION
@@ -25,120 +39,40 @@ unsigned long last_loop_time = 0;
 #define CAN_TIMEOUT_MS 5000
 #define LOOP_TIMEOUT_MS 1000
 
-// TCA9554 P5-P8 Input Monitoring
-volatile uint8_t tca_inputs_last_state = 0xFF;  // Assume all pulled high initially
-unsigned long last_tca_check = 0;
-#define TCA_CHECK_INTERVAL_MS 50  // Check every 50ms
-
-// Status Icon Control
-volatile bool cruise_active = false;
-volatile bool tcs_active = false;
-volatile bool launch_active = false;
-volatile bool two_step_active = false;
-volatile bool exhaust_bypass_active = false;
-volatile unsigned long last_cruise_time = 0;
-volatile unsigned long last_tcs_time = 0;
-volatile unsigned long last_launch_time = 0;
-volatile unsigned long last_two_step_time = 0;
-volatile unsigned long last_exhaust_bypass_time = 0;
-volatile bool icons_startup_shown = false;
-#define ICON_TIMEOUT_MS 500  // Hide icons after 500ms of no CAN data
-
-// ECU Warning state (from 0x64C)
-volatile uint8_t ecu_warning_flags = 0; // Bitmask of active warnings
-volatile unsigned long last_warning_time = 0;
-#define WARNING_TIMEOUT_MS 500 // Clear warning after 500ms of no updates
-
-// Warning flag bit positions
-#define WARN_FUEL_PRESSURE    (1 << 0)
-#define WARN_CRANKCASE_PRESS  (1 << 1)
-#define WARN_OIL_PRESSURE     (1 << 2)
-#define WARN_OIL_TEMP         (1 << 3)
-#define WARN_ENGINE_SPEED     (1 << 4)
-#define WARN_COOLANT_PRESSURE (1 << 5)
-#define WARN_COOLANT_TEMP     (1 << 6)
-#define WARN_KNOCK            (1 << 7)
+// TCA9554 P5-P8 inputs are read by the Buttons task (Buttons.h)
+bool tca_present = false;
+
+// Status Icon Control (CAN-driven icon state lives in CAN_Decoder)
+bool icons_startup_shown = false;  // For BOOT_ICONS_MS once the boot screen ends
+
+// Boot screen (BootProfile.h): shown from setup() until loop() ends it
+static unsigned long splash_start = 0;
+static bool splash_skip = false;  // A button was pressed during it
+
+// UI task (the Arduino loop) wake-ups, as task notification bits: CAN_CHANGED_*
+// from the RX task (CAN_Decoder.h) and these from the tasks below
+#define UI_EVENT_ODOMETER     (1u << 25)  // Odometer, trip or units changed
+#define UI_EVENT_ICONS        (1u << 26)  // icons_startup_shown changed (set by loop() itself)
+#define UI_EVENT_BUTTONS      (1u << 27)  // Button events queued
+static_assert((CAN_CHANGED_ALL & (UI_EVENT_ODOMETER | UI_EVENT_ICONS | UI_EVENT_BUTTONS)) == 0,
+              "UI events overlap CAN_CHANGED_* bits");
+
+#define UI_VALUE_MIN_INTERVAL_MS 100  // Value labels redraw at most this often
+#define UI_MAX_SLEEP_MS          100  // Longest loop() sleep (watchdog: LOOP_TIMEOUT_MS)
+
+TaskHandle_t ui_task = NULL;
+
+void ui_notify(uint32_t events) {
+  if (ui_task != NULL) xTaskNotify(ui_task, events, eSetBits);
+}
 
 // ============================================================================
 // CAN DATA STRUCTURES
 // ============================================================================
 
-// Thread-safe data structure for passing CAN data to UI
-// Raw values stored as received from M1 ECU (pre-scaling)
-typedef struct {
-  // 0x649: Coolant temp (B0, x1 -40 offset, °C), Oil temp (B2), Battery volts (B5, x0.1 V)
-  uint8_t  coolant_temp_raw;    // x1, -40 offset → °C
-  uint8_t  battery_volts_raw;   // x0.1 → V
-  bool     updated_0x649;
-  unsigned long last_update_0x649;
-
-  // 0x644: Engine oil pressure (B4-5, x0.1 kPa)
-  uint16_t oil_press_raw;       // x0.1 kPa → PSI (/6.895)
-  bool     updated_0x644;
-  unsigned long last_update_0x644;
-
-  // 0x651: Lambda Bank 1 (B2, x0.01 LA), Lambda Bank 2 (B3, x0.01 LA)
-  uint8_t  lambda_bank1_raw;    // x0.01 → AFR (x14.7)
-  uint8_t  lambda_bank2_raw;    // x0.01 → AFR (x14.7)
-  bool     updated_0x651;
-  unsigned long last_update_0x651;
-
-  // 0x640: Engine speed (B0-1, x1 RPM), MAP (B2-3, x0.1 kPa)
-  uint16_t map_raw;             // x0.1 kPa → PSI (/6.895)
-  bool     updated_0x640;
-  unsigned long last_update_0x640;
-
-  // 0x659: Vehicle speed (B4-5, x0.1 km/h)
-  uint16_t speed_raw;           // x0.1 km/h → MPH (/1.60934)
-  bool     updated_0x659;
-  unsigned long last_update_0x659;
-
-  // 0x641: Low side fuel pressure (B4-5, x0.1 kPa)
-  uint16_t ls_fuel_press_raw;   // x0.1 kPa → PSI (/6.895)
-  bool     updated_0x641;
-  unsigned long last_update_0x641;
-
-  // 0x641: Fuel Injector Primary Duty Cycle (B6, x1 %)
-  uint8_t  inj_duty_cycle_raw;  // x1 → %
-  bool     updated_0x641_duty;
-  unsigned long last_update_0x641_duty;
-
-  // 0x670: Ethanol/fuel composition (B5, x1 %)
-  uint8_t  ethanol_pct_raw;     // x1 → %
-  bool     updated_0x670;
-  unsigned long last_update_0x670;
-} DisplayData;
-
-volatile DisplayData display_data = {};
-SemaphoreHandle_t display_data_mutex = NULL;
-
-#define CAN_DATA_TIMEOUT_MS 500 // Reset values after 500ms of no updates
-
-// Max value tracking (same types as DisplayData raw values)
-typedef struct {
-  uint8_t  coolant_temp_max;
-  uint16_t oil_press_max;
-  uint8_t  lambda_bank1_max;
-  uint8_t  lambda_bank2_max;
-  uint16_t map_max;
-  uint16_t speed_max;
-  uint16_t ls_fuel_press_max;
-  uint8_t  inj_duty_cycle_max;
-  uint8_t  ethanol_pct_max;
-  uint8_t  battery_volts_max;
-} MaxValues;
-
-volatile MaxValues max_values = {};
-
-// Max recall state
-volatile bool max_recall_active = false;
-volatile bool max_clear_active = false; // Track if we're clearing (vs recalling)
-volatile unsigned long max_recall_start_time = 0;
-volatile unsigned long max_recall_button_press_start = 0; // When button was first pressed
-volatile bool max_recall_button_held = false; // Is the button currently held
-volatile bool max_recall_cleared_this_press = false; // Already cleared during this hold
-#define MAX_RECALL_DISPLAY_MS 2000 // Show max values for 2 seconds after release
-#define MAX_CLEAR_HOLD_MS 3000 // Hold 3 seconds to clear
+// DisplayData / MaxValues and the frame decoder live in CAN_Decoder.h so they
+// also build on the host. receive_can_task is their only writer and publishes
+// through the decoder's seqlock; the UI reads with can_state_snapshot().
 
 // ============================================================================
 // PERSISTENT STORAGE
@@ -150,7 +84,6 @@ uint32_t trip_miles = 0;
 uint32_t trip2_miles = 0;
 uint8_t last_screen_mode = 0;
 uint8_t current_trip_display = 1; // 1 or 2, always starts at 1
-bool restore_mode_pending = false; // Flag to trigger mode restore from main loop
 
 // ============================================================================
 // ODOMETER TRACKING
@@ -161,10 +94,77 @@ volatile uint8_t current_speed = 0; // Current speed in MPH
 portMUX_TYPE speed_mutex = portMUX_INITIALIZER_UNLOCKED;
 volatile bool trip_reset_pending = false; // Flag to trigger trip reset from main loop
 volatile bool trip_switch_pending = false; // Flag to trigger trip display switch from main loop
-volatile bool odometer_display_pending = false; // Flag to trigger odometer display update
 
-// Load values from NVS flash
+// Odometer journal (OdometerJournal.h) in the "odometer" partition. Without
+// that partition the values stay in NVS, saved every NVS_SAVE_INTERVAL_MS.
+#define NVS_SAVE_INTERVAL_MS 10000
+
+static OdoJournal odo_journal;
+static bool odo_journal_ok = false;
+static const esp_partition_t *odo_partition = NULL;
+static SemaphoreHandle_t odo_journal_lock = NULL; // Save task and trip reset both commit
+
+static bool odo_flash_read(void *ctx, uint32_t offset, void *dst, uint32_t len) {
+  return esp_partition_read((const esp_partition_t *)ctx, offset, dst, len) == ESP_OK;
+}
+
+static bool odo_flash_write(void *ctx, uint32_t offset, const void *src, uint32_t len) {
+  return esp_partition_write((const esp_partition_t *)ctx, offset, src, len) == ESP_OK;
+}
+
+static bool odo_flash_erase(void *ctx, uint32_t offset) {
+  return esp_partition_erase_range((const esp_partition_t *)ctx, offset, ODO_SECTOR_BYTES) == ESP_OK;
+}
+
+// Mount the journal; true if it held a record (the values are then loaded)
+static bool load_odometer_journal(void) {
+  const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                         ODO_JOURNAL_LABEL);
+  if (part == NULL || part->size < 2 * ODO_SECTOR_BYTES) {
+    Serial.println("No \"" ODO_JOURNAL_LABEL "\" partition, odometer stays in NVS");
+    return false;
+  }
+  odo_journal_lock = xSemaphoreCreateMutex();
+  if (odo_journal_lock == NULL) return false;
+  odo_journal_ok = true;
+  odo_partition = part;
+
+  OdoFlash flash = { odo_flash_read, odo_flash_write, odo_flash_erase, (void *)part,
+                     (uint32_t)(part->size / ODO_SECTOR_BYTES * ODO_SECTOR_BYTES) };
+  OdoState state;
+  if (!odo_journal_mount(&odo_journal, &flash, &state)) {
+    Serial.println("Odometer journal empty, starting it from NVS");
+    return false;
+  }
+  odometer_miles = state.odometer;
+  trip_miles = state.trip;
+  trip2_miles = state.trip2;
+  last_screen_mode = state.screen_mode;
+  Serial.printf("Loaded from journal: Odometer=%lu, Trip1=%lu, Trip2=%lu, Mode=%d (record %lu)\n",
+                odometer_miles, trip_miles, trip2_miles, last_screen_mode, (unsigned long)odo_journal.sequence);
+  return true;
+}
+
+// Where the values are kept from now on, printed once at boot
+static void print_odometer_storage(void) {
+  if (odo_journal_ok) {
+    Serial.printf("Odometer storage: journal in \"%s\" partition at 0x%lx (%lu KB), commit every %d ms\n",
+                  ODO_JOURNAL_LABEL, (unsigned long)odo_partition->address,
+                  (unsigned long)(odo_partition->size / 1024), ODO_JOURNAL_COMMIT_MS);
+  } else {
+    Serial.printf("Odometer storage: NVS, saved every %d ms\n", NVS_SAVE_INTERVAL_MS);
+  }
+}
+
+void save_persistent_data();
+
+// Load values from the odometer journal, or from NVS flash
 void load_persistent_data() {
+  if (load_odometer_journal()) {
+    print_odometer_storage();
+    return;
+  }
+
   preferences.begin("gauge", false); // Open in read-only mode
   
   // Load odometer/trip as hundredths of miles (default: 5862500 = 58,625.00 miles)
@@ -193,10 +193,21 @@ void load_persistent_data() {
   
   Serial.printf("Loaded from NVS: Odometer=%lu, Trip1=%lu, Trip2=%lu, Mode=%d\n", 
                 odometer_miles, trip_miles, trip2_miles, last_screen_mode);
+  if (odo_journal_ok) save_persistent_data(); // First journal record; NVS is no longer written
+  print_odometer_storage();
 }
 
-// Save values to NVS flash
+// Save values to the odometer journal, or to NVS flash
 void save_persistent_data() {
+  if (odo_journal_ok) {
+    OdoState state = { odometer_miles, trip_miles, trip2_miles, last_screen_mode };
+    xSemaphoreTake(odo_journal_lock, portMAX_DELAY);
+    bool ok = odo_journal_commit(&odo_journal, &state);
+    xSemaphoreGive(odo_journal_lock);
+    if (!ok) Serial.println("Odometer journal write failed");
+    return;
+  }
+
   preferences.begin("gauge", false); // Open in read-write mode
   
   preferences.putUInt("odometer", odometer_miles);
@@ -212,7 +223,8 @@ void save_persistent_data() {
   */
 }
 
-// Periodic save task - saves every 10 seconds if values changed
+// Periodic save task - saves every ODO_JOURNAL_COMMIT_MS (journal) or
+// NVS_SAVE_INTERVAL_MS (NVS) if values changed
 void periodic_save_task(void *arg) {
   static uint32_t last_odometer = 0;
   static uint32_t last_trip = 0;
@@ -220,7 +232,7 @@ void periodic_save_task(void *arg) {
   static uint8_t last_mode = 0;
   
   while (1) {
-    vTaskDelay(pdMS_TO_TICKS(10000)); // Check every 10 seconds
+    vTaskDelay(pdMS_TO_TICKS(odo_journal_ok ? ODO_JOURNAL_COMMIT_MS : NVS_SAVE_INTERVAL_MS));
     
     // Only save if values have changed
     if (odometer_miles != last_odometer || 
@@ -236,12 +248,26 @@ void periodic_save_task(void *arg) {
   }
 }
 
+// Odometer/trip text in the display unit system (stored as hundredths of miles)
+static void format_distance(char *text, uint32_t hundredths) {
+  if (can_display_units() == DISPLAY_UNITS_METRIC) fx_format_km(text, hundredths);
+  else fx_format_miles(text, hundredths);
+}
+
+// Switch between imperial and metric at run time; call from the main loop
+void set_display_units(DisplayUnits units) {
+  can_set_display_units(units);
+  update_screen_labels(get_current_screen_mode());
+  ui_notify(UI_EVENT_ODOMETER);
+}
+
 // Update odometer/trip display labels
 void update_odometer_display() {
   static uint32_t last_displayed_odometer = 0;
   static uint32_t last_displayed_trip1 = 0;
   static uint32_t last_displayed_trip2 = 0;
   static uint8_t last_displayed_trip_num = 0;
+  static DisplayUnits last_displayed_units = DISPLAY_UNITS_COUNT;
   
   // Check if labels exist before updating
   lv_obj_t* odo_label = get_odometer_label();
@@ -253,12 +279,14 @@ void update_odometer_display() {
     return;
   }
   
-  if (odometer_miles != last_displayed_odometer) {
+  bool units_changed = can_display_units() != last_displayed_units;
+  last_displayed_units = can_display_units();
+
+  if (units_changed || odometer_miles != last_displayed_odometer) {
     char text[16];
-    // Display as miles with 1 decimal place (stored as hundredths)
-    float miles = odometer_miles / 100.0;
-    sprintf(text, "%.1f", miles);
-    lv_label_set_text(odo_label, text);
+    // Display with 1 decimal place (stored as hundredths of miles)
+    format_distance(text, odometer_miles);
+    rotated_label_set_text(odo_label, text);
     last_displayed_odometer = odometer_miles;
   }
   
@@ -268,28 +296,26 @@ void update_odometer_display() {
   // Update trip text label if trip number changed
   if (trip_changed) {
     if (current_trip_display == 1) {
-      lv_label_set_text(trip_text_label, "Trip 1");
+      rotated_label_set_text(trip_text_label, "Trip 1");
     } else {
-      lv_label_set_text(trip_text_label, "Trip 2");
+      rotated_label_set_text(trip_text_label, "Trip 2");
     }
     last_displayed_trip_num = current_trip_display;
   }
   
   // Always update trip value if trip changed, or if the value changed
   if (current_trip_display == 1) {
-    if (trip_changed || trip_miles != last_displayed_trip1) {
+    if (trip_changed || units_changed || trip_miles != last_displayed_trip1) {
       char text[16];
-      float miles = trip_miles / 100.0;
-      sprintf(text, "%.1f", miles);
-      lv_label_set_text(trip_label, text);
+      format_distance(text, trip_miles);
+      rotated_label_set_text(trip_label, text);
       last_displayed_trip1 = trip_miles;
     }
   } else {
-    if (trip_changed || trip2_miles != last_displayed_trip2) {
+    if (trip_changed || units_changed || trip2_miles != last_displayed_trip2) {
       char text[16];
-      float miles = trip2_miles / 100.0;
-      sprintf(text, "%.1f", miles);
-      lv_label_set_text(trip_label, text);
+      format_distance(text, trip2_miles);
+      rotated_label_set_text(trip_label, text);
       last_displayed_trip2 = trip2_miles;
     }
   }
@@ -327,29 +353,6 @@ void process_trip_switch() {
   }
 }
 
-// Task to restore screen mode after boot screen completes
-void restore_screen_mode_task(void *arg) {
-  // Wait for boot screen to complete (4 seconds + small buffer)
-  vTaskDelay(pdMS_TO_TICKS(4100));
-  
-  // Set flag to trigger mode restore from main loop (LVGL-safe)
-  restore_mode_pending = true;
-  
-  Serial.printf("Boot complete, will restore mode to %d\n", last_screen_mode);
-  
-  // Wait a bit more for main screen to fully load, then trigger odometer display update
-  vTaskDelay(pdMS_TO_TICKS(200));
-  odometer_display_pending = true;
-  
-  // Show icons for 2 seconds on startup
-  icons_startup_shown = true;
-  vTaskDelay(pdMS_TO_TICKS(2000));
-  icons_startup_shown = false;
-  
-  // Task is done, delete itself
-  vTaskDelete(NULL);
-}
-
 // Task to calculate distance traveled and update odometer/trip
 void odometer_update_task(void *arg) {
   const int SAMPLES_PER_SECOND = 10; // Sample every 100ms
@@ -389,48 +392,51 @@ void odometer_update_task(void *arg) {
       trip2_miles += miles_to_add;
       accumulated_distance -= (miles_to_add / 100.0);
       
-      // Trigger display update from main loop (LVGL-safe)
-      // Only set flag if not already pending to avoid overwhelming the system
-      if (!odometer_display_pending) {
-        odometer_display_pending = true;
-      }
+      // Trigger display update from main loop (LVGL-safe); repeated
+      // notifications before it runs collapse into one
+      ui_notify(UI_EVENT_ODOMETER);
     }
   }
 }
 
 void drivers_init(void) {
   i2c_init();
+  // All I2C transfers from here on run on the I2C task; if it cannot start
+  // they stay blocking on the caller and buttons_init() leaves input off
+  i2c_service_start();
+  i2c_set_device_policy(TCA9554_ADDRESS, 10, 2);
 
   Serial.println("Scanning for TCA9554...");
-  bool found = false;
-  for (int attempt = 0; attempt < 10; attempt++) {
-    if (i2c_scan_address(0x20)) {
-      found = true;
-      break;
-    }
-    delay(50);
-  }
+  bool found = wait_for_expander(TCA9554_ADDRESS, 500);
 
   if (!found) {
     Serial.println("TCA9554 not detected! Skipping expander init.");
   } else {
+    tca_present = true;
     // Initialize TCA9554 with P5-P8 as inputs (bits 4-7 = 1), others as output (0)
     // Binary: 1111 0000 = 0xF0
     tca9554pwr_init(0xF0);
     Serial.println("TCA9554 initialized with P5-P8 as inputs");
   }
+  boot_mark("expander");
   lcd_init();
+  boot_mark("panel");
   lvgl_init();
+  boot_mark("LVGL");
 }
 
 void delayed_can_init_task(void *arg)
 {
-  Serial.println("Delayed CAN init task started, waiting 5 seconds...");
-  vTaskDelay(pdMS_TO_TICKS(5000));
-  Serial.println("5 seconds passed, initializing CANbus");
+  if (BOOT_CAN_DELAY_MS > 0) {
+    Serial.printf("Delayed CAN init task started, waiting %d ms...\n", BOOT_CAN_DELAY_MS);
+    vTaskDelay(pdMS_TO_TICKS(BOOT_CAN_DELAY_MS));
+  }
+  Serial.println("Initializing CANbus");
   canbus_init();
   can_initiated = true;
+  boot_mark("CAN started");
   Serial.println("CANbus initialized, flag set");
+  task_monitor_exit();
   vTaskDelete(NULL);
 }
 
@@ -439,314 +445,239 @@ void watchdog_task(void *arg) {
   
   Serial.println("Watchdog task started");
   
+  bool can_was_silent = false;
   while (1) {
+    unsigned long last_msg = last_can_message_time; // Before now: RX may update it meanwhile
     unsigned long now = millis();
     
     if (now - last_loop_time > LOOP_TIMEOUT_MS) {
       Serial.printf("WARNING: Main loop appears frozen! Last run: %lu ms ago\n", now - last_loop_time);
     }
     
-    if (can_initiated && last_can_message_time > 0) {
-      if (now - last_can_message_time > CAN_TIMEOUT_MS) {
-        Serial.println("WARNING: No CAN messages received recently.");
-      }
+    bool can_silent = can_initiated && last_msg > 0 && now - last_msg > CAN_TIMEOUT_MS;
+    if (can_silent) {
+      Serial.println("WARNING: No CAN messages received recently.");
     }
+#if LOGGER_ENABLED
+    // ECU off, likely key-off: get the session's last block to flash while there is power
+    if (can_silent && !can_was_silent) logger_flush();
+#endif
+    can_was_silent = can_silent;
     
     vTaskDelay(pdMS_TO_TICKS(2000));
   }
 }
 
+// The 10 s report (about 1.5 KB, over 100 ms at 115200 baud) prints here at
+// background priority. receive_can_task only copies and resets its counters
+// and wakes this task, so it never waits on serial.
+static portMUX_TYPE rx_stats_mux = portMUX_INITIALIZER_UNLOCKED;
+static CanRxStats rx_stats_window;   // Last window handed over by RX
+static uint32_t rx_stats_window_ms = 0;
+static TaskHandle_t stats_task_handle = NULL;
+
+void stats_task(void *arg) {
+  static CanRxStats st; // Static: keeps the copy off the task stack
+  while (1) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    portENTER_CRITICAL(&rx_stats_mux);
+    st = rx_stats_window;
+    uint32_t window_ms = rx_stats_window_ms;
+    portEXIT_CRITICAL(&rx_stats_mux);
+
+    canbus_print_rx_stats(&st, window_ms);
+#if LOGGER_ENABLED
+    logger_print_stats();
+#endif
+#if LCD_WINDOW_FB && LCD_BOUNCE_STATS
+    lcd_print_bounce_stats(window_ms);
+#endif
+#if I2C_STATS
+    i2c_print_stats(window_ms);
+#endif
+#if TASK_MONITOR_STATS
+    task_monitor_print(window_ms);
+#endif
+    boot_report(); // If no live values have been shown yet
+  }
+}
+
+// RX task: hand the window's counters to stats_task and start a new window
+static void rx_publish_stats(uint32_t window_ms) {
+  portENTER_CRITICAL(&rx_stats_mux);
+  rx_stats_window = can_rx_stats;
+  rx_stats_window_ms = window_ms;
+  portEXIT_CRITICAL(&rx_stats_mux);
+  memset(&can_rx_stats, 0, sizeof(can_rx_stats));
+  if (stats_task_handle != NULL) xTaskNotifyGive(stats_task_handle);
+}
+
+// Speed for the odometer, set outside the seqlock write (avoids nesting speed_mutex in it)
+static void rx_set_current_speed(uint16_t speed_raw) {
+  portENTER_CRITICAL(&speed_mutex);
+  current_speed = (uint8_t)(speed_raw * 0.1f / 1.60934f);
+  portEXIT_CRITICAL(&speed_mutex);
+}
+
+// Wake the UI task only if the batch changed something it shows
+static void rx_notify_ui(void) {
+  uint32_t changes = can_take_changes();
+  if (changes) ui_notify(changes);
+}
+
+static void rx_record_batch(uint32_t frames, uint32_t decode_us) {
+  can_rx_stats.batches++;
+  can_rx_stats.frames += frames;
+  if (frames > can_rx_stats.max_batch) can_rx_stats.max_batch = frames;
+  if (frames >= CAN_RX_BATCH_MAX) can_rx_stats.full_batches++;
+  can_rx_stats.decode_us_total += decode_us;
+  if (decode_us > can_rx_stats.decode_us_max) can_rx_stats.decode_us_max = decode_us;
+}
+
+// Overflow drains have their own counters: a drain of up to 2 * CAN_RX_QUEUE_LEN
+// frames is not a batch
+static void rx_record_overflow(uint32_t frames, uint32_t decode_us) {
+  can_rx_stats.overflows++;
+  can_rx_stats.frames += frames;
+  can_rx_stats.overflow_frames += frames;
+  if (decode_us > can_rx_stats.overflow_decode_us_max) can_rx_stats.overflow_decode_us_max = decode_us;
+}
+
+// Overloaded: drain the queue without decoding, keeping the newest frame per
+// ID, then decode each ID once. Nothing goes stale, nothing waits.
+static void rx_drain_overflow(CanFrameSlots *slots, int speed_slot) {
+  uint32_t drained = 0;
+  twai_message_t message;
+  while (drained < 2 * CAN_RX_QUEUE_LEN && twai_receive(&message, 0) == ESP_OK) {
+    drained++;
+    int index = can_handled_index(message.identifier);
+    if (index < 0) continue;
+    if (can_slots_put(slots, index, message.data)) {
+      can_rx_stats.coalesced++;
+      can_rx_stats.superseded[index]++;
+    }
+  }
+
+  unsigned long now_msg = millis();
+  last_can_message_time = now_msg;
+  bool has_speed = slots->pending & (1u << speed_slot);
+  uint16_t speed_raw = ((uint16_t)slots->data[speed_slot][4] << 8) | slots->data[speed_slot][5];
+
+  int64_t t0 = esp_timer_get_time();
+  can_state_write_begin();
+  can_slots_decode(slots, now_msg, get_current_screen_mode());
+  can_state_write_end();
+  rx_record_overflow(drained, (uint32_t)(esp_timer_get_time() - t0));
+  rx_notify_ui();
+
+  if (has_speed) rx_set_current_speed(speed_raw);
+}
+
+// Block until a frame arrives, then take whatever else is already queued
+static void rx_receive_batch(twai_message_t *batch) {
+  esp_err_t err = twai_receive(&batch[0], pdMS_TO_TICKS(CAN_RX_WAIT_MS));
+
+  if (err == ESP_OK) {
+    static bool first_frame = true;
+    if (first_frame) {
+      boot_mark("first CAN frame");
+      first_frame = false;
+    }
+    uint32_t count = 1;
+    while (count < CAN_RX_BATCH_MAX && twai_receive(&batch[count], 0) == ESP_OK) {
+      count++;
+    }
+
+    unsigned long now_msg = millis(); // One timestamp for the whole batch
+    last_can_message_time = now_msg;
+    uint8_t screen_mode = get_current_screen_mode();
+    bool has_speed = false;
+    uint16_t speed_raw = 0;
+
+    int64_t t0 = esp_timer_get_time();
+    can_state_write_begin();
+    for (uint32_t i = 0; i < count; i++) {
+      can_decode_frame(batch[i].identifier, batch[i].data, now_msg, screen_mode);
+      if (batch[i].identifier == 0x659) {
+        has_speed = true;
+        speed_raw = ((uint16_t)batch[i].data[4] << 8) | batch[i].data[5];
+      }
+    }
+    can_state_write_end();
+    rx_record_batch(count, (uint32_t)(esp_timer_get_time() - t0));
+    rx_notify_ui();
+
+    if (has_speed) rx_set_current_speed(speed_raw);
+
+  } else if (err != ESP_ERR_TIMEOUT) {
+    Serial.printf("CAN RX error: %s\n", esp_err_to_name(err));
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+}
+
 void receive_can_task(void *arg) {
   while (!can_initiated) {
-    vTaskDelay(pdMS_TO_TICKS(100));
+    vTaskDelay(pdMS_TO_TICKS(10));
   }
   
   Serial.println("CAN receive task starting...");
   
   uint32_t alerts;
-  uint32_t msg_count = 0;
-  uint32_t overflow_count = 0;
   uint32_t last_stats_time = millis();
+  twai_message_t batch[CAN_RX_BATCH_MAX];
+  static CanFrameSlots overflow_slots = {};
+  const int speed_slot = can_handled_index(0x659);
   
   while (1) {
     twai_read_alerts(&alerts, 0);
+    // Every path falls through to the stats check, so sustained overload still reports
     if (alerts & TWAI_ALERT_RX_QUEUE_FULL) {
-      overflow_count++;
-      twai_message_t dummy;
-      while (twai_receive(&dummy, 0) == ESP_OK) {}
-      vTaskDelay(pdMS_TO_TICKS(10));
-      continue;
-    }
-    
-    if (alerts & TWAI_ALERT_BUS_ERROR) {
+      rx_drain_overflow(&overflow_slots, speed_slot);
+    } else if (alerts & TWAI_ALERT_BUS_ERROR) {
       Serial.println("CAN bus error, recovering...");
       twai_initiate_recovery();
       vTaskDelay(pdMS_TO_TICKS(100));
-      continue;
+    } else {
+      rx_receive_batch(batch);
     }
-    
-    twai_message_t message;
-    esp_err_t err = twai_receive(&message, pdMS_TO_TICKS(10));
-    
-    if (err == ESP_OK) {
-      msg_count++;
-      last_can_message_time = millis();
-      unsigned long now_msg = millis(); // Capture time once, outside any critical section
-      
-      xSemaphoreTake(display_data_mutex, portMAX_DELAY);
-      switch (message.identifier) {
-        // ---- M1 ECU native messages ----
-
-        case 0x640: {
-          // Inlet_Manifold_Pressure: bit 23|16@0+ = B2-B3
-          uint16_t map_raw = ((uint16_t)message.data[2] << 8) | message.data[3];
-          display_data.map_raw = map_raw;
-          display_data.updated_0x640 = true;
-          display_data.last_update_0x640 = now_msg;
-          if (map_raw > max_values.map_max) max_values.map_max = map_raw;
-          break;
-        }
-
-        case 0x641: {
-          // Fuel_Pressure_Sensor: bit 39|16@0+ = B4-B5, x0.1 kPa
-          uint16_t ls_raw = ((uint16_t)message.data[4] << 8) | message.data[5];
-          display_data.ls_fuel_press_raw = ls_raw;
-          display_data.updated_0x641 = true;
-          display_data.last_update_0x641 = now_msg;
-          if (ls_raw > max_values.ls_fuel_press_max) max_values.ls_fuel_press_max = ls_raw;
-          // Fuel_Injector_Primary_Duty_Cycle: bit 55|8@0+ = B6, x1 %
-          uint8_t duty_raw = message.data[6];
-          display_data.inj_duty_cycle_raw = duty_raw;
-          display_data.updated_0x641_duty = true;
-          display_data.last_update_0x641_duty = now_msg;
-          if (duty_raw > max_values.inj_duty_cycle_max) max_values.inj_duty_cycle_max = duty_raw;
-          break;
-        }
-
-        case 0x644: {
-          // Engine_Oil_Pressure: bit 55|16@0+ = B6-B7, x0.1 kPa
-          uint16_t op_raw = ((uint16_t)message.data[6] << 8) | message.data[7];
-          display_data.oil_press_raw = op_raw;
-          display_data.updated_0x644 = true;
-          display_data.last_update_0x644 = now_msg;
-          if (op_raw > max_values.oil_press_max) max_values.oil_press_max = op_raw;
-          break;
-        }
-
-        case 0x649: {
-          display_data.coolant_temp_raw = message.data[0];
-          display_data.battery_volts_raw = message.data[5];
-          display_data.updated_0x649 = true;
-          display_data.last_update_0x649 = now_msg;
-          if (message.data[0] > max_values.coolant_temp_max) max_values.coolant_temp_max = message.data[0];
-          if (message.data[5] > max_values.battery_volts_max) max_values.battery_volts_max = message.data[5];
-          break;
-        }
-
-        case 0x651: {
-          display_data.lambda_bank1_raw = message.data[2];
-          display_data.lambda_bank2_raw = message.data[3];
-          display_data.updated_0x651 = true;
-          display_data.last_update_0x651 = now_msg;
-          if (message.data[2] > max_values.lambda_bank1_max) max_values.lambda_bank1_max = message.data[2];
-          if (message.data[3] > max_values.lambda_bank2_max) max_values.lambda_bank2_max = message.data[3];
-          break;
-        }
-
-        case 0x659: {
-          uint16_t spd_raw = ((uint16_t)message.data[4] << 8) | message.data[5];
-          display_data.speed_raw = spd_raw;
-          display_data.updated_0x659 = true;
-          display_data.last_update_0x659 = now_msg;
-          if (spd_raw > max_values.speed_max) max_values.speed_max = spd_raw;
-          break;
-        }
-
-        case 0x670: {
-          display_data.ethanol_pct_raw = message.data[5];
-          display_data.updated_0x670 = true;
-          display_data.last_update_0x670 = now_msg;
-          if (message.data[5] > max_values.ethanol_pct_max) max_values.ethanol_pct_max = message.data[5];
-          break;
-        }
-
-        case 0x178: {
-          // Peak recall button: byte 1, bit 6 (1 = pressed, 0 = released)
-          bool button_now = (message.data[1] >> 6) & 0x01;
-          
-          if (button_now && !max_recall_button_held) {
-            // Button just pressed - start tracking
-            max_recall_button_held = true;
-            max_recall_button_press_start = now_msg;
-            max_recall_cleared_this_press = false;
-            // Immediately show max recall
-            max_recall_active = true;
-            max_clear_active = false;
-            max_recall_start_time = now_msg;
-          } else if (button_now && max_recall_button_held) {
-            // Button still held - check for 3-second clear threshold
-            if (!max_recall_cleared_this_press && 
-                (now_msg - max_recall_button_press_start >= MAX_CLEAR_HOLD_MS)) {
-              // 3 seconds held - clear max values for current screen
-              uint8_t current_mode = get_current_screen_mode();
-              switch (current_mode) {
-                case 0:
-                  max_values.coolant_temp_max = 0;
-                  max_values.oil_press_max = 0;
-                  break;
-                case 1:
-                  max_values.lambda_bank1_max = 0;
-                  max_values.lambda_bank2_max = 0;
-                  break;
-                case 2:
-                  max_values.map_max = 0;
-                  max_values.speed_max = 0;
-                  break;
-                case 3:
-                  max_values.ls_fuel_press_max = 0;
-                  max_values.inj_duty_cycle_max = 0;
-                  break;
-                case 4:
-                  max_values.ethanol_pct_max = 0;
-                  max_values.battery_volts_max = 0;
-                  break;
-              }
-              max_clear_active = true;
-              max_recall_start_time = now_msg;
-              max_recall_cleared_this_press = true;
-            }
-            // Keep max_recall_active while held
-            max_recall_active = true;
-            max_recall_start_time = now_msg;
-          } else if (!button_now && max_recall_button_held) {
-            // Button released - show max recall for 2 more seconds then fade
-            max_recall_button_held = false;
-            max_recall_start_time = now_msg;
-            // max_recall_active stays true, will expire via MAX_RECALL_DISPLAY_MS
-          }
-          break;
-        }
-
-        case 0x64E: {
-          if ((message.data[3] >> 5) & 0x01) {
-            launch_active = true;
-            last_launch_time = now_msg;
-          }
-          if ((message.data[3] >> 4) & 0x01) {
-            tcs_active = true;
-            last_tcs_time = now_msg;
-          }
-          break;
-        }
-
-        case 0x650: {
-          if ((message.data[7] >> 6) & 0x01) {
-            two_step_active = true;
-            last_two_step_time = now_msg;
-          }
-          break;
-        }
-
-        case 0x64C: {
-          // ECU Warning flags from M1
-          // Byte 5 (data[5]): bit0=Fuel_Pressure, bit1=Crankcase_Pressure,
-          //   bit3=Oil_Pressure, bit4=Oil_Temp, bit5=Engine_Speed,
-          //   bit6=Coolant_Pressure, bit7=Coolant_Temp
-          // Byte 6 (data[6]): bit7=Knock
-          uint8_t flags = 0;
-          uint8_t b5 = message.data[5];
-          if (b5 & (1 << 0)) flags |= WARN_FUEL_PRESSURE;
-          if (b5 & (1 << 1)) flags |= WARN_CRANKCASE_PRESS;
-          if (b5 & (1 << 3)) flags |= WARN_OIL_PRESSURE;
-          if (b5 & (1 << 4)) flags |= WARN_OIL_TEMP;
-          if (b5 & (1 << 5)) flags |= WARN_ENGINE_SPEED;
-          if (b5 & (1 << 6)) flags |= WARN_COOLANT_PRESSURE;
-          if (b5 & (1 << 7)) flags |= WARN_COOLANT_TEMP;
-          if (message.data[6] & (1 << 7)) flags |= WARN_KNOCK;
-          ecu_warning_flags = flags;
-          last_warning_time = now_msg;
-          break;
-        }
-
-        case 0x6A8: {
-          if (message.data[3]) {
-            cruise_active = true;
-            last_cruise_time = now_msg;
-          }
-          if (message.data[5]) {
-            exhaust_bypass_active = true;
-            last_exhaust_bypass_time = now_msg;
-          }
-          break;
-        }
-      }
-      xSemaphoreGive(display_data_mutex);
-
-      // Update current_speed outside the critical section (avoids nested lock with speed_mutex)
-      if (message.identifier == 0x659) {
-        uint16_t spd_raw = ((uint16_t)message.data[4] << 8) | message.data[5];
-        portENTER_CRITICAL(&speed_mutex);
-        current_speed = (uint8_t)(spd_raw * 0.1f / 1.60934f);
-        portEXIT_CRITICAL(&speed_mutex);
-      }
 
-      if (msg_count % 10 == 0) {
-        vTaskDelay(pdMS_TO_TICKS(1));
-      }
-      
-      if (millis() - last_stats_time > 10000) {
-        Serial.printf("CAN: %lu msgs, %lu overflows\n", msg_count, overflow_count);
-        last_stats_time = millis();
-        msg_count = 0;
-      }
-      
-    } else if (err == ESP_ERR_TIMEOUT) {
-      vTaskDelay(pdMS_TO_TICKS(5));
-    } else {
-      Serial.printf("CAN RX error: %s\n", esp_err_to_name(err));
-      vTaskDelay(pdMS_TO_TICKS(10));
+    if (millis() - last_stats_time > 10000) {
+      rx_publish_stats(millis() - last_stats_time); // Printed by stats_task
+      last_stats_time = millis();
     }
   }
 }
 
-// Scale and format a float value for display (1 decimal place)
-void format_float_value(char* buffer, float value) {
-  // Right-align in 5 chars to accommodate decimals e.g. " 14.7"
-  char temp[10];
-  sprintf(temp, "%.1f", value);
-  int len = strlen(temp);
-  int padding = 5 - len;
-  if (padding < 0) padding = 0;
-  int i;
-  for (i = 0; i < padding; i++) buffer[i] = ' ';
-  strcpy(buffer + padding, temp);
-}
-
-// Helper function to format integer value with leading padding (4 chars, right-aligned)
-void format_value_with_padding(char* buffer, int value) {
-  char temp[8];
-  sprintf(temp, "%d", value);
-  int len = strlen(temp);
-  int padding = 4 - len;
-  if (padding < 0) padding = 0;
-  int i;
-  for (i = 0; i < padding; i++) buffer[i] = ' ';
-  strcpy(buffer + padding, temp);
-}
-
-void update_display_values(uint8_t mode, float left_val, float right_val) {
-  static float last_left = -9999;
-  static float last_right = -9999;
+// Colour thresholds in display units of each unit system
+typedef struct {
+  int32_t coolant_cold;  // Blue below
+  int32_t coolant_hot;   // Red at or above
+  int32_t oil_low;       // Red below
+  int32_t fuel_low;      // Red below
+} GaugeThresholds;
+
+static const GaugeThresholds gauge_thresholds[DISPLAY_UNITS_COUNT] = {
+  { 100, 210,  20,  40 },  // Imperial: °F, PSI
+  {  38,  99, 138, 276 },  // Metric: °C, kPa
+};
+
+// Values arrive as fixed-point display units (see FixedFormat.h); thresholds
+// below are in the same units, e.g. AFR in tenths
+void update_display_values(uint8_t mode, FixedValue left, FixedValue right) {
+  static int32_t last_left = INT32_MIN;
+  static int32_t last_right = INT32_MIN;
   static uint8_t last_left_r = 255, last_left_g = 255, last_left_b = 255;
   static uint8_t last_right_r = 255, last_right_g = 255, last_right_b = 255;
   static uint8_t last_mode = 255;
+  static DisplayUnits last_units = DISPLAY_UNITS_COUNT;
   
-  if (mode != last_mode) {
-    last_left = -9999;
-    last_right = -9999;
+  if (mode != last_mode || can_display_units() != last_units) {
+    last_left = INT32_MIN;
+    last_right = INT32_MIN;
     last_left_r = 255; last_left_g = 255; last_left_b = 255;
     last_right_r = 255; last_right_g = 255; last_right_b = 255;
     last_mode = mode;
+    last_units = can_display_units();
   }
   
   lv_obj_t *left_label = get_left_value_label();
@@ -755,22 +686,26 @@ void update_display_values(uint8_t mode, float left_val, float right_val) {
   uint8_t left_r = 255, left_g = 255, left_b = 255;
   uint8_t right_r = 255, right_g = 255, right_b = 255;
   
+  int32_t left_val = left.value;
+  int32_t right_val = right.value;
+  const GaugeThresholds *th = &gauge_thresholds[can_display_units()];
+  
   switch (mode) {
     case 0: // Coolant temp (°F) and oil pressure (PSI)
       // Coolant: blue if cold (<100°F), red if hot (≥210°F)
-      if (left_val > 0 && left_val < 100)       { left_r = 0;   left_g = 0;   left_b = 255; }
-      else if (left_val >= 210)                  { left_r = 255; left_g = 0;   left_b = 0;   }
+      if (left_val > 0 && left_val < th->coolant_cold) { left_r = 0;   left_g = 0;   left_b = 255; }
+      else if (left_val >= th->coolant_hot)            { left_r = 255; left_g = 0;   left_b = 0;   }
       // Oil: red if low (<20 PSI)
-      if (right_val > 0 && right_val < 20)       { right_r = 255; right_g = 0; right_b = 0;  }
+      if (right_val > 0 && right_val < th->oil_low)    { right_r = 255; right_g = 0; right_b = 0;  }
       break;
       
-    case 1: // AFR (Lambda × 14.7) - green 12-16, red otherwise
+    case 1: // AFR in tenths (Lambda × 14.7) - green 12.0-16.0, red otherwise
       if (left_val > 0) {
-        if (left_val < 12 || left_val > 16)      { left_r = 255; left_g = 0;   left_b = 0;   }
+        if (left_val < 120 || left_val > 160)    { left_r = 255; left_g = 0;   left_b = 0;   }
         else                                      { left_r = 0;   left_g = 255; left_b = 0;   }
       }
       if (right_val > 0) {
-        if (right_val < 12 || right_val > 16)    { right_r = 255; right_g = 0; right_b = 0;  }
+        if (right_val < 120 || right_val > 160)  { right_r = 255; right_g = 0; right_b = 0;  }
         else                                      { right_r = 0;   right_g = 255; right_b = 0;}
       }
       break;
@@ -779,7 +714,7 @@ void update_display_values(uint8_t mode, float left_val, float right_val) {
       break;
     case 3: // LS Fuel PSI and Injector Duty %
       // Fuel pressure: red if low (<40 PSI) while engine is running (value > 0)
-      if (left_val > 0 && left_val < 40)         { left_r = 255; left_g = 0;   left_b = 0;   }
+      if (left_val > 0 && left_val < th->fuel_low) { left_r = 255; left_g = 0;   left_b = 0;   }
       // Injector duty cycle: red if high (≥85%)
       if (right_val >= 85)                        { right_r = 255; right_g = 0; right_b = 0;  }
       break;
@@ -789,215 +724,118 @@ void update_display_values(uint8_t mode, float left_val, float right_val) {
   
   // Update left label
   if (left_val != last_left) {
-    char text[10];
-    // Integer display for ECT, LS Fuel PSI, Ethanol %
-    if (mode == 0 || mode == 3 || mode == 4) {
-      format_value_with_padding(text, (int)left_val);
-    } else {
-      format_float_value(text, left_val);
-    }
-    lv_label_set_text(left_label, text);
+    char text[16];
+    fx_format_value(text, left); // Integer (4 cols) or one decimal (5 cols) per channel
+    numeric_label_set_text(left_label, text);
     last_left = left_val;
   }
   if (left_r != last_left_r || left_g != last_left_g || left_b != last_left_b) {
-    lv_obj_set_style_text_color(left_label, lv_color_make(left_r, left_g, left_b), LV_PART_MAIN);
+    numeric_label_set_color(left_label, lv_color_make(left_r, left_g, left_b));
     last_left_r = left_r; last_left_g = left_g; last_left_b = left_b;
   }
   
   // Update right label
   if (right_val != last_right) {
-    char text[10];
-    // Integer display for Oil PSI, Speed, DI Fuel PSI
-    if (mode == 0 || mode == 2 || mode == 3) {
-      format_value_with_padding(text, (int)right_val);
-    } else {
-      format_float_value(text, right_val);
-    }
-    lv_label_set_text(right_label, text);
+    char text[16];
+    fx_format_value(text, right);
+    numeric_label_set_text(right_label, text);
     last_right = right_val;
   }
   if (right_r != last_right_r || right_g != last_right_g || right_b != last_right_b) {
-    lv_obj_set_style_text_color(right_label, lv_color_make(right_r, right_g, right_b), LV_PART_MAIN);
+    numeric_label_set_color(right_label, lv_color_make(right_r, right_g, right_b));
     last_right_r = right_r; last_right_g = right_g; last_right_b = right_b;
   }
 }
 
-void update_display_from_can_data(void) {
-  static unsigned long last_update_time = 0;
-  const unsigned long UPDATE_INTERVAL_MS = 100;
-  
-  unsigned long now = millis();
-  if (now - last_update_time < UPDATE_INTERVAL_MS) return;
-  
-  // Expire max recall (only when button is not held)
-  if (max_recall_active && !max_recall_button_held && 
-      (now - max_recall_start_time >= MAX_RECALL_DISPLAY_MS)) {
-    max_recall_active = false;
-    max_clear_active = false;
-  }
-  
-  float left_val = 0.0f, right_val = 0.0f;
+// Redraw the value labels from a snapshot; returns ms until a received
+// channel times out (UINT32_MAX if none), when this must run again
+uint32_t update_display_from_can_data(unsigned long now) {
+  uint16_t left_raw = 0, right_raw = 0;
   bool has_update = false;
   uint8_t mode = get_current_screen_mode();
 
-  // --- Snapshot display_data under mutex, no nested locks ---
-  xSemaphoreTake(display_data_mutex, portMAX_DELAY);
+  // --- Lock-free snapshot of the RX task's data (seqlock, RX never waits) ---
+  // If RX is mid-write for every retry, try again next tick
+  static DisplayData data = {};
+  static MaxValues max_data = {};
+  if (!can_state_snapshot(&data, &max_data)) return 1;
+  uint32_t next_timeout = can_ms_to_next_timeout(&data, now);
 
-  // Timeout checks
-  if (display_data.last_update_0x649 > 0 && now - display_data.last_update_0x649 > CAN_DATA_TIMEOUT_MS) {
-    display_data.coolant_temp_raw = 40;
-    display_data.battery_volts_raw = 0;
-    display_data.updated_0x649 = true;
-  }
-  if (display_data.last_update_0x644 > 0 && now - display_data.last_update_0x644 > CAN_DATA_TIMEOUT_MS) {
-    display_data.oil_press_raw = 0;
-    display_data.updated_0x644 = true;
-  }
-  if (display_data.last_update_0x651 > 0 && now - display_data.last_update_0x651 > CAN_DATA_TIMEOUT_MS) {
-    display_data.lambda_bank1_raw = 0;
-    display_data.lambda_bank2_raw = 0;
-    display_data.updated_0x651 = true;
-  }
-  if (display_data.last_update_0x640 > 0 && now - display_data.last_update_0x640 > CAN_DATA_TIMEOUT_MS) {
-    display_data.map_raw = 0;
-    display_data.updated_0x640 = true;
-  }
-  if (display_data.last_update_0x659 > 0 && now - display_data.last_update_0x659 > CAN_DATA_TIMEOUT_MS) {
-    display_data.speed_raw = 0;
-    display_data.updated_0x659 = true;
+  // Timeout checks (applied to our copy only; RX is the sole writer)
+  can_apply_timeouts(&data, now);
+  if (data.last_update_0x659 > 0 && now - data.last_update_0x659 > CAN_DATA_TIMEOUT_MS) {
     current_speed = 0; // speed_mutex not needed here - main loop only
   }
-  if (display_data.last_update_0x641 > 0 && now - display_data.last_update_0x641 > CAN_DATA_TIMEOUT_MS) {
-    display_data.ls_fuel_press_raw = 0;
-    display_data.updated_0x641 = true;
-  }
-  if (display_data.last_update_0x641_duty > 0 && now - display_data.last_update_0x641_duty > CAN_DATA_TIMEOUT_MS) {
-    display_data.inj_duty_cycle_raw = 0;
-    display_data.updated_0x641_duty = true;
-  }
-  if (display_data.last_update_0x670 > 0 && now - display_data.last_update_0x670 > CAN_DATA_TIMEOUT_MS) {
-    display_data.ethanol_pct_raw = 0;
-    display_data.updated_0x670 = true;
-  }
 
-  // Snapshot the values we need for this screen
+  // Nothing to show until this screen's channels have been received once;
+  // after that update_display_values() skips redraws of unchanged values
   switch (mode) {
-    case 0:
-      if (display_data.updated_0x649 || display_data.updated_0x644 || max_recall_active) {
-        left_val  = display_data.coolant_temp_raw;
-        right_val = display_data.oil_press_raw;
-        display_data.updated_0x649 = false;
-        display_data.updated_0x644 = false;
-        has_update = true;
-      }
-      break;
-    case 1:
-      if (display_data.updated_0x651 || max_recall_active) {
-        left_val  = display_data.lambda_bank1_raw;
-        right_val = display_data.lambda_bank2_raw;
-        display_data.updated_0x651 = false;
-        has_update = true;
-      }
-      break;
-    case 2:
-      if (display_data.updated_0x640 || display_data.updated_0x659 || max_recall_active) {
-        left_val  = display_data.map_raw;
-        right_val = display_data.speed_raw;
-        display_data.updated_0x640 = false;
-        display_data.updated_0x659 = false;
-        has_update = true;
-      }
-      break;
-    case 3:
-      if (display_data.updated_0x641 || display_data.updated_0x641_duty || max_recall_active) {
-        left_val  = display_data.ls_fuel_press_raw;
-        right_val = display_data.inj_duty_cycle_raw;
-        display_data.updated_0x641 = false;
-        display_data.updated_0x641_duty = false;
-        has_update = true;
-      }
-      break;
-    case 4:
-      if (display_data.updated_0x670 || display_data.updated_0x649 || max_recall_active) {
-        left_val  = display_data.ethanol_pct_raw;
-        right_val = display_data.battery_volts_raw;
-        display_data.updated_0x670 = false;
-        display_data.updated_0x649 = false;
-        has_update = true;
-      }
-      break;
+    case 0: has_update = data.last_update_0x649 > 0 || data.last_update_0x644 > 0; break;
+    case 1: has_update = data.last_update_0x651 > 0; break;
+    case 2: has_update = data.last_update_0x640 > 0 || data.last_update_0x659 > 0; break;
+    case 3: has_update = data.last_update_0x641 > 0 || data.last_update_0x641_duty > 0; break;
+    case 4: has_update = data.last_update_0x670 > 0 || data.last_update_0x649 > 0; break;
   }
+  if (!has_update && !max_recall_active) return next_timeout;
 
-  xSemaphoreGive(display_data_mutex);
-  // --- End of critical section ---
-
-  if (!has_update) return;
-
-  // Apply scaling outside the mutex - read max_values directly (volatile, no lock needed)
   if (max_recall_active) {
-    switch (mode) {
-      case 0:
-        left_val  = ((max_values.coolant_temp_max - 40) * 9.0f / 5.0f) + 32.0f;
-        right_val = max_values.oil_press_max * 0.1f / 6.895f;
-        break;
-      case 1:
-        left_val  = max_values.lambda_bank1_max * 0.01f * 14.7f;
-        right_val = max_values.lambda_bank2_max * 0.01f * 14.7f;
-        break;
-      case 2:
-        left_val  = (max_values.map_max * 0.1f - 105.0f) / 6.895f;
-        right_val = max_values.speed_max * 0.1f / 1.60934f;
-        break;
-      case 3:
-        left_val  = max_values.ls_fuel_press_max * 0.1f / 6.895f;
-        right_val = max_values.inj_duty_cycle_max;
-        break;
-      case 4:
-        left_val  = max_values.ethanol_pct_max;
-        right_val = max_values.battery_volts_max * 0.1f;
-        break;
-    }
+    can_screen_max_values(mode, &max_data, &left_raw, &right_raw);
   } else {
-    switch (mode) {
-      case 0:
-        left_val  = ((left_val - 40) * 9.0f / 5.0f) + 32.0f;
-        right_val = right_val * 0.1f / 6.895f;
-        break;
-      case 1:
-        left_val  = left_val * 0.01f * 14.7f;
-        right_val = right_val * 0.01f * 14.7f;
-        break;
-      case 2:
-        left_val  = (left_val * 0.1f - 105.0f) / 6.895f;  // MAP: x0.1 kPa, -105 kPa offset → PSI
-        right_val = right_val * 0.1f / 1.60934f;
-        break;
-      case 3:
-        left_val  = left_val * 0.1f / 6.895f;
-        // right_val already in % (x1), no conversion needed
-        break;
-      case 4:
-        // left_val (ethanol) needs no scaling
-        right_val = right_val * 0.1f;
-        break;
-    }
+    can_screen_raw_values(mode, &data, &left_raw, &right_raw);
   }
+  FixedValue left_val, right_val;
+  can_screen_fixed_values(mode, left_raw, right_raw, &left_val, &right_val);
 
   update_display_values(mode, left_val, right_val);
-  last_update_time = now;
+  return next_timeout;
 }
 
+// Tasks started from setup(); the logger starts its own in logger_init().
+// With FAST_BOOT the CAN tasks start before the display, so the bus comes up
+// on the RX core while the panel and LVGL initialise on the UI core.
+static const TaskSpec can_tasks[] = {
+  { receive_can_task,         "RX_CAN",       4096, TASK_PRIO_RX, TASK_CORE_RX },
+  { delayed_can_init_task,    "Init_CAN",     2048, TASK_PRIO_BG, TASK_CORE_BG },
+};
+
+static const TaskSpec app_tasks[] = {
+  { watchdog_task,            "Watchdog",     2048, TASK_PRIO_BG, TASK_CORE_BG },
+  { periodic_save_task,       "Save_Odo",     2048, TASK_PRIO_BG, TASK_CORE_BG },
+  { odometer_update_task,     "Odometer",     4096, TASK_PRIO_BG, TASK_CORE_BG },
+  { history_task,             "History",      3072, TASK_PRIO_BG, TASK_CORE_BG },
+};
+
+#if TASK_MONITOR_FULL_REDRAW_MS
+// Bench load for the task report: redraw the whole window on every tick
+static void full_redraw_timer_cb(lv_timer_t *timer) {
+  lv_obj_invalidate(lv_screen_active());
+}
+#endif
+
 void setup(void) {
+  boot_mark("setup");
   Serial.begin(115200);
+#if !FAST_BOOT
   delay(100);
+#endif
   Serial.println("1: Serial init");
+  ui_task = xTaskGetCurrentTaskHandle(); // setup() and loop() run in the Arduino loop task
 
-  // Create mutexes before starting any tasks
-  display_data_mutex = xSemaphoreCreateMutex();
-  
   // Load persistent data from NVS
   load_persistent_data();
   Serial.println("2: NVS loaded");
-  
+
+  // Signal history rings (PSRAM, allocated once)
+  if (!history_init()) {
+    Serial.println("History: PSRAM allocation failed, history disabled");
+  }
+  boot_mark("NVS, history");
+
+  // Before RX starts, so RX never sees the handle change
+  task_start(stats_task, "Stats", 4096, TASK_PRIO_BG, TASK_CORE_BG, &stats_task_handle);
+#if FAST_BOOT
+  task_start_all(can_tasks, sizeof(can_tasks) / sizeof(can_tasks[0]));
+#endif
   drivers_init();
   Serial.println("3: Drivers init");
   
@@ -1005,10 +843,13 @@ void setup(void) {
   Serial.println("4: Backlight set");
   
   screens_init();
+  splash_start = millis();
   Serial.println("5: Screens init");
   
   // Update odometer/trip display with loaded values before boot screen shows
+#if !FAST_BOOT
   delay(50); // Small delay to ensure LVGL is ready
+#endif
   update_odometer_display();
   
   set_exio(EXIO_PIN4, Low);
@@ -1016,29 +857,39 @@ void setup(void) {
   esp_reset_reason_t reason = esp_reset_reason();
   Serial.printf("Reset reason: %d\n", reason);
 
-  xTaskCreatePinnedToCore(receive_can_task, "RX_CAN", 4096, NULL, 1, NULL, 0);  // Core 0, priority 1
-  xTaskCreatePinnedToCore(delayed_can_init_task, "Init_CAN", 2048, NULL, 1, NULL, 1);  
-  xTaskCreatePinnedToCore(watchdog_task, "Watchdog", 2048, NULL, 1, NULL, 0);
-  xTaskCreatePinnedToCore(periodic_save_task, "Save_NVS", 2048, NULL, 1, NULL, 0);
-  xTaskCreatePinnedToCore(restore_screen_mode_task, "Restore_Mode", 2048, NULL, 1, NULL, 0);
-  xTaskCreatePinnedToCore(odometer_update_task, "Odometer", 4096, NULL, 1, NULL, 0);
-  
-  // Don't update display here - will be done after boot screen in restore task
-  
+  // Cores and priorities: see TASK TOPOLOGY in TaskMonitor.h
+  vTaskPrioritySet(NULL, TASK_PRIO_UI);
+  task_monitor_add(ui_task, "loopTask", getArduinoLoopTaskStackSize(), TASK_PRIO_UI, TASK_CORE_UI);
+  task_start_all(app_tasks, sizeof(app_tasks) / sizeof(app_tasks[0]));
+#if !FAST_BOOT
+  task_start_all(can_tasks, sizeof(can_tasks) / sizeof(can_tasks[0]));
+#endif
+  logger_init(); // Starts Log_Sample / Log_Write as background tasks when LOGGER_ENABLED
+  if (tca_present) buttons_init(ui_task, UI_EVENT_BUTTONS);
+#if TASK_MONITOR_FULL_REDRAW_MS
+  lv_timer_create(full_redraw_timer_cb, TASK_MONITOR_FULL_REDRAW_MS, NULL);
+#endif
+  
+  // The saved screen mode is restored when loop() ends the boot screen
+  
+  boot_mark("setup done");
   Serial.println("Setup complete");
 }
 
-// Update ECU warning display (background color + warning text)
-void update_ecu_warnings() {
+// Update ECU warning display (background color + warning text); returns ms
+// until the shown warning times out (UINT32_MAX if none)
+uint32_t update_ecu_warnings(unsigned long now) {
   static uint8_t last_flags = 0;
   static bool last_warning_active = false;
   
-  unsigned long now = millis();
-  
   // Timeout: clear warnings if no 0x64C message received recently
   uint8_t flags = ecu_warning_flags;
-  if (last_warning_time > 0 && (now - last_warning_time > WARNING_TIMEOUT_MS)) {
+  unsigned long last_time = last_warning_time;
+  uint32_t next_timeout = UINT32_MAX;
+  if (last_time > 0 && (now - last_time > WARNING_TIMEOUT_MS)) {
     flags = 0;
+  } else if (flags != 0) {
+    next_timeout = WARNING_TIMEOUT_MS + 1 - (now - last_time);
   }
   
   lv_obj_t* warn_left = get_warning_label_left();
@@ -1048,18 +899,20 @@ void update_ecu_warnings() {
   lv_obj_t* right_container = get_right_gauge_container();
   
   if (warn_left == NULL || warn_right == NULL || screen == NULL ||
-      left_container == NULL || right_container == NULL) return;
+      left_container == NULL || right_container == NULL) return UINT32_MAX;
   
   bool warning_active = (flags != 0);
   
   // Only update if state changed
-  if (flags == last_flags && warning_active == last_warning_active) return;
-  
+  if (flags == last_flags && warning_active == last_warning_active) return next_timeout;
   if (warning_active) {
     // Set background red on screen and both gauge containers
     lv_obj_set_style_bg_color(screen, lv_color_make(80, 0, 0), 0);
     lv_obj_set_style_bg_color(left_container, lv_color_make(80, 0, 0), LV_PART_MAIN);
     lv_obj_set_style_bg_color(right_container, lv_color_make(80, 0, 0), LV_PART_MAIN);
+    // Value tiles are opaque, so they are re-blended over the new background
+    numeric_label_set_bg_color(get_left_value_label(), lv_color_make(80, 0, 0));
+    numeric_label_set_bg_color(get_right_value_label(), lv_color_make(80, 0, 0));
     
     // Build warning message — show highest priority warning
     const char* warn_text = "";
@@ -1073,8 +926,8 @@ void update_ecu_warnings() {
     else if (flags & WARN_ENGINE_SPEED)     warn_text = "Engine RPM High";
     
     // Show same message on both gauges
-    lv_label_set_text(warn_left, warn_text);
-    lv_label_set_text(warn_right, warn_text);
+    rotated_label_set_text(warn_left, warn_text);
+    rotated_label_set_text(warn_right, warn_text);
     lv_obj_clear_flag(warn_left, LV_OBJ_FLAG_HIDDEN);
     lv_obj_clear_flag(warn_right, LV_OBJ_FLAG_HIDDEN);
   } else {
@@ -1082,167 +935,284 @@ void update_ecu_warnings() {
     lv_obj_set_style_bg_color(screen, lv_color_make(0, 0, 0), 0);
     lv_obj_set_style_bg_color(left_container, lv_color_make(0, 0, 0), LV_PART_MAIN);
     lv_obj_set_style_bg_color(right_container, lv_color_make(0, 0, 0), LV_PART_MAIN);
+    numeric_label_set_bg_color(get_left_value_label(), lv_color_make(0, 0, 0));
+    numeric_label_set_bg_color(get_right_value_label(), lv_color_make(0, 0, 0));
     lv_obj_add_flag(warn_left, LV_OBJ_FLAG_HIDDEN);
     lv_obj_add_flag(warn_right, LV_OBJ_FLAG_HIDDEN);
   }
   
   last_flags = flags;
   last_warning_active = warning_active;
+  return next_timeout;
 }
 
-// Update status icon visibility
-void update_status_icons() {
-  unsigned long now = millis();
-  
-  lv_obj_t* cruise_icon = get_cruise_icon();
-  lv_obj_t* tcs_icon = get_tcs_icon();
-  lv_obj_t* launch_icon = get_launch_icon();
-  lv_obj_t* two_step_icon = get_two_step_icon();
-  lv_obj_t* exhaust_bypass_icon = get_exhaust_bypass_icon();
+// Icon driven by a CAN flag: shown while active and refreshed within
+// ICON_TIMEOUT_MS. Clears the flag on timeout; returns ms until the icon
+// times out, UINT32_MAX if it is hidden.
+static uint32_t icon_time_left(volatile bool *active, volatile unsigned long *last_time, unsigned long now) {
+  if (!*active) return UINT32_MAX;
+  unsigned long age = now - *last_time;
+  if (age >= ICON_TIMEOUT_MS) {
+    *active = false; // Reset state after timeout
+    return UINT32_MAX;
+  }
+  return ICON_TIMEOUT_MS - age;
+}
+
+// Touch the object only on a change: clearing HIDDEN invalidates the icon
+// even when it is already visible
+static void set_icon_shown(lv_obj_t *icon, int8_t *shown, bool show) {
+  if (*shown == (int8_t)show) return;
+  if (show) lv_obj_clear_flag(icon, LV_OBJ_FLAG_HIDDEN);
+  else lv_obj_add_flag(icon, LV_OBJ_FLAG_HIDDEN);
+  *shown = show;
+}
+
+// Update status icon visibility; returns ms until a shown icon times out
+// (UINT32_MAX if none)
+uint32_t update_status_icons(unsigned long now) {
+  static int8_t shown[6] = { -1, -1, -1, -1, -1, -1 }; // -1 = not applied yet
+  
+  struct {
+    lv_obj_t *icon;
+    volatile bool *active;
+    volatile unsigned long *last_time;
+  } const timed[] = {
+    { get_cruise_icon(),          &cruise_active,         &last_cruise_time },
+    { get_tcs_icon(),             &tcs_active,            &last_tcs_time },
+    { get_launch_icon(),          &launch_active,         &last_launch_time },
+    { get_two_step_icon(),        &two_step_active,       &last_two_step_time },
+    { get_exhaust_bypass_icon(),  &exhaust_bypass_active, &last_exhaust_bypass_time },
+  };
   lv_obj_t* peak_recall_icon = get_peak_recall_icon();
   
-  if (cruise_icon == NULL || tcs_icon == NULL || launch_icon == NULL || 
-      two_step_icon == NULL || exhaust_bypass_icon == NULL || peak_recall_icon == NULL) {
-    return; // Icons not ready yet
+  for (const auto &t : timed) {
+    if (t.icon == NULL) return UINT32_MAX; // Icons not ready yet
   }
+  if (peak_recall_icon == NULL) return UINT32_MAX;
   
   // Show icons during startup period or when active
-  bool show_cruise = icons_startup_shown || (cruise_active && (now - last_cruise_time < ICON_TIMEOUT_MS));
-  bool show_tcs = icons_startup_shown || (tcs_active && (now - last_tcs_time < ICON_TIMEOUT_MS));
-  bool show_launch = icons_startup_shown || (launch_active && (now - last_launch_time < ICON_TIMEOUT_MS));
-  bool show_two_step = icons_startup_shown || (two_step_active && (now - last_two_step_time < ICON_TIMEOUT_MS));
-  bool show_exhaust_bypass = icons_startup_shown || (exhaust_bypass_active && (now - last_exhaust_bypass_time < ICON_TIMEOUT_MS));
-  bool show_peak_recall = icons_startup_shown || max_recall_active; // Show on startup or when max recall is active
-  
-  // Update visibility
-  if (show_cruise) {
-    lv_obj_clear_flag(cruise_icon, LV_OBJ_FLAG_HIDDEN);
-  } else {
-    lv_obj_add_flag(cruise_icon, LV_OBJ_FLAG_HIDDEN);
-    cruise_active = false; // Reset state after timeout
-  }
-  
-  if (show_tcs) {
-    lv_obj_clear_flag(tcs_icon, LV_OBJ_FLAG_HIDDEN);
-  } else {
-    lv_obj_add_flag(tcs_icon, LV_OBJ_FLAG_HIDDEN);
-    tcs_active = false;
-  }
-  
-  if (show_launch) {
-    lv_obj_clear_flag(launch_icon, LV_OBJ_FLAG_HIDDEN);
-  } else {
-    lv_obj_add_flag(launch_icon, LV_OBJ_FLAG_HIDDEN);
-    launch_active = false;
-  }
-  
-  if (show_two_step) {
-    lv_obj_clear_flag(two_step_icon, LV_OBJ_FLAG_HIDDEN);
-  } else {
-    lv_obj_add_flag(two_step_icon, LV_OBJ_FLAG_HIDDEN);
-    two_step_active = false;
-  }
-  
-  if (show_exhaust_bypass) {
-    lv_obj_clear_flag(exhaust_bypass_icon, LV_OBJ_FLAG_HIDDEN);
-  } else {
-    lv_obj_add_flag(exhaust_bypass_icon, LV_OBJ_FLAG_HIDDEN);
-    exhaust_bypass_active = false;
+  uint32_t next_timeout = UINT32_MAX;
+  for (size_t i = 0; i < sizeof(timed) / sizeof(timed[0]); i++) {
+    uint32_t left = icon_time_left(timed[i].active, timed[i].last_time, now);
+    set_icon_shown(timed[i].icon, &shown[i], icons_startup_shown || left != UINT32_MAX);
+    if (left < next_timeout) next_timeout = left;
   }
   
+  bool show_peak_recall = icons_startup_shown || max_recall_active; // Show on startup or when max recall is active
   if (show_peak_recall) {
-    // Swap image source based on clear vs recall mode
-    if (max_clear_active) {
-      lv_image_set_src(peak_recall_icon, &ClearPeakRecall);
-    } else {
-      lv_image_set_src(peak_recall_icon, &PeakRecall);
+    // Swap image source based on clear vs recall mode (a no-op if unchanged)
+    image_cache_set_src(peak_recall_icon, max_clear_active ? &ClearPeakRecall_asset : &PeakRecall_asset);
+  }
+  set_icon_shown(peak_recall_icon, &shown[5], show_peak_recall);
+  return next_timeout;
+}
+
+// Max recall stays up MAX_RECALL_DISPLAY_MS after the button is released.
+// Returns ms left, 0 once it has expired, UINT32_MAX while held or inactive.
+static uint32_t max_recall_time_left(unsigned long now) {
+  if (!max_recall_active || max_recall_button_held) return UINT32_MAX;
+  unsigned long age = now - max_recall_start_time;
+  return age >= MAX_RECALL_DISPLAY_MS ? 0 : MAX_RECALL_DISPLAY_MS - age;
+}
+
+static void change_screen(uint8_t new_mode) {
+  update_screen_labels(new_mode);
+  last_screen_mode = new_mode;
+  Serial.printf("Screen changed to mode %d\n", new_mode);
+}
+
+// Act on the gestures queued by the Buttons task (gestures per pin: Buttons.h)
+static void process_button_events(void) {
+  ButtonEvent ev;
+  while (buttons_get_event(&ev)) {
+    Serial.printf("TCA9554 P%d %s\n", ev.pin, button_event_name(ev.type));
+    // During the boot screen any button only skips it
+    if (boot_screen_active()) {
+      splash_skip = true;
+      continue;
+    }
+    uint8_t mode = get_current_screen_mode();
+    
+    // P5 click = next screen, long press = previous screen
+    if (ev.pin == EXIO_PIN5 && ev.type == BUTTON_CLICK) {
+      change_screen((mode + 1) % CAN_SCREEN_MODES);
+    } else if (ev.pin == EXIO_PIN5 && ev.type == BUTTON_LONG) {
+      change_screen((mode + CAN_SCREEN_MODES - 1) % CAN_SCREEN_MODES);
+    }
+    // P6 triggers trip reset
+    else if (ev.pin == EXIO_PIN6 && ev.type == BUTTON_CLICK) {
+      trip_reset_pending = true;
+      Serial.println("Trip reset triggered");
+    }
+    // P7 triggers trip switch
+    else if (ev.pin == EXIO_PIN7 && ev.type == BUTTON_CLICK) {
+      trip_switch_pending = true;
+      Serial.println("Trip switch triggered");
     }
-    lv_obj_clear_flag(peak_recall_icon, LV_OBJ_FLAG_HIDDEN);
-  } else {
-    lv_obj_add_flag(peak_recall_icon, LV_OBJ_FLAG_HIDDEN);
   }
 }
 
+// A loop() wake-up time; armed = false means none pending
+typedef struct {
+  bool armed;
+  unsigned long at;
+} UiDeadline;
+
+// ms == UINT32_MAX disarms
+static void ui_arm(UiDeadline *d, unsigned long now, uint32_t ms) {
+  d->armed = ms != UINT32_MAX;
+  d->at = now + ms;
+}
+
+static bool ui_due(const UiDeadline *d, unsigned long now) {
+  return d->armed && (long)(now - d->at) >= 0;
+}
+
+static uint32_t ui_ms_until(const UiDeadline *d, unsigned long now) {
+  if (!d->armed) return UINT32_MAX;
+  long ms = (long)(d->at - now);
+  return ms > 0 ? (uint32_t)ms : 0;
+}
+
+// Boot screen over: show the main screen in the saved mode, with the status
+// icons up for BOOT_ICONS_MS
+static void end_boot_screen(void) {
+  boot_screen_end();
+  boot_mark("main screen");
+  Serial.printf("Restoring screen mode to %d\n", last_screen_mode);
+  update_screen_labels(last_screen_mode);
+  update_odometer_display();
+  icons_startup_shown = true;
+}
+
+// The UI task. It sleeps on its task notification until an event bit arrives
+// (RX task: CAN_CHANGED_*, other tasks: UI_EVENT_*) or the earliest deadline:
+// LVGL's next timer, the end of the boot screen or a value/icon/warning/max
+// recall timeout. Each part of the screen is only touched when one of its events
+// or its own deadline fired, so with the values holding steady a wake-up
+// costs one lv_timer_handler() call.
 void loop(void) {
-  static unsigned long last_lvgl_time = 0;
-  const unsigned long LVGL_INTERVAL_MS = 16; // Run LVGL at ~60Hz
+  // Everything runs once on the first pass to apply the initial state
+  static UiDeadline lvgl_due = { true, 0 };
+  static UiDeadline values_due = { true, 0 }, icons_due = { true, 0 };
+  static UiDeadline warnings_due = { true, 0 }, recall_due = { true, 0 };
+  static UiDeadline splash_due = { true, 0 }, startup_icons_due = { false, 0 };
+  static bool live_shown = false;
+  static unsigned long last_values_time = 0;
+  static bool values_pending = false;
+  static uint8_t shown_mode = 255;
+  static DisplayUnits shown_units = DISPLAY_UNITS_COUNT;
+  static uint32_t sleep_ms = 0;
+  
+  uint32_t events = 0;
+  xTaskNotifyWait(0, UINT32_MAX, &events, pdMS_TO_TICKS(sleep_ms));
   
   last_loop_time = millis();
   unsigned long now = millis();
   
-  // Check if we need to restore screen mode after boot
-  if (restore_mode_pending) {
-    restore_mode_pending = false;
-    Serial.printf("Restoring screen mode to %d\n", last_screen_mode);
-    update_screen_labels(last_screen_mode);
-  }
-  
   // Check if odometer display update is pending
-  if (odometer_display_pending) {
-    odometer_display_pending = false;
+  if (events & UI_EVENT_ODOMETER) {
     update_odometer_display();
   }
   
+  // Button gestures from TCA9554 P5-P8
+  if (events & UI_EVENT_BUTTONS) {
+    process_button_events();
+  }
+  
   // Check if trip reset was requested
   process_trip_reset();
   
   // Check if trip switch was requested
   process_trip_switch();
   
-  // Check TCA9554 P5-P8 input states periodically
-  if (now - last_tca_check >= TCA_CHECK_INTERVAL_MS) {
-    last_tca_check = now;
-    uint8_t current_state = read_exios(TCA9554_INPUT_REG);
-    
-    // Check each pin (P5-P8) for falling edge (high to low transition = pulled to ground)
-    // P5 = bit 4, P6 = bit 5, P7 = bit 6, P8 = bit 7
-    for (int pin = 5; pin <= 8; pin++) {
-      uint8_t bit_mask = (1 << (pin - 1));
-      bool last_state = (tca_inputs_last_state & bit_mask) != 0;
-      bool curr_state = (current_state & bit_mask) != 0;
-      
-      // Detect falling edge
-      if (last_state && !curr_state) {
-        Serial.printf("TCA9554 P%d triggered - pulled to ground!\n", pin);
-        
-        // P5 triggers screen change
-        if (pin == 5) {
-          uint8_t new_mode = (get_current_screen_mode() + 1) % 5;
-          update_screen_labels(new_mode);
-          last_screen_mode = new_mode;
-          Serial.printf("Screen changed to mode %d\n", new_mode);
-        }
-        // P6 triggers trip reset
-        else if (pin == 6) {
-          trip_reset_pending = true;
-          Serial.println("Trip reset triggered");
-        }
-        // P7 triggers trip switch
-        else if (pin == 7) {
-          trip_switch_pending = true;
-          Serial.println("Trip switch triggered");
-        }
-      }
+  // Boot screen (up while splash_due is armed): ends on a button, at
+  // BOOT_SPLASH_MAX_MS, or once CAN values have arrived and it has been up
+  // BOOT_SPLASH_MIN_MS. Checked on every wake-up, since CAN data wakes us.
+  if (splash_due.armed) {
+    uint32_t shown = now - splash_start;
+    bool live = last_can_message_time != 0;
+    if (splash_skip || shown >= BOOT_SPLASH_MAX_MS || (live && shown >= BOOT_SPLASH_MIN_MS)) {
+      end_boot_screen();
+      events |= UI_EVENT_ICONS;
+      ui_arm(&splash_due, now, UINT32_MAX);
+      ui_arm(&startup_icons_due, now, BOOT_ICONS_MS);
+    } else {
+      ui_arm(&splash_due, now, (live ? BOOT_SPLASH_MIN_MS : BOOT_SPLASH_MAX_MS) - shown);
     }
-    
-    tca_inputs_last_state = current_state;
+  }
+  if (ui_due(&startup_icons_due, now)) {
+    icons_startup_shown = false;
+    events |= UI_EVENT_ICONS;
+    ui_arm(&startup_icons_due, now, UINT32_MAX);
   }
   
-  // Run LVGL timer handler at consistent intervals
-  if (now - last_lvgl_time >= LVGL_INTERVAL_MS) {
-    lv_timer_handler();
-    last_lvgl_time = now;
+  // Expire max recall (only when button is not held); the values switch back
+  // and the peak recall icon hides
+  if ((events & CAN_CHANGED_MAX_RECALL) || ui_due(&recall_due, now)) {
+    uint32_t left = max_recall_time_left(now);
+    if (left == 0) {
+      max_recall_active = false;
+      max_clear_active = false;
+      events |= CAN_CHANGED_MAX_RECALL;
+      left = UINT32_MAX;
+    }
+    ui_arm(&recall_due, now, left);
   }
   
   // Update status icon visibility
-  update_status_icons();
+  if ((events & (CAN_CHANGED_ICONS | CAN_CHANGED_MAX_RECALL | UI_EVENT_ICONS)) || ui_due(&icons_due, now)) {
+    ui_arm(&icons_due, now, update_status_icons(now));
+  }
   
   // Update ECU warning display
-  update_ecu_warnings();
+  if ((events & CAN_CHANGED_WARNINGS) || ui_due(&warnings_due, now)) {
+    ui_arm(&warnings_due, now, update_ecu_warnings(now));
+  }
   
-  // Update data values
-  update_display_from_can_data();
+  // Update data values: this screen's channels changed (or its max values
+  // during recall), the screen or units changed, or a channel timed out.
+  // Redraws are spaced at least UI_VALUE_MIN_INTERVAL_MS apart.
+  uint8_t mode = get_current_screen_mode();
+  uint32_t value_events = can_screen_changed_bits(mode) | CAN_CHANGED_MAX_RECALL |
+                          (max_recall_active ? CAN_CHANGED_MAX : 0);
+  if ((events & value_events) || ui_due(&values_due, now) ||
+      mode != shown_mode || can_display_units() != shown_units) {
+    values_pending = true;
+    shown_mode = mode;
+    shown_units = can_display_units();
+  }
+  if (values_pending) {
+    uint32_t since = now - last_values_time;
+    if (since >= UI_VALUE_MIN_INTERVAL_MS) {
+      ui_arm(&values_due, now, update_display_from_can_data(now));
+      last_values_time = now;
+      values_pending = false;
+      if (!live_shown && last_can_message_time != 0 && !boot_screen_active()) {
+        live_shown = true;
+        boot_mark("live values");
+        boot_report();
+      }
+    } else {
+      ui_arm(&values_due, now, UI_VALUE_MIN_INTERVAL_MS - since);
+    }
+  }
   
-  // Small delay to prevent CPU hogging, but don't block LVGL timing
-  vTaskDelay(pdMS_TO_TICKS(1));
-}
\ No newline at end of file
+  // Run LVGL timers on every pass, not only when lvgl_due fired: anything
+  // changed above gets its refresh scheduled now. LV_NO_TIMER_READY
+  // (UINT32_MAX) would disarm lvgl_due, so it is clamped like any long wait.
+  uint32_t next = lv_timer_handler();
+  if (next > UI_MAX_SLEEP_MS) next = UI_MAX_SLEEP_MS;
+  ui_arm(&lvgl_due, millis(), next == 0 ? 1 : next);
+  
+  // Sleep until the earliest deadline or the next event
+  now = millis();
+  const UiDeadline *deadlines[] = { &lvgl_due, &values_due, &icons_due, &warnings_due, &recall_due,
+                                    &splash_due, &startup_icons_due };
+  sleep_ms = UI_MAX_SLEEP_MS;
+  for (const UiDeadline *d : deadlines) {
+    uint32_t ms = ui_ms_until(d, now);
+    if (ms < sleep_ms) sleep_ms = ms;
+  }
+}
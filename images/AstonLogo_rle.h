@@ -0,0 +1,573 @@
+// Generated by tools/compress_images.py from images/AstonLogo.h - do not edit.
+// 100x300 RGB565A8, palette + RLE: 90000 -> 8850 bytes. Decoded on first use by ImageCache.
+#pragma once
+#include "../ImageCodec.h"
+
+static const uint8_t AstonLogo_rle[] = {
+  0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0xa2, 0x00, 0xff, 0x43, 0x01, 0xff,
+  0x45, 0x02, 0xff, 0x66, 0x02, 0xff, 0x86, 0x02, 0xff, 0xa7, 0x02, 0xff, 0xe7, 0x02, 0xff, 0x21,
+  0x08, 0xff, 0x41, 0x08, 0xff, 0x61, 0x08, 0xff, 0x03, 0x09, 0xff, 0xa7, 0x0a, 0xff, 0xc7, 0x0a,
+  0xff, 0xe7, 0x0a, 0xff, 0xe8, 0x0a, 0xff, 0x08, 0x0b, 0xff, 0x48, 0x0b, 0xff, 0x82, 0x10, 0xff,
+  0xa2, 0x10, 0xff, 0x84, 0x11, 0xff, 0xe5, 0x11, 0xff, 0xe8, 0x12, 0xff, 0x08, 0x13, 0xff, 0x28,
+  0x13, 0xff, 0x48, 0x13, 0xff, 0x49, 0x13, 0xff, 0x69, 0x13, 0xff, 0x89, 0x13, 0xff, 0xc3, 0x18,
+  0xff, 0x69, 0x1b, 0xff, 0x89, 0x1b, 0xff, 0xa9, 0x1b, 0xff, 0xaa, 0x1b, 0xff, 0xc9, 0x1b, 0xff,
+  0xca, 0x1b, 0xff, 0xea, 0x1b, 0xff, 0xe4, 0x20, 0xff, 0x24, 0x21, 0xff, 0xa7, 0x22, 0xff, 0x69,
+  0x23, 0xff, 0xca, 0x23, 0xff, 0xea, 0x23, 0xff, 0x0a, 0x24, 0xff, 0x0b, 0x24, 0xff, 0x2a, 0x24,
+  0xff, 0x2b, 0x24, 0xff, 0x6b, 0x24, 0xff, 0x45, 0x29, 0xff, 0x65, 0x29, 0xff, 0xcb, 0x2b, 0xff,
+  0x2b, 0x2c, 0xff, 0x4b, 0x2c, 0xff, 0x6b, 0x2c, 0xff, 0x6c, 0x2c, 0xff, 0x8c, 0x2c, 0xff, 0xac,
+  0x2c, 0xff, 0x86, 0x31, 0xff, 0xa6, 0x31, 0xff, 0x2c, 0x34, 0xff, 0x8c, 0x34, 0xff, 0xac, 0x34,
+  0xff, 0xcd, 0x34, 0xff, 0xc7, 0x39, 0xff, 0xcc, 0x3b, 0xff, 0xad, 0x3c, 0xff, 0xed, 0x3c, 0xff,
+  0xe8, 0x41, 0xff, 0x28, 0x42, 0xff, 0x2d, 0x44, 0xff, 0xee, 0x44, 0xff, 0x49, 0x4a, 0xff, 0x6e,
+  0x4c, 0xff, 0x6a, 0x52, 0xff, 0xaa, 0x52, 0xff, 0x6f, 0x54, 0xff, 0x0f, 0x55, 0xff, 0xcb, 0x5a,
+  0xff, 0xeb, 0x5a, 0xff, 0xec, 0x62, 0xff, 0x0c, 0x63, 0xff, 0xd0, 0x64, 0xff, 0x30, 0x65, 0xff,
+  0x71, 0x65, 0xff, 0x2d, 0x6b, 0xff, 0x4d, 0x6b, 0xff, 0x11, 0x6d, 0xff, 0x6e, 0x73, 0xff, 0xae,
+  0x73, 0xff, 0x72, 0x75, 0xff, 0xcf, 0x7b, 0xff, 0xd3, 0x7d, 0xff, 0xf0, 0x83, 0xff, 0x10, 0x84,
+  0xff, 0x73, 0x85, 0xff, 0x31, 0x8c, 0xff, 0x71, 0x8c, 0xff, 0xf4, 0x8d, 0xff, 0x92, 0x94, 0xff,
+  0xf5, 0x95, 0xff, 0xb3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xf4, 0xa4, 0xff, 0x14, 0xa5, 0xff, 0x36,
+  0xa6, 0xff, 0x55, 0xad, 0xff, 0x75, 0xad, 0xff, 0x77, 0xae, 0xff, 0x96, 0xb5, 0xff, 0xb6, 0xb5,
+  0xff, 0xd6, 0xb5, 0xff, 0x98, 0xb6, 0xff, 0xd7, 0xbd, 0xff, 0xb9, 0xbe, 0xff, 0xf8, 0xc5, 0xff,
+  0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0xda, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0xfa,
+  0xce, 0xff, 0x1b, 0xcf, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x3b, 0xd7, 0xff, 0x3c, 0xd7,
+  0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x5c, 0xdf, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff,
+  0x3c, 0xe7, 0xff, 0x7d, 0xe7, 0xff, 0x5d, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x7e, 0xf7, 0xff, 0x9e,
+  0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x8f, 0x00, 0x82, 0x01, 0xde, 0x00, 0x82, 0x01, 0x00, 0x33,
+  0x81, 0x01, 0xdc, 0x00, 0x81, 0x01, 0x05, 0x52, 0x78, 0x8e, 0x7d, 0x14, 0x01, 0xd9, 0x00, 0x81,
+  0x01, 0x02, 0x3c, 0x6c, 0x8d, 0x81, 0x8e, 0x02, 0x8d, 0x1f, 0x01, 0xd9, 0x00, 0x02, 0x01, 0x45,
+  0x85, 0x84, 0x8e, 0x01, 0x1f, 0x01, 0xd9, 0x00, 0x01, 0x01, 0x61, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xd9, 0x00, 0x01, 0x01, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xd7, 0x00, 0x82, 0x01, 0x00, 0x66,
+  0x85, 0x8e, 0x01, 0x1f, 0x01, 0xd6, 0x00, 0x81, 0x01, 0x02, 0x45, 0x41, 0x66, 0x85, 0x8e, 0x01,
+  0x1f, 0x01, 0xd4, 0x00, 0x81, 0x01, 0x04, 0x33, 0x64, 0x8a, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xd3, 0x00, 0x81, 0x01, 0x01, 0x5e, 0x84, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01,
+  0x1f, 0x01, 0xd2, 0x00, 0x81, 0x01, 0x00, 0x72, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01,
+  0x1f, 0x01, 0xd2, 0x00, 0x01, 0x01, 0x61, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xd2, 0x00, 0x01, 0x01, 0x76, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xd1, 0x00, 0x81, 0x01, 0x00, 0x7c, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xd0, 0x00, 0x82, 0x01, 0x00, 0x78, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xce, 0x00, 0x82, 0x01, 0x02, 0x5a, 0x27, 0x72, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01,
+  0x1f, 0x01, 0xcd, 0x00, 0x81, 0x01, 0x04, 0x56, 0x78, 0x8d, 0x3c, 0x6c, 0x84, 0x8e, 0x01, 0x5a,
+  0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xcb, 0x00, 0x04, 0x01, 0x02, 0x41, 0x72, 0x8d, 0x81, 0x8e,
+  0x01, 0x45, 0x66, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xca, 0x00, 0x81,
+  0x01, 0x01, 0x46, 0x85, 0x83, 0x8e, 0x01, 0x51, 0x5f, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e,
+  0x01, 0x1f, 0x01, 0xca, 0x00, 0x81, 0x01, 0x00, 0x50, 0x84, 0x8e, 0x01, 0x5c, 0x56, 0x84, 0x8e,
+  0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xca, 0x00, 0x81, 0x01, 0x00, 0x4f, 0x84, 0x8e,
+  0x01, 0x64, 0x45, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc9, 0x00, 0x81,
+  0x01, 0x81, 0x4b, 0x00, 0x8d, 0x83, 0x8e, 0x01, 0x6b, 0x27, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85,
+  0x8e, 0x01, 0x1f, 0x01, 0xc9, 0x00, 0x81, 0x01, 0x02, 0x6f, 0x45, 0x89, 0x83, 0x8e, 0x02, 0x6f,
+  0x01, 0x8d, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc9, 0x00, 0x04, 0x01,
+  0x56, 0x83, 0x3c, 0x85, 0x83, 0x8e, 0x02, 0x76, 0x01, 0x8a, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85,
+  0x8e, 0x01, 0x1f, 0x01, 0xc9, 0x00, 0x04, 0x01, 0x72, 0x89, 0x3c, 0x81, 0x83, 0x8e, 0x02, 0x7d,
+  0x01, 0x87, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc8, 0x00, 0x05, 0x01,
+  0x28, 0x84, 0x8d, 0x41, 0x75, 0x83, 0x8e, 0x02, 0x84, 0x01, 0x84, 0x83, 0x8e, 0x01, 0x5a, 0x66,
+  0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc8, 0x00, 0x05, 0x01, 0x49, 0x8d, 0x8e, 0x49, 0x69, 0x83, 0x8e,
+  0x02, 0x87, 0x01, 0x80, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc8, 0x00,
+  0x01, 0x01, 0x61, 0x81, 0x8e, 0x01, 0x5e, 0x5c, 0x83, 0x8e, 0x02, 0x8a, 0x28, 0x79, 0x83, 0x8e,
+  0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc7, 0x00, 0x81, 0x01, 0x00, 0x7c, 0x81, 0x8e,
+  0x01, 0x6b, 0x41, 0x83, 0x8e, 0x02, 0x8b, 0x41, 0x76, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e,
+  0x01, 0x1f, 0x01, 0xc7, 0x00, 0x02, 0x01, 0x41, 0x8d, 0x81, 0x8e, 0x02, 0x78, 0x01, 0x8d, 0x82,
+  0x8e, 0x02, 0x8d, 0x49, 0x72, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc7,
+  0x00, 0x01, 0x01, 0x5f, 0x82, 0x8e, 0x02, 0x84, 0x01, 0x85, 0x82, 0x8e, 0x02, 0x8d, 0x4f, 0x6e,
+  0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc7, 0x00, 0x01, 0x01, 0x6e, 0x82,
+  0x8e, 0x02, 0x8b, 0x1f, 0x7d, 0x82, 0x8e, 0x02, 0x8d, 0x52, 0x6b, 0x83, 0x8e, 0x01, 0x5a, 0x66,
+  0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc6, 0x00, 0x81, 0x01, 0x00, 0x78, 0x82, 0x8e, 0x02, 0x8d, 0x4b,
+  0x74, 0x83, 0x8e, 0x01, 0x59, 0x67, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xc6, 0x00, 0x81, 0x01, 0x00, 0x78, 0x83, 0x8e, 0x01, 0x57, 0x6b, 0x83, 0x8e, 0x01, 0x5a, 0x64,
+  0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc6, 0x00, 0x81, 0x01, 0x00, 0x75,
+  0x83, 0x8e, 0x01, 0x5e, 0x64, 0x83, 0x8e, 0x01, 0x5e, 0x5f, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85,
+  0x8e, 0x01, 0x1f, 0x01, 0xc5, 0x00, 0x82, 0x01, 0x00, 0x6e, 0x83, 0x8e, 0x01, 0x64, 0x5c, 0x83,
+  0x8e, 0x01, 0x62, 0x5a, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc5, 0x00,
+  0x03, 0x01, 0x32, 0x4b, 0x67, 0x83, 0x8e, 0x01, 0x6e, 0x4c, 0x83, 0x8e, 0x01, 0x67, 0x51, 0x83,
+  0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc5, 0x00, 0x03, 0x01, 0x59, 0x64, 0x5c,
+  0x83, 0x8e, 0x02, 0x79, 0x02, 0x8d, 0x82, 0x8e, 0x01, 0x6c, 0x49, 0x83, 0x8e, 0x01, 0x5a, 0x66,
+  0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc4, 0x00, 0x81, 0x01, 0x02, 0x76, 0x72, 0x46, 0x83, 0x8e, 0x02,
+  0x84, 0x01, 0x87, 0x82, 0x8e, 0x01, 0x72, 0x14, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01,
+  0x1f, 0x01, 0xc4, 0x00, 0x05, 0x01, 0x32, 0x8b, 0x83, 0x01, 0x87, 0x82, 0x8e, 0x02, 0x8d, 0x01,
+  0x7c, 0x82, 0x8e, 0x02, 0x78, 0x01, 0x8d, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xc4, 0x00, 0x05, 0x01, 0x5a, 0x8e, 0x8d, 0x01, 0x75, 0x83, 0x8e, 0x01, 0x41, 0x6e, 0x82,
+  0x8e, 0x02, 0x7c, 0x01, 0x89, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc4,
+  0x00, 0x01, 0x01, 0x6b, 0x81, 0x8e, 0x01, 0x59, 0x62, 0x83, 0x8e, 0x01, 0x5a, 0x61, 0x82, 0x8e,
+  0x02, 0x83, 0x01, 0x84, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc3, 0x00,
+  0x81, 0x01, 0x00, 0x81, 0x81, 0x8e, 0x01, 0x6b, 0x4c, 0x83, 0x8e, 0x01, 0x67, 0x56, 0x82, 0x8e,
+  0x02, 0x87, 0x01, 0x7d, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc3, 0x00,
+  0x01, 0x01, 0x41, 0x82, 0x8e, 0x02, 0x79, 0x46, 0x8a, 0x82, 0x8e, 0x02, 0x6f, 0x4f, 0x8d, 0x81,
+  0x8e, 0x02, 0x8b, 0x01, 0x78, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc3,
+  0x00, 0x01, 0x01, 0x68, 0x82, 0x8e, 0x02, 0x84, 0x3c, 0x84, 0x82, 0x8e, 0x02, 0x78, 0x46, 0x8a,
+  0x82, 0x8e, 0x01, 0x01, 0x72, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc2,
+  0x00, 0x02, 0x01, 0x14, 0x7d, 0x82, 0x8e, 0x02, 0x8b, 0x41, 0x76, 0x82, 0x8e, 0x02, 0x81, 0x41,
+  0x87, 0x82, 0x8e, 0x01, 0x3c, 0x6b, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xc2, 0x00, 0x02, 0x01, 0x41, 0x89, 0x83, 0x8e, 0x01, 0x4f, 0x67, 0x82, 0x8e, 0x02, 0x85, 0x3b,
+  0x83, 0x82, 0x8e, 0x01, 0x4f, 0x66, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xc2, 0x00, 0x01, 0x01, 0x49, 0x84, 0x8e, 0x01, 0x68, 0x4b, 0x82, 0x8e, 0x02, 0x8b, 0x3c, 0x78,
+  0x82, 0x8e, 0x01, 0x59, 0x5e, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc2,
+  0x00, 0x01, 0x01, 0x49, 0x84, 0x8e, 0x02, 0x7c, 0x01, 0x8a, 0x82, 0x8e, 0x01, 0x45, 0x6e, 0x82,
+  0x8e, 0x01, 0x61, 0x59, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc1, 0x00,
+  0x81, 0x01, 0x01, 0x46, 0x8d, 0x83, 0x8e, 0x02, 0x8a, 0x0b, 0x7d, 0x82, 0x8e, 0x01, 0x57, 0x62,
+  0x82, 0x8e, 0x01, 0x64, 0x56, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc1,
+  0x00, 0x03, 0x01, 0x0a, 0x3c, 0x87, 0x83, 0x8e, 0x02, 0x8d, 0x4f, 0x6f, 0x82, 0x8e, 0x01, 0x67,
+  0x4c, 0x82, 0x8e, 0x01, 0x69, 0x51, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xc1, 0x00, 0x03, 0x01, 0x56, 0x3c, 0x7d, 0x84, 0x8e, 0x01, 0x5e, 0x64, 0x82, 0x8e, 0x01, 0x74,
+  0x01, 0x82, 0x8e, 0x02, 0x6c, 0x4f, 0x8d, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xc0, 0x00, 0x81, 0x01, 0x02, 0x78, 0x4f, 0x66, 0x84, 0x8e, 0x01, 0x68, 0x56, 0x82, 0x8e,
+  0x02, 0x81, 0x01, 0x89, 0x81, 0x8e, 0x02, 0x72, 0x4b, 0x8b, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x85,
+  0x8e, 0x01, 0x1f, 0x01, 0xc0, 0x00, 0x04, 0x01, 0x15, 0x8e, 0x6e, 0x28, 0x84, 0x8e, 0x02, 0x78,
+  0x15, 0x8d, 0x81, 0x8e, 0x02, 0x89, 0x0c, 0x80, 0x81, 0x8e, 0x02, 0x76, 0x49, 0x8a, 0x81, 0x8e,
+  0x01, 0x5a, 0x66, 0x84, 0x8e, 0x02, 0x8d, 0x1f, 0x01, 0xc0, 0x00, 0x05, 0x01, 0x62, 0x8e, 0x87,
+  0x01, 0x7d, 0x83, 0x8e, 0x02, 0x89, 0x01, 0x81, 0x81, 0x8e, 0x02, 0x8d, 0x46, 0x76, 0x81, 0x8e,
+  0x02, 0x79, 0x45, 0x89, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x84, 0x8e, 0x02, 0x83, 0x14, 0x01, 0xc0,
+  0x00, 0x01, 0x0b, 0x78, 0x81, 0x8e, 0x01, 0x56, 0x68, 0x84, 0x8e, 0x01, 0x3c, 0x6c, 0x81, 0x8e,
+  0x02, 0x8d, 0x52, 0x6e, 0x81, 0x8e, 0x02, 0x7d, 0x3c, 0x87, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x84,
+  0x8e, 0x00, 0x67, 0x81, 0x01, 0xbf, 0x00, 0x02, 0x01, 0x3b, 0x87, 0x81, 0x8e, 0x01, 0x67, 0x57,
+  0x84, 0x8e, 0x01, 0x61, 0x59, 0x82, 0x8e, 0x01, 0x5a, 0x67, 0x81, 0x8e, 0x02, 0x81, 0x28, 0x85,
+  0x81, 0x8e, 0x01, 0x5a, 0x66, 0x83, 0x8e, 0x01, 0x7d, 0x0c, 0x81, 0x01, 0xbf, 0x00, 0x01, 0x01,
+  0x4b, 0x82, 0x8e, 0x02, 0x7d, 0x01, 0x89, 0x83, 0x8e, 0x02, 0x72, 0x4b, 0x8d, 0x81, 0x8e, 0x01,
+  0x61, 0x5f, 0x81, 0x8e, 0x02, 0x84, 0x28, 0x83, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x82, 0x8e, 0x04,
+  0x7d, 0x41, 0x5f, 0x14, 0x01, 0xbf, 0x00, 0x01, 0x01, 0x6b, 0x83, 0x8e, 0x01, 0x33, 0x6c, 0x83,
+  0x8e, 0x02, 0x7d, 0x41, 0x87, 0x81, 0x8e, 0x01, 0x69, 0x52, 0x81, 0x8e, 0x02, 0x87, 0x28, 0x80,
+  0x81, 0x8e, 0x09, 0x5a, 0x66, 0x8e, 0x8a, 0x6e, 0x01, 0x5f, 0x8a, 0x27, 0x01, 0xbe, 0x00, 0x81,
+  0x01, 0x00, 0x85, 0x83, 0x8e, 0x01, 0x67, 0x4f, 0x83, 0x8e, 0x02, 0x87, 0x3b, 0x81, 0x81, 0x8e,
+  0x01, 0x75, 0x28, 0x81, 0x8e, 0x02, 0x8a, 0x32, 0x78, 0x81, 0x8e, 0x05, 0x5a, 0x64, 0x75, 0x49,
+  0x3c, 0x6e, 0x81, 0x8e, 0x01, 0x1f, 0x01, 0xbe, 0x00, 0x02, 0x01, 0x50, 0x8d, 0x83, 0x8e, 0x02,
+  0x7d, 0x41, 0x87, 0x82, 0x8e, 0x02, 0x8d, 0x45, 0x6f, 0x81, 0x8e, 0x06, 0x81, 0x01, 0x8a, 0x8e,
+  0x8d, 0x33, 0x72, 0x81, 0x8e, 0x04, 0x5a, 0x1f, 0x01, 0x68, 0x89, 0x82, 0x8e, 0x01, 0x1f, 0x01,
+  0xbe, 0x00, 0x01, 0x01, 0x62, 0x84, 0x8e, 0x02, 0x89, 0x41, 0x78, 0x83, 0x8e, 0x01, 0x5a, 0x5e,
+  0x81, 0x8e, 0x02, 0x8a, 0x01, 0x80, 0x81, 0x8e, 0x06, 0x3b, 0x6c, 0x8b, 0x6b, 0x1f, 0x4f, 0x81,
+  0x84, 0x8e, 0x01, 0x1f, 0x01, 0xbd, 0x00, 0x81, 0x01, 0x00, 0x76, 0x85, 0x8e, 0x01, 0x57, 0x5f,
+  0x83, 0x8e, 0x01, 0x6f, 0x1f, 0x82, 0x8e, 0x01, 0x27, 0x72, 0x81, 0x8e, 0x05, 0x45, 0x57, 0x4c,
+  0x41, 0x33, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xbd, 0x00, 0x81, 0x01, 0x00, 0x83, 0x85, 0x8e,
+  0x02, 0x76, 0x01, 0x8a, 0x82, 0x8e, 0x02, 0x83, 0x01, 0x85, 0x81, 0x8e, 0x09, 0x56, 0x66, 0x8e,
+  0x8d, 0x49, 0x01, 0x5f, 0x85, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xbb, 0x00, 0x81, 0x01,
+  0x02, 0x14, 0x01, 0x7c, 0x85, 0x8e, 0x02, 0x8b, 0x32, 0x76, 0x82, 0x8e, 0x02, 0x8d, 0x3c, 0x78,
+  0x81, 0x8e, 0x05, 0x64, 0x59, 0x85, 0x57, 0x01, 0x50, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e,
+  0x01, 0x1f, 0x01, 0xb9, 0x00, 0x81, 0x01, 0x04, 0x32, 0x56, 0x81, 0x50, 0x6b, 0x86, 0x8e, 0x01,
+  0x5c, 0x64, 0x83, 0x8e, 0x01, 0x56, 0x6b, 0x81, 0x8e, 0x05, 0x6c, 0x1f, 0x3c, 0x57, 0x5a, 0x46,
+  0x81, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb8, 0x00, 0x81, 0x01, 0x01, 0x5f,
+  0x83, 0x81, 0x8e, 0x01, 0x66, 0x57, 0x86, 0x8e, 0x01, 0x6c, 0x4b, 0x83, 0x8e, 0x01, 0x61, 0x5f,
+  0x81, 0x8e, 0x05, 0x62, 0x14, 0x69, 0x8d, 0x6b, 0x28, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e,
+  0x01, 0x1f, 0x01, 0xb7, 0x00, 0x81, 0x01, 0x00, 0x69, 0x83, 0x8e, 0x02, 0x80, 0x01, 0x80, 0x85,
+  0x8e, 0x02, 0x84, 0x01, 0x83, 0x82, 0x8e, 0x0d, 0x6e, 0x4b, 0x89, 0x5c, 0x01, 0x41, 0x89, 0x8e,
+  0x72, 0x0b, 0x8d, 0x8e, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb7, 0x00, 0x01, 0x01, 0x61,
+  0x85, 0x8e, 0x01, 0x5c, 0x56, 0x86, 0x8e, 0x01, 0x4b, 0x66, 0x82, 0x8e, 0x0d, 0x80, 0x01, 0x45,
+  0x46, 0x72, 0x33, 0x85, 0x8e, 0x78, 0x02, 0x8a, 0x8e, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xb6, 0x00, 0x02, 0x01, 0x28, 0x85, 0x85, 0x8e, 0x02, 0x80, 0x3b, 0x83, 0x85, 0x8e, 0x02, 0x6c,
+  0x4b, 0x8d, 0x81, 0x8e, 0x02, 0x79, 0x01, 0x57, 0x81, 0x89, 0x08, 0x33, 0x7d, 0x8e, 0x80, 0x01,
+  0x87, 0x8e, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb6, 0x00, 0x01, 0x01, 0x61, 0x86, 0x8e,
+  0x02, 0x8d, 0x51, 0x62, 0x85, 0x8e, 0x12, 0x81, 0x3c, 0x85, 0x8e, 0x7c, 0x3b, 0x01, 0x66, 0x8e,
+  0x8d, 0x3c, 0x72, 0x8e, 0x84, 0x01, 0x84, 0x8e, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb5,
+  0x00, 0x81, 0x01, 0x00, 0x85, 0x87, 0x8e, 0x02, 0x79, 0x01, 0x84, 0x84, 0x8e, 0x07, 0x8b, 0x45,
+  0x6f, 0x78, 0x3b, 0x64, 0x67, 0x52, 0x81, 0x8e, 0x08, 0x50, 0x66, 0x8e, 0x87, 0x01, 0x81, 0x8e,
+  0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb5, 0x00, 0x02, 0x01, 0x41, 0x8b, 0x88, 0x8e, 0x01,
+  0x56, 0x64, 0x85, 0x8e, 0x11, 0x61, 0x46, 0x28, 0x33, 0x69, 0x5c, 0x3c, 0x69, 0x6c, 0x4c, 0x4b,
+  0x6c, 0x68, 0x14, 0x62, 0x6b, 0x49, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb5, 0x00, 0x02, 0x01,
+  0x0c, 0x87, 0x88, 0x8e, 0x02, 0x72, 0x3c, 0x89, 0x84, 0x8e, 0x02, 0x6e, 0x01, 0x16, 0x8c, 0x17,
+  0x01, 0x03, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb4, 0x00, 0x81, 0x01, 0x01, 0x1f, 0x69, 0x88,
+  0x8e, 0x02, 0x8d, 0x41, 0x67, 0x83, 0x8e, 0x03, 0x79, 0x32, 0x01, 0x36, 0x8b, 0x40, 0x02, 0x3f,
+  0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb4, 0x00, 0x04, 0x01, 0x3b, 0x6f, 0x32, 0x85, 0x88,
+  0x8e, 0x02, 0x72, 0x41, 0x89, 0x81, 0x8e, 0x06, 0x7d, 0x33, 0x59, 0x01, 0x36, 0x40, 0x44, 0x8a,
+  0x40, 0x01, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb4, 0x00, 0x04, 0x01, 0x62, 0x8d, 0x56,
+  0x5a, 0x88, 0x8e, 0x0e, 0x8a, 0x41, 0x6f, 0x8e, 0x85, 0x46, 0x61, 0x84, 0x01, 0x36, 0x40, 0x7a,
+  0x7b, 0x60, 0x44, 0x87, 0x40, 0x01, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb4, 0x00, 0x05,
+  0x02, 0x74, 0x8e, 0x87, 0x28, 0x69, 0x88, 0x8e, 0x0f, 0x69, 0x33, 0x85, 0x4b, 0x56, 0x8d, 0x85,
+  0x01, 0x36, 0x40, 0x4e, 0x6a, 0x88, 0x86, 0x60, 0x48, 0x85, 0x40, 0x01, 0x17, 0x66, 0x85, 0x8e,
+  0x01, 0x1f, 0x01, 0xb3, 0x00, 0x02, 0x01, 0x28, 0x83, 0x81, 0x8e, 0x02, 0x72, 0x28, 0x80, 0x87,
+  0x8e, 0x01, 0x8a, 0x41, 0x81, 0x46, 0x04, 0x89, 0x8e, 0x85, 0x01, 0x36, 0x82, 0x40, 0x05, 0x44,
+  0x60, 0x8b, 0x86, 0x71, 0x48, 0x83, 0x40, 0x01, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb3,
+  0x00, 0x02, 0x01, 0x41, 0x8d, 0x82, 0x8e, 0x02, 0x5f, 0x45, 0x8a, 0x87, 0x8e, 0x02, 0x5c, 0x01,
+  0x83, 0x81, 0x8e, 0x02, 0x85, 0x01, 0x36, 0x84, 0x40, 0x05, 0x7f, 0x4e, 0x73, 0x82, 0x71, 0x55,
+  0x81, 0x40, 0x01, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb3, 0x00, 0x01, 0x01, 0x62, 0x83,
+  0x8e, 0x02, 0x89, 0x49, 0x64, 0x86, 0x8e, 0x03, 0x78, 0x1f, 0x01, 0x78, 0x81, 0x8e, 0x03, 0x85,
+  0x01, 0x36, 0x3f, 0x83, 0x40, 0x09, 0x7f, 0x4e, 0x65, 0x88, 0x8e, 0x88, 0x48, 0x40, 0x17, 0x66,
+  0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb2, 0x00, 0x81, 0x01, 0x00, 0x7d, 0x84, 0x8e, 0x02, 0x7d, 0x01,
+  0x72, 0x84, 0x8e, 0x09, 0x85, 0x3c, 0x69, 0x64, 0x4f, 0x8d, 0x8e, 0x85, 0x01, 0x36, 0x81, 0x3f,
+  0x02, 0x40, 0x3f, 0x54, 0x81, 0x8b, 0x03, 0x8e, 0x7e, 0x63, 0x48, 0x81, 0x40, 0x01, 0x17, 0x66,
+  0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb2, 0x00, 0x02, 0x01, 0x41, 0x8a, 0x85, 0x8e, 0x02, 0x69, 0x45,
+  0x87, 0x82, 0x8e, 0x12, 0x8d, 0x59, 0x52, 0x8d, 0x83, 0x3b, 0x7d, 0x8e, 0x85, 0x01, 0x35, 0x3f,
+  0x4e, 0x65, 0x7e, 0x8e, 0x8b, 0x7a, 0x55, 0x84, 0x40, 0x01, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xb2, 0x00, 0x01, 0x01, 0x59, 0x87, 0x8e, 0x81, 0x51, 0x00, 0x8d, 0x81, 0x8e, 0x02, 0x6c,
+  0x33, 0x87, 0x81, 0x8e, 0x0b, 0x57, 0x59, 0x8e, 0x85, 0x01, 0x35, 0x3f, 0x7a, 0x8e, 0x8b, 0x6a,
+  0x4e, 0x86, 0x40, 0x01, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb2, 0x00, 0x01, 0x01, 0x62,
+  0x87, 0x8e, 0x06, 0x84, 0x3c, 0x6b, 0x8e, 0x84, 0x32, 0x6e, 0x82, 0x8e, 0x0a, 0x83, 0x01, 0x7d,
+  0x85, 0x01, 0x35, 0x3f, 0x6a, 0x63, 0x44, 0x3a, 0x87, 0x40, 0x01, 0x17, 0x66, 0x85, 0x8e, 0x01,
+  0x1f, 0x01, 0xb1, 0x00, 0x81, 0x01, 0x00, 0x5a, 0x88, 0x8e, 0x04, 0x72, 0x01, 0x78, 0x52, 0x59,
+  0x84, 0x8e, 0x08, 0x5a, 0x61, 0x85, 0x01, 0x30, 0x3e, 0x5b, 0x7f, 0x58, 0x81, 0x3f, 0x04, 0x48,
+  0x6d, 0x77, 0x65, 0x48, 0x81, 0x40, 0x01, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb1, 0x00,
+  0x03, 0x01, 0x14, 0x28, 0x84, 0x88, 0x8e, 0x03, 0x62, 0x27, 0x3b, 0x83, 0x84, 0x8e, 0x0f, 0x78,
+  0x01, 0x78, 0x01, 0x30, 0x3e, 0x7e, 0x73, 0x43, 0x3f, 0x3a, 0x7e, 0x8e, 0x86, 0x8b, 0x6d, 0x81,
+  0x40, 0x01, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb1, 0x00, 0x04, 0x01, 0x5f, 0x5a, 0x4f,
+  0x89, 0x87, 0x8e, 0x02, 0x81, 0x01, 0x4f, 0x86, 0x8e, 0x06, 0x50, 0x4b, 0x01, 0x2e, 0x3e, 0x86,
+  0x4e, 0x81, 0x3f, 0x09, 0x5b, 0x8e, 0x6a, 0x3a, 0x4e, 0x86, 0x3a, 0x40, 0x17, 0x66, 0x85, 0x8e,
+  0x01, 0x1f, 0x01, 0xb1, 0x00, 0x05, 0x0a, 0x74, 0x89, 0x4f, 0x56, 0x89, 0x86, 0x8e, 0x03, 0x66,
+  0x33, 0x27, 0x75, 0x85, 0x8e, 0x06, 0x78, 0x14, 0x01, 0x2e, 0x3e, 0x7e, 0x5b, 0x81, 0x3a, 0x09,
+  0x7a, 0x8c, 0x4e, 0x3f, 0x48, 0x88, 0x48, 0x40, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb0,
+  0x00, 0x07, 0x01, 0x27, 0x83, 0x8e, 0x8a, 0x4f, 0x50, 0x89, 0x84, 0x8e, 0x05, 0x87, 0x14, 0x72,
+  0x67, 0x27, 0x85, 0x84, 0x8e, 0x0a, 0x8b, 0x46, 0x01, 0x2e, 0x39, 0x5b, 0x8b, 0x6d, 0x73, 0x8e,
+  0x71, 0x81, 0x3f, 0x05, 0x65, 0x88, 0x3a, 0x40, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb0,
+  0x00, 0x02, 0x01, 0x3c, 0x8d, 0x81, 0x8e, 0x03, 0x89, 0x51, 0x4c, 0x85, 0x83, 0x8e, 0x03, 0x5c,
+  0x56, 0x8e, 0x8d, 0x81, 0x59, 0x85, 0x8e, 0x02, 0x72, 0x01, 0x2e, 0x81, 0x38, 0x04, 0x60, 0x82,
+  0x8b, 0x77, 0x43, 0x81, 0x3f, 0x05, 0x63, 0x5d, 0x3f, 0x40, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xb0, 0x00, 0x01, 0x01, 0x64, 0x83, 0x8e, 0x03, 0x8a, 0x57, 0x49, 0x84, 0x81, 0x8e, 0x02,
+  0x83, 0x3b, 0x7c, 0x81, 0x8e, 0x02, 0x84, 0x28, 0x69, 0x84, 0x8e, 0x02, 0x85, 0x01, 0x2d, 0x81,
+  0x38, 0x04, 0x39, 0x38, 0x31, 0x39, 0x3e, 0x81, 0x3f, 0x05, 0x4e, 0x71, 0x3a, 0x3f, 0x17, 0x66,
+  0x85, 0x8e, 0x01, 0x1f, 0x01, 0xaf, 0x00, 0x81, 0x01, 0x00, 0x7c, 0x84, 0x8e, 0x06, 0x8d, 0x5a,
+  0x49, 0x85, 0x8e, 0x61, 0x4c, 0x83, 0x8e, 0x02, 0x76, 0x33, 0x80, 0x83, 0x8e, 0x02, 0x85, 0x01,
+  0x2c, 0x82, 0x38, 0x81, 0x39, 0x82, 0x3e, 0x06, 0x3f, 0x54, 0x86, 0x3a, 0x3f, 0x17, 0x66, 0x85,
+  0x8e, 0x01, 0x1f, 0x01, 0xaf, 0x00, 0x02, 0x01, 0x41, 0x8a, 0x85, 0x8e, 0x05, 0x8b, 0x5e, 0x45,
+  0x6f, 0x01, 0x7c, 0x84, 0x8e, 0x02, 0x5f, 0x49, 0x8a, 0x82, 0x8e, 0x02, 0x85, 0x01, 0x2c, 0x81,
+  0x37, 0x81, 0x31, 0x82, 0x38, 0x81, 0x39, 0x05, 0x54, 0x82, 0x31, 0x3f, 0x17, 0x66, 0x85, 0x8e,
+  0x01, 0x1f, 0x01, 0xaf, 0x00, 0x01, 0x01, 0x57, 0x87, 0x8e, 0x04, 0x8d, 0x5f, 0x01, 0x51, 0x8d,
+  0x84, 0x8e, 0x02, 0x8b, 0x4c, 0x61, 0x82, 0x8e, 0x04, 0x85, 0x01, 0x2c, 0x36, 0x6d, 0x86, 0x7b,
+  0x05, 0x7e, 0x86, 0x31, 0x3f, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xaf, 0x00, 0x01, 0x01,
+  0x67, 0x88, 0x8e, 0x03, 0x8a, 0x1f, 0x32, 0x80, 0x85, 0x8e, 0x02, 0x7c, 0x0c, 0x72, 0x81, 0x8e,
+  0x04, 0x85, 0x01, 0x2c, 0x36, 0x73, 0x87, 0x86, 0x04, 0x88, 0x31, 0x3e, 0x17, 0x66, 0x85, 0x8e,
+  0x01, 0x1f, 0x01, 0xae, 0x00, 0x81, 0x01, 0x00, 0x80, 0x88, 0x8e, 0x04, 0x6e, 0x27, 0x64, 0x32,
+  0x79, 0x85, 0x8e, 0x07, 0x6c, 0x3b, 0x85, 0x8e, 0x85, 0x01, 0x2c, 0x36, 0x84, 0x2f, 0x82, 0x31,
+  0x05, 0x4e, 0x82, 0x31, 0x3e, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xae, 0x00, 0x81, 0x01,
+  0x00, 0x83, 0x87, 0x8e, 0x06, 0x8d, 0x4c, 0x68, 0x8e, 0x66, 0x01, 0x78, 0x84, 0x8e, 0x06, 0x8d,
+  0x56, 0x57, 0x8d, 0x85, 0x01, 0x2c, 0x83, 0x36, 0x00, 0x31, 0x81, 0x2f, 0x07, 0x31, 0x38, 0x54,
+  0x86, 0x31, 0x3e, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xae, 0x00, 0x81, 0x01, 0x01, 0x5a,
+  0x8d, 0x86, 0x8e, 0x02, 0x84, 0x3b, 0x81, 0x81, 0x8e, 0x02, 0x67, 0x28, 0x76, 0x84, 0x8e, 0x06,
+  0x87, 0x3c, 0x69, 0x85, 0x01, 0x2b, 0x35, 0x81, 0x36, 0x0b, 0x53, 0x77, 0x88, 0x8b, 0x7b, 0x5b,
+  0x4e, 0x6d, 0x31, 0x3e, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xae, 0x00, 0x04, 0x02, 0x64,
+  0x27, 0x5a, 0x85, 0x85, 0x8e, 0x02, 0x69, 0x49, 0x8d, 0x82, 0x8e, 0x02, 0x6c, 0x1f, 0x72, 0x84,
+  0x8e, 0x04, 0x72, 0x15, 0x6e, 0x01, 0x2b, 0x81, 0x35, 0x07, 0x65, 0x8d, 0x8b, 0x82, 0x7f, 0x8b,
+  0x8e, 0x73, 0x82, 0x39, 0x01, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xad, 0x00, 0x07, 0x01,
+  0x1f, 0x83, 0x84, 0x56, 0x01, 0x6e, 0x8b, 0x83, 0x8e, 0x01, 0x33, 0x6c, 0x84, 0x8e, 0x02, 0x6b,
+  0x01, 0x6f, 0x84, 0x8e, 0x00, 0x62, 0x81, 0x01, 0x06, 0x2b, 0x35, 0x4d, 0x8a, 0x65, 0x36, 0x35,
+  0x81, 0x31, 0x02, 0x63, 0x88, 0x63, 0x81, 0x38, 0x01, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xad, 0x00, 0x01, 0x01, 0x3c, 0x81, 0x8e, 0x04, 0x8d, 0x6e, 0x41, 0x49, 0x79, 0x81, 0x8e, 0x02,
+  0x7c, 0x0c, 0x89, 0x85, 0x8e, 0x02, 0x6e, 0x27, 0x6c, 0x83, 0x8e, 0x06, 0x8a, 0x49, 0x01, 0x2b,
+  0x30, 0x73, 0x6a, 0x85, 0x36, 0x05, 0x58, 0x7e, 0x31, 0x38, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xad, 0x00, 0x01, 0x01, 0x64, 0x83, 0x8e, 0x07, 0x87, 0x66, 0x01, 0x5f, 0x83, 0x69, 0x56,
+  0x8d, 0x86, 0x8e, 0x02, 0x72, 0x27, 0x6b, 0x83, 0x8e, 0x06, 0x7c, 0x01, 0x25, 0x36, 0x7f, 0x36,
+  0x35, 0x84, 0x36, 0x05, 0x3e, 0x82, 0x3a, 0x38, 0x17, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xac,
+  0x00, 0x81, 0x01, 0x00, 0x7d, 0x85, 0x8e, 0x04, 0x7d, 0x59, 0x01, 0x28, 0x64, 0x88, 0x8e, 0x02,
+  0x72, 0x27, 0x68, 0x82, 0x8e, 0x05, 0x85, 0x01, 0x25, 0x3d, 0x7e, 0x24, 0x82, 0x35, 0x83, 0x36,
+  0x04, 0x82, 0x4a, 0x37, 0x17, 0x66, 0x84, 0x8e, 0x02, 0x8d, 0x1f, 0x01, 0xac, 0x00, 0x02, 0x01,
+  0x41, 0x8a, 0x87, 0x8e, 0x03, 0x6e, 0x01, 0x41, 0x76, 0x88, 0x8e, 0x02, 0x75, 0x28, 0x64, 0x81,
+  0x8e, 0x06, 0x85, 0x01, 0x22, 0x2e, 0x7e, 0x54, 0x30, 0x82, 0x35, 0x81, 0x36, 0x05, 0x3e, 0x82,
+  0x2f, 0x36, 0x17, 0x66, 0x84, 0x8e, 0x02, 0x8b, 0x1f, 0x01, 0xac, 0x00, 0x01, 0x01, 0x56, 0x88,
+  0x8e, 0x05, 0x75, 0x01, 0x68, 0x01, 0x5a, 0x80, 0x87, 0x8e, 0x0b, 0x79, 0x28, 0x64, 0x8e, 0x85,
+  0x01, 0x22, 0x2e, 0x65, 0x7f, 0x36, 0x30, 0x82, 0x35, 0x06, 0x30, 0x65, 0x77, 0x2f, 0x36, 0x17,
+  0x66, 0x84, 0x8e, 0x02, 0x85, 0x15, 0x01, 0xac, 0x00, 0x01, 0x01, 0x67, 0x88, 0x8e, 0x07, 0x5e,
+  0x5c, 0x8e, 0x81, 0x5a, 0x01, 0x67, 0x89, 0x86, 0x8e, 0x05, 0x7c, 0x3c, 0x62, 0x83, 0x01, 0x22,
+  0x81, 0x2d, 0x08, 0x84, 0x86, 0x65, 0x54, 0x53, 0x5b, 0x71, 0x8d, 0x58, 0x81, 0x36, 0x01, 0x17,
+  0x66, 0x84, 0x8e, 0x02, 0x76, 0x0a, 0x01, 0xab, 0x00, 0x81, 0x01, 0x00, 0x80, 0x87, 0x8e, 0x02,
+  0x8d, 0x4f, 0x6e, 0x82, 0x8e, 0x03, 0x76, 0x49, 0x41, 0x72, 0x86, 0x8e, 0x04, 0x7d, 0x33, 0x4b,
+  0x01, 0x22, 0x81, 0x2d, 0x01, 0x4d, 0x82, 0x83, 0x8e, 0x01, 0x8d, 0x60, 0x82, 0x36, 0x01, 0x17,
+  0x66, 0x84, 0x8e, 0x01, 0x5e, 0x01, 0xac, 0x00, 0x81, 0x01, 0x00, 0x8d, 0x87, 0x8e, 0x02, 0x89,
+  0x41, 0x7c, 0x83, 0x8e, 0x04, 0x8a, 0x6b, 0x01, 0x59, 0x7d, 0x85, 0x8e, 0x04, 0x80, 0x33, 0x01,
+  0x22, 0x2c, 0x81, 0x2d, 0x07, 0x30, 0x5b, 0x65, 0x70, 0x65, 0x4d, 0x30, 0x35, 0x81, 0x36, 0x01,
+  0x17, 0x66, 0x83, 0x8e, 0x00, 0x74, 0x81, 0x01, 0xac, 0x00, 0x81, 0x01, 0x00, 0x85, 0x87, 0x8e,
+  0x02, 0x83, 0x33, 0x85, 0x85, 0x8e, 0x04, 0x84, 0x5e, 0x01, 0x64, 0x87, 0x84, 0x8e, 0x04, 0x7d,
+  0x01, 0x21, 0x2c, 0x4d, 0x88, 0x53, 0x81, 0x35, 0x01, 0x17, 0x66, 0x82, 0x8e, 0x02, 0x79, 0x3b,
+  0x01, 0xad, 0x00, 0x81, 0x01, 0x01, 0x59, 0x8b, 0x86, 0x8e, 0x02, 0x75, 0x3c, 0x8d, 0x87, 0x8e,
+  0x03, 0x79, 0x49, 0x41, 0x6e, 0x83, 0x8e, 0x04, 0x85, 0x01, 0x21, 0x2c, 0x77, 0x85, 0x8b, 0x0b,
+  0x8d, 0x8e, 0x7f, 0x26, 0x35, 0x17, 0x66, 0x8e, 0x87, 0x61, 0x27, 0x01, 0xae, 0x00, 0x05, 0x01,
+  0x14, 0x41, 0x4c, 0x6b, 0x80, 0x84, 0x8e, 0x01, 0x66, 0x50, 0x89, 0x8e, 0x04, 0x8b, 0x6e, 0x1f,
+  0x52, 0x78, 0x81, 0x8e, 0x05, 0x85, 0x01, 0x21, 0x2c, 0x2e, 0x30, 0x83, 0x35, 0x03, 0x58, 0x8b,
+  0x86, 0x4d, 0x81, 0x35, 0x03, 0x17, 0x4b, 0x57, 0x0b, 0x81, 0x01, 0xaf, 0x00, 0x81, 0x01, 0x0a,
+  0x76, 0x68, 0x50, 0x01, 0x28, 0x66, 0x79, 0x87, 0x8e, 0x50, 0x66, 0x8b, 0x8e, 0x03, 0x85, 0x61,
+  0x01, 0x62, 0x81, 0x85, 0x02, 0x01, 0x1d, 0x2b, 0x83, 0x2c, 0x04, 0x26, 0x5b, 0x8c, 0x7f, 0x3d,
+  0x82, 0x30, 0x00, 0x16, 0x82, 0x01, 0xb2, 0x00, 0x06, 0x01, 0x56, 0x8b, 0x8d, 0x87, 0x6e, 0x51,
+  0x81, 0x41, 0x03, 0x4b, 0x01, 0x6b, 0x8d, 0x8c, 0x8e, 0x05, 0x80, 0x4f, 0x3b, 0x61, 0x01, 0x1d,
+  0x81, 0x2b, 0x81, 0x2c, 0x04, 0x2d, 0x60, 0x8e, 0x7a, 0x3d, 0x81, 0x2e, 0x03, 0x30, 0x2e, 0x16,
+  0x01, 0xb4, 0x00, 0x81, 0x01, 0x01, 0x5c, 0x8d, 0x82, 0x8e, 0x02, 0x89, 0x80, 0x67, 0x81, 0x01,
+  0x03, 0x49, 0x61, 0x6f, 0x84, 0x8a, 0x8e, 0x05, 0x8d, 0x72, 0x27, 0x01, 0x1d, 0x25, 0x81, 0x2b,
+  0x05, 0x2c, 0x6a, 0x8e, 0x73, 0x3d, 0x2d, 0x83, 0x2e, 0x01, 0x16, 0x01, 0xb5, 0x00, 0x81, 0x01,
+  0x01, 0x61, 0x8d, 0x83, 0x8e, 0x0a, 0x83, 0x01, 0x7c, 0x6f, 0x61, 0x4b, 0x01, 0x46, 0x69, 0x7d,
+  0x89, 0x88, 0x8e, 0x02, 0x83, 0x01, 0x1c, 0x81, 0x25, 0x05, 0x2e, 0x70, 0x8e, 0x71, 0x2d, 0x2c,
+  0x81, 0x2d, 0x82, 0x2e, 0x01, 0x16, 0x01, 0xb6, 0x00, 0x81, 0x01, 0x01, 0x61, 0x8d, 0x82, 0x8e,
+  0x02, 0x7c, 0x33, 0x8b, 0x81, 0x8e, 0x03, 0x8d, 0x83, 0x69, 0x4c, 0x81, 0x41, 0x03, 0x4f, 0x6c,
+  0x85, 0x8d, 0x84, 0x8e, 0x09, 0x85, 0x01, 0x1c, 0x25, 0x34, 0x73, 0x8e, 0x6d, 0x4a, 0x47, 0x82,
+  0x4a, 0x00, 0x47, 0x81, 0x2e, 0x01, 0x16, 0x01, 0xb7, 0x00, 0x81, 0x01, 0x00, 0x64, 0x82, 0x8e,
+  0x02, 0x75, 0x49, 0x8d, 0x85, 0x8e, 0x08, 0x87, 0x7c, 0x66, 0x3b, 0x01, 0x4f, 0x62, 0x74, 0x87,
+  0x81, 0x8e, 0x04, 0x85, 0x01, 0x1c, 0x23, 0x6d, 0x81, 0x8d, 0x81, 0x87, 0x83, 0x88, 0x04, 0x7e,
+  0x24, 0x2d, 0x16, 0x01, 0xb8, 0x00, 0x02, 0x01, 0x02, 0x68, 0x81, 0x8e, 0x02, 0x6f, 0x50, 0x8d,
+  0x89, 0x8e, 0x0b, 0x81, 0x6c, 0x5e, 0x41, 0x01, 0x50, 0x6c, 0x75, 0x01, 0x1c, 0x23, 0x22, 0x84,
+  0x1e, 0x82, 0x24, 0x04, 0x26, 0x2d, 0x2c, 0x16, 0x01, 0xb9, 0x00, 0x06, 0x01, 0x0a, 0x68, 0x8e,
+  0x6c, 0x56, 0x8d, 0x8c, 0x8e, 0x07, 0x8d, 0x80, 0x64, 0x49, 0x3b, 0x01, 0x1c, 0x22, 0x81, 0x23,
+  0x82, 0x25, 0x81, 0x2b, 0x84, 0x2c, 0x01, 0x16, 0x01, 0xba, 0x00, 0x01, 0x01, 0x14, 0x81, 0x6b,
+  0x00, 0x59, 0x90, 0x8e, 0x03, 0x8d, 0x7c, 0x01, 0x1c, 0x81, 0x22, 0x81, 0x23, 0x82, 0x25, 0x81,
+  0x2b, 0x83, 0x2c, 0x01, 0x16, 0x01, 0xbb, 0x00, 0x03, 0x01, 0x02, 0x3b, 0x5a, 0x91, 0x8e, 0x03,
+  0x85, 0x01, 0x1c, 0x21, 0x81, 0x22, 0x82, 0x23, 0x81, 0x25, 0x81, 0x2b, 0x82, 0x2c, 0x01, 0x16,
+  0x01, 0xbc, 0x00, 0x81, 0x01, 0x01, 0x5a, 0x8d, 0x90, 0x8e, 0x04, 0x85, 0x01, 0x1b, 0x21, 0x25,
+  0x81, 0x22, 0x82, 0x23, 0x81, 0x25, 0x81, 0x2b, 0x81, 0x2c, 0x01, 0x16, 0x01, 0xbd, 0x00, 0x01,
+  0x01, 0x45, 0x91, 0x61, 0x0c, 0x5c, 0x01, 0x1b, 0x21, 0x70, 0x7a, 0x72, 0x60, 0x4d, 0x24, 0x1e,
+  0x24, 0x23, 0x82, 0x2b, 0x01, 0x16, 0x01, 0xbd, 0x00, 0x01, 0x01, 0x45, 0x91, 0x61, 0x11, 0x5c,
+  0x01, 0x1a, 0x21, 0x67, 0x75, 0x77, 0x81, 0x82, 0x85, 0x81, 0x7e, 0x73, 0x65, 0x24, 0x2b, 0x16,
+  0x01, 0xbc, 0x00, 0x81, 0x01, 0x01, 0x5a, 0x8d, 0x90, 0x8e, 0x02, 0x85, 0x01, 0x1a, 0x83, 0x21,
+  0x06, 0x22, 0x34, 0x53, 0x7f, 0x8e, 0x86, 0x58, 0x81, 0x25, 0x01, 0x16, 0x01, 0xbb, 0x00, 0x03,
+  0x01, 0x02, 0x3c, 0x5a, 0x91, 0x8e, 0x03, 0x85, 0x01, 0x1a, 0x20, 0x81, 0x21, 0x05, 0x20, 0x4a,
+  0x7c, 0x8d, 0x84, 0x60, 0x81, 0x23, 0x81, 0x25, 0x01, 0x16, 0x01, 0xba, 0x00, 0x01, 0x01, 0x14,
+  0x81, 0x6b, 0x00, 0x59, 0x90, 0x8e, 0x0a, 0x8d, 0x7c, 0x01, 0x1a, 0x20, 0x1e, 0x4d, 0x71, 0x8e,
+  0x89, 0x65, 0x81, 0x22, 0x83, 0x23, 0x01, 0x16, 0x01, 0xb9, 0x00, 0x06, 0x01, 0x0a, 0x68, 0x8e,
+  0x6c, 0x56, 0x8d, 0x8c, 0x8e, 0x0c, 0x8d, 0x80, 0x64, 0x49, 0x3b, 0x01, 0x12, 0x1d, 0x66, 0x8d,
+  0x8e, 0x6d, 0x42, 0x81, 0x21, 0x81, 0x22, 0x82, 0x23, 0x01, 0x16, 0x01, 0xb8, 0x00, 0x02, 0x01,
+  0x02, 0x68, 0x81, 0x8e, 0x02, 0x72, 0x50, 0x8d, 0x89, 0x8e, 0x10, 0x81, 0x6c, 0x5e, 0x41, 0x01,
+  0x50, 0x6c, 0x75, 0x01, 0x12, 0x1d, 0x13, 0x53, 0x71, 0x84, 0x68, 0x1e, 0x81, 0x21, 0x81, 0x22,
+  0x81, 0x23, 0x01, 0x16, 0x01, 0xb7, 0x00, 0x81, 0x01, 0x00, 0x64, 0x82, 0x8e, 0x02, 0x76, 0x49,
+  0x8d, 0x85, 0x8e, 0x08, 0x87, 0x79, 0x66, 0x3b, 0x01, 0x4f, 0x62, 0x74, 0x87, 0x81, 0x8e, 0x03,
+  0x85, 0x01, 0x12, 0x1c, 0x81, 0x1d, 0x01, 0x1b, 0x4d, 0x81, 0x7d, 0x02, 0x58, 0x1e, 0x21, 0x82,
+  0x22, 0x01, 0x16, 0x01, 0xb6, 0x00, 0x81, 0x01, 0x01, 0x61, 0x8d, 0x82, 0x8e, 0x02, 0x7c, 0x33,
+  0x8b, 0x81, 0x8e, 0x03, 0x8d, 0x83, 0x69, 0x4c, 0x81, 0x41, 0x03, 0x4f, 0x6c, 0x85, 0x8d, 0x84,
+  0x8e, 0x02, 0x85, 0x01, 0x11, 0x81, 0x1c, 0x81, 0x1d, 0x06, 0x20, 0x2a, 0x53, 0x84, 0x7a, 0x4d,
+  0x23, 0x81, 0x22, 0x01, 0x16, 0x01, 0xb5, 0x00, 0x81, 0x01, 0x01, 0x61, 0x8d, 0x83, 0x8e, 0x0a,
+  0x83, 0x01, 0x79, 0x6f, 0x61, 0x4b, 0x01, 0x46, 0x69, 0x7d, 0x89, 0x88, 0x8e, 0x11, 0x83, 0x01,
+  0x11, 0x1b, 0x61, 0x6c, 0x74, 0x79, 0x81, 0x82, 0x87, 0x8e, 0x8d, 0x71, 0x1e, 0x21, 0x16, 0x01,
+  0xb4, 0x00, 0x81, 0x01, 0x01, 0x5e, 0x8d, 0x82, 0x8e, 0x02, 0x89, 0x80, 0x67, 0x81, 0x01, 0x03,
+  0x49, 0x61, 0x6f, 0x84, 0x8a, 0x8e, 0x0f, 0x8d, 0x72, 0x27, 0x01, 0x11, 0x1b, 0x7a, 0x8d, 0x89,
+  0x85, 0x7f, 0x79, 0x74, 0x69, 0x5b, 0x4a, 0x81, 0x21, 0x01, 0x16, 0x01, 0xb4, 0x00, 0x06, 0x01,
+  0x56, 0x8b, 0x8d, 0x87, 0x6e, 0x51, 0x81, 0x41, 0x03, 0x4b, 0x01, 0x6b, 0x8d, 0x8c, 0x8e, 0x06,
+  0x80, 0x4f, 0x3b, 0x61, 0x01, 0x10, 0x1b, 0x81, 0x4d, 0x03, 0x42, 0x34, 0x2a, 0x1d, 0x81, 0x20,
+  0x83, 0x21, 0x01, 0x16, 0x01, 0xb3, 0x00, 0x81, 0x01, 0x0a, 0x76, 0x68, 0x50, 0x01, 0x32, 0x66,
+  0x79, 0x87, 0x8e, 0x50, 0x66, 0x8b, 0x8e, 0x03, 0x85, 0x61, 0x01, 0x62, 0x81, 0x85, 0x07, 0x01,
+  0x10, 0x1a, 0x77, 0x87, 0x70, 0x2a, 0x1b, 0x81, 0x1d, 0x81, 0x20, 0x82, 0x21, 0x00, 0x16, 0x82,
+  0x01, 0xb1, 0x00, 0x05, 0x01, 0x14, 0x3c, 0x4c, 0x6b, 0x81, 0x84, 0x8e, 0x01, 0x66, 0x50, 0x89,
+  0x8e, 0x04, 0x8b, 0x6e, 0x1f, 0x52, 0x78, 0x81, 0x8e, 0x0b, 0x85, 0x01, 0x10, 0x1a, 0x13, 0x64,
+  0x7d, 0x85, 0x70, 0x4d, 0x13, 0x1d, 0x81, 0x20, 0x05, 0x21, 0x20, 0x16, 0x4b, 0x57, 0x0b, 0x81,
+  0x01, 0xaf, 0x00, 0x81, 0x01, 0x01, 0x59, 0x8b, 0x86, 0x8e, 0x02, 0x75, 0x3c, 0x8d, 0x87, 0x8e,
+  0x03, 0x79, 0x49, 0x41, 0x6e, 0x83, 0x8e, 0x02, 0x85, 0x01, 0x0f, 0x82, 0x1a, 0x06, 0x2a, 0x42,
+  0x87, 0x89, 0x78, 0x4d, 0x2a, 0x82, 0x20, 0x06, 0x16, 0x66, 0x8e, 0x87, 0x61, 0x27, 0x01, 0xae,
+  0x00, 0x81, 0x01, 0x00, 0x85, 0x87, 0x8e, 0x02, 0x83, 0x33, 0x85, 0x85, 0x8e, 0x04, 0x84, 0x5f,
+  0x01, 0x64, 0x87, 0x84, 0x8e, 0x02, 0x7d, 0x01, 0x0f, 0x83, 0x1a, 0x0a, 0x1b, 0x7e, 0x42, 0x66,
+  0x7a, 0x7e, 0x5b, 0x1b, 0x1d, 0x16, 0x66, 0x82, 0x8e, 0x02, 0x79, 0x3b, 0x01, 0xad, 0x00, 0x81,
+  0x01, 0x00, 0x8d, 0x87, 0x8e, 0x02, 0x89, 0x45, 0x7c, 0x83, 0x8e, 0x04, 0x8a, 0x6b, 0x01, 0x59,
+  0x7d, 0x85, 0x8e, 0x03, 0x80, 0x33, 0x01, 0x0f, 0x84, 0x1a, 0x09, 0x7a, 0x5e, 0x71, 0x8b, 0x8d,
+  0x80, 0x34, 0x1d, 0x04, 0x66, 0x83, 0x8e, 0x00, 0x74, 0x81, 0x01, 0xac, 0x00, 0x81, 0x01, 0x00,
+  0x80, 0x87, 0x8e, 0x02, 0x8d, 0x4f, 0x6e, 0x82, 0x8e, 0x03, 0x76, 0x49, 0x41, 0x72, 0x86, 0x8e,
+  0x05, 0x7d, 0x33, 0x4b, 0x01, 0x0e, 0x19, 0x81, 0x1a, 0x01, 0x34, 0x58, 0x82, 0x8d, 0x02, 0x74,
+  0x47, 0x2a, 0x81, 0x1d, 0x01, 0x04, 0x66, 0x84, 0x8e, 0x01, 0x5e, 0x01, 0xad, 0x00, 0x01, 0x01,
+  0x67, 0x88, 0x8e, 0x07, 0x5f, 0x5a, 0x8e, 0x81, 0x5a, 0x01, 0x67, 0x89, 0x86, 0x8e, 0x0e, 0x79,
+  0x3c, 0x62, 0x83, 0x01, 0x08, 0x12, 0x57, 0x74, 0x87, 0x8e, 0x85, 0x69, 0x42, 0x12, 0x81, 0x1b,
+  0x81, 0x1c, 0x01, 0x04, 0x66, 0x84, 0x8e, 0x02, 0x76, 0x0a, 0x01, 0xac, 0x00, 0x01, 0x01, 0x56,
+  0x88, 0x8e, 0x05, 0x75, 0x01, 0x68, 0x01, 0x5a, 0x80, 0x87, 0x8e, 0x0d, 0x78, 0x28, 0x64, 0x8e,
+  0x85, 0x01, 0x08, 0x12, 0x7d, 0x8d, 0x80, 0x62, 0x09, 0x1a, 0x85, 0x1b, 0x01, 0x04, 0x66, 0x84,
+  0x8e, 0x02, 0x85, 0x15, 0x01, 0xac, 0x00, 0x02, 0x01, 0x41, 0x8a, 0x87, 0x8e, 0x03, 0x6e, 0x01,
+  0x41, 0x76, 0x88, 0x8e, 0x02, 0x75, 0x28, 0x64, 0x81, 0x8e, 0x06, 0x85, 0x01, 0x08, 0x12, 0x64,
+  0x47, 0x2a, 0x83, 0x1c, 0x02, 0x1d, 0x20, 0x1d, 0x81, 0x1b, 0x01, 0x04, 0x66, 0x84, 0x8e, 0x02,
+  0x8b, 0x1f, 0x01, 0xac, 0x00, 0x81, 0x01, 0x00, 0x7d, 0x85, 0x8e, 0x04, 0x7d, 0x59, 0x01, 0x28,
+  0x64, 0x88, 0x8e, 0x02, 0x72, 0x27, 0x68, 0x82, 0x8e, 0x05, 0x85, 0x01, 0x08, 0x10, 0x70, 0x7f,
+  0x86, 0x83, 0x04, 0x78, 0x12, 0x1b, 0x04, 0x66, 0x84, 0x8e, 0x02, 0x8d, 0x1f, 0x01, 0xad, 0x00,
+  0x01, 0x01, 0x64, 0x83, 0x8e, 0x07, 0x87, 0x66, 0x01, 0x5f, 0x83, 0x69, 0x56, 0x8d, 0x86, 0x8e,
+  0x02, 0x72, 0x27, 0x6b, 0x83, 0x8e, 0x04, 0x7c, 0x01, 0x08, 0x10, 0x70, 0x82, 0x83, 0x01, 0x85,
+  0x8b, 0x81, 0x83, 0x05, 0x82, 0x87, 0x09, 0x1b, 0x04, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xad,
+  0x00, 0x01, 0x01, 0x3c, 0x81, 0x8e, 0x04, 0x8d, 0x6e, 0x41, 0x49, 0x79, 0x81, 0x8e, 0x02, 0x7d,
+  0x0c, 0x89, 0x85, 0x8e, 0x02, 0x6e, 0x27, 0x6c, 0x83, 0x8e, 0x05, 0x89, 0x49, 0x01, 0x07, 0x10,
+  0x18, 0x81, 0x1c, 0x0a, 0x34, 0x78, 0x7d, 0x1a, 0x2a, 0x42, 0x81, 0x09, 0x1a, 0x04, 0x66, 0x85,
+  0x8e, 0x01, 0x1f, 0x01, 0xad, 0x00, 0x07, 0x01, 0x1f, 0x83, 0x84, 0x56, 0x01, 0x6e, 0x8b, 0x83,
+  0x8e, 0x01, 0x32, 0x6c, 0x84, 0x8e, 0x02, 0x6b, 0x01, 0x6f, 0x84, 0x8e, 0x00, 0x62, 0x81, 0x01,
+  0x00, 0x07, 0x82, 0x10, 0x0b, 0x42, 0x83, 0x8d, 0x87, 0x13, 0x1a, 0x42, 0x80, 0x09, 0x1a, 0x04,
+  0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xae, 0x00, 0x04, 0x02, 0x64, 0x27, 0x5a, 0x85, 0x85, 0x8e,
+  0x02, 0x69, 0x49, 0x8d, 0x82, 0x8e, 0x02, 0x6c, 0x1f, 0x72, 0x84, 0x8e, 0x13, 0x72, 0x15, 0x6e,
+  0x01, 0x07, 0x10, 0x09, 0x62, 0x8a, 0x89, 0x5e, 0x80, 0x6c, 0x4d, 0x6b, 0x7d, 0x09, 0x1a, 0x04,
+  0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xae, 0x00, 0x81, 0x01, 0x01, 0x5a, 0x8d, 0x86, 0x8e, 0x02,
+  0x84, 0x3b, 0x81, 0x81, 0x8e, 0x02, 0x67, 0x28, 0x76, 0x84, 0x8e, 0x0d, 0x87, 0x3c, 0x69, 0x85,
+  0x01, 0x07, 0x0f, 0x6c, 0x8e, 0x83, 0x50, 0x10, 0x53, 0x8b, 0x81, 0x8d, 0x04, 0x60, 0x12, 0x1a,
+  0x04, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xae, 0x00, 0x81, 0x01, 0x00, 0x83, 0x87, 0x8e, 0x06,
+  0x8d, 0x4c, 0x68, 0x8e, 0x66, 0x01, 0x78, 0x84, 0x8e, 0x0a, 0x8d, 0x56, 0x57, 0x8d, 0x85, 0x01,
+  0x07, 0x0f, 0x7a, 0x72, 0x2a, 0x82, 0x10, 0x03, 0x59, 0x67, 0x61, 0x12, 0x81, 0x1a, 0x01, 0x04,
+  0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xae, 0x00, 0x81, 0x01, 0x00, 0x80, 0x88, 0x8e, 0x04, 0x6e,
+  0x27, 0x64, 0x32, 0x79, 0x85, 0x8e, 0x09, 0x6b, 0x3b, 0x85, 0x8e, 0x85, 0x01, 0x07, 0x0f, 0x47,
+  0x08, 0x83, 0x10, 0x07, 0x11, 0x12, 0x4d, 0x7e, 0x09, 0x12, 0x04, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xaf, 0x00, 0x01, 0x01, 0x67, 0x88, 0x8e, 0x03, 0x8a, 0x1f, 0x32, 0x80, 0x85, 0x8e, 0x02,
+  0x7c, 0x0b, 0x72, 0x81, 0x8e, 0x02, 0x85, 0x01, 0x06, 0x83, 0x0f, 0x83, 0x10, 0x06, 0x11, 0x57,
+  0x85, 0x09, 0x12, 0x04, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xaf, 0x00, 0x01, 0x01, 0x57, 0x87,
+  0x8e, 0x04, 0x8d, 0x5f, 0x01, 0x51, 0x8d, 0x84, 0x8e, 0x02, 0x8b, 0x4c, 0x61, 0x82, 0x8e, 0x03,
+  0x85, 0x01, 0x06, 0x0e, 0x83, 0x07, 0x81, 0x08, 0x81, 0x09, 0x05, 0x47, 0x84, 0x09, 0x12, 0x04,
+  0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xaf, 0x00, 0x02, 0x01, 0x41, 0x8a, 0x85, 0x8e, 0x05, 0x8b,
+  0x5e, 0x45, 0x6f, 0x01, 0x7c, 0x84, 0x8e, 0x02, 0x5f, 0x49, 0x8a, 0x82, 0x8e, 0x04, 0x85, 0x01,
+  0x06, 0x08, 0x7d, 0x87, 0x8d, 0x04, 0x89, 0x09, 0x12, 0x04, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xaf, 0x00, 0x81, 0x01, 0x00, 0x7c, 0x84, 0x8e, 0x06, 0x8d, 0x5a, 0x46, 0x85, 0x8e, 0x61, 0x4c,
+  0x83, 0x8e, 0x02, 0x76, 0x33, 0x80, 0x83, 0x8e, 0x04, 0x85, 0x01, 0x06, 0x08, 0x64, 0x86, 0x6c,
+  0x05, 0x6f, 0x85, 0x09, 0x11, 0x04, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb0, 0x00, 0x01, 0x01,
+  0x64, 0x83, 0x8e, 0x03, 0x8a, 0x57, 0x49, 0x84, 0x81, 0x8e, 0x02, 0x83, 0x3b, 0x7c, 0x81, 0x8e,
+  0x02, 0x84, 0x28, 0x69, 0x84, 0x8e, 0x03, 0x85, 0x01, 0x05, 0x08, 0x82, 0x07, 0x82, 0x08, 0x81,
+  0x09, 0x05, 0x56, 0x85, 0x07, 0x10, 0x04, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb0, 0x00, 0x02,
+  0x01, 0x3c, 0x8d, 0x81, 0x8e, 0x03, 0x89, 0x51, 0x4c, 0x85, 0x83, 0x8e, 0x03, 0x5c, 0x56, 0x8e,
+  0x8d, 0x81, 0x59, 0x85, 0x8e, 0x02, 0x72, 0x01, 0x05, 0x82, 0x08, 0x81, 0x0e, 0x83, 0x0f, 0x05,
+  0x59, 0x85, 0x07, 0x10, 0x04, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb0, 0x00, 0x07, 0x01, 0x27,
+  0x83, 0x8e, 0x89, 0x4f, 0x50, 0x89, 0x84, 0x8e, 0x05, 0x87, 0x14, 0x72, 0x67, 0x27, 0x85, 0x84,
+  0x8e, 0x05, 0x8b, 0x46, 0x01, 0x05, 0x07, 0x0e, 0x81, 0x10, 0x84, 0x18, 0x05, 0x2a, 0x47, 0x0f,
+  0x10, 0x04, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb1, 0x00, 0x05, 0x0a, 0x74, 0x89, 0x4f, 0x56,
+  0x89, 0x86, 0x8e, 0x03, 0x66, 0x33, 0x27, 0x75, 0x85, 0x8e, 0x05, 0x78, 0x14, 0x01, 0x05, 0x07,
+  0x70, 0x87, 0x81, 0x04, 0x78, 0x08, 0x10, 0x04, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb1, 0x00,
+  0x04, 0x01, 0x5f, 0x5a, 0x4f, 0x89, 0x87, 0x8e, 0x02, 0x81, 0x01, 0x4f, 0x86, 0x8e, 0x05, 0x50,
+  0x4b, 0x01, 0x05, 0x07, 0x70, 0x87, 0x81, 0x04, 0x78, 0x07, 0x0f, 0x04, 0x66, 0x85, 0x8e, 0x01,
+  0x1f, 0x01, 0xb1, 0x00, 0x03, 0x01, 0x14, 0x28, 0x84, 0x88, 0x8e, 0x03, 0x62, 0x27, 0x3b, 0x83,
+  0x84, 0x8e, 0x04, 0x78, 0x01, 0x78, 0x01, 0x05, 0x81, 0x07, 0x81, 0x08, 0x81, 0x0e, 0x82, 0x0f,
+  0x81, 0x10, 0x81, 0x0f, 0x01, 0x04, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb1, 0x00, 0x81, 0x01,
+  0x00, 0x5a, 0x88, 0x8e, 0x04, 0x72, 0x01, 0x78, 0x52, 0x5a, 0x84, 0x8e, 0x06, 0x5a, 0x61, 0x85,
+  0x01, 0x05, 0x07, 0x64, 0x87, 0x6e, 0x04, 0x69, 0x08, 0x0f, 0x04, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xb2, 0x00, 0x01, 0x01, 0x62, 0x87, 0x8e, 0x06, 0x84, 0x3c, 0x6b, 0x8e, 0x84, 0x32, 0x6e,
+  0x82, 0x8e, 0x07, 0x83, 0x01, 0x7d, 0x85, 0x01, 0x05, 0x07, 0x6b, 0x85, 0x79, 0x06, 0x89, 0x8e,
+  0x75, 0x07, 0x0f, 0x04, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb2, 0x00, 0x01, 0x01, 0x59, 0x86,
+  0x8e, 0x00, 0x8d, 0x81, 0x51, 0x00, 0x8d, 0x81, 0x8e, 0x02, 0x6c, 0x33, 0x85, 0x81, 0x8e, 0x05,
+  0x57, 0x59, 0x8e, 0x85, 0x01, 0x05, 0x85, 0x07, 0x04, 0x29, 0x6c, 0x8e, 0x72, 0x29, 0x81, 0x0e,
+  0x01, 0x04, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb2, 0x00, 0x02, 0x01, 0x41, 0x8a, 0x85, 0x8e,
+  0x02, 0x69, 0x45, 0x87, 0x82, 0x8e, 0x0a, 0x8d, 0x5a, 0x52, 0x8d, 0x83, 0x3b, 0x7d, 0x8e, 0x85,
+  0x01, 0x05, 0x84, 0x07, 0x05, 0x05, 0x74, 0x8e, 0x6c, 0x07, 0x08, 0x81, 0x0e, 0x01, 0x04, 0x66,
+  0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb2, 0x00, 0x81, 0x01, 0x00, 0x7d, 0x84, 0x8e, 0x02, 0x7d, 0x01,
+  0x72, 0x84, 0x8e, 0x09, 0x85, 0x3c, 0x69, 0x64, 0x4f, 0x8d, 0x8e, 0x85, 0x01, 0x05, 0x83, 0x07,
+  0x04, 0x29, 0x76, 0x8e, 0x68, 0x06, 0x83, 0x08, 0x01, 0x0d, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xb3, 0x00, 0x01, 0x01, 0x62, 0x83, 0x8e, 0x02, 0x89, 0x49, 0x64, 0x86, 0x8e, 0x03, 0x78, 0x1f,
+  0x01, 0x78, 0x81, 0x8e, 0x02, 0x85, 0x01, 0x05, 0x82, 0x07, 0x04, 0x4b, 0x80, 0x8d, 0x62, 0x0e,
+  0x81, 0x07, 0x82, 0x08, 0x01, 0x0d, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb3, 0x00, 0x02, 0x01,
+  0x41, 0x8d, 0x82, 0x8e, 0x02, 0x5f, 0x46, 0x8a, 0x87, 0x8e, 0x02, 0x5c, 0x01, 0x83, 0x81, 0x8e,
+  0x02, 0x85, 0x01, 0x05, 0x81, 0x07, 0x03, 0x4f, 0x83, 0x8d, 0x61, 0x84, 0x07, 0x81, 0x08, 0x01,
+  0x0d, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb3, 0x00, 0x02, 0x01, 0x28, 0x83, 0x81, 0x8e, 0x02,
+  0x72, 0x28, 0x80, 0x87, 0x8e, 0x0d, 0x8a, 0x41, 0x45, 0x49, 0x89, 0x8e, 0x85, 0x01, 0x05, 0x07,
+  0x57, 0x85, 0x8e, 0x70, 0x84, 0x66, 0x04, 0x62, 0x06, 0x07, 0x0d, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xb4, 0x00, 0x05, 0x02, 0x74, 0x8e, 0x87, 0x28, 0x69, 0x88, 0x8e, 0x0a, 0x69, 0x33, 0x85,
+  0x4b, 0x57, 0x8d, 0x85, 0x01, 0x05, 0x07, 0x6b, 0x81, 0x7d, 0x85, 0x7c, 0x04, 0x75, 0x05, 0x07,
+  0x0d, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb4, 0x00, 0x04, 0x01, 0x61, 0x8d, 0x56, 0x5a, 0x88,
+  0x8e, 0x0b, 0x8a, 0x41, 0x6f, 0x8e, 0x85, 0x46, 0x62, 0x85, 0x01, 0x05, 0x07, 0x06, 0x87, 0x05,
+  0x00, 0x06, 0x81, 0x07, 0x01, 0x0d, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb4, 0x00, 0x04, 0x01,
+  0x33, 0x6f, 0x33, 0x85, 0x88, 0x8e, 0x02, 0x72, 0x41, 0x89, 0x81, 0x8e, 0x04, 0x7d, 0x33, 0x59,
+  0x01, 0x05, 0x8c, 0x07, 0x01, 0x0d, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb4, 0x00, 0x81, 0x01,
+  0x01, 0x15, 0x69, 0x88, 0x8e, 0x02, 0x8d, 0x3c, 0x67, 0x83, 0x8e, 0x03, 0x79, 0x32, 0x01, 0x05,
+  0x8c, 0x07, 0x01, 0x0d, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb5, 0x00, 0x02, 0x01, 0x14, 0x87,
+  0x88, 0x8e, 0x02, 0x72, 0x3c, 0x89, 0x84, 0x8e, 0x01, 0x6e, 0x01, 0x8d, 0x03, 0x01, 0x02, 0x66,
+  0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb5, 0x00, 0x02, 0x01, 0x41, 0x8b, 0x88, 0x8e, 0x01, 0x56, 0x64,
+  0x85, 0x8e, 0x11, 0x61, 0x46, 0x28, 0x3c, 0x6b, 0x5e, 0x3c, 0x6b, 0x6e, 0x4f, 0x4b, 0x6e, 0x69,
+  0x14, 0x64, 0x6c, 0x4b, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb5, 0x00, 0x81, 0x01, 0x00, 0x85,
+  0x87, 0x8e, 0x02, 0x79, 0x01, 0x84, 0x84, 0x8e, 0x07, 0x8b, 0x45, 0x6f, 0x78, 0x3b, 0x64, 0x67,
+  0x52, 0x81, 0x8e, 0x08, 0x50, 0x66, 0x8e, 0x87, 0x01, 0x81, 0x8e, 0x5a, 0x66, 0x85, 0x8e, 0x01,
+  0x1f, 0x01, 0xb6, 0x00, 0x01, 0x01, 0x61, 0x86, 0x8e, 0x02, 0x8d, 0x51, 0x62, 0x85, 0x8e, 0x12,
+  0x81, 0x3c, 0x85, 0x8e, 0x7c, 0x33, 0x01, 0x66, 0x8e, 0x8d, 0x3c, 0x72, 0x8e, 0x84, 0x01, 0x84,
+  0x8e, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb6, 0x00, 0x02, 0x01, 0x28, 0x85, 0x85, 0x8e,
+  0x02, 0x80, 0x3b, 0x83, 0x85, 0x8e, 0x02, 0x6c, 0x4b, 0x8d, 0x81, 0x8e, 0x02, 0x79, 0x01, 0x56,
+  0x81, 0x89, 0x08, 0x33, 0x7d, 0x8e, 0x80, 0x01, 0x87, 0x8e, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xb7, 0x00, 0x01, 0x01, 0x61, 0x85, 0x8e, 0x01, 0x5c, 0x56, 0x86, 0x8e, 0x01, 0x4c, 0x66,
+  0x82, 0x8e, 0x0d, 0x80, 0x01, 0x45, 0x46, 0x72, 0x33, 0x85, 0x8e, 0x78, 0x02, 0x8a, 0x8e, 0x5a,
+  0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb7, 0x00, 0x81, 0x01, 0x00, 0x69, 0x83, 0x8e, 0x02, 0x80,
+  0x01, 0x81, 0x85, 0x8e, 0x02, 0x84, 0x01, 0x83, 0x82, 0x8e, 0x0d, 0x6e, 0x4b, 0x87, 0x5c, 0x01,
+  0x41, 0x89, 0x8e, 0x72, 0x0b, 0x8d, 0x8e, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb8, 0x00,
+  0x81, 0x01, 0x01, 0x5f, 0x83, 0x81, 0x8e, 0x01, 0x66, 0x59, 0x86, 0x8e, 0x01, 0x6c, 0x4c, 0x83,
+  0x8e, 0x01, 0x61, 0x5f, 0x81, 0x8e, 0x05, 0x62, 0x14, 0x69, 0x8d, 0x6b, 0x28, 0x81, 0x8e, 0x01,
+  0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xb9, 0x00, 0x81, 0x01, 0x04, 0x32, 0x56, 0x81, 0x50,
+  0x6b, 0x86, 0x8e, 0x01, 0x5a, 0x64, 0x83, 0x8e, 0x01, 0x56, 0x6b, 0x81, 0x8e, 0x05, 0x6c, 0x1f,
+  0x3c, 0x59, 0x5c, 0x46, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xbb, 0x00,
+  0x81, 0x01, 0x02, 0x14, 0x01, 0x7d, 0x85, 0x8e, 0x02, 0x8b, 0x32, 0x76, 0x82, 0x8e, 0x02, 0x8d,
+  0x3c, 0x78, 0x81, 0x8e, 0x05, 0x64, 0x59, 0x85, 0x57, 0x01, 0x50, 0x81, 0x8e, 0x01, 0x5a, 0x66,
+  0x85, 0x8e, 0x01, 0x1f, 0x01, 0xbd, 0x00, 0x81, 0x01, 0x00, 0x83, 0x85, 0x8e, 0x02, 0x75, 0x01,
+  0x8a, 0x82, 0x8e, 0x02, 0x83, 0x01, 0x85, 0x81, 0x8e, 0x09, 0x56, 0x66, 0x8e, 0x8d, 0x4b, 0x01,
+  0x61, 0x87, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xbd, 0x00, 0x81, 0x01, 0x00, 0x76, 0x85,
+  0x8e, 0x01, 0x57, 0x5f, 0x83, 0x8e, 0x01, 0x6f, 0x1f, 0x82, 0x8e, 0x01, 0x27, 0x72, 0x81, 0x8e,
+  0x05, 0x45, 0x57, 0x4c, 0x41, 0x33, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xbe, 0x00, 0x01, 0x01,
+  0x64, 0x84, 0x8e, 0x02, 0x89, 0x41, 0x78, 0x83, 0x8e, 0x01, 0x5a, 0x5e, 0x81, 0x8e, 0x02, 0x8a,
+  0x01, 0x80, 0x81, 0x8e, 0x06, 0x3b, 0x6c, 0x8b, 0x6b, 0x1f, 0x4f, 0x83, 0x84, 0x8e, 0x01, 0x1f,
+  0x01, 0xbe, 0x00, 0x02, 0x01, 0x50, 0x8d, 0x83, 0x8e, 0x02, 0x7d, 0x41, 0x87, 0x82, 0x8e, 0x02,
+  0x8d, 0x45, 0x6f, 0x81, 0x8e, 0x06, 0x81, 0x01, 0x8a, 0x8e, 0x8d, 0x33, 0x72, 0x81, 0x8e, 0x04,
+  0x5a, 0x1f, 0x01, 0x69, 0x89, 0x82, 0x8e, 0x01, 0x1f, 0x01, 0xbe, 0x00, 0x81, 0x01, 0x00, 0x85,
+  0x83, 0x8e, 0x01, 0x67, 0x4f, 0x83, 0x8e, 0x02, 0x87, 0x3b, 0x81, 0x81, 0x8e, 0x01, 0x75, 0x28,
+  0x81, 0x8e, 0x02, 0x8a, 0x32, 0x78, 0x81, 0x8e, 0x05, 0x5a, 0x64, 0x75, 0x49, 0x3c, 0x6e, 0x81,
+  0x8e, 0x01, 0x1f, 0x01, 0xbf, 0x00, 0x01, 0x01, 0x6b, 0x83, 0x8e, 0x01, 0x33, 0x6c, 0x83, 0x8e,
+  0x02, 0x7d, 0x41, 0x87, 0x81, 0x8e, 0x01, 0x69, 0x52, 0x81, 0x8e, 0x02, 0x87, 0x28, 0x80, 0x81,
+  0x8e, 0x09, 0x5a, 0x66, 0x8e, 0x8a, 0x6e, 0x01, 0x5f, 0x8a, 0x27, 0x01, 0xbf, 0x00, 0x01, 0x01,
+  0x4b, 0x82, 0x8e, 0x02, 0x7d, 0x01, 0x89, 0x83, 0x8e, 0x02, 0x72, 0x4b, 0x8d, 0x81, 0x8e, 0x01,
+  0x61, 0x5f, 0x81, 0x8e, 0x02, 0x84, 0x28, 0x83, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x82, 0x8e, 0x04,
+  0x80, 0x45, 0x5f, 0x14, 0x01, 0xbf, 0x00, 0x02, 0x01, 0x3b, 0x87, 0x81, 0x8e, 0x01, 0x67, 0x57,
+  0x84, 0x8e, 0x01, 0x62, 0x59, 0x82, 0x8e, 0x01, 0x5a, 0x67, 0x81, 0x8e, 0x02, 0x81, 0x28, 0x85,
+  0x81, 0x8e, 0x01, 0x5a, 0x66, 0x83, 0x8e, 0x01, 0x80, 0x14, 0x81, 0x01, 0xc0, 0x00, 0x01, 0x0b,
+  0x78, 0x81, 0x8e, 0x01, 0x56, 0x68, 0x84, 0x8e, 0x01, 0x3c, 0x6c, 0x81, 0x8e, 0x02, 0x8d, 0x52,
+  0x6e, 0x81, 0x8e, 0x02, 0x7d, 0x3c, 0x87, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x84, 0x8e, 0x00, 0x68,
+  0x81, 0x01, 0xc0, 0x00, 0x05, 0x01, 0x62, 0x8e, 0x87, 0x01, 0x7d, 0x83, 0x8e, 0x02, 0x89, 0x01,
+  0x81, 0x81, 0x8e, 0x02, 0x8d, 0x46, 0x76, 0x81, 0x8e, 0x02, 0x79, 0x45, 0x89, 0x81, 0x8e, 0x01,
+  0x5a, 0x66, 0x84, 0x8e, 0x02, 0x83, 0x14, 0x01, 0xc0, 0x00, 0x04, 0x01, 0x15, 0x8e, 0x6e, 0x28,
+  0x84, 0x8e, 0x02, 0x78, 0x15, 0x8d, 0x81, 0x8e, 0x02, 0x89, 0x0c, 0x80, 0x81, 0x8e, 0x02, 0x76,
+  0x49, 0x8a, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x84, 0x8e, 0x02, 0x8d, 0x1f, 0x01, 0xc0, 0x00, 0x81,
+  0x01, 0x02, 0x78, 0x4f, 0x67, 0x84, 0x8e, 0x01, 0x68, 0x56, 0x82, 0x8e, 0x02, 0x81, 0x01, 0x89,
+  0x81, 0x8e, 0x02, 0x72, 0x4b, 0x8b, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xc1, 0x00, 0x03, 0x01, 0x56, 0x3c, 0x7d, 0x84, 0x8e, 0x01, 0x5e, 0x64, 0x82, 0x8e, 0x01, 0x74,
+  0x01, 0x82, 0x8e, 0x02, 0x6e, 0x4f, 0x8d, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xc1, 0x00, 0x03, 0x01, 0x0a, 0x3c, 0x87, 0x83, 0x8e, 0x02, 0x8d, 0x4f, 0x6f, 0x82, 0x8e,
+  0x01, 0x67, 0x4c, 0x82, 0x8e, 0x01, 0x69, 0x51, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01,
+  0x1f, 0x01, 0xc1, 0x00, 0x81, 0x01, 0x01, 0x46, 0x8d, 0x83, 0x8e, 0x02, 0x8a, 0x0b, 0x7d, 0x82,
+  0x8e, 0x01, 0x57, 0x62, 0x82, 0x8e, 0x01, 0x64, 0x56, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e,
+  0x01, 0x1f, 0x01, 0xc2, 0x00, 0x01, 0x01, 0x49, 0x84, 0x8e, 0x02, 0x7c, 0x01, 0x8a, 0x82, 0x8e,
+  0x01, 0x45, 0x6e, 0x82, 0x8e, 0x01, 0x61, 0x59, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01,
+  0x1f, 0x01, 0xc2, 0x00, 0x01, 0x01, 0x49, 0x84, 0x8e, 0x01, 0x68, 0x4b, 0x82, 0x8e, 0x02, 0x8b,
+  0x3c, 0x78, 0x82, 0x8e, 0x01, 0x59, 0x5e, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xc2, 0x00, 0x02, 0x01, 0x41, 0x89, 0x83, 0x8e, 0x01, 0x4f, 0x67, 0x82, 0x8e, 0x02, 0x85,
+  0x3b, 0x83, 0x82, 0x8e, 0x01, 0x4f, 0x66, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xc2, 0x00, 0x02, 0x01, 0x14, 0x7c, 0x82, 0x8e, 0x02, 0x8a, 0x41, 0x76, 0x82, 0x8e, 0x02,
+  0x81, 0x41, 0x87, 0x82, 0x8e, 0x01, 0x3c, 0x6b, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01,
+  0x1f, 0x01, 0xc3, 0x00, 0x01, 0x01, 0x67, 0x82, 0x8e, 0x02, 0x84, 0x3c, 0x84, 0x82, 0x8e, 0x02,
+  0x78, 0x46, 0x8a, 0x82, 0x8e, 0x01, 0x01, 0x72, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01,
+  0x1f, 0x01, 0xc3, 0x00, 0x01, 0x01, 0x41, 0x82, 0x8e, 0x02, 0x79, 0x46, 0x8a, 0x82, 0x8e, 0x02,
+  0x6f, 0x4f, 0x8d, 0x81, 0x8e, 0x02, 0x8b, 0x01, 0x78, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e,
+  0x01, 0x1f, 0x01, 0xc3, 0x00, 0x81, 0x01, 0x00, 0x80, 0x81, 0x8e, 0x01, 0x6b, 0x4c, 0x83, 0x8e,
+  0x01, 0x67, 0x52, 0x82, 0x8e, 0x02, 0x87, 0x01, 0x7d, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e,
+  0x01, 0x1f, 0x01, 0xc4, 0x00, 0x01, 0x01, 0x6b, 0x81, 0x8e, 0x01, 0x59, 0x62, 0x83, 0x8e, 0x01,
+  0x5a, 0x61, 0x82, 0x8e, 0x02, 0x83, 0x01, 0x84, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01,
+  0x1f, 0x01, 0xc4, 0x00, 0x05, 0x01, 0x5a, 0x8e, 0x8d, 0x01, 0x75, 0x83, 0x8e, 0x01, 0x41, 0x6e,
+  0x82, 0x8e, 0x02, 0x7d, 0x01, 0x89, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xc4, 0x00, 0x05, 0x01, 0x28, 0x8b, 0x81, 0x01, 0x87, 0x82, 0x8e, 0x02, 0x8d, 0x01, 0x7c, 0x82,
+  0x8e, 0x02, 0x78, 0x01, 0x8d, 0x82, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc4,
+  0x00, 0x81, 0x01, 0x02, 0x76, 0x72, 0x46, 0x83, 0x8e, 0x02, 0x84, 0x01, 0x87, 0x82, 0x8e, 0x01,
+  0x72, 0x14, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc5, 0x00, 0x03, 0x01,
+  0x59, 0x64, 0x5c, 0x83, 0x8e, 0x02, 0x79, 0x02, 0x8d, 0x82, 0x8e, 0x01, 0x6c, 0x46, 0x83, 0x8e,
+  0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc5, 0x00, 0x03, 0x01, 0x32, 0x49, 0x67, 0x83,
+  0x8e, 0x01, 0x6e, 0x4c, 0x83, 0x8e, 0x01, 0x67, 0x51, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e,
+  0x01, 0x1f, 0x01, 0xc5, 0x00, 0x82, 0x01, 0x00, 0x6e, 0x83, 0x8e, 0x01, 0x64, 0x5c, 0x83, 0x8e,
+  0x01, 0x62, 0x5a, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc6, 0x00, 0x81,
+  0x01, 0x00, 0x75, 0x83, 0x8e, 0x01, 0x5e, 0x64, 0x83, 0x8e, 0x81, 0x5f, 0x83, 0x8e, 0x01, 0x5a,
+  0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc6, 0x00, 0x81, 0x01, 0x00, 0x78, 0x83, 0x8e, 0x01, 0x57,
+  0x6b, 0x83, 0x8e, 0x01, 0x5c, 0x64, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xc6, 0x00, 0x81, 0x01, 0x00, 0x78, 0x82, 0x8e, 0x02, 0x8d, 0x4b, 0x74, 0x83, 0x8e, 0x01, 0x59,
+  0x67, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc7, 0x00, 0x01, 0x01, 0x6e,
+  0x82, 0x8e, 0x02, 0x8b, 0x1f, 0x7d, 0x82, 0x8e, 0x02, 0x8d, 0x56, 0x69, 0x83, 0x8e, 0x01, 0x5a,
+  0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc7, 0x00, 0x01, 0x01, 0x5f, 0x82, 0x8e, 0x02, 0x84, 0x01,
+  0x85, 0x82, 0x8e, 0x02, 0x8d, 0x50, 0x6e, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f,
+  0x01, 0xc7, 0x00, 0x02, 0x01, 0x41, 0x8d, 0x81, 0x8e, 0x02, 0x78, 0x01, 0x8d, 0x82, 0x8e, 0x02,
+  0x8d, 0x49, 0x72, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc7, 0x00, 0x81,
+  0x01, 0x00, 0x7d, 0x81, 0x8e, 0x01, 0x6b, 0x41, 0x83, 0x8e, 0x02, 0x8b, 0x41, 0x76, 0x83, 0x8e,
+  0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc8, 0x00, 0x01, 0x01, 0x62, 0x81, 0x8e, 0x01,
+  0x5e, 0x5c, 0x83, 0x8e, 0x02, 0x8a, 0x28, 0x79, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01,
+  0x1f, 0x01, 0xc8, 0x00, 0x05, 0x01, 0x4b, 0x8d, 0x8e, 0x49, 0x69, 0x83, 0x8e, 0x02, 0x89, 0x01,
+  0x80, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc8, 0x00, 0x05, 0x01, 0x28,
+  0x84, 0x8d, 0x41, 0x75, 0x83, 0x8e, 0x02, 0x84, 0x01, 0x84, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85,
+  0x8e, 0x01, 0x1f, 0x01, 0xc9, 0x00, 0x04, 0x01, 0x72, 0x89, 0x3c, 0x81, 0x83, 0x8e, 0x02, 0x80,
+  0x01, 0x87, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc9, 0x00, 0x04, 0x01,
+  0x56, 0x83, 0x3c, 0x85, 0x83, 0x8e, 0x02, 0x78, 0x01, 0x8a, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85,
+  0x8e, 0x01, 0x1f, 0x01, 0xc9, 0x00, 0x81, 0x01, 0x02, 0x6f, 0x45, 0x89, 0x83, 0x8e, 0x02, 0x72,
+  0x01, 0x8d, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xc9, 0x00, 0x81, 0x01,
+  0x81, 0x4b, 0x00, 0x8d, 0x83, 0x8e, 0x01, 0x6c, 0x27, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e,
+  0x01, 0x1f, 0x01, 0xca, 0x00, 0x81, 0x01, 0x00, 0x4f, 0x84, 0x8e, 0x01, 0x66, 0x45, 0x84, 0x8e,
+  0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xca, 0x00, 0x81, 0x01, 0x00, 0x50, 0x84, 0x8e,
+  0x01, 0x5e, 0x56, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xca, 0x00, 0x81,
+  0x01, 0x01, 0x45, 0x85, 0x83, 0x8e, 0x01, 0x52, 0x5f, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e,
+  0x01, 0x1f, 0x01, 0xcb, 0x00, 0x04, 0x01, 0x02, 0x41, 0x6f, 0x8d, 0x81, 0x8e, 0x01, 0x49, 0x66,
+  0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xcd, 0x00, 0x81, 0x01, 0x04, 0x57,
+  0x79, 0x8e, 0x3c, 0x6c, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xce, 0x00,
+  0x82, 0x01, 0x02, 0x5a, 0x27, 0x72, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xd0, 0x00, 0x82, 0x01, 0x00, 0x78, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xd1, 0x00, 0x81, 0x01, 0x00, 0x7c, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xd2, 0x00, 0x01, 0x01, 0x76, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xd2,
+  0x00, 0x01, 0x01, 0x62, 0x84, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xd2, 0x00,
+  0x81, 0x01, 0x00, 0x72, 0x83, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xd3, 0x00,
+  0x81, 0x01, 0x01, 0x5c, 0x83, 0x81, 0x8e, 0x01, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xd4,
+  0x00, 0x81, 0x01, 0x04, 0x33, 0x64, 0x8a, 0x5a, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xd6, 0x00,
+  0x81, 0x01, 0x02, 0x45, 0x41, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xd7, 0x00, 0x82, 0x01, 0x00,
+  0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xd9, 0x00, 0x01, 0x01, 0x66, 0x85, 0x8e, 0x01, 0x1f, 0x01,
+  0xd9, 0x00, 0x01, 0x01, 0x61, 0x85, 0x8e, 0x01, 0x1f, 0x01, 0xd9, 0x00, 0x02, 0x01, 0x41, 0x85,
+  0x84, 0x8e, 0x01, 0x1f, 0x01, 0xd9, 0x00, 0x81, 0x01, 0x02, 0x3c, 0x6c, 0x8d, 0x81, 0x8e, 0x02,
+  0x8d, 0x1f, 0x01, 0xdb, 0x00, 0x81, 0x01, 0x05, 0x52, 0x78, 0x8e, 0x7d, 0x14, 0x01, 0xdc, 0x00,
+  0x82, 0x01, 0x02, 0x33, 0x0b, 0x01, 0xdf, 0x00, 0x82, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0xd8, 0x00,
+};
+
+IMAGE_ASSET_DECLARE(AstonLogo);
+const ImageAsset AstonLogo_asset = {
+  .name = "AstonLogo",
+  .data = AstonLogo_rle,
+  .data_size = sizeof(AstonLogo_rle),
+  .raw_size = 90000,
+  .crc32 = 0x1f964456,
+  .w = 100,
+  .h = 300,
+  .codec = IMAGE_CODEC_RLE_PALETTE,
+};
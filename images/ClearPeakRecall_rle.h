@@ -0,0 +1,124 @@
+// Generated by tools/compress_images.py from images/ClearPeakRecall.h - do not edit.
+// 44x48 RGB565A8, planar RLE: 6336 -> 1674 bytes. Decoded on first use by ImageCache.
+#pragma once
+#include "../ImageCodec.h"
+
+static const uint8_t ClearPeakRecall_rle[] = {
+  0x97, 0x00, 0x00, 0x00, 0x63, 0x00, 0x81, 0x00, 0x00, 0x00, 0x43, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x25, 0x10, 0xff, 0x00, 0x00, 0x84, 0x00, 0x00, 0x01, 0x2c, 0x76, 0x2f, 0x87, 0xa9, 0x00, 0x00,
+  0x01, 0xa5, 0x32, 0x4c, 0x7e, 0x8e, 0x00, 0x00, 0x02, 0x00, 0x28, 0x00, 0x00, 0x00, 0x20, 0x97,
+  0x00, 0x00, 0x01, 0xa4, 0x32, 0x4c, 0x7e, 0x8a, 0x00, 0x00, 0x00, 0xa0, 0x98, 0x89, 0xe0, 0xe9,
+  0x00, 0xa0, 0xa0, 0x92, 0x00, 0x00, 0x01, 0xa4, 0x32, 0x4c, 0x86, 0x87, 0x00, 0x00, 0x00, 0x20,
+  0x50, 0x89, 0xe0, 0xe9, 0x01, 0x01, 0xea, 0x02, 0xea, 0x82, 0xe0, 0xe9, 0x01, 0xc0, 0xe9, 0x40,
+  0x58, 0x8f, 0x00, 0x00, 0x02, 0xa4, 0x3a, 0x6e, 0xa7, 0xcd, 0x96, 0x81, 0xce, 0x96, 0x01, 0xaf,
+  0x96, 0xaf, 0x8e, 0x81, 0x90, 0x8e, 0x00, 0xe6, 0xe2, 0x8a, 0x01, 0xea, 0x02, 0x02, 0xea, 0xe1,
+  0xe9, 0x02, 0xea, 0x83, 0xe0, 0xe9, 0x01, 0x80, 0xe1, 0x00, 0x20, 0x8d, 0x00, 0x00, 0x01, 0xa4,
+  0x3a, 0x4b, 0x8e, 0x84, 0x20, 0x00, 0x00, 0x60, 0x80, 0x85, 0xe0, 0xe9, 0x01, 0xe0, 0xb8, 0x20,
+  0x50, 0x85, 0x00, 0x00, 0x03, 0x20, 0x50, 0x66, 0xb1, 0x02, 0xf2, 0xe1, 0xe9, 0x83, 0xe0, 0xe9,
+  0x00, 0x60, 0x88, 0x8c, 0x00, 0x00, 0x01, 0xa4, 0x3a, 0x4b, 0x96, 0x83, 0x00, 0x00, 0x00, 0xa0,
+  0xa8, 0x83, 0xe0, 0xe9, 0x01, 0xc0, 0xe1, 0x40, 0x60, 0x8a, 0x00, 0x00, 0x02, 0xe5, 0x18, 0x16,
+  0x9c, 0xe4, 0xe9, 0x83, 0xe0, 0xe9, 0x00, 0xa0, 0xa8, 0x8b, 0x00, 0x00, 0x01, 0xa4, 0x3a, 0x4b,
+  0x96, 0x82, 0x00, 0x00, 0x00, 0xa0, 0xa8, 0x83, 0xe0, 0xe9, 0x00, 0x60, 0x80, 0x8b, 0x00, 0x00,
+  0x04, 0x62, 0x08, 0xb3, 0x7b, 0xf5, 0x7b, 0x00, 0x00, 0x60, 0x78, 0x82, 0xe0, 0xe9, 0x01, 0xe0,
+  0xf1, 0xc0, 0xb8, 0x8a, 0x00, 0x00, 0x05, 0xa4, 0x42, 0x2c, 0xaf, 0x0a, 0x96, 0xea, 0x95, 0x88,
+  0xbc, 0x01, 0xea, 0x82, 0x00, 0xea, 0x0f, 0x6d, 0x95, 0x8e, 0x8d, 0x6e, 0x8d, 0x6f, 0x8d, 0x4f,
+  0x8d, 0x2f, 0x8d, 0x10, 0x8d, 0xf0, 0x84, 0xd1, 0x84, 0xb1, 0x84, 0x92, 0x84, 0x72, 0x84, 0x52,
+  0x84, 0xc8, 0x39, 0x54, 0x8c, 0x71, 0x73, 0x83, 0x00, 0x00, 0x83, 0xe0, 0xe9, 0x00, 0xa0, 0xa0,
+  0x89, 0x00, 0x00, 0x03, 0xa4, 0x42, 0x8b, 0xa6, 0x85, 0x53, 0x05, 0x83, 0x82, 0x00, 0xea, 0x81,
+  0xe0, 0xe9, 0x00, 0x44, 0xba, 0x81, 0x28, 0x53, 0x81, 0x08, 0x53, 0x81, 0xe9, 0x52, 0x81, 0xc9,
+  0x4a, 0x81, 0xaa, 0x4a, 0x03, 0x8a, 0x4a, 0x94, 0x94, 0xd5, 0x9c, 0xed, 0x62, 0x85, 0x00, 0x00,
+  0x83, 0xe0, 0xe9, 0x00, 0x40, 0x70, 0x88, 0x00, 0x00, 0x02, 0xa3, 0x42, 0x4a, 0xa6, 0x00, 0x00,
+  0x86, 0xe0, 0xe9, 0x00, 0xc0, 0xb8, 0x89, 0x00, 0x00, 0x01, 0x4e, 0x6b, 0x2a, 0x4a, 0x87, 0x00,
+  0x00, 0x83, 0xe0, 0xe9, 0x88, 0x00, 0x00, 0x02, 0xa3, 0x42, 0x49, 0xa6, 0xe0, 0xc0, 0x87, 0xe0,
+  0xe9, 0x00, 0xc0, 0xb8, 0x81, 0x00, 0x00, 0x01, 0x87, 0x4a, 0xae, 0x8c, 0x8e, 0x00, 0x00, 0x00,
+  0x00, 0x20, 0x82, 0xe0, 0xe9, 0x00, 0xe0, 0xb8, 0x87, 0x00, 0x00, 0x01, 0xa3, 0x42, 0xaa, 0xb6,
+  0x82, 0x00, 0xea, 0x02, 0x45, 0xab, 0x07, 0x74, 0xe0, 0xe9, 0x83, 0x00, 0xea, 0x05, 0x65, 0xca,
+  0xa9, 0x73, 0x6c, 0x8c, 0xd1, 0xb5, 0x30, 0xa5, 0xa5, 0x31, 0x8d, 0x00, 0x00, 0x00, 0x80, 0x98,
+  0x82, 0xe0, 0xe9, 0x87, 0x00, 0x00, 0x01, 0x83, 0x4a, 0x66, 0xdc, 0x82, 0x00, 0xea, 0x00, 0x29,
+  0x95, 0x81, 0x09, 0x95, 0x84, 0x00, 0xea, 0x05, 0xe7, 0xd2, 0x6c, 0x8c, 0x29, 0x63, 0x4a, 0x6b,
+  0x51, 0xb5, 0x68, 0x52, 0x8d, 0x00, 0x00, 0x82, 0xe0, 0xe9, 0x00, 0x00, 0xc1, 0x86, 0x00, 0x00,
+  0x01, 0x83, 0x4a, 0x00, 0xf2, 0x81, 0xe0, 0xe9, 0x00, 0x80, 0x90, 0x83, 0x00, 0x00, 0x84, 0xe0,
+  0xe9, 0x00, 0x20, 0xd1, 0x81, 0x00, 0x00, 0x02, 0x67, 0x52, 0x11, 0xb5, 0x2b, 0x73, 0x8c, 0x00,
+  0x00, 0x00, 0x80, 0x90, 0x82, 0xe0, 0xe9, 0x86, 0x00, 0x00, 0x01, 0x82, 0x5a, 0x00, 0xf2, 0x81,
+  0xe0, 0xe9, 0x85, 0x00, 0x00, 0x84, 0xe0, 0xe9, 0x00, 0x40, 0xd1, 0x81, 0x00, 0x00, 0x01, 0xcc,
+  0x93, 0xb0, 0xb4, 0x8d, 0x00, 0x00, 0x82, 0xe0, 0xe9, 0x00, 0x20, 0x38, 0x85, 0x00, 0x00, 0x01,
+  0x01, 0xaa, 0x00, 0xf2, 0x81, 0xe0, 0xe9, 0x86, 0x00, 0x00, 0x00, 0xc0, 0xe9, 0x83, 0xe0, 0xe9,
+  0x02, 0x60, 0xd1, 0x6d, 0xa4, 0x6e, 0xac, 0x8e, 0x00, 0x00, 0x82, 0xe0, 0xe9, 0x00, 0xa0, 0xa0,
+  0x85, 0x00, 0x00, 0x00, 0xe0, 0xe9, 0x81, 0x00, 0xf2, 0x0e, 0xe6, 0xdc, 0x69, 0xce, 0x69, 0xc6,
+  0x4a, 0xc6, 0x4a, 0xce, 0x2b, 0xc6, 0x0b, 0xc6, 0xeb, 0xc5, 0xcc, 0xc5, 0x63, 0xea, 0x00, 0xf2,
+  0x01, 0xf2, 0x00, 0xf2, 0x01, 0xf2, 0x24, 0xda, 0x8f, 0x00, 0x00, 0x00, 0xc0, 0xa8, 0x82, 0xe0,
+  0xe9, 0x85, 0x00, 0x00, 0x03, 0xe0, 0xf1, 0x00, 0xf2, 0xe0, 0xe9, 0x20, 0x58, 0x88, 0x00, 0x00,
+  0x02, 0xa0, 0xe1, 0xe0, 0xe9, 0x01, 0xf2, 0x81, 0xe0, 0xe9, 0x00, 0x60, 0xd9, 0x8e, 0x00, 0x00,
+  0x00, 0x40, 0x70, 0x82, 0xe0, 0xe9, 0x85, 0x00, 0x00, 0x03, 0xe0, 0xf1, 0x00, 0xf2, 0xe0, 0xe9,
+  0x00, 0x10, 0x89, 0x00, 0x00, 0x00, 0xa0, 0xe1, 0x83, 0xe0, 0xe9, 0x00, 0xa0, 0xe1, 0x8e, 0x00,
+  0x00, 0x81, 0xe0, 0xe9, 0x00, 0xe0, 0xf1, 0x85, 0x00, 0x00, 0x02, 0xe0, 0xe9, 0x00, 0xf2, 0xe0,
+  0xe9, 0x8b, 0x00, 0x00, 0x00, 0x60, 0xd9, 0x83, 0xe0, 0xe9, 0x00, 0xc0, 0xe1, 0x88, 0x00, 0x00,
+  0x01, 0xd2, 0xca, 0xcd, 0x91, 0x81, 0x00, 0x00, 0x00, 0x00, 0x28, 0x82, 0xe0, 0xe9, 0x85, 0x00,
+  0x00, 0x00, 0xe0, 0xe9, 0x81, 0x00, 0xf2, 0x81, 0x07, 0xce, 0x0c, 0xe7, 0xcd, 0xc7, 0xcd, 0xa8,
+  0xcd, 0xa8, 0xc5, 0x88, 0xc5, 0x69, 0xc5, 0x49, 0xc5, 0x29, 0xc5, 0x0a, 0xc5, 0xea, 0xc4, 0xcb,
+  0xc4, 0x85, 0xe2, 0x01, 0xf2, 0x82, 0x00, 0xf2, 0x0b, 0x02, 0xea, 0xad, 0xc3, 0x8d, 0xc3, 0x4e,
+  0xc3, 0x2e, 0xc3, 0x0e, 0xc3, 0xcf, 0xba, 0xaf, 0xba, 0x90, 0xba, 0xb2, 0xca, 0x0f, 0xaa, 0xef,
+  0xa9, 0x81, 0x00, 0x00, 0x82, 0xe0, 0xe9, 0x85, 0x00, 0x00, 0x04, 0xe0, 0xe9, 0x00, 0xf2, 0xe0,
+  0xe9, 0x42, 0x62, 0x62, 0x52, 0x82, 0x42, 0x52, 0x00, 0x22, 0x52, 0x81, 0x23, 0x52, 0x82, 0x03,
+  0x52, 0x00, 0xe3, 0x51, 0x81, 0xc4, 0x51, 0x00, 0x61, 0xd1, 0x84, 0xe0, 0xe9, 0x81, 0x45, 0x49,
+  0x00, 0x25, 0x49, 0x81, 0x05, 0x49, 0x81, 0xe6, 0x48, 0x04, 0xa5, 0x38, 0x00, 0x00, 0x8d, 0x91,
+  0xf1, 0xb9, 0x85, 0x58, 0x81, 0xe0, 0xe9, 0x00, 0xe0, 0xf1, 0x85, 0x00, 0x00, 0x03, 0xe0, 0xf1,
+  0x00, 0xf2, 0xe0, 0xe9, 0x60, 0x80, 0x8d, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x84, 0xe0, 0xe9, 0x88,
+  0x00, 0x00, 0x01, 0x0a, 0x71, 0x8e, 0xd1, 0x82, 0xe0, 0xe9, 0x85, 0x00, 0x00, 0x03, 0xc0, 0xc9,
+  0x00, 0xf2, 0xe0, 0xe9, 0x80, 0xd9, 0x8e, 0x00, 0x00, 0x01, 0x00, 0xc9, 0xe0, 0xf1, 0x83, 0xe0,
+  0xe9, 0x86, 0x00, 0x00, 0x02, 0x01, 0x10, 0x8d, 0xa9, 0xa5, 0xe9, 0x81, 0xe0, 0xe9, 0x00, 0x00,
+  0xc1, 0x85, 0x00, 0x00, 0x00, 0x41, 0x7a, 0x82, 0x00, 0xf2, 0x81, 0x64, 0xa4, 0x81, 0x44, 0xa4,
+  0x00, 0x24, 0x9c, 0x81, 0x05, 0x9c, 0x09, 0xe5, 0x9b, 0xc5, 0x9b, 0xa6, 0x9b, 0x86, 0x9b, 0x66,
+  0x9b, 0x46, 0x9b, 0x27, 0x9b, 0x07, 0x9b, 0xe7, 0x9a, 0xe4, 0xd1, 0x84, 0xe0, 0xe9, 0x08, 0x09,
+  0x9a, 0xe9, 0x99, 0xc9, 0x99, 0xaa, 0x99, 0x69, 0x89, 0x64, 0x38, 0xce, 0xc1, 0x6c, 0xa1, 0xe0,
+  0xf1, 0x81, 0xe0, 0xe9, 0x00, 0x40, 0x60, 0x85, 0x00, 0x00, 0x00, 0x61, 0x52, 0x82, 0x00, 0xf2,
+  0x00, 0x23, 0xac, 0x81, 0x64, 0xa4, 0x01, 0x44, 0xa4, 0x24, 0xa4, 0x81, 0x05, 0xa4, 0x0b, 0xe5,
+  0xa3, 0xc5, 0xa3, 0xa5, 0xa3, 0x86, 0xa3, 0x66, 0xa3, 0x46, 0xa3, 0x26, 0xa3, 0x07, 0xa3, 0xe7,
+  0xa2, 0xc7, 0x9a, 0xe4, 0xd1, 0xe0, 0xf1, 0x83, 0xe0, 0xe9, 0x06, 0xe9, 0x99, 0xc9, 0x99, 0xaa,
+  0x99, 0x6f, 0xe2, 0x0e, 0xd2, 0x29, 0x89, 0x20, 0x50, 0x82, 0xe0, 0xe9, 0x86, 0x00, 0x00, 0x01,
+  0x61, 0x52, 0x40, 0xea, 0x81, 0xe0, 0xe9, 0x00, 0xa0, 0xe1, 0x90, 0x00, 0x00, 0x00, 0xe0, 0xb8,
+  0x84, 0xe0, 0xe9, 0x05, 0x00, 0x10, 0x00, 0x00, 0x0c, 0xc2, 0xe6, 0x68, 0x00, 0x00, 0xa0, 0xe1,
+  0x81, 0xe0, 0xe9, 0x00, 0xc0, 0xe9, 0x86, 0x00, 0x00, 0x01, 0x61, 0x52, 0x43, 0xd5, 0x82, 0xe0,
+  0xe9, 0x00, 0x40, 0x58, 0x84, 0x00, 0x00, 0x00, 0xa4, 0x9b, 0x8a, 0x00, 0x00, 0x00, 0xe0, 0xb8,
+  0x84, 0xe0, 0xe9, 0x00, 0x20, 0x30, 0x81, 0x00, 0x00, 0x00, 0x20, 0x58, 0x82, 0xe0, 0xe9, 0x00,
+  0x20, 0x60, 0x86, 0x00, 0x00, 0x01, 0x61, 0x5a, 0xe3, 0xd5, 0x83, 0xe0, 0xe9, 0x82, 0xe1, 0x49,
+  0x81, 0xc1, 0x49, 0x02, 0x86, 0xed, 0xe6, 0xdc, 0xc1, 0x59, 0x89, 0x00, 0x00, 0x01, 0xc0, 0xb0,
+  0xe0, 0xf1, 0x83, 0xe0, 0xe9, 0x01, 0x20, 0x40, 0x00, 0x00, 0x83, 0xe0, 0xe9, 0x87, 0x00, 0x00,
+  0x02, 0x61, 0x5a, 0xa4, 0xf6, 0xa3, 0xd5, 0x82, 0x00, 0xf2, 0x08, 0x82, 0xe3, 0x64, 0xd5, 0x44,
+  0xd5, 0x24, 0xd5, 0x05, 0xd5, 0x84, 0xc4, 0xc3, 0x7a, 0xe6, 0xe4, 0x83, 0x7a, 0x89, 0x00, 0x00,
+  0x00, 0xa0, 0xb0, 0x83, 0xe0, 0xe9, 0x01, 0xe0, 0xf1, 0xc0, 0xe1, 0x82, 0xe0, 0xe9, 0x00, 0x20,
+  0x40, 0x87, 0x00, 0x00, 0x04, 0x60, 0x5a, 0xc3, 0xd5, 0x00, 0x00, 0xe0, 0xb8, 0xe0, 0xf1, 0x81,
+  0xe0, 0xe9, 0x00, 0x80, 0xa0, 0x84, 0x00, 0x00, 0x02, 0xc1, 0x59, 0x85, 0xdc, 0x23, 0xa3, 0x89,
+  0x00, 0x00, 0x00, 0xa0, 0xa8, 0x86, 0xe0, 0xe9, 0x00, 0xc0, 0xb8, 0x88, 0x00, 0x00, 0x01, 0x60,
+  0x5a, 0xa2, 0xd5, 0x81, 0x00, 0x00, 0x00, 0xc0, 0xe9, 0x82, 0xe0, 0xe9, 0x00, 0xa0, 0xa8, 0x84,
+  0x00, 0x00, 0x02, 0xa1, 0x51, 0xc6, 0xf4, 0x02, 0x6a, 0x89, 0x00, 0x00, 0x00, 0xa0, 0xa0, 0x84,
+  0xe0, 0xe9, 0x00, 0xc0, 0xe9, 0x89, 0x00, 0x00, 0x01, 0x60, 0x5a, 0xa2, 0xd5, 0x82, 0x00, 0x00,
+  0x83, 0xe0, 0xe9, 0x00, 0x20, 0xc9, 0x82, 0x00, 0x00, 0x02, 0x21, 0x6a, 0x85, 0xe4, 0xc3, 0x92,
+  0x8b, 0x00, 0x00, 0x84, 0xe0, 0xe9, 0x8a, 0x00, 0x00, 0x05, 0x60, 0x5a, 0xa3, 0xf6, 0x02, 0xe6,
+  0xe2, 0xe5, 0xe3, 0xe5, 0xc3, 0xe5, 0x84, 0x00, 0xf2, 0x03, 0xe2, 0xdb, 0x02, 0x93, 0xc4, 0xe4,
+  0x21, 0x6a, 0x8a, 0x00, 0x00, 0x00, 0x60, 0x88, 0x84, 0xe0, 0xe9, 0x8b, 0x00, 0x00, 0x01, 0x60,
+  0x5a, 0xa2, 0xd5, 0x84, 0x00, 0x00, 0x00, 0x60, 0xd9, 0x82, 0xe0, 0xe9, 0x81, 0x00, 0xf2, 0x00,
+  0x40, 0xa1, 0x89, 0x00, 0x00, 0x00, 0xa0, 0xa0, 0x84, 0xe0, 0xe9, 0x00, 0x80, 0xe1, 0x8c, 0x00,
+  0x00, 0x01, 0x60, 0x5a, 0xa1, 0xd5, 0x85, 0x00, 0x00, 0x00, 0x80, 0xa0, 0x87, 0xe0, 0xe9, 0x03,
+  0x80, 0xd9, 0x20, 0xc1, 0x00, 0xc1, 0x80, 0xd9, 0x87, 0xe0, 0xe9, 0x00, 0xa0, 0xa0, 0x8d, 0x00,
+  0x00, 0x01, 0x40, 0x5a, 0xa1, 0xd5, 0x87, 0x00, 0x00, 0x00, 0x60, 0xd9, 0x8f, 0xe0, 0xe9, 0x00,
+  0x20, 0xd1, 0x8f, 0x00, 0x00, 0x01, 0x40, 0x5a, 0xa1, 0xd5, 0x88, 0x00, 0x00, 0x01, 0x00, 0x20,
+  0xc0, 0xb0, 0x8a, 0xe0, 0xe9, 0x01, 0xe0, 0xf1, 0xe0, 0xb8, 0x91, 0x00, 0x00, 0x01, 0x40, 0x5a,
+  0xa1, 0xd5, 0x8c, 0x00, 0x00, 0x02, 0x40, 0x68, 0x80, 0x90, 0x20, 0xc9, 0x81, 0xc0, 0xe1, 0x02,
+  0x20, 0xc9, 0xa0, 0x90, 0x40, 0x68, 0x94, 0x00, 0x00, 0x01, 0xa0, 0x41, 0xa1, 0xb4, 0xff, 0x00,
+  0x00, 0xac, 0x00, 0x00, 0xaa, 0xff, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff,
+};
+
+IMAGE_ASSET_DECLARE(ClearPeakRecall);
+const ImageAsset ClearPeakRecall_asset = {
+  .name = "ClearPeakRecall",
+  .data = ClearPeakRecall_rle,
+  .data_size = sizeof(ClearPeakRecall_rle),
+  .raw_size = 6336,
+  .crc32 = 0x5200e7d3,
+  .w = 44,
+  .h = 48,
+  .codec = IMAGE_CODEC_RLE_PLANAR,
+};
@@ -0,0 +1,77 @@
+// Generated by tools/compress_images.py from images/CruiseControl.h - do not edit.
+// 48x48 RGB565A8, palette + RLE: 6912 -> 923 bytes. Decoded on first use by ImageCache.
+#pragma once
+#include "../ImageCodec.h"
+
+static const uint8_t CruiseControl_rle[] = {
+  0x41, 0x00, 0x00, 0xa3, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x08, 0xff,
+  0x40, 0x08, 0xff, 0x60, 0x08, 0xff, 0x80, 0x08, 0xff, 0xa0, 0x10, 0xff, 0xc0, 0x10, 0xff, 0x20,
+  0x21, 0xff, 0x60, 0x21, 0xff, 0x60, 0x29, 0xff, 0xa0, 0x29, 0xff, 0xc0, 0x29, 0xff, 0xc0, 0x31,
+  0xff, 0xe0, 0x31, 0xff, 0x00, 0x32, 0xff, 0x40, 0x3a, 0xff, 0x60, 0x42, 0xff, 0x80, 0x42, 0xff,
+  0xa0, 0x42, 0xff, 0xc0, 0x4a, 0xff, 0xe0, 0x4a, 0xff, 0x00, 0x4b, 0xff, 0x20, 0x53, 0xff, 0x40,
+  0x53, 0xff, 0x60, 0x5b, 0xff, 0x80, 0x5b, 0xff, 0xa0, 0x5b, 0xff, 0xc0, 0x63, 0xff, 0xe0, 0x63,
+  0xff, 0x20, 0x6c, 0xff, 0x40, 0x74, 0xff, 0x60, 0x74, 0xff, 0x80, 0x74, 0xff, 0xa0, 0x7c, 0xff,
+  0xc0, 0x7c, 0xff, 0xe0, 0x7c, 0xff, 0x00, 0x85, 0xff, 0x20, 0x85, 0xff, 0x40, 0x85, 0xff, 0x40,
+  0x8d, 0xff, 0x60, 0x8d, 0xff, 0x80, 0x8d, 0xff, 0xa0, 0x95, 0xff, 0xc0, 0x95, 0xff, 0xe0, 0x95,
+  0xff, 0xe0, 0x9d, 0xff, 0x00, 0x9e, 0xff, 0x20, 0x9e, 0xff, 0x40, 0xa6, 0xff, 0x60, 0xa6, 0xff,
+  0x80, 0xa6, 0xff, 0x80, 0xae, 0xff, 0xa0, 0xae, 0xff, 0xc0, 0xae, 0xff, 0xe0, 0xb6, 0xff, 0x00,
+  0xb7, 0xff, 0x40, 0xbf, 0xff, 0x60, 0xbf, 0xff, 0x80, 0xc7, 0xff, 0xa0, 0xc7, 0xff, 0xc0, 0xc7,
+  0xff, 0xc0, 0xcf, 0xff, 0xe0, 0xcf, 0xff, 0x00, 0x00, 0xad, 0x02, 0x00, 0x01, 0xff, 0x02, 0xfc,
+  0x02, 0x09, 0x16, 0x26, 0x30, 0x34, 0x36, 0x37, 0x34, 0x32, 0x27, 0x19, 0xa2, 0x02, 0x02, 0x11,
+  0x2c, 0x3b, 0x89, 0x41, 0x02, 0x3d, 0x2e, 0x15, 0x9d, 0x02, 0x02, 0x0f, 0x2d, 0x3f, 0x8e, 0x41,
+  0x01, 0x32, 0x13, 0x9a, 0x02, 0x01, 0x1f, 0x3c, 0x83, 0x41, 0x03, 0x38, 0x29, 0x1f, 0x34, 0x81,
+  0x41, 0x04, 0x0b, 0x1d, 0x27, 0x35, 0x3f, 0x82, 0x41, 0x01, 0x3e, 0x24, 0x98, 0x02, 0x00, 0x29,
+  0x82, 0x41, 0x02, 0x3f, 0x2d, 0x14, 0x82, 0x02, 0x00, 0x34, 0x81, 0x41, 0x00, 0x0b, 0x82, 0x02,
+  0x02, 0x0f, 0x29, 0x3d, 0x82, 0x41, 0x00, 0x31, 0x96, 0x02, 0x00, 0x2a, 0x82, 0x41, 0x01, 0x37,
+  0x14, 0x84, 0x02, 0x00, 0x32, 0x81, 0x41, 0x00, 0x0a, 0x84, 0x02, 0x01, 0x10, 0x31, 0x82, 0x41,
+  0x00, 0x34, 0x85, 0x02, 0x04, 0x2a, 0x0d, 0x02, 0x0d, 0x1c, 0x89, 0x02, 0x00, 0x20, 0x82, 0x41,
+  0x00, 0x32, 0x86, 0x02, 0x02, 0x10, 0x20, 0x1a, 0x86, 0x02, 0x01, 0x05, 0x39, 0x82, 0x41, 0x00,
+  0x31, 0x83, 0x02, 0x06, 0x0d, 0x3e, 0x2e, 0x33, 0x3f, 0x3e, 0x08, 0x88, 0x02, 0x01, 0x05, 0x34,
+  0x81, 0x41, 0x01, 0x40, 0x20, 0x8e, 0x02, 0x01, 0x05, 0x34, 0x84, 0x41, 0x00, 0x25, 0x82, 0x02,
+  0x00, 0x28, 0x84, 0x41, 0x00, 0x24, 0x89, 0x02, 0x01, 0x05, 0x34, 0x81, 0x41, 0x01, 0x40, 0x06,
+  0x8d, 0x02, 0x00, 0x2d, 0x81, 0x41, 0x01, 0x40, 0x2d, 0x81, 0x41, 0x01, 0x3f, 0x14, 0x81, 0x02,
+  0x00, 0x3c, 0x84, 0x41, 0x00, 0x38, 0x8a, 0x02, 0x03, 0x05, 0x34, 0x41, 0x36, 0x8e, 0x02, 0x05,
+  0x1e, 0x41, 0x40, 0x20, 0x02, 0x30, 0x81, 0x41, 0x02, 0x34, 0x02, 0x21, 0x86, 0x41, 0x00, 0x14,
+  0x8a, 0x02, 0x02, 0x05, 0x20, 0x05, 0x8f, 0x02, 0x01, 0x17, 0x1b, 0x81, 0x02, 0x01, 0x0e, 0x3c,
+  0x81, 0x41, 0x01, 0x19, 0x39, 0x85, 0x41, 0x01, 0x40, 0x22, 0xa2, 0x02, 0x00, 0x27, 0x81, 0x41,
+  0x02, 0x31, 0x1c, 0x35, 0x82, 0x41, 0x02, 0x3b, 0x28, 0x10, 0x9f, 0x02, 0x00, 0x13, 0x82, 0x02,
+  0x09, 0x09, 0x3e, 0x41, 0x3e, 0x03, 0x02, 0x15, 0x30, 0x3f, 0x36, 0x9e, 0x02, 0x04, 0x14, 0x2c,
+  0x3c, 0x41, 0x1c, 0x82, 0x02, 0x00, 0x32, 0x81, 0x41, 0x00, 0x1e, 0x82, 0x02, 0x02, 0x10, 0x27,
+  0x04, 0x9a, 0x02, 0x02, 0x04, 0x23, 0x37, 0x83, 0x41, 0x00, 0x2b, 0x82, 0x02, 0x00, 0x23, 0x81,
+  0x41, 0x00, 0x2c, 0x9b, 0x02, 0x05, 0x11, 0x25, 0x1e, 0x17, 0x2e, 0x3d, 0x84, 0x41, 0x01, 0x36,
+  0x1a, 0x82, 0x02, 0x00, 0x15, 0x81, 0x41, 0x00, 0x34, 0x9a, 0x02, 0x01, 0x18, 0x3d, 0x86, 0x41,
+  0x02, 0x3b, 0x2b, 0x12, 0x81, 0x02, 0x00, 0x10, 0x82, 0x28, 0x81, 0x41, 0x00, 0x3a, 0x9a, 0x02,
+  0x00, 0x31, 0x84, 0x41, 0x02, 0x3f, 0x33, 0x1e, 0x84, 0x02, 0x00, 0x2f, 0x84, 0x41, 0x00, 0x3b,
+  0x9a, 0x02, 0x00, 0x31, 0x83, 0x41, 0x01, 0x27, 0x0f, 0x86, 0x02, 0x00, 0x2f, 0x84, 0x41, 0x00,
+  0x3b, 0x9a, 0x02, 0x01, 0x18, 0x3d, 0x81, 0x41, 0x00, 0x31, 0x88, 0x02, 0x00, 0x10, 0x82, 0x28,
+  0x81, 0x41, 0x00, 0x3a, 0x9b, 0x02, 0x02, 0x11, 0x25, 0x1e, 0x8c, 0x02, 0x00, 0x15, 0x81, 0x41,
+  0x00, 0x34, 0xab, 0x02, 0x00, 0x23, 0x81, 0x41, 0x00, 0x2c, 0xab, 0x02, 0x00, 0x32, 0x81, 0x41,
+  0x00, 0x1f, 0xaa, 0x02, 0x04, 0x09, 0x3e, 0x41, 0x3e, 0x03, 0xaa, 0x02, 0x00, 0x27, 0x81, 0x41,
+  0x00, 0x31, 0x93, 0x02, 0x02, 0x04, 0x20, 0x05, 0x8f, 0x02, 0x01, 0x17, 0x1b, 0x81, 0x02, 0x01,
+  0x0e, 0x3c, 0x81, 0x41, 0x00, 0x1a, 0x92, 0x02, 0x03, 0x05, 0x34, 0x41, 0x36, 0x8e, 0x02, 0x05,
+  0x1e, 0x41, 0x40, 0x20, 0x02, 0x30, 0x81, 0x41, 0x00, 0x34, 0x92, 0x02, 0x01, 0x05, 0x34, 0x81,
+  0x41, 0x01, 0x40, 0x07, 0x8d, 0x02, 0x00, 0x2d, 0x81, 0x41, 0x01, 0x40, 0x2d, 0x81, 0x41, 0x01,
+  0x3f, 0x14, 0x91, 0x02, 0x01, 0x05, 0x34, 0x81, 0x41, 0x01, 0x40, 0x20, 0x8e, 0x02, 0x01, 0x05,
+  0x34, 0x84, 0x41, 0x00, 0x25, 0x92, 0x02, 0x00, 0x20, 0x82, 0x41, 0x00, 0x32, 0x86, 0x02, 0x02,
+  0x10, 0x20, 0x1a, 0x86, 0x02, 0x01, 0x05, 0x39, 0x82, 0x41, 0x00, 0x31, 0x94, 0x02, 0x00, 0x2a,
+  0x82, 0x41, 0x01, 0x37, 0x14, 0x84, 0x02, 0x00, 0x32, 0x81, 0x41, 0x00, 0x0a, 0x84, 0x02, 0x01,
+  0x10, 0x31, 0x82, 0x41, 0x00, 0x34, 0x96, 0x02, 0x00, 0x29, 0x82, 0x41, 0x02, 0x3f, 0x2d, 0x14,
+  0x82, 0x02, 0x00, 0x34, 0x81, 0x41, 0x00, 0x0b, 0x82, 0x02, 0x02, 0x0f, 0x29, 0x3d, 0x82, 0x41,
+  0x00, 0x31, 0x98, 0x02, 0x01, 0x1f, 0x3c, 0x83, 0x41, 0x03, 0x38, 0x2a, 0x1f, 0x34, 0x81, 0x41,
+  0x04, 0x0c, 0x1d, 0x27, 0x35, 0x3f, 0x82, 0x41, 0x01, 0x3e, 0x24, 0x9a, 0x02, 0x02, 0x0f, 0x2d,
+  0x3f, 0x8e, 0x41, 0x01, 0x32, 0x13, 0x9d, 0x02, 0x02, 0x11, 0x2c, 0x3b, 0x89, 0x41, 0x02, 0x3d,
+  0x2e, 0x15, 0xa2, 0x02, 0x09, 0x16, 0x26, 0x30, 0x34, 0x36, 0x37, 0x34, 0x31, 0x27, 0x19, 0xff,
+  0x02, 0xff, 0x02, 0x88, 0x02, 0x00, 0x00, 0xad, 0x02, 0x00, 0x00,
+};
+
+IMAGE_ASSET_DECLARE(CruiseControl);
+const ImageAsset CruiseControl_asset = {
+  .name = "CruiseControl",
+  .data = CruiseControl_rle,
+  .data_size = sizeof(CruiseControl_rle),
+  .raw_size = 6912,
+  .crc32 = 0xcc490ff0,
+  .w = 48,
+  .h = 48,
+  .codec = IMAGE_CODEC_RLE_PALETTE,
+};
@@ -0,0 +1,153 @@
+// Generated by tools/compress_images.py from images/ExhaustBypass.h - do not edit.
+// 48x48 RGB565A8, palette + RLE: 6912 -> 2130 bytes. Decoded on first use by ImageCache.
+#pragma once
+#include "../ImageCodec.h"
+
+static const uint8_t ExhaustBypass_rle[] = {
+  0x99, 0x00, 0x00, 0xff, 0x01, 0x00, 0xff, 0x02, 0x00, 0xff, 0x03, 0x00, 0xff, 0x04, 0x00, 0xff,
+  0x05, 0x00, 0xff, 0x07, 0x00, 0xff, 0x09, 0x00, 0xff, 0x0c, 0x00, 0xff, 0x0d, 0x00, 0xff, 0x0e,
+  0x00, 0xff, 0x0f, 0x00, 0xff, 0x11, 0x00, 0xff, 0x20, 0x00, 0xff, 0x21, 0x00, 0xff, 0x22, 0x00,
+  0xff, 0x23, 0x00, 0xff, 0x24, 0x00, 0xff, 0x26, 0x00, 0xff, 0x28, 0x00, 0xff, 0x29, 0x00, 0xff,
+  0x2a, 0x00, 0xff, 0x2b, 0x00, 0xff, 0x2c, 0x00, 0xff, 0x2d, 0x00, 0xff, 0x2e, 0x00, 0xff, 0x2f,
+  0x00, 0xff, 0x30, 0x00, 0xff, 0x32, 0x00, 0xff, 0x33, 0x00, 0xff, 0x34, 0x00, 0xff, 0x35, 0x00,
+  0xff, 0x36, 0x00, 0xff, 0x38, 0x00, 0xff, 0x40, 0x00, 0xff, 0x41, 0x00, 0xff, 0x42, 0x00, 0xff,
+  0x45, 0x00, 0xff, 0x46, 0x00, 0xff, 0x48, 0x00, 0xff, 0x4f, 0x00, 0xff, 0x50, 0x00, 0xff, 0x51,
+  0x00, 0xff, 0x53, 0x00, 0xff, 0x54, 0x00, 0xff, 0x55, 0x00, 0xff, 0x56, 0x00, 0xff, 0x57, 0x00,
+  0xff, 0x58, 0x00, 0xff, 0x59, 0x00, 0xff, 0x5a, 0x00, 0xff, 0x5b, 0x00, 0xff, 0x5c, 0x00, 0xff,
+  0x60, 0x00, 0xff, 0x61, 0x00, 0xff, 0x62, 0x00, 0xff, 0x69, 0x00, 0xff, 0x6c, 0x00, 0xff, 0x6f,
+  0x00, 0xff, 0x70, 0x00, 0xff, 0x72, 0x00, 0xff, 0x74, 0x00, 0xff, 0x75, 0x00, 0xff, 0x76, 0x00,
+  0xff, 0x77, 0x00, 0xff, 0x78, 0x00, 0xff, 0x79, 0x00, 0xff, 0x7a, 0x00, 0xff, 0x7b, 0x00, 0xff,
+  0x7c, 0x00, 0xff, 0x7d, 0x00, 0xff, 0x7e, 0x00, 0xff, 0x95, 0x00, 0xff, 0x99, 0x00, 0xff, 0x9a,
+  0x00, 0xff, 0x9b, 0x00, 0xff, 0x9c, 0x00, 0xff, 0x9d, 0x00, 0xff, 0x9e, 0x00, 0xff, 0x9f, 0x00,
+  0xff, 0xb8, 0x00, 0xff, 0xb9, 0x00, 0xff, 0xba, 0x00, 0xff, 0xbb, 0x00, 0xff, 0xbc, 0x00, 0xff,
+  0xbd, 0x00, 0xff, 0xbe, 0x00, 0xff, 0xbf, 0x00, 0xff, 0xdc, 0x00, 0xff, 0xde, 0x00, 0xff, 0xdf,
+  0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x08, 0xff, 0x01, 0x08, 0xff, 0x02, 0x08, 0xff, 0x05, 0x08,
+  0xff, 0x07, 0x08, 0xff, 0x0f, 0x08, 0xff, 0x14, 0x08, 0xff, 0x20, 0x08, 0xff, 0x21, 0x08, 0xff,
+  0x22, 0x08, 0xff, 0x28, 0x08, 0xff, 0x29, 0x08, 0xff, 0x2a, 0x08, 0xff, 0x2f, 0x08, 0xff, 0x31,
+  0x08, 0xff, 0x32, 0x08, 0xff, 0x33, 0x08, 0xff, 0x34, 0x08, 0xff, 0x36, 0x08, 0xff, 0x37, 0x08,
+  0xff, 0x40, 0x08, 0xff, 0x41, 0x08, 0xff, 0x42, 0x08, 0xff, 0x49, 0x08, 0xff, 0x4f, 0x08, 0xff,
+  0x50, 0x08, 0xff, 0x55, 0x08, 0xff, 0x56, 0x08, 0xff, 0x57, 0x08, 0xff, 0x59, 0x08, 0xff, 0x5a,
+  0x08, 0xff, 0x5b, 0x08, 0xff, 0x5c, 0x08, 0xff, 0x5d, 0x08, 0xff, 0x71, 0x08, 0xff, 0x73, 0x08,
+  0xff, 0x74, 0x08, 0xff, 0x75, 0x08, 0xff, 0x76, 0x08, 0xff, 0x79, 0x08, 0xff, 0x7a, 0x08, 0xff,
+  0x7b, 0x08, 0xff, 0x7c, 0x08, 0xff, 0x7d, 0x08, 0xff, 0x7f, 0x08, 0xff, 0x99, 0x08, 0xff, 0x9a,
+  0x08, 0xff, 0x9b, 0x08, 0xff, 0x9c, 0x08, 0xff, 0x9d, 0x08, 0xff, 0x9e, 0x08, 0xff, 0x9f, 0x08,
+  0xff, 0xb9, 0x08, 0xff, 0xba, 0x08, 0xff, 0xbb, 0x08, 0xff, 0xbd, 0x08, 0xff, 0xbe, 0x08, 0xff,
+  0xbf, 0x08, 0xff, 0xdd, 0x08, 0xff, 0xdf, 0x08, 0xff, 0x01, 0x10, 0xff, 0x7d, 0x10, 0xff, 0x8f,
+  0x00, 0x09, 0x01, 0x5c, 0x0e, 0x00, 0x0d, 0x5e, 0x00, 0x5c, 0x01, 0x0d, 0x81, 0x01, 0x01, 0x0e,
+  0x01, 0xa1, 0x00, 0x02, 0x01, 0x5c, 0x0e, 0x82, 0x00, 0x05, 0x0f, 0x0e, 0x5c, 0x0d, 0x00, 0x01,
+  0x81, 0x00, 0x01, 0x02, 0x0e, 0xa0, 0x00, 0x01, 0x5c, 0x0e, 0x81, 0x00, 0x02, 0x01, 0x7e, 0x80,
+  0x81, 0x76, 0x05, 0x1c, 0x6a, 0x0e, 0x01, 0x00, 0x01, 0x9f, 0x00, 0x02, 0x63, 0x00, 0x0d, 0x81,
+  0x00, 0x0a, 0x01, 0x8c, 0x95, 0x5a, 0x57, 0x4a, 0x43, 0x23, 0x0e, 0x5c, 0x5d, 0x9f, 0x00, 0x0b,
+  0x01, 0x0e, 0x0d, 0x00, 0x5d, 0x00, 0x93, 0x59, 0x57, 0x8f, 0x4a, 0x84, 0x81, 0x01, 0x01, 0x00,
+  0x0d, 0x9f, 0x00, 0x0f, 0x01, 0x0d, 0x00, 0x0d, 0x5d, 0x0d, 0x94, 0x5a, 0x95, 0x8f, 0x83, 0x84,
+  0x00, 0x01, 0x00, 0x0d, 0x9f, 0x00, 0x01, 0x0d, 0x22, 0x81, 0x01, 0x02, 0x00, 0x0d, 0x54, 0x81,
+  0x57, 0x03, 0x4f, 0x49, 0x44, 0x5c, 0x81, 0x00, 0x00, 0x01, 0x9f, 0x00, 0x03, 0x01, 0x0d, 0x01,
+  0x00, 0x81, 0x0d, 0x08, 0x54, 0x8f, 0x57, 0x95, 0x4a, 0x49, 0x5e, 0x00, 0x01, 0x91, 0x00, 0x09,
+  0x01, 0x0d, 0x0e, 0x5d, 0x5c, 0x00, 0x01, 0x00, 0x01, 0x64, 0x81, 0x0d, 0x04, 0x01, 0x00, 0x5d,
+  0x0e, 0x5c, 0x81, 0x0d, 0x02, 0x00, 0x22, 0x99, 0x82, 0x57, 0x03, 0x84, 0x42, 0x0e, 0x01, 0x82,
+  0x00, 0x01, 0x0d, 0x63, 0x81, 0x00, 0x02, 0x01, 0x02, 0x00, 0x81, 0x0d, 0x00, 0x0e, 0x81, 0x00,
+  0x10, 0x01, 0x0d, 0x01, 0x00, 0x5c, 0x0d, 0x00, 0x5c, 0x00, 0x0d, 0x01, 0x5d, 0x00, 0x5c, 0x5d,
+  0x70, 0x0e, 0x82, 0x00, 0x0e, 0x0d, 0x1d, 0x3e, 0x76, 0x2d, 0x8e, 0x57, 0x5a, 0x57, 0x8c, 0x54,
+  0x2e, 0x2c, 0x2e, 0x1b, 0x83, 0x01, 0x0a, 0x35, 0x0d, 0x00, 0x0d, 0x5c, 0x64, 0x0d, 0x00, 0x01,
+  0x00, 0x0e, 0x81, 0x00, 0x0b, 0x5c, 0x0d, 0x00, 0x01, 0x00, 0x0d, 0x01, 0x5d, 0x37, 0x0a, 0x0f,
+  0x0d, 0x81, 0x01, 0x03, 0x0e, 0x00, 0x0d, 0x43, 0x81, 0x57, 0x05, 0x4f, 0x95, 0x57, 0x4f, 0x57,
+  0x4f, 0x81, 0x93, 0x0f, 0x32, 0x96, 0x40, 0x0d, 0x5d, 0x00, 0x0d, 0x02, 0x5c, 0x5d, 0x00, 0x5c,
+  0x5d, 0x01, 0x0d, 0x5c, 0x81, 0x0d, 0x0e, 0x5d, 0x0d, 0x01, 0x63, 0x01, 0x00, 0x0d, 0x01, 0x00,
+  0x0d, 0x41, 0x95, 0x75, 0x5d, 0x5c, 0x82, 0x0d, 0x01, 0x01, 0x3f, 0x82, 0x57, 0x01, 0x4f, 0x5a,
+  0x81, 0x8f, 0x0f, 0x4f, 0x49, 0x43, 0x36, 0x42, 0x19, 0x01, 0x5d, 0x63, 0x0e, 0x01, 0x36, 0x7a,
+  0x4e, 0x14, 0x01, 0x81, 0x0d, 0x18, 0x01, 0x0e, 0x00, 0x5d, 0x0d, 0x01, 0x5c, 0x01, 0x0d, 0x5d,
+  0x01, 0x0e, 0x2c, 0x5a, 0x43, 0x01, 0x5c, 0x22, 0x01, 0x5d, 0x00, 0x01, 0x2d, 0x8f, 0x57, 0x81,
+  0x4f, 0x82, 0x57, 0x09, 0x5b, 0x43, 0x4a, 0x0d, 0x8a, 0x1b, 0x35, 0x23, 0x00, 0x0d, 0x81, 0x00,
+  0x0a, 0x6b, 0x5a, 0x44, 0x24, 0x5c, 0x01, 0x00, 0x01, 0x00, 0x5d, 0x01, 0x82, 0x00, 0x0e, 0x0e,
+  0x5d, 0x00, 0x16, 0x8f, 0x54, 0x12, 0x5c, 0x3e, 0x3f, 0x01, 0x5c, 0x00, 0x0d, 0x2d, 0x81, 0x5a,
+  0x84, 0x57, 0x10, 0x5a, 0x31, 0x49, 0x0d, 0x49, 0x0b, 0x98, 0x5d, 0x5c, 0x67, 0x48, 0x12, 0x5d,
+  0x30, 0x5a, 0x1f, 0x01, 0x81, 0x0d, 0x03, 0x00, 0x63, 0x00, 0x01, 0x82, 0x00, 0x0e, 0x0e, 0x5d,
+  0x0e, 0x30, 0x57, 0x1b, 0x0d, 0x1d, 0x5b, 0x34, 0x0d, 0x01, 0x00, 0x0d, 0x2d, 0x84, 0x57, 0x81,
+  0x4f, 0x06, 0x57, 0x83, 0x4a, 0x0e, 0x49, 0x69, 0x5d, 0x81, 0x0d, 0x0e, 0x0c, 0x57, 0x7a, 0x0d,
+  0x04, 0x4e, 0x8d, 0x27, 0x01, 0x0d, 0x00, 0x63, 0x00, 0x5c, 0x00, 0x81, 0x01, 0x11, 0x22, 0x01,
+  0x12, 0x57, 0x53, 0x5c, 0x60, 0x56, 0x47, 0x67, 0x00, 0x04, 0x01, 0x00, 0x2d, 0x8f, 0x4f, 0x5a,
+  0x81, 0x57, 0x02, 0x95, 0x57, 0x5a, 0x81, 0x49, 0x25, 0x5c, 0x49, 0x29, 0x22, 0x01, 0x5c, 0x0e,
+  0x7a, 0x5a, 0x2b, 0x0d, 0x2c, 0x57, 0x20, 0x5c, 0x0d, 0x01, 0x5d, 0x01, 0x00, 0x5c, 0x01, 0x5d,
+  0x0d, 0x00, 0x6c, 0x5a, 0x2c, 0x63, 0x3e, 0x5a, 0x6d, 0x5c, 0x3b, 0x5a, 0x1e, 0x0d, 0x76, 0x82,
+  0x57, 0x00, 0x4f, 0x83, 0x57, 0x81, 0x4a, 0x1e, 0x22, 0x42, 0x1a, 0x00, 0x43, 0x2f, 0x5c, 0x13,
+  0x56, 0x8e, 0x00, 0x11, 0x4f, 0x54, 0x5c, 0x00, 0x0d, 0x5c, 0x01, 0x00, 0x01, 0x00, 0x5e, 0x0d,
+  0x00, 0x21, 0x57, 0x17, 0x5d, 0x4c, 0x56, 0x81, 0x02, 0x05, 0x4e, 0x95, 0x18, 0x0d, 0x78, 0x5a,
+  0x86, 0x57, 0x81, 0x4a, 0x0e, 0x22, 0x42, 0x1a, 0x00, 0x85, 0x97, 0x1b, 0x0d, 0x3e, 0x95, 0x1a,
+  0x0d, 0x4b, 0x4f, 0x72, 0x81, 0x0d, 0x00, 0x5c, 0x81, 0x00, 0x02, 0x01, 0x00, 0x02, 0x81, 0x00,
+  0x0e, 0x44, 0x56, 0x0d, 0x5c, 0x57, 0x4a, 0x5c, 0x69, 0x5a, 0x6f, 0x0d, 0x01, 0x2e, 0x57, 0x95,
+  0x81, 0x57, 0x00, 0x5a, 0x82, 0x57, 0x81, 0x4a, 0x14, 0x22, 0x42, 0x1a, 0x0d, 0x15, 0x57, 0x4a,
+  0x64, 0x1a, 0x4f, 0x2e, 0x00, 0x3f, 0x57, 0x08, 0x0d, 0x00, 0x5c, 0x01, 0x5c, 0x01, 0x81, 0x0d,
+  0x03, 0x00, 0x01, 0x53, 0x55, 0x81, 0x01, 0x0b, 0x4f, 0x42, 0x0d, 0x2c, 0x57, 0x61, 0x5d, 0x63,
+  0x3e, 0x57, 0x95, 0x4f, 0x84, 0x57, 0x81, 0x4a, 0x14, 0x22, 0x42, 0x1a, 0x0d, 0x5c, 0x4d, 0x55,
+  0x5c, 0x13, 0x4f, 0x40, 0x00, 0x2d, 0x5a, 0x1b, 0x0e, 0x00, 0x5c, 0x0d, 0x5c, 0x0e, 0x81, 0x0d,
+  0x10, 0x00, 0x01, 0x53, 0x4e, 0x0d, 0x0e, 0x57, 0x43, 0x0d, 0x6c, 0x57, 0x3c, 0x00, 0x01, 0x3e,
+  0x57, 0x95, 0x85, 0x57, 0x81, 0x4a, 0x15, 0x22, 0x42, 0x1a, 0x0e, 0x5c, 0x8d, 0x55, 0x5c, 0x66,
+  0x57, 0x40, 0x01, 0x2e, 0x5a, 0x1b, 0x0e, 0x00, 0x5c, 0x0d, 0x00, 0x0d, 0x00, 0x82, 0x01, 0x0f,
+  0x42, 0x57, 0x06, 0x00, 0x4e, 0x86, 0x63, 0x73, 0x57, 0x54, 0x0e, 0x00, 0x3d, 0x57, 0x95, 0x57,
+  0x81, 0x4f, 0x82, 0x57, 0x81, 0x4a, 0x25, 0x22, 0x42, 0x1a, 0x00, 0x17, 0x4f, 0x49, 0x0e, 0x1b,
+  0x57, 0x3e, 0x00, 0x3f, 0x57, 0x08, 0x0d, 0x01, 0x5c, 0x01, 0x00, 0x63, 0x00, 0x5d, 0x0e, 0x5c,
+  0x1e, 0x57, 0x2a, 0x5d, 0x42, 0x95, 0x09, 0x00, 0x3f, 0x95, 0x62, 0x71, 0x82, 0x83, 0x57, 0x00,
+  0x5a, 0x82, 0x57, 0x81, 0x4a, 0x26, 0x22, 0x42, 0x1a, 0x0d, 0x87, 0x95, 0x19, 0x0d, 0x40, 0x95,
+  0x18, 0x0d, 0x4b, 0x4e, 0x71, 0x00, 0x0d, 0x5c, 0x00, 0x01, 0x63, 0x01, 0x5c, 0x0d, 0x00, 0x18,
+  0x5a, 0x42, 0x00, 0x1a, 0x5a, 0x52, 0x5d, 0x02, 0x3d, 0x39, 0x0d, 0x78, 0x5a, 0x81, 0x57, 0x00,
+  0x4f, 0x83, 0x57, 0x81, 0x4a, 0x13, 0x22, 0x42, 0x1a, 0x00, 0x42, 0x2c, 0x63, 0x68, 0x56, 0x4c,
+  0x01, 0x12, 0x4f, 0x53, 0x5c, 0x00, 0x01, 0x5d, 0x01, 0x0d, 0x81, 0x01, 0x0b, 0x0d, 0x63, 0x00,
+  0x36, 0x7d, 0x4e, 0x07, 0x5c, 0x7a, 0x57, 0x81, 0x0d, 0x81, 0x00, 0x04, 0x01, 0x2d, 0x4f, 0x56,
+  0x5a, 0x81, 0x57, 0x17, 0x56, 0x8f, 0x95, 0x83, 0x49, 0x0d, 0x84, 0x28, 0x0e, 0x00, 0x5c, 0x11,
+  0x45, 0x57, 0x28, 0x00, 0x2d, 0x5a, 0x1d, 0x0d, 0x0e, 0x0d, 0x5d, 0x0d, 0x81, 0x00, 0x13, 0x0d,
+  0x00, 0x63, 0x5d, 0x0d, 0x2a, 0x57, 0x43, 0x0d, 0x12, 0x58, 0x7c, 0x00, 0x01, 0x0d, 0x00, 0x80,
+  0x95, 0x94, 0x57, 0x81, 0x4f, 0x00, 0x5a, 0x81, 0x57, 0x81, 0x4a, 0x12, 0x0e, 0x84, 0x1b, 0x00,
+  0x01, 0x64, 0x6b, 0x95, 0x2e, 0x00, 0x14, 0x4f, 0x46, 0x25, 0x5d, 0x03, 0x00, 0x5d, 0x00, 0x81,
+  0x01, 0x00, 0x00, 0x81, 0x01, 0x0f, 0x5d, 0x0d, 0x0e, 0x43, 0x56, 0x2b, 0x5c, 0x0f, 0x11, 0x5c,
+  0x0e, 0x0d, 0x01, 0x3f, 0x57, 0x4f, 0x81, 0x57, 0x81, 0x95, 0x0b, 0x57, 0x95, 0x4a, 0x89, 0x5d,
+  0x89, 0x1a, 0x0e, 0x63, 0x5c, 0x10, 0x28, 0x81, 0x00, 0x0b, 0x43, 0x5a, 0x1d, 0x01, 0x5c, 0x0d,
+  0x00, 0x64, 0x00, 0x0d, 0x00, 0x0d, 0x81, 0x00, 0x0f, 0x64, 0x01, 0x00, 0x68, 0x4e, 0x4f, 0x17,
+  0x5c, 0x5d, 0x01, 0x0d, 0x00, 0x5d, 0x3e, 0x59, 0x95, 0x81, 0x57, 0x00, 0x95, 0x81, 0x57, 0x16,
+  0x95, 0x8a, 0x84, 0x0d, 0x4a, 0x28, 0x0d, 0x0e, 0x0d, 0x01, 0x00, 0x0d, 0x78, 0x5a, 0x42, 0x36,
+  0x5c, 0x0d, 0x00, 0x02, 0x0d, 0x00, 0x0d, 0x82, 0x00, 0x81, 0x0d, 0x05, 0x0f, 0x5d, 0x00, 0x17,
+  0x79, 0x38, 0x81, 0x00, 0x01, 0x22, 0x5d, 0x81, 0x00, 0x04, 0x2e, 0x4f, 0x88, 0x95, 0x59, 0x82,
+  0x57, 0x12, 0x97, 0x49, 0x32, 0x35, 0x42, 0x1a, 0x64, 0x02, 0x00, 0x0e, 0x00, 0x23, 0x77, 0x85,
+  0x26, 0x01, 0x00, 0x0d, 0x00, 0x81, 0x0d, 0x01, 0x5d, 0x00, 0x83, 0x01, 0x01, 0x0e, 0x0d, 0x81,
+  0x00, 0x04, 0x0e, 0x00, 0x5c, 0x5d, 0x64, 0x81, 0x01, 0x17, 0x63, 0x00, 0x31, 0x5a, 0x4f, 0x57,
+  0x97, 0x57, 0x95, 0x4f, 0x95, 0x54, 0x93, 0x2e, 0x4d, 0x6d, 0x5c, 0x00, 0x01, 0x64, 0x22, 0x00,
+  0x5d, 0x0d, 0x81, 0x5c, 0x04, 0x0e, 0x00, 0x5c, 0x0d, 0x0e, 0x81, 0x5c, 0x00, 0x01, 0x81, 0x0d,
+  0x81, 0x01, 0x00, 0x0e, 0x81, 0x01, 0x0a, 0x02, 0x22, 0x23, 0x01, 0x0e, 0x0d, 0x0e, 0x5c, 0x0d,
+  0x2e, 0x8a, 0x81, 0x42, 0x09, 0x7a, 0x4e, 0x57, 0x4e, 0x53, 0x31, 0x4b, 0x43, 0x51, 0x7f, 0x81,
+  0x22, 0x04, 0x0d, 0x00, 0x0d, 0x00, 0x5c, 0x81, 0x00, 0x0b, 0x01, 0x0d, 0x00, 0x5d, 0x00, 0x01,
+  0x00, 0x5c, 0x0f, 0x0d, 0x00, 0x5c, 0x81, 0x0d, 0x00, 0x5c, 0x81, 0x0d, 0x82, 0x01, 0x02, 0x63,
+  0x00, 0x5d, 0x81, 0x01, 0x12, 0x0e, 0x5c, 0x0e, 0x01, 0x22, 0x42, 0x5a, 0x84, 0x6e, 0x0d, 0x5c,
+  0x0d, 0x0e, 0x5d, 0x00, 0x01, 0x0d, 0x00, 0x5d, 0x81, 0x0d, 0x08, 0x5c, 0x0d, 0x02, 0x00, 0x5d,
+  0x5c, 0x00, 0x01, 0x0d, 0x8f, 0x00, 0x01, 0x0e, 0x0d, 0x81, 0x01, 0x00, 0x00, 0x81, 0x5c, 0x08,
+  0x43, 0x57, 0x41, 0x2e, 0x63, 0x0d, 0x5d, 0x00, 0x0d, 0xa1, 0x00, 0x09, 0x01, 0x64, 0x23, 0x00,
+  0x0d, 0x49, 0x5a, 0x83, 0x3d, 0x5d, 0x82, 0x00, 0x00, 0x01, 0x9f, 0x00, 0x0f, 0x65, 0x01, 0x00,
+  0x5c, 0x00, 0x5d, 0x00, 0x8a, 0x57, 0x83, 0x3e, 0x5c, 0x01, 0x00, 0x5c, 0x01, 0x9f, 0x00, 0x03,
+  0x0d, 0x02, 0x64, 0x00, 0x81, 0x0e, 0x09, 0x0d, 0x52, 0x57, 0x83, 0x3e, 0x00, 0x5d, 0x0e, 0x5d,
+  0x0d, 0x9f, 0x00, 0x02, 0x35, 0x64, 0x63, 0x81, 0x0d, 0x0a, 0x5c, 0x01, 0x42, 0x57, 0x89, 0x3e,
+  0x0d, 0x00, 0x0e, 0x01, 0x0d, 0x9f, 0x00, 0x0f, 0x01, 0x5c, 0x01, 0x0e, 0x01, 0x5c, 0x0e, 0x8b,
+  0x57, 0x90, 0x20, 0x0d, 0x00, 0x0d, 0x01, 0x0d, 0x9f, 0x00, 0x0e, 0x5c, 0x65, 0x19, 0x2f, 0x84,
+  0x8a, 0x44, 0x57, 0x4f, 0x91, 0x0b, 0x0d, 0x5d, 0x00, 0x0d, 0xa0, 0x00, 0x04, 0x0d, 0x2d, 0x57,
+  0x5a, 0x4e, 0x81, 0x4c, 0x04, 0x91, 0x49, 0x8b, 0x23, 0x0e, 0x81, 0x5c, 0x01, 0x23, 0x5c, 0x9f,
+  0x00, 0x0a, 0x2b, 0x8f, 0x57, 0x50, 0x8c, 0x4d, 0x4e, 0x4f, 0x7b, 0x38, 0x0d, 0x81, 0x5d, 0x02,
+  0x00, 0x01, 0x0d, 0x9f, 0x00, 0x0c, 0x4b, 0x95, 0x92, 0x33, 0x30, 0x2f, 0x2e, 0x3a, 0x35, 0x0d,
+  0x01, 0x5d, 0x0d, 0x81, 0x01, 0x00, 0x0d, 0x9f, 0x00, 0x09, 0x5a, 0x56, 0x4a, 0x29, 0x0e, 0x01,
+  0x64, 0x5d, 0x5c, 0x5d, 0x81, 0x63, 0x82, 0x0d, 0x00, 0x01, 0x9f, 0x00, 0x03, 0x8f, 0x57, 0x45,
+  0x74, 0x81, 0x00, 0x03, 0x0e, 0x22, 0x00, 0x01, 0x81, 0x00, 0x03, 0x01, 0x0d, 0x63, 0x5e, 0x9f,
+  0x00, 0x08, 0x5a, 0x57, 0x84, 0x61, 0x0e, 0x0d, 0x01, 0x00, 0x0d, 0x81, 0x01, 0x81, 0x00, 0x00,
+  0x0d, 0x81, 0x5c, 0x9f, 0x00, 0x08, 0x5a, 0x57, 0x4b, 0x0a, 0x0d, 0x01, 0x0d, 0x01, 0x0e, 0x81,
+  0x0d, 0x04, 0x5d, 0x5e, 0x01, 0x00, 0x0d, 0x9f, 0x00, 0x07, 0x97, 0x5a, 0x53, 0x28, 0x0e, 0x00,
+  0x01, 0x00, 0x81, 0x01, 0x01, 0x00, 0x0d, 0x81, 0x00, 0x01, 0x0d, 0x22, 0x9f, 0x00, 0x0b, 0x5f,
+  0x05, 0x11, 0x5d, 0x5c, 0x70, 0x0e, 0x01, 0x00, 0x01, 0x0d, 0x0e, 0x81, 0x01, 0x01, 0x5c, 0x5d,
+  0x8f, 0x00,
+};
+
+IMAGE_ASSET_DECLARE(ExhaustBypass);
+const ImageAsset ExhaustBypass_asset = {
+  .name = "ExhaustBypass",
+  .data = ExhaustBypass_rle,
+  .data_size = sizeof(ExhaustBypass_rle),
+  .raw_size = 6912,
+  .crc32 = 0xc018a62c,
+  .w = 48,
+  .h = 48,
+  .codec = IMAGE_CODEC_RLE_PALETTE,
+};
@@ -0,0 +1,454 @@
+// Generated by tools/compress_images.py from images/MotecLogo.h - do not edit.
+// 75x225 RGB565A8, palette + RLE: 50625 -> 6956 bytes. Decoded on first use by ImageCache.
+#pragma once
+#include "../ImageCodec.h"
+
+static const uint8_t MotecLogo_rle[] = {
+  0x43, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x21, 0x08, 0xff, 0x62, 0x10, 0xff, 0x00, 0x18, 0xff,
+  0xc3, 0x18, 0xff, 0xe3, 0x18, 0xff, 0x41, 0x20, 0xff, 0x04, 0x21, 0xff, 0x21, 0x28, 0xff, 0x45,
+  0x29, 0xff, 0x41, 0x30, 0xff, 0x86, 0x31, 0xff, 0x21, 0x38, 0xff, 0xc7, 0x39, 0xff, 0x62, 0x40,
+  0xff, 0x08, 0x42, 0xff, 0x83, 0x48, 0xff, 0x49, 0x4a, 0xff, 0x83, 0x50, 0xff, 0xaa, 0x52, 0xff,
+  0xc3, 0x58, 0xff, 0xcb, 0x5a, 0xff, 0xa3, 0x60, 0xff, 0x0c, 0x63, 0xff, 0xa4, 0x68, 0xff, 0xc4,
+  0x68, 0xff, 0xc3, 0x70, 0xff, 0x6e, 0x73, 0xff, 0xc3, 0x78, 0xff, 0xe4, 0x78, 0xff, 0xcf, 0x7b,
+  0xff, 0xe5, 0x80, 0xff, 0x10, 0x84, 0xff, 0x26, 0x89, 0xff, 0xc5, 0x90, 0xff, 0xe5, 0x90, 0xff,
+  0x72, 0x94, 0xff, 0xb2, 0x94, 0xff, 0x05, 0xa1, 0xff, 0x47, 0xa1, 0xff, 0xf4, 0xa4, 0xff, 0x26,
+  0xa9, 0xff, 0x55, 0xad, 0xff, 0x66, 0xb1, 0xff, 0x46, 0xb9, 0xff, 0xd7, 0xbd, 0xff, 0x66, 0xc1,
+  0xff, 0xf8, 0xc5, 0xff, 0x39, 0xce, 0xff, 0x79, 0xce, 0xff, 0x47, 0xd1, 0xff, 0x67, 0xd9, 0xff,
+  0xbb, 0xde, 0xff, 0x27, 0xe1, 0xff, 0x1c, 0xe7, 0xff, 0xe5, 0xe8, 0xff, 0xe6, 0xe8, 0xff, 0x06,
+  0xe9, 0xff, 0x07, 0xe9, 0xff, 0x26, 0xe9, 0xff, 0x5d, 0xef, 0xff, 0xc5, 0xf0, 0xff, 0xe6, 0xf0,
+  0xff, 0x07, 0xf1, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
+  0x00, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0xa7,
+  0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x02, 0xb1,
+  0x00, 0x00, 0x02, 0x95, 0x00, 0x81, 0x01, 0x02, 0x00, 0x0f, 0x17, 0x81, 0x19, 0xa7, 0x1e, 0x03,
+  0x19, 0x1a, 0x15, 0x0b, 0x81, 0x00, 0x00, 0x01, 0x94, 0x00, 0x04, 0x04, 0x19, 0x2d, 0x34, 0x36,
+  0x81, 0x40, 0xa7, 0x3a, 0x05, 0x40, 0x3b, 0x36, 0x33, 0x2c, 0x17, 0x94, 0x00, 0x04, 0x17, 0x2f,
+  0x3b, 0x3f, 0x3c, 0x81, 0x38, 0x00, 0x3f, 0x82, 0x38, 0x00, 0x3f, 0x9f, 0x39, 0x83, 0x38, 0x00,
+  0x3f, 0x81, 0x38, 0x06, 0x3e, 0x3f, 0x36, 0x2c, 0x0f, 0x00, 0x01, 0x8f, 0x00, 0x01, 0x1e, 0x34,
+  0x81, 0x39, 0x01, 0x3f, 0x3c, 0x81, 0x38, 0x00, 0x3c, 0x82, 0x39, 0xa0, 0x38, 0x00, 0x3f, 0x82,
+  0x39, 0x82, 0x38, 0x05, 0x3c, 0x3f, 0x39, 0x40, 0x33, 0x15, 0x82, 0x00, 0x00, 0x02, 0x89, 0x00,
+  0x04, 0x02, 0x00, 0x1e, 0x3b, 0x38, 0x81, 0x3f, 0x83, 0x38, 0x00, 0x3c, 0xa7, 0x3b, 0x82, 0x38,
+  0x81, 0x3f, 0x81, 0x38, 0x04, 0x3f, 0x34, 0x15, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0x81, 0x00,
+  0x03, 0x17, 0x36, 0x3f, 0x38, 0x81, 0x3f, 0x81, 0x38, 0x02, 0x36, 0x2d, 0x27, 0xa6, 0x20, 0x0d,
+  0x23, 0x27, 0x2f, 0x3a, 0x3f, 0x3c, 0x3f, 0x3e, 0x3f, 0x3c, 0x34, 0x0f, 0x00, 0x02, 0x89, 0x00,
+  0x02, 0x07, 0x2d, 0x38, 0x81, 0x3f, 0x06, 0x3c, 0x3f, 0x3a, 0x2c, 0x13, 0x02, 0x01, 0x82, 0x00,
+  0xa0, 0x01, 0x83, 0x00, 0x07, 0x01, 0x07, 0x1a, 0x2f, 0x40, 0x3e, 0x3c, 0x38, 0x81, 0x3c, 0x00,
+  0x2a, 0x8b, 0x00, 0x07, 0x20, 0x39, 0x38, 0x3e, 0x38, 0x3e, 0x36, 0x1e, 0x82, 0x00, 0xa5, 0x02,
+  0x00, 0x00, 0x82, 0x02, 0x81, 0x00, 0x03, 0x02, 0x24, 0x3b, 0x3e, 0x81, 0x38, 0x02, 0x3e, 0x3a,
+  0x17, 0x88, 0x00, 0x03, 0x02, 0x00, 0x2f, 0x38, 0x81, 0x3f, 0x02, 0x38, 0x36, 0x20, 0x81, 0x00,
+  0x00, 0x02, 0x81, 0x01, 0xa3, 0x00, 0x82, 0x02, 0x02, 0x00, 0x01, 0x00, 0x81, 0x02, 0x01, 0x00,
+  0x24, 0x81, 0x3c, 0x00, 0x3f, 0x81, 0x38, 0x00, 0x27, 0x89, 0x00, 0x02, 0x0b, 0x36, 0x38, 0x82,
+  0x3f, 0x01, 0x2c, 0x04, 0xb0, 0x00, 0x08, 0x02, 0x0b, 0x2f, 0x3a, 0x3f, 0x3c, 0x3f, 0x2f, 0x07,
+  0x88, 0x00, 0x07, 0x1a, 0x3a, 0x38, 0x39, 0x3e, 0x36, 0x0f, 0x01, 0xaf, 0x00, 0x00, 0x02, 0x81,
+  0x00, 0x02, 0x19, 0x3b, 0x3e, 0x81, 0x3f, 0x01, 0x34, 0x11, 0x88, 0x00, 0x09, 0x23, 0x39, 0x3f,
+  0x39, 0x38, 0x2d, 0x00, 0x01, 0x00, 0x01, 0xad, 0x00, 0x05, 0x01, 0x00, 0x01, 0x0b, 0x33, 0x3e,
+  0x81, 0x3f, 0x01, 0x3b, 0x19, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x3b, 0x39, 0x24, 0xb5, 0x00,
+  0x05, 0x2c, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x3a, 0x1e,
+  0xb5, 0x00, 0x05, 0x27, 0x3f, 0x3e, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f,
+  0x01, 0x3a, 0x1d, 0xb5, 0x00, 0x05, 0x27, 0x40, 0x3f, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24,
+  0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0xb5, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88,
+  0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0xb5, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c,
+  0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0xb5, 0x00, 0x05, 0x27, 0x3f, 0x38,
+  0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0xb5, 0x00, 0x05, 0x27,
+  0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0xb5,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01,
+  0x40, 0x1d, 0xb5, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c,
+  0x81, 0x3f, 0x01, 0x40, 0x1d, 0xb5, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00,
+  0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x01, 0x16, 0x08, 0xac, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x86,
+  0x00, 0x03, 0x3d, 0x42, 0x31, 0x1f, 0xaa, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88,
+  0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37, 0x82, 0x43, 0x03,
+  0x42, 0x31, 0x1c, 0x03, 0xa6, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01,
+  0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37, 0x86, 0x43, 0x02, 0x31, 0x1f,
+  0x08, 0xa3, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81,
+  0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37, 0x88, 0x43, 0x02, 0x41, 0x31, 0x1f, 0xa1, 0x00,
+  0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40,
+  0x1d, 0x86, 0x00, 0x00, 0x37, 0x8c, 0x43, 0x02, 0x32, 0x1f, 0x08, 0x9d, 0x00, 0x05, 0x27, 0x3f,
+  0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x86, 0x00, 0x00,
+  0x37, 0x8e, 0x43, 0x02, 0x42, 0x32, 0x1f, 0x9b, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b,
+  0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37, 0x91, 0x43,
+  0x03, 0x42, 0x31, 0x1f, 0x03, 0x97, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00,
+  0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x3d, 0x95, 0x43, 0x02, 0x32,
+  0x1f, 0x08, 0x94, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c,
+  0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x01, 0x18, 0x2e, 0x96, 0x43, 0x02, 0x42, 0x31, 0x21,
+  0x92, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f,
+  0x01, 0x40, 0x1d, 0x89, 0x00, 0x02, 0x1c, 0x30, 0x41, 0x96, 0x43, 0x02, 0x32, 0x1f, 0x08, 0x8e,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40,
+  0x1d, 0x8c, 0x00, 0x02, 0x18, 0x2e, 0x42, 0x95, 0x43, 0x03, 0x42, 0x32, 0x21, 0x05, 0x8b, 0x00,
+  0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40,
+  0x1d, 0x8f, 0x00, 0x02, 0x18, 0x2e, 0x42, 0x95, 0x43, 0x03, 0x42, 0x32, 0x1f, 0x05, 0x88, 0x00,
+  0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40,
+  0x1d, 0x92, 0x00, 0x02, 0x1c, 0x30, 0x41, 0x96, 0x43, 0x02, 0x32, 0x21, 0x03, 0x85, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d,
+  0x86, 0x00, 0x01, 0x10, 0x03, 0x8b, 0x00, 0x03, 0x03, 0x18, 0x2e, 0x42, 0x95, 0x43, 0x00, 0x12,
+  0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f,
+  0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x3d, 0x81, 0x43, 0x07, 0x3d, 0x32, 0x2e, 0x29, 0x1c, 0x14,
+  0x0e, 0x06, 0x86, 0x00, 0x02, 0x18, 0x2e, 0x41, 0x92, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27,
+  0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x86, 0x00,
+  0x00, 0x37, 0x88, 0x43, 0x07, 0x41, 0x37, 0x35, 0x2e, 0x29, 0x21, 0x18, 0x0a, 0x82, 0x00, 0x02,
+  0x16, 0x2e, 0x41, 0x8f, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b,
+  0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37, 0x91, 0x43,
+  0x07, 0x41, 0x32, 0x2b, 0x26, 0x1f, 0x25, 0x30, 0x42, 0x8c, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d,
+  0x86, 0x00, 0x00, 0x37, 0xa6, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c,
+  0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37, 0xa6,
+  0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24,
+  0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37, 0xa6, 0x43, 0x00, 0x10, 0x85, 0x00,
+  0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d,
+  0x86, 0x00, 0x00, 0x37, 0xa6, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c,
+  0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x3d, 0x8a,
+  0x43, 0x81, 0x42, 0x99, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b,
+  0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x01, 0x1c, 0x37, 0x89,
+  0x43, 0x0a, 0x41, 0x25, 0x0a, 0x16, 0x21, 0x25, 0x2b, 0x31, 0x35, 0x37, 0x3d, 0x90, 0x43, 0x00,
+  0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81,
+  0x3f, 0x01, 0x40, 0x1d, 0x88, 0x00, 0x01, 0x21, 0x42, 0x89, 0x43, 0x01, 0x37, 0x1c, 0x85, 0x00,
+  0x09, 0x03, 0x0c, 0x10, 0x18, 0x1f, 0x29, 0x30, 0x31, 0x37, 0x42, 0x87, 0x43, 0x00, 0x10, 0x85,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01,
+  0x40, 0x1d, 0x8a, 0x00, 0x01, 0x26, 0x41, 0x89, 0x43, 0x01, 0x35, 0x14, 0x8e, 0x00, 0x07, 0x03,
+  0x10, 0x1f, 0x25, 0x2b, 0x2e, 0x3d, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b,
+  0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x8b, 0x00, 0x01, 0x08, 0x2b, 0x8a, 0x43,
+  0x01, 0x2e, 0x0a, 0x9a, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24,
+  0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8d, 0x00, 0x01, 0x0a, 0x30, 0x89, 0x43, 0x01, 0x42, 0x29,
+  0x99, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f,
+  0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x16, 0x87, 0x00, 0x01, 0x12, 0x32, 0x89, 0x43, 0x01, 0x41,
+  0x21, 0x97, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81,
+  0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x03, 0x3d, 0x41, 0x2e, 0x18, 0x86, 0x00, 0x01, 0x18, 0x37,
+  0x89, 0x43, 0x01, 0x37, 0x16, 0x95, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00,
+  0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37, 0x82, 0x43, 0x03, 0x42,
+  0x2e, 0x18, 0x03, 0x84, 0x00, 0x01, 0x1f, 0x37, 0x89, 0x43, 0x01, 0x32, 0x10, 0x93, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x86,
+  0x00, 0x00, 0x37, 0x85, 0x43, 0x02, 0x41, 0x2e, 0x1c, 0x84, 0x00, 0x01, 0x25, 0x41, 0x89, 0x43,
+  0x01, 0x2e, 0x08, 0x91, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24,
+  0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37, 0x88, 0x43, 0x02, 0x42, 0x2e, 0x18,
+  0x83, 0x00, 0x00, 0x29, 0x89, 0x43, 0x01, 0x42, 0x26, 0x90, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39,
+  0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37,
+  0x8b, 0x43, 0x02, 0x42, 0x2e, 0x1c, 0x81, 0x00, 0x01, 0x03, 0x2b, 0x89, 0x43, 0x01, 0x41, 0x1f,
+  0x8e, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f,
+  0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37, 0x8e, 0x43, 0x05, 0x41, 0x30, 0x18, 0x00, 0x0a, 0x30,
+  0x89, 0x43, 0x01, 0x35, 0x14, 0x8c, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00,
+  0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37, 0x91, 0x43, 0x04, 0x42,
+  0x30, 0x14, 0x12, 0x31, 0x89, 0x43, 0x01, 0x31, 0x0e, 0x8a, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39,
+  0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x3d, 0x94,
+  0x43, 0x03, 0x41, 0x2e, 0x29, 0x37, 0x89, 0x43, 0x01, 0x2b, 0x03, 0x88, 0x00, 0x05, 0x27, 0x3f,
+  0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00,
+  0x02, 0x1f, 0x31, 0x42, 0x95, 0x43, 0x00, 0x41, 0x8a, 0x43, 0x01, 0x42, 0x25, 0x87, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d,
+  0x89, 0x00, 0x02, 0x21, 0x31, 0x42, 0xa0, 0x43, 0x01, 0x41, 0x0a, 0x85, 0x00, 0x05, 0x27, 0x3f,
+  0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8b, 0x00,
+  0x02, 0x08, 0x1f, 0x31, 0x9f, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c,
+  0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8f, 0x00, 0x02, 0x1f, 0x31,
+  0x42, 0x9b, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00,
+  0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x91, 0x00, 0x02, 0x08, 0x1c, 0x32, 0x99, 0x43, 0x00,
+  0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81,
+  0x3f, 0x01, 0x40, 0x1d, 0x95, 0x00, 0x02, 0x1f, 0x31, 0x42, 0x95, 0x43, 0x00, 0x10, 0x85, 0x00,
+  0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40,
+  0x1d, 0x98, 0x00, 0x02, 0x21, 0x31, 0x42, 0x92, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f,
+  0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x9a, 0x00,
+  0x02, 0x08, 0x1c, 0x31, 0x90, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c,
+  0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8b, 0x00, 0x01, 0x03, 0x0e,
+  0x81, 0x10, 0x01, 0x0e, 0x08, 0x8c, 0x00, 0x02, 0x1c, 0x30, 0x42, 0x8c, 0x43, 0x00, 0x10, 0x85,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40,
+  0x1d, 0x89, 0x00, 0x02, 0x18, 0x31, 0x41, 0x83, 0x43, 0x04, 0x41, 0x37, 0x30, 0x21, 0x08, 0x8a,
+  0x00, 0x02, 0x06, 0x1c, 0x31, 0x8a, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39,
+  0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x88, 0x00, 0x00, 0x2e,
+  0x8b, 0x43, 0x01, 0x35, 0x1f, 0x8c, 0x00, 0x02, 0x1c, 0x31, 0x42, 0x86, 0x43, 0x00, 0x10, 0x85,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01,
+  0x40, 0x1d, 0x87, 0x00, 0x00, 0x32, 0x8e, 0x43, 0x02, 0x42, 0x29, 0x08, 0x8c, 0x00, 0x02, 0x1f,
+  0x31, 0x41, 0x83, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88,
+  0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x21, 0x91, 0x43, 0x01,
+  0x42, 0x29, 0x8d, 0x00, 0x02, 0x06, 0x1c, 0x30, 0x81, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27,
+  0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86,
+  0x00, 0x00, 0x42, 0x93, 0x43, 0x01, 0x3d, 0x16, 0x8f, 0x00, 0x01, 0x1f, 0x0c, 0x85, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x85,
+  0x00, 0x00, 0x21, 0x96, 0x43, 0x00, 0x26, 0x96, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b,
+  0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x30, 0x97, 0x43,
+  0x00, 0x30, 0x95, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c,
+  0x81, 0x3f, 0x01, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x37, 0x98, 0x43, 0x00, 0x31, 0x94, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d,
+  0x84, 0x00, 0x01, 0x05, 0x41, 0x87, 0x43, 0x01, 0x32, 0x25, 0x81, 0x1f, 0x01, 0x2b, 0x32, 0x8b,
+  0x43, 0x00, 0x2e, 0x93, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24,
+  0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x84, 0x00, 0x01, 0x08, 0x42, 0x86, 0x43, 0x00, 0x1c, 0x86,
+  0x00, 0x01, 0x1f, 0x35, 0x89, 0x43, 0x00, 0x21, 0x92, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c,
+  0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x84, 0x00, 0x01, 0x05, 0x41, 0x85,
+  0x43, 0x00, 0x32, 0x89, 0x00, 0x01, 0x18, 0x3d, 0x88, 0x43, 0x00, 0x03, 0x91, 0x00, 0x05, 0x27,
+  0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x85,
+  0x00, 0x00, 0x3d, 0x85, 0x43, 0x00, 0x26, 0x8b, 0x00, 0x00, 0x2e, 0x87, 0x43, 0x00, 0x2e, 0x91,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01,
+  0x40, 0x1d, 0x85, 0x00, 0x00, 0x35, 0x85, 0x43, 0x00, 0x2b, 0x8c, 0x00, 0x00, 0x21, 0x87, 0x43,
+  0x00, 0x0e, 0x90, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c,
+  0x81, 0x3f, 0x01, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x2b, 0x85, 0x43, 0x00, 0x35, 0x8d, 0x00, 0x00,
+  0x26, 0x86, 0x43, 0x00, 0x29, 0x90, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00,
+  0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x1c, 0x86, 0x43, 0x00, 0x12,
+  0x8d, 0x00, 0x00, 0x32, 0x85, 0x43, 0x00, 0x3d, 0x90, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c,
+  0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x42, 0x85, 0x43,
+  0x00, 0x37, 0x8d, 0x00, 0x00, 0x12, 0x86, 0x43, 0x00, 0x0e, 0x8f, 0x00, 0x05, 0x27, 0x3f, 0x38,
+  0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00,
+  0x2b, 0x86, 0x43, 0x00, 0x2e, 0x8d, 0x00, 0x00, 0x42, 0x85, 0x43, 0x00, 0x21, 0x8f, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d,
+  0x86, 0x00, 0x00, 0x0e, 0x87, 0x43, 0x00, 0x30, 0x8c, 0x00, 0x00, 0x35, 0x85, 0x43, 0x00, 0x2b,
+  0x8f, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f,
+  0x01, 0x40, 0x1d, 0x87, 0x00, 0x00, 0x2e, 0x87, 0x43, 0x01, 0x3d, 0x14, 0x8a, 0x00, 0x00, 0x3d,
+  0x85, 0x43, 0x00, 0x30, 0x8f, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01,
+  0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x87, 0x00, 0x01, 0x05, 0x41, 0x88, 0x43, 0x01, 0x31,
+  0x10, 0x87, 0x00, 0x00, 0x12, 0x86, 0x43, 0x00, 0x31, 0x8f, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39,
+  0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x88, 0x00, 0x00, 0x18, 0x8a,
+  0x43, 0x02, 0x35, 0x25, 0x10, 0x83, 0x00, 0x01, 0x1f, 0x41, 0x86, 0x43, 0x00, 0x31, 0x8f, 0x00,
+  0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40,
+  0x1d, 0x89, 0x00, 0x00, 0x26, 0x8d, 0x43, 0x82, 0x42, 0x88, 0x43, 0x00, 0x30, 0x8f, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d,
+  0x8a, 0x00, 0x00, 0x29, 0x98, 0x43, 0x00, 0x29, 0x8f, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c,
+  0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8b, 0x00, 0x00, 0x25, 0x97,
+  0x43, 0x00, 0x14, 0x8f, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24,
+  0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8c, 0x00, 0x01, 0x12, 0x3d, 0x94, 0x43, 0x00, 0x3d, 0x90,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40,
+  0x1d, 0x8e, 0x00, 0x00, 0x2b, 0x93, 0x43, 0x00, 0x26, 0x90, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39,
+  0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8f, 0x00, 0x01, 0x10,
+  0x31, 0x90, 0x43, 0x00, 0x35, 0x91, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00,
+  0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x91, 0x00, 0x02, 0x12, 0x2e, 0x42, 0x8c, 0x43,
+  0x01, 0x3d, 0x05, 0x91, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24,
+  0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x93, 0x00, 0x02, 0x08, 0x1f, 0x31, 0x89, 0x43, 0x01, 0x2e,
+  0x05, 0x92, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81,
+  0x3f, 0x01, 0x40, 0x1d, 0x97, 0x00, 0x08, 0x10, 0x25, 0x2b, 0x2e, 0x30, 0x2e, 0x2b, 0x21, 0x03,
+  0x85, 0x00, 0x00, 0x0a, 0x8d, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05,
+  0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x86, 0x00, 0x02, 0x32, 0x2b, 0x18, 0x9c, 0x00, 0x03, 0x2b,
+  0x3d, 0x2b, 0x14, 0x8a, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24,
+  0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x3d, 0x81, 0x43, 0x02, 0x41, 0x2e, 0x16,
+  0x99, 0x00, 0x00, 0x2b, 0x82, 0x43, 0x02, 0x3d, 0x2b, 0x12, 0x87, 0x00, 0x05, 0x27, 0x3f, 0x38,
+  0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00,
+  0x37, 0x84, 0x43, 0x03, 0x41, 0x30, 0x18, 0x03, 0x95, 0x00, 0x00, 0x2b, 0x85, 0x43, 0x01, 0x41,
+  0x0c, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81,
+  0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37, 0x87, 0x43, 0x02, 0x41, 0x30, 0x1c, 0x93, 0x00,
+  0x00, 0x2b, 0x86, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88,
+  0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37, 0x8b, 0x43, 0x02,
+  0x30, 0x1f, 0x08, 0x8f, 0x00, 0x00, 0x2b, 0x86, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f,
+  0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x86, 0x00, 0x00,
+  0x37, 0x8d, 0x43, 0x03, 0x42, 0x32, 0x21, 0x03, 0x8c, 0x00, 0x00, 0x2b, 0x86, 0x43, 0x00, 0x10,
+  0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f,
+  0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x37, 0x91, 0x43, 0x02, 0x32, 0x21, 0x08, 0x89, 0x00, 0x00,
+  0x2b, 0x86, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00,
+  0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x3d, 0x94, 0x43, 0x02, 0x35,
+  0x21, 0x0e, 0x86, 0x00, 0x00, 0x2b, 0x86, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38,
+  0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x01,
+  0x21, 0x37, 0x95, 0x43, 0x03, 0x42, 0x35, 0x25, 0x05, 0x83, 0x00, 0x00, 0x2b, 0x86, 0x43, 0x00,
+  0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81,
+  0x3f, 0x01, 0x40, 0x1d, 0x88, 0x00, 0x03, 0x03, 0x26, 0x35, 0x42, 0x95, 0x43, 0x04, 0x35, 0x26,
+  0x10, 0x00, 0x29, 0x86, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b,
+  0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x8b, 0x00, 0x02, 0x0e, 0x21, 0x32, 0x96,
+  0x43, 0x81, 0x35, 0x86, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b,
+  0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8e, 0x00, 0x02, 0x08, 0x21, 0x31,
+  0x9c, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01,
+  0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x91, 0x00, 0x03, 0x03, 0x1f, 0x32, 0x42, 0x98, 0x43,
+  0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c,
+  0x81, 0x3f, 0x01, 0x40, 0x1d, 0x94, 0x00, 0x02, 0x08, 0x1c, 0x31, 0x96, 0x43, 0x00, 0x10, 0x85,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01,
+  0x40, 0x1d, 0x98, 0x00, 0x02, 0x1c, 0x30, 0x41, 0x92, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27,
+  0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x9b, 0x00,
+  0x02, 0x18, 0x2e, 0x41, 0x8f, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c,
+  0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x9e, 0x00, 0x02, 0x16, 0x2b,
+  0x41, 0x8c, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00,
+  0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0xa1, 0x00, 0x02, 0x16, 0x2b, 0x3d, 0x89, 0x43,
+  0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c,
+  0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8c, 0x00, 0x00, 0x1c, 0x81, 0x25, 0x00, 0x18, 0x93, 0x00, 0x02,
+  0x14, 0x2b, 0x41, 0x86, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b,
+  0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x89, 0x00, 0x01, 0x18, 0x35, 0x85,
+  0x43, 0x03, 0x41, 0x30, 0x1c, 0x06, 0x90, 0x00, 0x00, 0x2b, 0x86, 0x43, 0x00, 0x10, 0x85, 0x00,
+  0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d,
+  0x88, 0x00, 0x00, 0x2b, 0x8a, 0x43, 0x02, 0x42, 0x30, 0x16, 0x8e, 0x00, 0x00, 0x2b, 0x86, 0x43,
+  0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c,
+  0x81, 0x3f, 0x01, 0x40, 0x1d, 0x87, 0x00, 0x00, 0x30, 0x8e, 0x43, 0x01, 0x35, 0x18, 0x8c, 0x00,
+  0x00, 0x2b, 0x86, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88,
+  0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x21, 0x91, 0x43, 0x01,
+  0x35, 0x14, 0x8a, 0x00, 0x00, 0x2b, 0x86, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38,
+  0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00,
+  0x41, 0x93, 0x43, 0x00, 0x2e, 0x89, 0x00, 0x00, 0x2b, 0x86, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d,
+  0x85, 0x00, 0x00, 0x21, 0x95, 0x43, 0x01, 0x41, 0x14, 0x87, 0x00, 0x00, 0x2b, 0x86, 0x43, 0x00,
+  0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f,
+  0x39, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x31, 0x97, 0x43, 0x00, 0x1f, 0x86, 0x00, 0x00, 0x2b, 0x86,
+  0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24,
+  0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x3d, 0x88, 0x43, 0x00, 0x42, 0x8e, 0x43,
+  0x00, 0x25, 0x85, 0x00, 0x00, 0x2b, 0x86, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38,
+  0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x84, 0x00, 0x01,
+  0x05, 0x41, 0x86, 0x43, 0x05, 0x32, 0x14, 0x08, 0x12, 0x29, 0x42, 0x8c, 0x43, 0x00, 0x21, 0x84,
+  0x00, 0x00, 0x2b, 0x86, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b,
+  0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x84, 0x00, 0x01, 0x08, 0x41, 0x85,
+  0x43, 0x00, 0x32, 0x84, 0x00, 0x00, 0x35, 0x8d, 0x43, 0x00, 0x14, 0x83, 0x00, 0x00, 0x2b, 0x86,
+  0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24,
+  0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x84, 0x00, 0x01, 0x05, 0x41, 0x85, 0x43, 0x00, 0x16, 0x84,
+  0x00, 0x00, 0x35, 0x84, 0x43, 0x00, 0x42, 0x87, 0x43, 0x00, 0x41, 0x83, 0x00, 0x02, 0x0c, 0x29,
+  0x35, 0x84, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00,
+  0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x37, 0x85, 0x43, 0x00, 0x0a, 0x84,
+  0x00, 0x00, 0x35, 0x84, 0x43, 0x01, 0x26, 0x29, 0x87, 0x43, 0x00, 0x2b, 0x85, 0x00, 0x02, 0x10,
+  0x26, 0x35, 0x81, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88,
+  0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x30, 0x85, 0x43, 0x00,
+  0x0c, 0x84, 0x00, 0x00, 0x35, 0x84, 0x43, 0x03, 0x25, 0x00, 0x18, 0x42, 0x85, 0x43, 0x01, 0x42,
+  0x0c, 0x87, 0x00, 0x02, 0x0a, 0x26, 0x0e, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b,
+  0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x25, 0x85, 0x43,
+  0x00, 0x1c, 0x84, 0x00, 0x00, 0x35, 0x84, 0x43, 0x00, 0x25, 0x81, 0x00, 0x00, 0x18, 0x86, 0x43,
+  0x00, 0x29, 0x90, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c,
+  0x81, 0x3f, 0x01, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x0c, 0x85, 0x43, 0x00, 0x2e, 0x84, 0x00, 0x00,
+  0x35, 0x84, 0x43, 0x00, 0x25, 0x82, 0x00, 0x00, 0x2b, 0x85, 0x43, 0x00, 0x3d, 0x90, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d,
+  0x86, 0x00, 0x00, 0x35, 0x85, 0x43, 0x00, 0x0e, 0x83, 0x00, 0x00, 0x35, 0x84, 0x43, 0x00, 0x25,
+  0x83, 0x00, 0x86, 0x43, 0x00, 0x0e, 0x8f, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88,
+  0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x1c, 0x85, 0x43, 0x00, 0x32,
+  0x83, 0x00, 0x00, 0x35, 0x84, 0x43, 0x00, 0x25, 0x83, 0x00, 0x00, 0x37, 0x85, 0x43, 0x00, 0x21,
+  0x8f, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f,
+  0x01, 0x40, 0x1d, 0x87, 0x00, 0x00, 0x3d, 0x85, 0x43, 0x00, 0x2e, 0x82, 0x00, 0x00, 0x35, 0x84,
+  0x43, 0x00, 0x25, 0x83, 0x00, 0x00, 0x30, 0x85, 0x43, 0x00, 0x2b, 0x8f, 0x00, 0x05, 0x27, 0x3f,
+  0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x87, 0x00,
+  0x00, 0x1f, 0x86, 0x43, 0x00, 0x21, 0x81, 0x00, 0x00, 0x35, 0x84, 0x43, 0x00, 0x25, 0x83, 0x00,
+  0x00, 0x30, 0x85, 0x43, 0x00, 0x30, 0x8f, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88,
+  0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x88, 0x00, 0x00, 0x35, 0x85, 0x43, 0x00,
+  0x21, 0x81, 0x00, 0x00, 0x35, 0x84, 0x43, 0x00, 0x25, 0x83, 0x00, 0x00, 0x3d, 0x85, 0x43, 0x00,
+  0x30, 0x8f, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81,
+  0x3f, 0x01, 0x40, 0x1d, 0x88, 0x00, 0x00, 0x0a, 0x85, 0x43, 0x00, 0x21, 0x81, 0x00, 0x00, 0x35,
+  0x84, 0x43, 0x00, 0x25, 0x82, 0x00, 0x00, 0x21, 0x86, 0x43, 0x00, 0x30, 0x8f, 0x00, 0x05, 0x27,
+  0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x89, 0x00,
+  0x00, 0x21, 0x84, 0x43, 0x00, 0x21, 0x81, 0x00, 0x00, 0x35, 0x84, 0x43, 0x00, 0x41, 0x81, 0x35,
+  0x00, 0x37, 0x87, 0x43, 0x00, 0x30, 0x8f, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88,
+  0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8a, 0x00, 0x00, 0x2b, 0x83, 0x43, 0x00,
+  0x21, 0x81, 0x00, 0x00, 0x35, 0x90, 0x43, 0x00, 0x29, 0x8f, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39,
+  0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8b, 0x00, 0x00, 0x2e,
+  0x82, 0x43, 0x00, 0x21, 0x81, 0x00, 0x00, 0x35, 0x90, 0x43, 0x00, 0x16, 0x8f, 0x00, 0x05, 0x27,
+  0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8c,
+  0x00, 0x00, 0x2b, 0x81, 0x43, 0x00, 0x21, 0x81, 0x00, 0x00, 0x35, 0x8f, 0x43, 0x00, 0x41, 0x90,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01,
+  0x40, 0x1d, 0x8d, 0x00, 0x02, 0x1c, 0x42, 0x25, 0x81, 0x00, 0x00, 0x35, 0x8f, 0x43, 0x00, 0x25,
+  0x90, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39,
+  0x40, 0x1d, 0x8e, 0x00, 0x01, 0x0a, 0x10, 0x81, 0x00, 0x00, 0x35, 0x8e, 0x43, 0x00, 0x35, 0x91,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01,
+  0x40, 0x1d, 0x92, 0x00, 0x00, 0x2b, 0x8d, 0x43, 0x00, 0x35, 0x92, 0x00, 0x05, 0x27, 0x3f, 0x38,
+  0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x93, 0x00, 0x03,
+  0x08, 0x25, 0x35, 0x42, 0x87, 0x43, 0x01, 0x42, 0x29, 0x93, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39,
+  0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x96, 0x00, 0x09, 0x0a,
+  0x18, 0x29, 0x30, 0x32, 0x35, 0x31, 0x2b, 0x1c, 0x06, 0x94, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39,
+  0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0xb5, 0x00, 0x05, 0x27,
+  0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0xb5, 0x00,
+  0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40,
+  0x1d, 0x8d, 0x00, 0x02, 0x08, 0x16, 0x1f, 0x81, 0x25, 0x02, 0x1f, 0x14, 0x08, 0x9f, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d,
+  0x8a, 0x00, 0x02, 0x10, 0x2b, 0x3d, 0x87, 0x43, 0x03, 0x41, 0x32, 0x26, 0x14, 0x9b, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d,
+  0x89, 0x00, 0x00, 0x2e, 0x8e, 0x43, 0x02, 0x41, 0x2b, 0x12, 0x98, 0x00, 0x05, 0x27, 0x3f, 0x38,
+  0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x87, 0x00, 0x01,
+  0x0a, 0x3d, 0x92, 0x43, 0x02, 0x3d, 0x25, 0x0a, 0x95, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c,
+  0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x87, 0x00, 0x00, 0x37, 0x95, 0x43,
+  0x02, 0x42, 0x2b, 0x08, 0x93, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01,
+  0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x2b, 0x98, 0x43, 0x01, 0x42, 0x29,
+  0x92, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f,
+  0x01, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x0a, 0x9b, 0x43, 0x01, 0x3d, 0x18, 0x90, 0x00, 0x05, 0x27,
+  0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x85,
+  0x00, 0x00, 0x25, 0x9d, 0x43, 0x00, 0x2b, 0x8f, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b,
+  0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x35, 0x8b, 0x43,
+  0x82, 0x42, 0x8f, 0x43, 0x01, 0x37, 0x0c, 0x8d, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b,
+  0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x3d, 0x88, 0x43, 0x09,
+  0x37, 0x25, 0x14, 0x0c, 0x0a, 0x0e, 0x16, 0x21, 0x30, 0x41, 0x8c, 0x43, 0x01, 0x42, 0x10, 0x8c,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01,
+  0x40, 0x1d, 0x84, 0x00, 0x01, 0x06, 0x41, 0x87, 0x43, 0x00, 0x25, 0x89, 0x00, 0x02, 0x12, 0x2b,
+  0x42, 0x8a, 0x43, 0x01, 0x42, 0x16, 0x8b, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88,
+  0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x84, 0x00, 0x01, 0x08, 0x42, 0x86, 0x43,
+  0x00, 0x2b, 0x8d, 0x00, 0x01, 0x21, 0x37, 0x8a, 0x43, 0x00, 0x14, 0x8a, 0x00, 0x05, 0x27, 0x3f,
+  0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x84, 0x00,
+  0x01, 0x05, 0x41, 0x86, 0x43, 0x00, 0x10, 0x8f, 0x00, 0x01, 0x1f, 0x3d, 0x88, 0x43, 0x01, 0x41,
+  0x0a, 0x89, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81,
+  0x3f, 0x01, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x3d, 0x85, 0x43, 0x01, 0x41, 0x03, 0x91, 0x00, 0x01,
+  0x25, 0x41, 0x87, 0x43, 0x00, 0x3d, 0x89, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88,
+  0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x35, 0x85, 0x43, 0x00, 0x3d,
+  0x93, 0x00, 0x01, 0x0c, 0x37, 0x87, 0x43, 0x00, 0x2b, 0x88, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39,
+  0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x85, 0x00, 0x00, 0x2b,
+  0x86, 0x43, 0x00, 0x0c, 0x94, 0x00, 0x00, 0x32, 0x87, 0x43, 0x00, 0x10, 0x87, 0x00, 0x05, 0x27,
+  0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x85,
+  0x00, 0x00, 0x1f, 0x86, 0x43, 0x00, 0x18, 0x95, 0x00, 0x00, 0x35, 0x86, 0x43, 0x00, 0x32, 0x87,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01,
+  0x40, 0x1d, 0x85, 0x00, 0x00, 0x05, 0x86, 0x43, 0x00, 0x2b, 0x95, 0x00, 0x01, 0x08, 0x42, 0x86,
+  0x43, 0x00, 0x12, 0x86, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24,
+  0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x32, 0x85, 0x43, 0x00, 0x42, 0x96, 0x00,
+  0x00, 0x1c, 0x86, 0x43, 0x00, 0x2e, 0x86, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88,
+  0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x86, 0x00, 0x00, 0x1f, 0x86, 0x43, 0x00, 0x25,
+  0x96, 0x00, 0x00, 0x35, 0x85, 0x43, 0x00, 0x41, 0x86, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c,
+  0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x87, 0x00, 0x00, 0x42, 0x85,
+  0x43, 0x01, 0x42, 0x0c, 0x95, 0x00, 0x00, 0x21, 0x86, 0x43, 0x00, 0x10, 0x85, 0x00, 0x05, 0x27,
+  0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x87,
+  0x00, 0x00, 0x26, 0x86, 0x43, 0x01, 0x37, 0x03, 0x95, 0x00, 0x86, 0x43, 0x00, 0x26, 0x85, 0x00,
+  0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40,
+  0x1d, 0x87, 0x00, 0x01, 0x05, 0x41, 0x86, 0x43, 0x01, 0x37, 0x0c, 0x94, 0x00, 0x86, 0x43, 0x00,
+  0x2e, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81,
+  0x3f, 0x01, 0x40, 0x1d, 0x88, 0x00, 0x00, 0x1c, 0x88, 0x43, 0x01, 0x2b, 0x0a, 0x92, 0x00, 0x86,
+  0x43, 0x00, 0x31, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24,
+  0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x89, 0x00, 0x00, 0x31, 0x89, 0x43, 0x00, 0x26, 0x91, 0x00, 0x86,
+  0x43, 0x00, 0x37, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24,
+  0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x89, 0x00, 0x01, 0x03, 0x37, 0x88, 0x43, 0x00, 0x31, 0x90,
+  0x00, 0x00, 0x10, 0x86, 0x43, 0x00, 0x3d, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b,
+  0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8a, 0x00, 0x01, 0x08, 0x3d, 0x87,
+  0x43, 0x00, 0x31, 0x90, 0x00, 0x00, 0x2e, 0x86, 0x43, 0x00, 0x37, 0x85, 0x00, 0x05, 0x27, 0x3f,
+  0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8b, 0x00,
+  0x01, 0x08, 0x3d, 0x86, 0x43, 0x00, 0x31, 0x8f, 0x00, 0x00, 0x21, 0x87, 0x43, 0x00, 0x31, 0x85,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01,
+  0x40, 0x1d, 0x8d, 0x00, 0x00, 0x30, 0x85, 0x43, 0x00, 0x31, 0x89, 0x00, 0x05, 0x06, 0x31, 0x26,
+  0x1f, 0x2b, 0x37, 0x88, 0x43, 0x00, 0x2e, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b,
+  0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x8e, 0x00, 0x00, 0x26, 0x84, 0x43, 0x00,
+  0x31, 0x89, 0x00, 0x00, 0x05, 0x8d, 0x43, 0x00, 0x21, 0x85, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39,
+  0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x8f, 0x00, 0x01, 0x0e,
+  0x35, 0x82, 0x43, 0x00, 0x31, 0x89, 0x00, 0x00, 0x05, 0x8d, 0x43, 0x00, 0x08, 0x85, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d,
+  0x91, 0x00, 0x03, 0x1c, 0x35, 0x43, 0x31, 0x89, 0x00, 0x00, 0x05, 0x8c, 0x43, 0x00, 0x31, 0x86,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01,
+  0x40, 0x1d, 0x93, 0x00, 0x01, 0x12, 0x1f, 0x89, 0x00, 0x00, 0x05, 0x8c, 0x43, 0x00, 0x10, 0x86,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01,
+  0x40, 0x1d, 0x9f, 0x00, 0x00, 0x05, 0x8b, 0x43, 0x00, 0x21, 0x87, 0x00, 0x05, 0x27, 0x3f, 0x38,
+  0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0x9f, 0x00, 0x00, 0x05,
+  0x8a, 0x43, 0x00, 0x26, 0x88, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01,
+  0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0x9f, 0x00, 0x00, 0x05, 0x88, 0x43, 0x01, 0x41, 0x1c,
+  0x89, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f,
+  0x01, 0x40, 0x1d, 0xa0, 0x00, 0x02, 0x25, 0x31, 0x3d, 0x82, 0x43, 0x02, 0x41, 0x35, 0x26, 0x8b,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01,
+  0x40, 0x1d, 0xa3, 0x00, 0x00, 0x0c, 0x81, 0x0e, 0x00, 0x08, 0x8d, 0x00, 0x05, 0x27, 0x3f, 0x38,
+  0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81, 0x3f, 0x01, 0x40, 0x1d, 0xb5, 0x00, 0x05,
+  0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0xb5,
+  0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40,
+  0x1d, 0xb5, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x01, 0x24, 0x3c, 0x81,
+  0x3f, 0x01, 0x40, 0x1d, 0xb5, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05,
+  0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0xb5, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88,
+  0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x40, 0x1d, 0xb5, 0x00, 0x05, 0x27, 0x3f, 0x38, 0x39, 0x3c,
+  0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x3a, 0x1d, 0xb5, 0x00, 0x05, 0x27, 0x3f, 0x38,
+  0x39, 0x3c, 0x1b, 0x88, 0x00, 0x05, 0x24, 0x3c, 0x3f, 0x39, 0x3a, 0x1d, 0xb5, 0x00, 0x05, 0x27,
+  0x3f, 0x38, 0x39, 0x3c, 0x1b, 0x88, 0x00, 0x00, 0x24, 0x81, 0x3c, 0x02, 0x3f, 0x3c, 0x20, 0xb1,
+  0x00, 0x81, 0x02, 0x07, 0x01, 0x00, 0x2a, 0x3e, 0x3c, 0x3f, 0x3c, 0x19, 0x88, 0x00, 0x05, 0x24,
+  0x3f, 0x38, 0x3e, 0x38, 0x28, 0x81, 0x00, 0x81, 0x02, 0xad, 0x00, 0x81, 0x02, 0x81, 0x00, 0x05,
+  0x2c, 0x3e, 0x39, 0x3f, 0x3c, 0x1a, 0x88, 0x00, 0x05, 0x20, 0x3f, 0x38, 0x3f, 0x38, 0x33, 0x82,
+  0x00, 0x00, 0x02, 0xad, 0x00, 0x00, 0x02, 0x81, 0x00, 0x02, 0x0f, 0x33, 0x3e, 0x81, 0x3f, 0x01,
+  0x36, 0x17, 0x88, 0x00, 0x06, 0x1a, 0x3a, 0x3c, 0x38, 0x3f, 0x3b, 0x11, 0x81, 0x00, 0x00, 0x01,
+  0xad, 0x00, 0x00, 0x02, 0x81, 0x00, 0x02, 0x1e, 0x3b, 0x3e, 0x81, 0x3f, 0x01, 0x34, 0x11, 0x88,
+  0x00, 0x01, 0x0b, 0x36, 0x83, 0x38, 0x03, 0x2d, 0x04, 0x00, 0x01, 0xad, 0x00, 0x09, 0x01, 0x00,
+  0x0d, 0x33, 0x3c, 0x38, 0x3f, 0x3e, 0x2f, 0x07, 0x89, 0x00, 0x01, 0x2d, 0x39, 0x82, 0x38, 0x03,
+  0x3c, 0x20, 0x00, 0x01, 0xad, 0x00, 0x03, 0x01, 0x04, 0x27, 0x3f, 0x81, 0x38, 0x02, 0x3f, 0x40,
+  0x24, 0x88, 0x00, 0x81, 0x01, 0x03, 0x1e, 0x3b, 0x38, 0x3c, 0x81, 0x38, 0x01, 0x3b, 0x22, 0xae,
+  0x00, 0x03, 0x07, 0x28, 0x3b, 0x38, 0x82, 0x3f, 0x01, 0x36, 0x11, 0x88, 0x00, 0x00, 0x01, 0x81,
+  0x00, 0x02, 0x2d, 0x39, 0x3f, 0x81, 0x3c, 0x04, 0x3f, 0x3c, 0x2f, 0x19, 0x07, 0xa9, 0x00, 0x03,
+  0x0b, 0x1e, 0x33, 0x40, 0x81, 0x3f, 0x06, 0x3a, 0x3f, 0x3a, 0x27, 0x00, 0x02, 0x01, 0x87, 0x00,
+  0x0b, 0x02, 0x01, 0x13, 0x34, 0x3e, 0x3f, 0x3c, 0x3f, 0x38, 0x3c, 0x3a, 0x2f, 0x83, 0x27, 0xa1,
+  0x24, 0x82, 0x27, 0x03, 0x2c, 0x33, 0x40, 0x39, 0x84, 0x3f, 0x03, 0x2f, 0x0b, 0x00, 0x02, 0x89,
+  0x00, 0x05, 0x02, 0x00, 0x1a, 0x34, 0x39, 0x3f, 0x84, 0x38, 0x00, 0x3f, 0x82, 0x3a, 0x00, 0x39,
+  0x9f, 0x3f, 0x00, 0x39, 0x82, 0x3a, 0x81, 0x3f, 0x00, 0x38, 0x81, 0x3f, 0x04, 0x3e, 0x3f, 0x39,
+  0x33, 0x11, 0x8c, 0x00, 0x00, 0x02, 0x81, 0x00, 0x02, 0x1b, 0x34, 0x3f, 0x81, 0x39, 0x81, 0x3f,
+  0x00, 0x3c, 0x83, 0x38, 0xa1, 0x3c, 0x82, 0x3f, 0x00, 0x39, 0x81, 0x3f, 0x81, 0x39, 0x81, 0x3f,
+  0x01, 0x2f, 0x13, 0x8f, 0x00, 0x09, 0x01, 0x00, 0x11, 0x2c, 0x36, 0x3f, 0x3c, 0x40, 0x3f, 0x3c,
+  0xa3, 0x3f, 0x83, 0x39, 0x07, 0x3a, 0x3f, 0x39, 0x38, 0x3f, 0x34, 0x27, 0x0f, 0x90, 0x00, 0x81,
+  0x02, 0x81, 0x00, 0x05, 0x13, 0x2c, 0x33, 0x3b, 0x3a, 0x3c, 0x83, 0x3a, 0xa3, 0x3c, 0x05, 0x3f,
+  0x39, 0x36, 0x33, 0x27, 0x11, 0x81, 0x00, 0x00, 0x02, 0x8f, 0x00, 0x81, 0x02, 0x01, 0x00, 0x02,
+  0x81, 0x00, 0x01, 0x09, 0x11, 0x81, 0x17, 0x81, 0x1a, 0x00, 0x17, 0xa1, 0x1a, 0x82, 0x17, 0x03,
+  0x1a, 0x15, 0x0f, 0x07, 0x82, 0x00, 0x00, 0x01, 0xe5, 0x00, 0x00, 0x01, 0x82, 0x00, 0x9f, 0x01,
+  0x00, 0x00, 0x82, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xd3, 0x00,
+};
+
+IMAGE_ASSET_DECLARE(MotecLogo);
+const ImageAsset MotecLogo_asset = {
+  .name = "MotecLogo",
+  .data = MotecLogo_rle,
+  .data_size = sizeof(MotecLogo_rle),
+  .raw_size = 50625,
+  .crc32 = 0x4369c84a,
+  .w = 75,
+  .h = 225,
+  .codec = IMAGE_CODEC_RLE_PALETTE,
+};
@@ -0,0 +1,89 @@
+// Generated by tools/compress_images.py from images/PeakRecall.h - do not edit.
+// 44x48 RGB565A8, planar RLE: 6336 -> 1119 bytes. Decoded on first use by ImageCache.
+#pragma once
+#include "../ImageCodec.h"
+
+static const uint8_t PeakRecall_rle[] = {
+  0x97, 0x00, 0x00, 0x00, 0x63, 0x00, 0x81, 0x00, 0x00, 0x00, 0x43, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x25, 0x10, 0xff, 0x00, 0x00, 0x84, 0x00, 0x00, 0x01, 0x2c, 0x76, 0x2f, 0x87, 0xa9, 0x00, 0x00,
+  0x01, 0xa5, 0x32, 0x4c, 0x7e, 0xa9, 0x00, 0x00, 0x01, 0xa4, 0x32, 0x4c, 0x7e, 0x92, 0x00, 0x00,
+  0x00, 0x6b, 0x3a, 0x95, 0x00, 0x00, 0x01, 0xa4, 0x32, 0x4c, 0x86, 0x92, 0x00, 0x00, 0x02, 0x95,
+  0x6c, 0xd7, 0x74, 0xc9, 0x29, 0x93, 0x00, 0x00, 0x02, 0xa4, 0x3a, 0x6e, 0xa7, 0xcd, 0x96, 0x81,
+  0xce, 0x96, 0x01, 0xaf, 0x96, 0xaf, 0x8e, 0x81, 0x90, 0x8e, 0x0f, 0x71, 0x8e, 0x51, 0x8e, 0x52,
+  0x8e, 0x32, 0x86, 0x13, 0x86, 0xf3, 0x85, 0xd4, 0x85, 0xb4, 0x85, 0x95, 0x85, 0x75, 0x85, 0x56,
+  0x85, 0x36, 0x7d, 0x37, 0x85, 0x0f, 0x4b, 0xb7, 0x7c, 0x6d, 0x42, 0x92, 0x00, 0x00, 0x01, 0xa4,
+  0x3a, 0x4b, 0x8e, 0x89, 0x20, 0x00, 0x8a, 0x00, 0x00, 0x02, 0xc9, 0x31, 0x77, 0x84, 0x10, 0x5b,
+  0x91, 0x00, 0x00, 0x01, 0xa4, 0x3a, 0x4b, 0x96, 0x95, 0x00, 0x00, 0x02, 0xe5, 0x18, 0x57, 0x8c,
+  0xd0, 0x5a, 0x90, 0x00, 0x00, 0x01, 0xa4, 0x3a, 0x4b, 0x96, 0x94, 0x00, 0x00, 0x02, 0x62, 0x08,
+  0xb3, 0x7b, 0xf5, 0x7b, 0x91, 0x00, 0x00, 0x03, 0xa4, 0x42, 0x2c, 0xaf, 0x0a, 0x96, 0xea, 0x95,
+  0x81, 0xeb, 0x95, 0x81, 0xcc, 0x95, 0x81, 0xad, 0x8d, 0x0e, 0x8e, 0x8d, 0x6e, 0x8d, 0x6f, 0x8d,
+  0x4f, 0x8d, 0x2f, 0x8d, 0x10, 0x8d, 0xf0, 0x84, 0xd1, 0x84, 0xb1, 0x84, 0x92, 0x84, 0x72, 0x84,
+  0x52, 0x84, 0xc8, 0x39, 0x54, 0x8c, 0x71, 0x73, 0x92, 0x00, 0x00, 0x02, 0xa4, 0x42, 0x8b, 0xa6,
+  0x85, 0x53, 0x83, 0x66, 0x53, 0x82, 0x47, 0x53, 0x81, 0x28, 0x53, 0x81, 0x08, 0x53, 0x81, 0xe9,
+  0x52, 0x81, 0xc9, 0x4a, 0x81, 0xaa, 0x4a, 0x03, 0x8a, 0x4a, 0x94, 0x94, 0xd5, 0x9c, 0xed, 0x62,
+  0x93, 0x00, 0x00, 0x01, 0xa3, 0x42, 0x4a, 0xa6, 0x92, 0x00, 0x00, 0x01, 0x4e, 0x6b, 0x2a, 0x4a,
+  0x94, 0x00, 0x00, 0x01, 0xa3, 0x42, 0x49, 0xa6, 0x8b, 0x00, 0x00, 0x01, 0x87, 0x4a, 0xae, 0x8c,
+  0x9b, 0x00, 0x00, 0x03, 0xa3, 0x42, 0xaa, 0xb6, 0x46, 0x74, 0x26, 0x74, 0x81, 0x27, 0x74, 0x81,
+  0x07, 0x74, 0x82, 0xe8, 0x73, 0x00, 0xc9, 0x73, 0x81, 0xa9, 0x73, 0x03, 0x6c, 0x8c, 0xd1, 0xb5,
+  0x30, 0xa5, 0xa5, 0x31, 0x99, 0x00, 0x00, 0x01, 0x83, 0x4a, 0xea, 0xc6, 0x81, 0x48, 0x95, 0x01,
+  0x28, 0x95, 0x29, 0x95, 0x81, 0x09, 0x95, 0x81, 0xea, 0x8c, 0x00, 0xcb, 0x8c, 0x81, 0xab, 0x8c,
+  0x05, 0x8c, 0x8c, 0x6c, 0x8c, 0x29, 0x63, 0x4a, 0x6b, 0x51, 0xb5, 0x68, 0x52, 0x98, 0x00, 0x00,
+  0x01, 0x83, 0x4a, 0x28, 0xb6, 0x8e, 0x00, 0x00, 0x02, 0x67, 0x52, 0x11, 0xb5, 0x2b, 0x73, 0x97,
+  0x00, 0x00, 0x01, 0x83, 0x4a, 0x28, 0xb6, 0x8f, 0x00, 0x00, 0x01, 0xcc, 0x93, 0xb0, 0xb4, 0x97,
+  0x00, 0x00, 0x01, 0x82, 0x4a, 0x28, 0xbe, 0x8d, 0x00, 0x00, 0x02, 0xc2, 0x18, 0x6d, 0xa4, 0x6e,
+  0xac, 0x98, 0x00, 0x00, 0x11, 0x82, 0x4a, 0x29, 0xdf, 0x88, 0xce, 0x89, 0xce, 0x69, 0xce, 0x69,
+  0xc6, 0x4a, 0xc6, 0x4a, 0xce, 0x2b, 0xc6, 0x0b, 0xc6, 0xeb, 0xc5, 0xcc, 0xc5, 0xac, 0xc5, 0x8d,
+  0xc5, 0x8e, 0xcd, 0xac, 0xac, 0xee, 0xbc, 0xcb, 0x93, 0x99, 0x00, 0x00, 0x01, 0x82, 0x52, 0x07,
+  0xbe, 0x8b, 0x00, 0x00, 0x02, 0x07, 0x73, 0xae, 0xd5, 0x08, 0x7b, 0x9a, 0x00, 0x00, 0x01, 0x82,
+  0x52, 0x07, 0xbe, 0x8c, 0x00, 0x00, 0x00, 0xe4, 0x49, 0x9b, 0x00, 0x00, 0x01, 0x82, 0x52, 0x06,
+  0xc6, 0x9b, 0x00, 0x00, 0x01, 0xd2, 0xca, 0xcd, 0x91, 0x8b, 0x00, 0x00, 0x02, 0x82, 0x52, 0xe7,
+  0xe6, 0x06, 0xce, 0x81, 0x07, 0xce, 0x1b, 0xe7, 0xcd, 0xc7, 0xcd, 0xa8, 0xcd, 0xa8, 0xc5, 0x88,
+  0xc5, 0x69, 0xc5, 0x49, 0xc5, 0x29, 0xc5, 0x0a, 0xc5, 0xea, 0xc4, 0xcb, 0xc4, 0xab, 0xc4, 0x6b,
+  0xc4, 0x4c, 0xc4, 0x2c, 0xc4, 0x0c, 0xc4, 0xcd, 0xc3, 0xad, 0xc3, 0x8d, 0xc3, 0x4e, 0xc3, 0x2e,
+  0xc3, 0x0e, 0xc3, 0xcf, 0xba, 0xaf, 0xba, 0x90, 0xba, 0xb2, 0xca, 0x0f, 0xaa, 0xef, 0xa9, 0x8a,
+  0x00, 0x00, 0x01, 0x82, 0x52, 0x26, 0xce, 0x82, 0x62, 0x52, 0x82, 0x42, 0x52, 0x00, 0x22, 0x52,
+  0x81, 0x23, 0x52, 0x82, 0x03, 0x52, 0x00, 0xe3, 0x51, 0x81, 0xc4, 0x51, 0x81, 0xa4, 0x51, 0x81,
+  0x84, 0x51, 0x01, 0x64, 0x51, 0x65, 0x49, 0x81, 0x45, 0x49, 0x00, 0x25, 0x49, 0x81, 0x05, 0x49,
+  0x81, 0xe6, 0x48, 0x04, 0xa5, 0x38, 0x00, 0x00, 0x8d, 0x91, 0xf1, 0xb9, 0x66, 0x40, 0x88, 0x00,
+  0x00, 0x01, 0x61, 0x52, 0xe5, 0xcd, 0x9e, 0x00, 0x00, 0x02, 0x0a, 0x71, 0xd1, 0xc9, 0x86, 0x48,
+  0x87, 0x00, 0x00, 0x01, 0x61, 0x52, 0xe5, 0xcd, 0x9d, 0x00, 0x00, 0x02, 0x01, 0x10, 0x8d, 0xa9,
+  0x8f, 0xb9, 0x88, 0x00, 0x00, 0x01, 0x61, 0x52, 0x65, 0xde, 0x81, 0x83, 0xa4, 0x81, 0x64, 0xa4,
+  0x81, 0x44, 0xa4, 0x00, 0x24, 0x9c, 0x81, 0x05, 0x9c, 0x16, 0xe5, 0x9b, 0xc5, 0x9b, 0xa6, 0x9b,
+  0x86, 0x9b, 0x66, 0x9b, 0x46, 0x9b, 0x27, 0x9b, 0x07, 0x9b, 0xe7, 0x9a, 0xc7, 0x9a, 0xa8, 0x9a,
+  0x88, 0x9a, 0x68, 0x9a, 0x48, 0x9a, 0x29, 0x9a, 0x09, 0x9a, 0xe9, 0x99, 0xc9, 0x99, 0xaa, 0x99,
+  0x69, 0x89, 0x64, 0x38, 0xce, 0xc1, 0x6c, 0xa1, 0x89, 0x00, 0x00, 0x04, 0x61, 0x52, 0x65, 0xde,
+  0xa3, 0xa4, 0x83, 0xa4, 0x63, 0xa4, 0x81, 0x64, 0xa4, 0x01, 0x44, 0xa4, 0x24, 0xa4, 0x81, 0x05,
+  0xa4, 0x15, 0xe5, 0xa3, 0xc5, 0xa3, 0xa5, 0xa3, 0x86, 0xa3, 0x66, 0xa3, 0x46, 0xa3, 0x26, 0xa3,
+  0x07, 0xa3, 0xe7, 0xa2, 0xc7, 0x9a, 0xa7, 0x9a, 0x88, 0x9a, 0x68, 0x9a, 0x48, 0x9a, 0x29, 0x9a,
+  0x09, 0x9a, 0xe9, 0x99, 0xc9, 0x99, 0xaa, 0x99, 0x6f, 0xe2, 0x0e, 0xd2, 0x29, 0x89, 0x8a, 0x00,
+  0x00, 0x01, 0x61, 0x52, 0xc4, 0xcd, 0x9b, 0x00, 0x00, 0x01, 0x0c, 0xc2, 0xe6, 0x68, 0x8b, 0x00,
+  0x00, 0x01, 0x61, 0x52, 0xc4, 0xcd, 0x88, 0x00, 0x00, 0x00, 0xa4, 0x9b, 0x9f, 0x00, 0x00, 0x05,
+  0x61, 0x5a, 0xe3, 0xd5, 0x21, 0x4a, 0x01, 0x4a, 0x01, 0x52, 0x01, 0x4a, 0x82, 0xe1, 0x49, 0x81,
+  0xc1, 0x49, 0x02, 0x86, 0xed, 0xe6, 0xdc, 0xc1, 0x59, 0x9d, 0x00, 0x00, 0x01, 0x61, 0x5a, 0xa4,
+  0xf6, 0x81, 0xc3, 0xd5, 0x00, 0xa4, 0xd5, 0x81, 0x84, 0xd5, 0x07, 0x64, 0xd5, 0x44, 0xd5, 0x24,
+  0xd5, 0x05, 0xd5, 0x84, 0xc4, 0xc3, 0x7a, 0xe6, 0xe4, 0x83, 0x7a, 0x9c, 0x00, 0x00, 0x01, 0x60,
+  0x5a, 0xc3, 0xd5, 0x8a, 0x00, 0x00, 0x02, 0xc1, 0x59, 0x85, 0xdc, 0x23, 0xa3, 0x9b, 0x00, 0x00,
+  0x01, 0x60, 0x5a, 0xa2, 0xd5, 0x8b, 0x00, 0x00, 0x02, 0xa1, 0x51, 0xc6, 0xf4, 0x02, 0x6a, 0x9a,
+  0x00, 0x00, 0x01, 0x60, 0x5a, 0xa2, 0xd5, 0x8a, 0x00, 0x00, 0x02, 0x21, 0x6a, 0x85, 0xe4, 0xc3,
+  0x92, 0x9b, 0x00, 0x00, 0x0e, 0x60, 0x5a, 0xa3, 0xf6, 0x02, 0xe6, 0xe2, 0xe5, 0xe3, 0xe5, 0xc3,
+  0xe5, 0xa3, 0xe5, 0x83, 0xe5, 0x63, 0xe5, 0x43, 0xe5, 0x23, 0xe5, 0xa3, 0xd4, 0x02, 0x93, 0xc4,
+  0xe4, 0x21, 0x6a, 0x9c, 0x00, 0x00, 0x01, 0x60, 0x5a, 0xa2, 0xd5, 0x88, 0x00, 0x00, 0x02, 0x44,
+  0xf5, 0xa3, 0xdc, 0x60, 0x49, 0x9d, 0x00, 0x00, 0x01, 0x60, 0x5a, 0xa1, 0xd5, 0x88, 0x00, 0x00,
+  0x00, 0x21, 0x93, 0x9f, 0x00, 0x00, 0x01, 0x40, 0x5a, 0xa1, 0xd5, 0xa9, 0x00, 0x00, 0x01, 0x40,
+  0x5a, 0xa1, 0xd5, 0xa9, 0x00, 0x00, 0x01, 0x40, 0x5a, 0xa1, 0xd5, 0xa9, 0x00, 0x00, 0x01, 0xa0,
+  0x41, 0xa1, 0xb4, 0xff, 0x00, 0x00, 0xac, 0x00, 0x00, 0xaa, 0xff, 0x00, 0xfd, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff,
+};
+
+IMAGE_ASSET_DECLARE(PeakRecall);
+const ImageAsset PeakRecall_asset = {
+  .name = "PeakRecall",
+  .data = PeakRecall_rle,
+  .data_size = sizeof(PeakRecall_rle),
+  .raw_size = 6336,
+  .crc32 = 0x2fe28e81,
+  .w = 44,
+  .h = 48,
+  .codec = IMAGE_CODEC_RLE_PLANAR,
+};
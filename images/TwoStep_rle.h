@@ -0,0 +1,106 @@
+// Generated by tools/compress_images.py from images/TwoStep.h - do not edit.
+// 48x48 RGB565A8, palette + RLE: 6912 -> 1378 bytes. Decoded on first use by ImageCache.
+#pragma once
+#include "../ImageCodec.h"
+
+static const uint8_t TwoStep_rle[] = {
+  0x7b, 0x00, 0x00, 0xff, 0x01, 0x00, 0xff, 0x20, 0x00, 0xff, 0x21, 0x00, 0xff, 0x40, 0x00, 0xff,
+  0x41, 0x00, 0xff, 0x00, 0x08, 0xff, 0x01, 0x08, 0xff, 0x02, 0x08, 0xff, 0x20, 0x08, 0xff, 0x21,
+  0x08, 0xff, 0x40, 0x08, 0xff, 0x41, 0x08, 0xff, 0x61, 0x08, 0xff, 0x00, 0x10, 0xff, 0x20, 0x10,
+  0xff, 0x00, 0x18, 0xff, 0x20, 0x18, 0xff, 0x21, 0x18, 0xff, 0x00, 0x20, 0xff, 0x01, 0x20, 0xff,
+  0x20, 0x20, 0xff, 0x21, 0x20, 0xff, 0x40, 0x20, 0xff, 0x00, 0x28, 0xff, 0x20, 0x28, 0xff, 0x21,
+  0x28, 0xff, 0x40, 0x28, 0xff, 0x00, 0x30, 0xff, 0x01, 0x30, 0xff, 0x22, 0x30, 0xff, 0x00, 0x38,
+  0xff, 0x01, 0x38, 0xff, 0x20, 0x38, 0xff, 0x21, 0x38, 0xff, 0x22, 0x38, 0xff, 0x40, 0x38, 0xff,
+  0x41, 0x38, 0xff, 0x01, 0x40, 0xff, 0x20, 0x40, 0xff, 0x21, 0x40, 0xff, 0x40, 0x40, 0xff, 0x41,
+  0x40, 0xff, 0x01, 0x48, 0xff, 0x20, 0x48, 0xff, 0x21, 0x48, 0xff, 0x41, 0x48, 0xff, 0x20, 0x50,
+  0xff, 0x21, 0x50, 0xff, 0x41, 0x50, 0xff, 0x61, 0x50, 0xff, 0x20, 0x58, 0xff, 0x21, 0x58, 0xff,
+  0x40, 0x58, 0xff, 0x41, 0x58, 0xff, 0x60, 0x58, 0xff, 0x61, 0x58, 0xff, 0x21, 0x60, 0xff, 0x40,
+  0x60, 0xff, 0x41, 0x60, 0xff, 0x42, 0x60, 0xff, 0x61, 0x60, 0xff, 0x81, 0x60, 0xff, 0x21, 0x68,
+  0xff, 0x41, 0x68, 0xff, 0x60, 0x68, 0xff, 0x61, 0x68, 0xff, 0x21, 0x70, 0xff, 0x40, 0x70, 0xff,
+  0x41, 0x70, 0xff, 0x42, 0x70, 0xff, 0x61, 0x70, 0xff, 0x62, 0x70, 0xff, 0x41, 0x78, 0xff, 0x42,
+  0x78, 0xff, 0x61, 0x78, 0xff, 0x62, 0x78, 0xff, 0x81, 0x78, 0xff, 0x82, 0x78, 0xff, 0x83, 0x78,
+  0xff, 0x41, 0x80, 0xff, 0x62, 0x80, 0xff, 0x63, 0x80, 0xff, 0x21, 0x88, 0xff, 0x61, 0x88, 0xff,
+  0x62, 0x88, 0xff, 0x80, 0x88, 0xff, 0x82, 0x88, 0xff, 0x61, 0x90, 0xff, 0x62, 0x90, 0xff, 0x83,
+  0x90, 0xff, 0xa2, 0x90, 0xff, 0xa3, 0x90, 0xff, 0x62, 0x98, 0xff, 0x82, 0x98, 0xff, 0x83, 0x98,
+  0xff, 0xa2, 0x98, 0xff, 0x62, 0xa0, 0xff, 0x63, 0xa0, 0xff, 0x82, 0xa0, 0xff, 0x83, 0xa0, 0xff,
+  0x84, 0xa0, 0xff, 0xa2, 0xa0, 0xff, 0xa3, 0xa0, 0xff, 0x62, 0xa8, 0xff, 0x81, 0xa8, 0xff, 0x83,
+  0xa8, 0xff, 0xa2, 0xa8, 0xff, 0xa3, 0xa8, 0xff, 0xc2, 0xa8, 0xff, 0xc3, 0xa8, 0xff, 0xa1, 0xb0,
+  0xff, 0xa2, 0xb0, 0xff, 0xa3, 0xb0, 0xff, 0xa4, 0xb0, 0xff, 0xc1, 0xb0, 0xff, 0xc2, 0xb0, 0xff,
+  0xc3, 0xb0, 0xff, 0xc4, 0xb0, 0xff, 0xe2, 0xb0, 0xff, 0xe4, 0xb0, 0xff, 0xa2, 0xb8, 0xff, 0xc2,
+  0xb8, 0xff, 0xc3, 0xb8, 0xff, 0x9f, 0x00, 0x00, 0x02, 0x81, 0x00, 0x01, 0x06, 0x03, 0x81, 0x00,
+  0x00, 0x02, 0xa8, 0x00, 0x81, 0x06, 0xac, 0x00, 0x07, 0x0a, 0x03, 0x00, 0x0c, 0x00, 0x02, 0x03,
+  0x01, 0xa8, 0x00, 0x00, 0x02, 0x81, 0x00, 0x01, 0x06, 0x02, 0xaa, 0x00, 0x00, 0x0a, 0x82, 0x00,
+  0x81, 0x06, 0xa8, 0x00, 0x03, 0x06, 0x02, 0x06, 0x1e, 0x81, 0x00, 0x01, 0x01, 0x03, 0xa7, 0x00,
+  0x07, 0x07, 0x02, 0x27, 0x4f, 0x21, 0x09, 0x00, 0x03, 0xa7, 0x00, 0x06, 0x02, 0x2e, 0x63, 0x70,
+  0x55, 0x24, 0x06, 0xa8, 0x00, 0x0c, 0x2b, 0x29, 0x71, 0x7a, 0x70, 0x4b, 0x1d, 0x01, 0x02, 0x07,
+  0x00, 0x02, 0x06, 0xa2, 0x00, 0x02, 0x0e, 0x00, 0x31, 0x81, 0x71, 0x05, 0x42, 0x2d, 0x09, 0x0e,
+  0x02, 0x03, 0x81, 0x06, 0xa3, 0x00, 0x0b, 0x01, 0x00, 0x38, 0x3a, 0x5b, 0x60, 0x28, 0x06, 0x01,
+  0x07, 0x06, 0x04, 0xa4, 0x00, 0x0a, 0x01, 0x06, 0x55, 0x6e, 0x7b, 0x50, 0x16, 0x02, 0x01, 0x06,
+  0x02, 0xa2, 0x00, 0x09, 0x02, 0x06, 0x03, 0x00, 0x1f, 0x70, 0x7b, 0x68, 0x28, 0x09, 0x81, 0x00,
+  0x00, 0x02, 0xa2, 0x00, 0x0c, 0x02, 0x01, 0x00, 0x03, 0x01, 0x4b, 0x6b, 0x41, 0x33, 0x13, 0x06,
+  0x03, 0x02, 0xa2, 0x00, 0x0e, 0x02, 0x08, 0x06, 0x02, 0x0a, 0x00, 0x40, 0x60, 0x64, 0x2a, 0x02,
+  0x00, 0x06, 0x00, 0x02, 0xa5, 0x00, 0x08, 0x03, 0x52, 0x79, 0x7b, 0x3b, 0x06, 0x00, 0x06, 0x00,
+  0x81, 0x02, 0x90, 0x00, 0x00, 0x02, 0x82, 0x00, 0x81, 0x06, 0x89, 0x00, 0x81, 0x02, 0x0a, 0x06,
+  0x02, 0x0a, 0x26, 0x78, 0x75, 0x58, 0x21, 0x01, 0x03, 0x02, 0x81, 0x06, 0x90, 0x00, 0x81, 0x02,
+  0x01, 0x0a, 0x03, 0x81, 0x01, 0x00, 0x03, 0x8b, 0x00, 0x0a, 0x06, 0x02, 0x0f, 0x54, 0x51, 0x3e,
+  0x1c, 0x07, 0x02, 0x06, 0x05, 0x90, 0x00, 0x01, 0x06, 0x00, 0x81, 0x01, 0x01, 0x03, 0x00, 0x81,
+  0x06, 0x87, 0x00, 0x00, 0x06, 0x81, 0x00, 0x08, 0x02, 0x00, 0x07, 0x00, 0x37, 0x5c, 0x64, 0x31,
+  0x02, 0x81, 0x00, 0x01, 0x06, 0x03, 0x8f, 0x00, 0x01, 0x02, 0x00, 0x81, 0x06, 0x01, 0x00, 0x02,
+  0x8b, 0x00, 0x08, 0x06, 0x02, 0x00, 0x01, 0x04, 0x39, 0x79, 0x74, 0x49, 0x82, 0x00, 0x01, 0x06,
+  0x02, 0x8f, 0x00, 0x00, 0x02, 0x84, 0x00, 0x81, 0x01, 0x8c, 0x00, 0x0a, 0x01, 0x02, 0x26, 0x70,
+  0x7a, 0x53, 0x09, 0x05, 0x06, 0x01, 0x02, 0x8f, 0x00, 0x01, 0x01, 0x03, 0x83, 0x00, 0x00, 0x02,
+  0x88, 0x00, 0x0e, 0x01, 0x00, 0x02, 0x06, 0x02, 0x07, 0x06, 0x09, 0x65, 0x5b, 0x4b, 0x28, 0x02,
+  0x00, 0x07, 0x91, 0x00, 0x00, 0x0b, 0x81, 0x02, 0x02, 0x07, 0x06, 0x02, 0x88, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x81, 0x06, 0x0a, 0x02, 0x03, 0x00, 0x46, 0x4d, 0x49, 0x22, 0x00, 0x07, 0x01, 0x02,
+  0x8f, 0x00, 0x06, 0x59, 0x4e, 0x1c, 0x00, 0x03, 0x01, 0x02, 0x88, 0x00, 0x05, 0x01, 0x06, 0x02,
+  0x00, 0x02, 0x00, 0x81, 0x06, 0x04, 0x66, 0x74, 0x61, 0x11, 0x06, 0x81, 0x01, 0x90, 0x00, 0x06,
+  0x66, 0x74, 0x66, 0x19, 0x00, 0x06, 0x02, 0x83, 0x00, 0x01, 0x06, 0x09, 0x81, 0x00, 0x03, 0x03,
+  0x00, 0x03, 0x02, 0x81, 0x00, 0x81, 0x06, 0x04, 0x03, 0x67, 0x73, 0x64, 0x10, 0x81, 0x00, 0x00,
+  0x07, 0x90, 0x00, 0x09, 0x30, 0x6a, 0x71, 0x67, 0x25, 0x07, 0x00, 0x02, 0x06, 0x02, 0x81, 0x00,
+  0x01, 0x02, 0x00, 0x82, 0x06, 0x81, 0x00, 0x0c, 0x06, 0x00, 0x02, 0x00, 0x06, 0x5e, 0x75, 0x5d,
+  0x17, 0x02, 0x07, 0x01, 0x03, 0x8f, 0x00, 0x09, 0x06, 0x14, 0x5f, 0x7b, 0x64, 0x28, 0x07, 0x02,
+  0x00, 0x02, 0x81, 0x07, 0x00, 0x06, 0x82, 0x02, 0x01, 0x00, 0x02, 0x83, 0x00, 0x08, 0x02, 0x06,
+  0x43, 0x34, 0x30, 0x20, 0x00, 0x07, 0x02, 0x90, 0x00, 0x81, 0x02, 0x08, 0x00, 0x45, 0x70, 0x72,
+  0x35, 0x02, 0x01, 0x00, 0x02, 0x81, 0x00, 0x03, 0x06, 0x00, 0x01, 0x00, 0x81, 0x02, 0x82, 0x00,
+  0x06, 0x02, 0x0f, 0x77, 0x74, 0x59, 0x19, 0x06, 0x81, 0x00, 0x00, 0x06, 0x91, 0x00, 0x06, 0x02,
+  0x00, 0x31, 0x69, 0x6c, 0x3c, 0x06, 0x82, 0x00, 0x02, 0x06, 0x01, 0x07, 0x83, 0x00, 0x0c, 0x06,
+  0x00, 0x01, 0x00, 0x34, 0x71, 0x74, 0x4c, 0x00, 0x06, 0x02, 0x03, 0x02, 0x8f, 0x00, 0x12, 0x02,
+  0x06, 0x01, 0x06, 0x02, 0x19, 0x5d, 0x71, 0x44, 0x0f, 0x07, 0x02, 0x06, 0x01, 0x03, 0x06, 0x02,
+  0x00, 0x01, 0x81, 0x00, 0x0a, 0x01, 0x06, 0x40, 0x76, 0x6f, 0x42, 0x09, 0x02, 0x06, 0x01, 0x03,
+  0x8f, 0x00, 0x03, 0x09, 0x01, 0x06, 0x02, 0x81, 0x01, 0x05, 0x06, 0x4d, 0x71, 0x4a, 0x0d, 0x00,
+  0x81, 0x02, 0x01, 0x00, 0x02, 0x81, 0x06, 0x0a, 0x01, 0x00, 0x02, 0x00, 0x02, 0x3a, 0x2f, 0x46,
+  0x28, 0x03, 0x00, 0x81, 0x02, 0x00, 0x06, 0x92, 0x00, 0x0b, 0x02, 0x01, 0x00, 0x06, 0x00, 0x35,
+  0x6e, 0x54, 0x09, 0x01, 0x06, 0x02, 0x82, 0x00, 0x09, 0x03, 0x01, 0x00, 0x06, 0x12, 0x6c, 0x74,
+  0x55, 0x21, 0x06, 0x81, 0x01, 0x00, 0x02, 0x98, 0x00, 0x07, 0x07, 0x19, 0x5e, 0x5d, 0x13, 0x02,
+  0x07, 0x01, 0x81, 0x00, 0x09, 0x01, 0x00, 0x01, 0x06, 0x40, 0x75, 0x79, 0x48, 0x0e, 0x02, 0x82,
+  0x00, 0x00, 0x02, 0x98, 0x00, 0x04, 0x02, 0x06, 0x48, 0x5b, 0x15, 0x81, 0x00, 0x0a, 0x01, 0x07,
+  0x06, 0x02, 0x00, 0x09, 0x55, 0x74, 0x6e, 0x32, 0x06, 0x83, 0x00, 0x00, 0x06, 0x9a, 0x00, 0x11,
+  0x06, 0x34, 0x5b, 0x1b, 0x06, 0x0b, 0x01, 0x02, 0x01, 0x02, 0x31, 0x40, 0x3d, 0x51, 0x1c, 0x06,
+  0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x97, 0x00, 0x14, 0x02, 0x07, 0x01, 0x00, 0x06, 0x19, 0x51,
+  0x2b, 0x02, 0x00, 0x01, 0x00, 0x0f, 0x62, 0x75, 0x6a, 0x2d, 0x06, 0x02, 0x06, 0x02, 0x81, 0x00,
+  0x00, 0x06, 0x97, 0x00, 0x00, 0x02, 0x81, 0x00, 0x09, 0x03, 0x00, 0x06, 0x01, 0x40, 0x2c, 0x06,
+  0x00, 0x02, 0x3b, 0x81, 0x7a, 0x04, 0x5e, 0x1d, 0x02, 0x00, 0x06, 0x81, 0x00, 0x00, 0x02, 0x98,
+  0x00, 0x00, 0x07, 0x82, 0x00, 0x0e, 0x01, 0x03, 0x09, 0x00, 0x2f, 0x23, 0x01, 0x13, 0x49, 0x6d,
+  0x71, 0x31, 0x06, 0x02, 0x03, 0x81, 0x00, 0x01, 0x06, 0x07, 0x98, 0x00, 0x03, 0x02, 0x01, 0x00,
+  0x09, 0x81, 0x00, 0x00, 0x03, 0x81, 0x01, 0x0c, 0x15, 0x12, 0x5e, 0x5a, 0x36, 0x47, 0x1a, 0x06,
+  0x00, 0x02, 0x06, 0x00, 0x02, 0x9a, 0x00, 0x03, 0x06, 0x03, 0x02, 0x06, 0x81, 0x00, 0x0c, 0x02,
+  0x21, 0x0e, 0x56, 0x7b, 0x75, 0x57, 0x26, 0x06, 0x02, 0x07, 0x00, 0x02, 0x81, 0x00, 0x00, 0x06,
+  0xa0, 0x00, 0x06, 0x13, 0x3f, 0x66, 0x74, 0x6e, 0x2f, 0x06, 0xa8, 0x00, 0x07, 0x02, 0x18, 0x45,
+  0x67, 0x3f, 0x11, 0x02, 0x01, 0xa8, 0x00, 0x03, 0x02, 0x18, 0x31, 0x13, 0x81, 0x02, 0x00, 0x03,
+  0xa7, 0x00, 0x00, 0x07, 0x81, 0x02, 0x02, 0x00, 0x02, 0x00, 0x81, 0x01, 0xa9, 0x00, 0x00, 0x09,
+  0x81, 0x02, 0x01, 0x00, 0x06, 0xa8, 0x00, 0x01, 0x02, 0x00, 0x81, 0x06, 0xab, 0x00, 0x00, 0x06,
+  0x83, 0x00, 0x00, 0x02, 0xa9, 0x00, 0x03, 0x02, 0x06, 0x00, 0x02, 0x81, 0x00, 0x01, 0x02, 0x01,
+  0x87, 0x00,
+};
+
+IMAGE_ASSET_DECLARE(TwoStep);
+const ImageAsset TwoStep_asset = {
+  .name = "TwoStep",
+  .data = TwoStep_rle,
+  .data_size = sizeof(TwoStep_rle),
+  .raw_size = 6912,
+  .crc32 = 0x0fb331f9,
+  .w = 48,
+  .h = 48,
+  .codec = IMAGE_CODEC_RLE_PALETTE,
+};
@@ -0,0 +1,143 @@
+// Generated by tools/compress_images.py from images/flag.h - do not edit.
+// 46x48 RGB565A8, palette + RLE: 6624 -> 1980 bytes. Decoded on first use by ImageCache.
+#pragma once
+#include "../ImageCodec.h"
+
+static const uint8_t flag_rle[] = {
+  0xf1, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x21, 0x00, 0xff, 0x21, 0x08, 0xff, 0x41, 0x08, 0xff,
+  0x61, 0x08, 0xff, 0x60, 0x10, 0xff, 0x62, 0x10, 0xff, 0x80, 0x10, 0xff, 0x81, 0x10, 0xff, 0x82,
+  0x10, 0xff, 0xa2, 0x18, 0xff, 0xa3, 0x18, 0xff, 0xc0, 0x18, 0xff, 0xc3, 0x18, 0xff, 0xe3, 0x18,
+  0xff, 0xe4, 0x18, 0xff, 0xe0, 0x20, 0xff, 0xe3, 0x20, 0xff, 0xe4, 0x20, 0xff, 0x03, 0x21, 0xff,
+  0x04, 0x21, 0xff, 0x24, 0x21, 0xff, 0x25, 0x21, 0xff, 0x24, 0x29, 0xff, 0x40, 0x29, 0xff, 0x43,
+  0x29, 0xff, 0x44, 0x29, 0xff, 0x45, 0x29, 0xff, 0x65, 0x29, 0xff, 0x66, 0x29, 0xff, 0x64, 0x31,
+  0xff, 0x84, 0x31, 0xff, 0x85, 0x31, 0xff, 0xa4, 0x31, 0xff, 0xa5, 0x31, 0xff, 0xa4, 0x39, 0xff,
+  0xa6, 0x39, 0xff, 0xc5, 0x39, 0xff, 0xc6, 0x39, 0xff, 0xe6, 0x39, 0xff, 0xe5, 0x41, 0xff, 0xe6,
+  0x41, 0xff, 0x06, 0x42, 0xff, 0x27, 0x42, 0xff, 0x20, 0x4a, 0xff, 0x25, 0x4a, 0xff, 0x26, 0x4a,
+  0xff, 0x27, 0x4a, 0xff, 0x46, 0x4a, 0xff, 0x47, 0x4a, 0xff, 0x67, 0x4a, 0xff, 0x60, 0x52, 0xff,
+  0x66, 0x52, 0xff, 0x86, 0x52, 0xff, 0xa7, 0x52, 0xff, 0xa5, 0x5a, 0xff, 0xa6, 0x5a, 0xff, 0xa7,
+  0x5a, 0xff, 0xa9, 0x5a, 0xff, 0xc6, 0x5a, 0xff, 0xc7, 0x5a, 0xff, 0xc9, 0x5a, 0xff, 0xe0, 0x62,
+  0xff, 0xe7, 0x62, 0xff, 0xe8, 0x62, 0xff, 0x06, 0x63, 0xff, 0x07, 0x63, 0xff, 0x08, 0x6b, 0xff,
+  0x20, 0x6b, 0xff, 0x26, 0x6b, 0xff, 0x27, 0x6b, 0xff, 0x28, 0x6b, 0xff, 0x29, 0x6b, 0xff, 0x40,
+  0x6b, 0xff, 0x46, 0x6b, 0xff, 0x47, 0x6b, 0xff, 0x40, 0x73, 0xff, 0x66, 0x73, 0xff, 0x68, 0x73,
+  0xff, 0x80, 0x73, 0xff, 0x85, 0x73, 0xff, 0x86, 0x73, 0xff, 0x87, 0x73, 0xff, 0x88, 0x73, 0xff,
+  0x89, 0x73, 0xff, 0x87, 0x7b, 0xff, 0xa0, 0x7b, 0xff, 0xa7, 0x7b, 0xff, 0xa8, 0x7b, 0xff, 0xc6,
+  0x7b, 0xff, 0xc8, 0x7b, 0xff, 0xc0, 0x83, 0xff, 0xc8, 0x83, 0xff, 0xe0, 0x83, 0xff, 0xe7, 0x83,
+  0xff, 0xe8, 0x83, 0xff, 0xe9, 0x83, 0xff, 0x08, 0x84, 0xff, 0x09, 0x84, 0xff, 0x00, 0x8c, 0xff,
+  0x08, 0x8c, 0xff, 0x09, 0x8c, 0xff, 0x20, 0x8c, 0xff, 0x28, 0x8c, 0xff, 0x2a, 0x8c, 0xff, 0x48,
+  0x8c, 0xff, 0x49, 0x8c, 0xff, 0x40, 0x94, 0xff, 0x48, 0x94, 0xff, 0x49, 0x94, 0xff, 0x60, 0x94,
+  0xff, 0x68, 0x94, 0xff, 0x69, 0x94, 0xff, 0x88, 0x94, 0xff, 0x89, 0x94, 0xff, 0x8a, 0x94, 0xff,
+  0x87, 0x9c, 0xff, 0x88, 0x9c, 0xff, 0x89, 0x9c, 0xff, 0xa0, 0x9c, 0xff, 0xa8, 0x9c, 0xff, 0xa9,
+  0x9c, 0xff, 0xaa, 0x9c, 0xff, 0xc8, 0x9c, 0xff, 0xc9, 0x9c, 0xff, 0xc0, 0xa4, 0xff, 0xc8, 0xa4,
+  0xff, 0xc9, 0xa4, 0xff, 0xe0, 0xa4, 0xff, 0xe6, 0xa4, 0xff, 0xe7, 0xa4, 0xff, 0xe8, 0xa4, 0xff,
+  0xe9, 0xa4, 0xff, 0x08, 0xa5, 0xff, 0x09, 0xa5, 0xff, 0x00, 0xad, 0xff, 0x08, 0xad, 0xff, 0x09,
+  0xad, 0xff, 0x27, 0xad, 0xff, 0x28, 0xad, 0xff, 0x29, 0xad, 0xff, 0x48, 0xad, 0xff, 0x40, 0xb5,
+  0xff, 0x47, 0xb5, 0xff, 0x48, 0xb5, 0xff, 0x49, 0xb5, 0xff, 0x4a, 0xb5, 0xff, 0x60, 0xb5, 0xff,
+  0x68, 0xb5, 0xff, 0x69, 0xb5, 0xff, 0x88, 0xb5, 0xff, 0x89, 0xb5, 0xff, 0x80, 0xbd, 0xff, 0x84,
+  0xbd, 0xff, 0x88, 0xbd, 0xff, 0x89, 0xbd, 0xff, 0x8a, 0xbd, 0xff, 0x8b, 0xbd, 0xff, 0xa0, 0xbd,
+  0xff, 0xa8, 0xbd, 0xff, 0xaa, 0xbd, 0xff, 0xab, 0xbd, 0xff, 0xc7, 0xc5, 0xff, 0xc8, 0xc5, 0xff,
+  0xc9, 0xc5, 0xff, 0xca, 0xc5, 0xff, 0xe8, 0xc5, 0xff, 0xe9, 0xc5, 0xff, 0xe8, 0xcd, 0xff, 0x08,
+  0xce, 0xff, 0x09, 0xce, 0xff, 0x0a, 0xce, 0xff, 0x27, 0xce, 0xff, 0x28, 0xce, 0xff, 0x29, 0xce,
+  0xff, 0x2a, 0xce, 0xff, 0x29, 0xd6, 0xff, 0x40, 0xd6, 0xff, 0x48, 0xd6, 0xff, 0x49, 0xd6, 0xff,
+  0x4b, 0xd6, 0xff, 0x60, 0xd6, 0xff, 0x68, 0xd6, 0xff, 0x69, 0xd6, 0xff, 0x80, 0xde, 0xff, 0x87,
+  0xde, 0xff, 0x88, 0xde, 0xff, 0x89, 0xde, 0xff, 0x8a, 0xde, 0xff, 0xa7, 0xde, 0xff, 0xa8, 0xde,
+  0xff, 0xa9, 0xde, 0xff, 0xa0, 0xe6, 0xff, 0xa8, 0xe6, 0xff, 0xa9, 0xe6, 0xff, 0xc7, 0xe6, 0xff,
+  0xc8, 0xe6, 0xff, 0xc9, 0xe6, 0xff, 0xe0, 0xe6, 0xff, 0xe8, 0xe6, 0xff, 0xe9, 0xe6, 0xff, 0xe8,
+  0xee, 0xff, 0x00, 0xef, 0xff, 0x07, 0xef, 0xff, 0x08, 0xef, 0xff, 0x09, 0xef, 0xff, 0x20, 0xef,
+  0xff, 0x25, 0xef, 0xff, 0x27, 0xef, 0xff, 0x28, 0xef, 0xff, 0x27, 0xf7, 0xff, 0x28, 0xf7, 0xff,
+  0x40, 0xf7, 0xff, 0x46, 0xf7, 0xff, 0x47, 0xf7, 0xff, 0x48, 0xf7, 0xff, 0x49, 0xf7, 0xff, 0x66,
+  0xf7, 0xff, 0x67, 0xf7, 0xff, 0x68, 0xf7, 0xff, 0x65, 0xff, 0xff, 0x66, 0xff, 0xff, 0x67, 0xff,
+  0xff, 0x80, 0xff, 0xff, 0x84, 0xff, 0xff, 0x85, 0xff, 0xff, 0x86, 0xff, 0xff, 0x87, 0xff, 0xff,
+  0x88, 0xff, 0xff, 0xa2, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xa6,
+  0xff, 0xff, 0xa8, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xc2, 0xff, 0xff, 0xc3, 0xff,
+  0xff, 0xc5, 0xff, 0xff, 0xc6, 0xff, 0xff, 0xa1, 0x00, 0x04, 0x01, 0x32, 0x8d, 0xc4, 0xa1, 0xa6,
+  0x00, 0x03, 0x2a, 0x85, 0xba, 0xe9, 0x81, 0xec, 0x01, 0xde, 0x25, 0xa2, 0x00, 0x03, 0x1d, 0x76,
+  0xb7, 0xe3, 0x83, 0xec, 0x02, 0xd4, 0x97, 0x29, 0x9f, 0x00, 0x03, 0x14, 0x6b, 0xb3, 0xe3, 0x83,
+  0xec, 0x04, 0xe3, 0xb3, 0x65, 0x07, 0x2b, 0x9d, 0x00, 0x03, 0x0a, 0x61, 0xaa, 0xdb, 0x83, 0xec,
+  0x08, 0xed, 0xcd, 0x8c, 0x2c, 0x15, 0x70, 0xbc, 0xea, 0x7f, 0x99, 0x00, 0x03, 0x04, 0x54, 0xa5,
+  0xd7, 0x84, 0xec, 0x06, 0xe3, 0xab, 0x59, 0x04, 0x43, 0xa0, 0xd7, 0x82, 0xec, 0x01, 0xe2, 0x53,
+  0x95, 0x00, 0x04, 0x01, 0x47, 0x9c, 0xd1, 0xed, 0x83, 0xec, 0x07, 0xe7, 0xc6, 0x84, 0x24, 0x1f,
+  0x7c, 0xc2, 0xe9, 0x85, 0xec, 0x01, 0xcd, 0x1b, 0x91, 0x00, 0x04, 0x01, 0x3d, 0x95, 0xca, 0xe6,
+  0x84, 0xec, 0x06, 0xda, 0xa4, 0x4c, 0x04, 0x4f, 0xa7, 0xdf, 0x89, 0xec, 0x00, 0x9c, 0x8e, 0x00,
+  0x04, 0x01, 0x31, 0x8c, 0xc5, 0xe8, 0x84, 0xec, 0x09, 0xe9, 0xbe, 0x77, 0x18, 0x27, 0x89, 0xc8,
+  0xef, 0xe9, 0xcd, 0x89, 0xec, 0x01, 0xe3, 0x37, 0x8b, 0x00, 0x03, 0x29, 0x80, 0xbc, 0xe8, 0x85,
+  0xec, 0x0c, 0xd8, 0x9c, 0x3c, 0x04, 0x5b, 0xaf, 0xe3, 0xef, 0xcd, 0x92, 0x35, 0x1a, 0xc8, 0x89,
+  0xec, 0x00, 0xa8, 0x88, 0x00, 0x03, 0x1d, 0x75, 0xb8, 0xe2, 0x85, 0xec, 0x0b, 0xe9, 0xb7, 0x6a,
+  0x0b, 0x31, 0x92, 0xcd, 0xed, 0xe4, 0xaa, 0x5b, 0x04, 0x82, 0x00, 0x01, 0x42, 0xe1, 0x88, 0xec,
+  0x01, 0xe2, 0x2b, 0x84, 0x00, 0x03, 0x14, 0x6a, 0xb1, 0xe4, 0x85, 0xec, 0x0b, 0xee, 0xcd, 0x91,
+  0x32, 0x0c, 0x68, 0xb7, 0xea, 0xe7, 0xc3, 0x7f, 0x23, 0x86, 0x00, 0x00, 0x8c, 0x89, 0xec, 0x00,
+  0x8d, 0x81, 0x00, 0x03, 0x0a, 0x60, 0xaa, 0xdc, 0x86, 0xec, 0x06, 0xe3, 0xae, 0x5d, 0x07, 0x3a,
+  0x9c, 0xd4, 0x82, 0xec, 0x01, 0x98, 0x01, 0x88, 0x00, 0x01, 0x0e, 0xca, 0x88, 0xec, 0x00, 0xc6,
+  0x81, 0x00, 0x00, 0xd8, 0x86, 0xec, 0x07, 0xed, 0xc8, 0x8a, 0x28, 0x12, 0x72, 0xbb, 0xe9, 0x84,
+  0xec, 0x01, 0xe2, 0x56, 0x89, 0x00, 0x01, 0x62, 0xed, 0x86, 0xec, 0x04, 0xe6, 0xe9, 0x2f, 0x00,
+  0xdf, 0x84, 0xec, 0x06, 0xdf, 0xa7, 0x4f, 0x01, 0x43, 0xa4, 0xdc, 0x88, 0xec, 0x01, 0xd2, 0x22,
+  0x88, 0x00, 0x01, 0x01, 0xbe, 0x83, 0xec, 0x07, 0xee, 0xc8, 0x89, 0x69, 0xec, 0x76, 0x00, 0xa8,
+  0x81, 0xec, 0x03, 0xe8, 0xc2, 0x79, 0x1b, 0x81, 0x00, 0x01, 0x74, 0xe9, 0x8b, 0xec, 0x00, 0xa7,
+  0x89, 0x00, 0x10, 0x60, 0xef, 0xec, 0xe3, 0xaa, 0x54, 0x03, 0x00, 0x0f, 0xe4, 0xa5, 0x00, 0x4c,
+  0xd9, 0xa0, 0x40, 0x01, 0x84, 0x00, 0x01, 0x83, 0xea, 0x8a, 0xec, 0x01, 0xe7, 0x59, 0x88, 0x00,
+  0x03, 0x0c, 0xb5, 0x85, 0x24, 0x83, 0x00, 0x02, 0x03, 0xc9, 0xbf, 0x81, 0x00, 0x00, 0x0c, 0x88,
+  0x00, 0x01, 0x71, 0xe9, 0x8a, 0xec, 0x01, 0xc8, 0x07, 0x85, 0x00, 0x03, 0x26, 0x8c, 0xd2, 0xb8,
+  0x86, 0x00, 0x02, 0xb3, 0xd8, 0x03, 0x8b, 0x00, 0x01, 0x73, 0xe6, 0x8a, 0xec, 0x00, 0x7d, 0x82,
+  0x00, 0x03, 0x01, 0x43, 0xa7, 0xe3, 0x81, 0xec, 0x01, 0xe4, 0x23, 0x85, 0x00, 0x02, 0xa6, 0xe3,
+  0x13, 0x8c, 0x00, 0x00, 0x87, 0x8a, 0xec, 0x05, 0xd3, 0x16, 0x0a, 0x68, 0xbb, 0xe9, 0x84, 0xec,
+  0x00, 0x71, 0x85, 0x00, 0x02, 0x9a, 0xf1, 0x22, 0x8c, 0x00, 0x01, 0x01, 0xa5, 0x89, 0xec, 0x02,
+  0xe9, 0xa2, 0xcd, 0x87, 0xec, 0x00, 0xa7, 0x85, 0x00, 0x02, 0x93, 0xec, 0x33, 0x8d, 0x00, 0x01,
+  0x0f, 0xc2, 0x86, 0xec, 0x04, 0xd7, 0x97, 0x35, 0x60, 0xed, 0x87, 0xec, 0x01, 0xc9, 0x03, 0x84,
+  0x00, 0x02, 0x93, 0xec, 0x3b, 0x8e, 0x00, 0x01, 0x35, 0xda, 0x82, 0xec, 0x03, 0xe8, 0xbf, 0x71,
+  0x10, 0x81, 0x00, 0x01, 0x04, 0xcd, 0x87, 0xec, 0x01, 0xe5, 0x0a, 0x83, 0x00, 0x03, 0x24, 0xb0,
+  0xec, 0x33, 0x8f, 0x00, 0x05, 0x6a, 0xe6, 0xe2, 0xa8, 0x47, 0x01, 0x84, 0x00, 0x00, 0x9b, 0x88,
+  0xec, 0x00, 0x41, 0x81, 0x00, 0x05, 0x35, 0xa0, 0xde, 0xed, 0xc8, 0x1a, 0x8f, 0x00, 0x03, 0x01,
+  0xab, 0xe8, 0x56, 0x86, 0x00, 0x01, 0x47, 0xed, 0x87, 0xec, 0x07, 0x62, 0x47, 0xaa, 0xe3, 0xe9,
+  0xb7, 0x5d, 0x01, 0x91, 0x00, 0x03, 0x29, 0xd7, 0xca, 0x0e, 0x85, 0x00, 0x01, 0x03, 0xd2, 0x87,
+  0xec, 0x04, 0xcc, 0xe9, 0xe2, 0xa7, 0x40, 0x92, 0x00, 0x05, 0x52, 0x82, 0x00, 0x79, 0xec, 0x89,
+  0x86, 0x00, 0x00, 0xa9, 0x87, 0xec, 0x02, 0xd4, 0x91, 0x27, 0x87, 0x00, 0x02, 0x4a, 0x88, 0x7e,
+  0x82, 0x78, 0x02, 0x7e, 0x81, 0x5e, 0x82, 0x00, 0x07, 0x58, 0xe1, 0xe9, 0x79, 0x03, 0xc6, 0xdb,
+  0x22, 0x85, 0x00, 0x00, 0x7a, 0x84, 0xec, 0x03, 0xee, 0xc5, 0x77, 0x0e, 0x89, 0x00, 0x02, 0x81,
+  0xc1, 0xb6, 0x82, 0xb2, 0x02, 0xb6, 0xb9, 0x88, 0x81, 0x00, 0x01, 0x01, 0xc5, 0x81, 0xec, 0x04,
+  0xe3, 0x40, 0x5f, 0xee, 0x91, 0x85, 0x00, 0x00, 0x49, 0x82, 0xec, 0x09, 0xe9, 0xb3, 0x59, 0x02,
+  0x00, 0x01, 0x1e, 0x65, 0xa4, 0x53, 0x85, 0x00, 0x01, 0x78, 0x57, 0x88, 0x00, 0x01, 0x2b, 0xe8,
+  0x82, 0xec, 0x04, 0xb8, 0x03, 0xc5, 0xd8, 0x13, 0x82, 0x00, 0x0c, 0x12, 0x7a, 0xc8, 0xec, 0xdf,
+  0xa4, 0x39, 0x00, 0x0a, 0x55, 0x91, 0xbf, 0xe3, 0x81, 0xec, 0x00, 0x96, 0x85, 0x00, 0x01, 0x7e,
+  0x5e, 0x88, 0x00, 0x00, 0x59, 0x83, 0xec, 0x10, 0xe9, 0x44, 0x77, 0xec, 0x71, 0x00, 0x2b, 0x95,
+  0xd7, 0xec, 0xd2, 0x8d, 0x24, 0x04, 0x85, 0xb4, 0xdb, 0x85, 0xec, 0x01, 0xc0, 0x01, 0x84, 0x00,
+  0x01, 0x6f, 0x5e, 0x88, 0x00, 0x03, 0x5a, 0xec, 0xeb, 0xd8, 0x81, 0xec, 0x09, 0x8b, 0x1c, 0xe4,
+  0xbc, 0xa8, 0xe2, 0xf0, 0xbf, 0x70, 0x0a, 0x81, 0x00, 0x01, 0x01, 0xce, 0x86, 0xec, 0x02, 0xe3,
+  0xe4, 0x21, 0x86, 0x00, 0x04, 0x06, 0x45, 0x67, 0x4d, 0x08, 0x83, 0x00, 0x00, 0x3e, 0x81, 0xec,
+  0x0a, 0xd4, 0x9d, 0xad, 0x51, 0x01, 0xc0, 0xec, 0xe8, 0xae, 0x4f, 0x01, 0x84, 0x00, 0x00, 0xa7,
+  0x83, 0xec, 0x05, 0xdf, 0xaa, 0x61, 0x6d, 0xec, 0x7b, 0x85, 0x00, 0x06, 0x50, 0xcb, 0xe0, 0xd5,
+  0xe0, 0xcf, 0x57, 0x82, 0x00, 0x01, 0x12, 0xe5, 0x81, 0xec, 0x06, 0xe3, 0x8e, 0x17, 0x01, 0xbb,
+  0xec, 0x96, 0x87, 0x00, 0x05, 0x61, 0xed, 0xe9, 0xbc, 0x77, 0x1b, 0x81, 0x00, 0x03, 0x18, 0xdf,
+  0xbb, 0x01, 0x83, 0x00, 0x08, 0x2d, 0xc7, 0x6c, 0x11, 0x00, 0x0d, 0x67, 0xc7, 0x34, 0x81, 0x00,
+  0x01, 0x01, 0xc5, 0x83, 0xec, 0x05, 0xd8, 0xbe, 0xe9, 0xec, 0xc6, 0x01, 0x85, 0x00, 0x04, 0x0e,
+  0x6e, 0x9e, 0x2f, 0x01, 0x84, 0x00, 0x02, 0xa7, 0xe9, 0x43, 0x83, 0x00, 0x01, 0x8f, 0x50, 0x84,
+  0x00, 0x01, 0x45, 0x8f, 0x82, 0x00, 0x00, 0x9c, 0x87, 0xec, 0x01, 0xe7, 0x48, 0x82, 0x00, 0x05,
+  0x05, 0x59, 0xa8, 0xdb, 0xec, 0xa4, 0x86, 0x00, 0x02, 0x40, 0xe9, 0xaf, 0x83, 0x00, 0x00, 0x94,
+  0x86, 0x00, 0x00, 0x94, 0x82, 0x00, 0x01, 0x48, 0xe6, 0x87, 0xec, 0x05, 0xa7, 0x01, 0x40, 0x9c,
+  0xd2, 0xed, 0x82, 0xec, 0x01, 0xdf, 0x20, 0x86, 0x00, 0x02, 0xaa, 0xe7, 0x5b, 0x82, 0x00, 0x01,
+  0x8f, 0x01, 0x85, 0x00, 0x00, 0x99, 0x83, 0x00, 0x00, 0xc9, 0x86, 0xec, 0x03, 0xe3, 0xac, 0xbd,
+  0xe7, 0x86, 0xec, 0x00, 0x90, 0x86, 0x00, 0x03, 0x2b, 0xd7, 0xd1, 0x27, 0x81, 0x00, 0x01, 0x81,
+  0x5e, 0x84, 0x00, 0x01, 0x64, 0x9f, 0x83, 0x00, 0x00, 0x84, 0x83, 0xec, 0x05, 0xe9, 0xbf, 0x85,
+  0x26, 0x00, 0xa3, 0x87, 0xec, 0x01, 0xdf, 0x31, 0x84, 0x00, 0x04, 0x1b, 0x79, 0xcd, 0xec, 0xb8,
+  0x81, 0x00, 0x01, 0x19, 0x5c, 0x84, 0x00, 0x01, 0x64, 0x3f, 0x83, 0x00, 0x06, 0x1b, 0xd7, 0xef,
+  0xcd, 0x92, 0x36, 0x01, 0x82, 0x00, 0x01, 0x2e, 0xdf, 0x87, 0xec, 0x0a, 0xb3, 0x03, 0x00, 0x01,
+  0x46, 0xa4, 0xdb, 0xec, 0xd7, 0x9b, 0x3c, 0x8f, 0x00, 0x02, 0x8b, 0xef, 0x66, 0x86, 0x00, 0x00,
+  0x89, 0x87, 0xec, 0x03, 0xef, 0x87, 0x79, 0xc2, 0x81, 0xe9, 0x02, 0xb8, 0x6d, 0x0c, 0x91, 0x00,
+  0x03, 0x14, 0xd2, 0xcd, 0x15, 0x85, 0x00, 0x01, 0x0a, 0xbf, 0x87, 0xec, 0x04, 0xed, 0xec, 0xd1,
+  0x96, 0x35, 0x95, 0x00, 0x02, 0x68, 0xe6, 0x9b, 0x86, 0x00, 0x01, 0x35, 0xd7, 0x85, 0xec, 0x03,
+  0xe3, 0xb3, 0x63, 0x09, 0x98, 0x00, 0x02, 0xab, 0xe9, 0x5d, 0x86, 0x00, 0x01, 0x4e, 0xe4, 0x81,
+  0xec, 0x03, 0xed, 0xcd, 0x8e, 0x30, 0x9b, 0x00, 0x03, 0x26, 0xd1, 0xd6, 0x39, 0x83, 0x00, 0x07,
+  0x26, 0x86, 0xc9, 0xe6, 0xe3, 0xae, 0x5b, 0x04, 0x9e, 0x00, 0x0b, 0x47, 0xdd, 0xd0, 0x38, 0x04,
+  0x59, 0xae, 0xe3, 0xed, 0xc9, 0x89, 0x28, 0xa2, 0x00, 0x07, 0x59, 0xde, 0xd7, 0xce, 0xec, 0xe3,
+  0xaa, 0x54, 0xa6, 0x00, 0x04, 0x4b, 0xce, 0xc5, 0x84, 0x21, 0x93, 0x00,
+};
+
+IMAGE_ASSET_DECLARE(flag);
+const ImageAsset flag_asset = {
+  .name = "flag",
+  .data = flag_rle,
+  .data_size = sizeof(flag_rle),
+  .raw_size = 6624,
+  .crc32 = 0x9be17d1f,
+  .w = 46,
+  .h = 48,
+  .codec = IMAGE_CODEC_RLE_PALETTE,
+};
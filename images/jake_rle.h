@@ -0,0 +1,401 @@
+// Generated by tools/compress_images.py from images/jake.h - do not edit.
+// 180x151 RGB565A8, planar RLE: 81540 -> 6100 bytes. Decoded on first use by ImageCache.
+#pragma once
+#include "../ImageCodec.h"
+
+static const uint8_t jake_rle[] = {
+  0xb6, 0x00, 0x00, 0x02, 0xe0, 0xff, 0x20, 0xff, 0x00, 0xff, 0x84, 0x20, 0xff, 0x00, 0x00, 0xff,
+  0x86, 0x20, 0xff, 0x8d, 0x00, 0xff, 0x85, 0xe0, 0xfe, 0x98, 0x00, 0xff, 0x81, 0x20, 0xff, 0x81,
+  0x00, 0xff, 0x81, 0xe0, 0xfe, 0x00, 0xe0, 0xff, 0xee, 0x00, 0x00, 0x00, 0x20, 0xff, 0xc5, 0x00,
+  0xff, 0x81, 0xe0, 0xfe, 0xe9, 0x00, 0x00, 0xcb, 0x00, 0xff, 0x02, 0x20, 0xff, 0xe0, 0xfe, 0xe0,
+  0xff, 0xe3, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xcf, 0x00, 0xff, 0x00, 0x20, 0xff, 0xe1, 0x00, 0x00,
+  0xd3, 0x00, 0xff, 0x00, 0xc0, 0xfe, 0xdd, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0xd6, 0x00, 0xff, 0xdb,
+  0x00, 0x00, 0xd9, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0x96, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x40, 0xff,
+  0x92, 0x00, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x00, 0x83, 0x00, 0x00, 0x01, 0xc0, 0xfe, 0xe0,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x20, 0xff, 0x91, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xe0, 0xfe,
+  0x81, 0x00, 0xff, 0x00, 0xa0, 0xfe, 0x9f, 0x00, 0x00, 0x90, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xfb,
+  0x00, 0x00, 0x00, 0xe0, 0xff, 0x83, 0x00, 0xff, 0xa2, 0x00, 0x00, 0x01, 0x60, 0xfe, 0xe0, 0xfe,
+  0x8d, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xf9, 0x00, 0x00, 0x85, 0x00, 0xff, 0xa4, 0x00, 0x00, 0x00,
+  0xe0, 0xff, 0x8e, 0x00, 0xff, 0xf6, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x86, 0x00, 0xff, 0xa6, 0x00,
+  0x00, 0x00, 0xe0, 0xff, 0x8d, 0x00, 0xff, 0x00, 0x40, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0xfe,
+  0x87, 0x00, 0xff, 0x00, 0x20, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x60, 0xfe, 0x8d, 0x00, 0xff, 0xef,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0x89, 0x00, 0xff, 0xab, 0x00, 0x00, 0x8c, 0x00, 0xff, 0x00, 0xe0,
+  0xfe, 0xec, 0x00, 0x00, 0x01, 0xe0, 0xff, 0xe0, 0xfe, 0x8a, 0x00, 0xff, 0xad, 0x00, 0x00, 0x8c,
+  0x00, 0xff, 0xea, 0x00, 0x00, 0x8c, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xae, 0x00, 0x00, 0x8c, 0x00,
+  0xff, 0x00, 0xe0, 0xff, 0xe6, 0x00, 0x00, 0x8e, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xaf, 0x00, 0x00,
+  0x00, 0xe0, 0xff, 0x8b, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x8f,
+  0x00, 0xff, 0xb2, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x8a, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xe1, 0x00,
+  0x00, 0x00, 0xe0, 0xfe, 0x90, 0x00, 0xff, 0xb3, 0x00, 0x00, 0x8b, 0x00, 0xff, 0xdf, 0x00, 0x00,
+  0x00, 0xe0, 0xff, 0x91, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xb4, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x8a,
+  0x00, 0xff, 0xdd, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x92, 0x00, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x60,
+  0xfe, 0x8a, 0x00, 0xff, 0xdc, 0x00, 0x00, 0x92, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xb7, 0x00, 0x00,
+  0x00, 0xe0, 0xfe, 0x89, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xda, 0x00, 0x00, 0x00, 0x60, 0xfe, 0x92,
+  0x00, 0xff, 0xb9, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x8a, 0x00, 0xff, 0xd9, 0x00, 0x00, 0x93, 0x00,
+  0xff, 0xba, 0x00, 0x00, 0x00, 0x20, 0xff, 0x89, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xd8, 0x00, 0x00,
+  0x93, 0x00, 0xff, 0xbb, 0x00, 0x00, 0x00, 0xa0, 0xfe, 0x89, 0x00, 0xff, 0xd7, 0x00, 0x00, 0x00,
+  0xe0, 0xff, 0x92, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x20, 0xff, 0x88, 0x00,
+  0xff, 0x00, 0xe0, 0xfe, 0xd6, 0x00, 0x00, 0x93, 0x00, 0xff, 0xbe, 0x00, 0x00, 0x89, 0x00, 0xff,
+  0x00, 0x40, 0xff, 0xd5, 0x00, 0x00, 0x93, 0x00, 0xff, 0xbf, 0x00, 0x00, 0x89, 0x00, 0xff, 0x94,
+  0x00, 0x00, 0x97, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x82, 0x00, 0xff, 0xa4, 0x00, 0x00, 0x92, 0x00,
+  0xff, 0x00, 0x00, 0xfe, 0xbf, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x89, 0x00, 0xff, 0x92, 0x00, 0x00,
+  0x00, 0xe0, 0xff, 0x9b, 0x00, 0xff, 0xa3, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x92, 0x00, 0xff, 0xc1,
+  0x00, 0x00, 0x81, 0xe0, 0xfe, 0x87, 0x00, 0xff, 0x00, 0xa0, 0xfe, 0x91, 0x00, 0x00, 0x00, 0xe0,
+  0xfe, 0x9b, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xa2, 0x00, 0x00, 0x92, 0x00, 0xff, 0x00, 0xe0, 0xfe,
+  0xc2, 0x00, 0x00, 0x00, 0x20, 0xff, 0x88, 0x00, 0xff, 0x91, 0x00, 0x00, 0x9c, 0x00, 0xff, 0xa2,
+  0x00, 0x00, 0x00, 0xe0, 0xff, 0x92, 0x00, 0xff, 0xc4, 0x00, 0x00, 0x88, 0x00, 0xff, 0x00, 0xc0,
+  0xfe, 0x90, 0x00, 0x00, 0x00, 0x20, 0xff, 0x9a, 0x00, 0xff, 0x00, 0x60, 0xff, 0xa2, 0x00, 0x00,
+  0x00, 0xe0, 0xfe, 0x91, 0x00, 0xff, 0xc5, 0x00, 0x00, 0x00, 0x40, 0xff, 0x88, 0x00, 0xff, 0x00,
+  0xe0, 0xff, 0xcf, 0x00, 0x00, 0x90, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xc7, 0x00, 0x00, 0x89, 0x00,
+  0xff, 0xcf, 0x00, 0x00, 0x90, 0x00, 0xff, 0xc8, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x88, 0x00, 0xff,
+  0xce, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x8f, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xc9, 0x00, 0x00, 0x00,
+  0xe0, 0xfe, 0x88, 0x00, 0xff, 0xcd, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x8f, 0x00, 0xff, 0xcb, 0x00,
+  0x00, 0x88, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xcb, 0x00, 0x00, 0x91, 0x00, 0xff, 0xcb, 0x00, 0x00,
+  0x89, 0x00, 0xff, 0x8c, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x88, 0x00, 0x00, 0x82, 0xe0, 0xff, 0xb0,
+  0x00, 0x00, 0x91, 0x00, 0xff, 0x00, 0xc0, 0xfe, 0xcc, 0x00, 0x00, 0x88, 0x00, 0xff, 0x8b, 0x00,
+  0x00, 0x00, 0xe0, 0xfe, 0x92, 0x00, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x40, 0xff, 0x92, 0x00, 0xff,
+  0xcd, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x87, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x8a, 0x00, 0x00, 0x93,
+  0x00, 0xff, 0x00, 0xe0, 0xfe, 0xa6, 0x00, 0x00, 0x00, 0xa0, 0xfe, 0x93, 0x00, 0xff, 0xce, 0x00,
+  0x00, 0x88, 0x00, 0xff, 0x8a, 0x00, 0x00, 0x94, 0x00, 0xff, 0xa6, 0x00, 0x00, 0x93, 0x00, 0xff,
+  0x00, 0x20, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x87, 0x00, 0xff, 0x00, 0x60, 0xfe, 0x89,
+  0x00, 0x00, 0x00, 0x20, 0xff, 0x92, 0x00, 0xff, 0x00, 0x20, 0xff, 0xa6, 0x00, 0x00, 0x93, 0x00,
+  0xff, 0xd0, 0x00, 0x00, 0x87, 0x00, 0xff, 0x00, 0x20, 0xff, 0x89, 0x00, 0x00, 0x93, 0x00, 0xff,
+  0xa6, 0x00, 0x00, 0x00, 0xa0, 0xfe, 0x92, 0x00, 0xff, 0x00, 0x20, 0xff, 0xd0, 0x00, 0x00, 0x00,
+  0xa0, 0xfe, 0x87, 0x00, 0xff, 0x89, 0x00, 0x00, 0x01, 0xe0, 0xfe, 0xe0, 0xff, 0xb8, 0x00, 0x00,
+  0x93, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xd1, 0x00, 0x00, 0x87, 0x00, 0xff, 0x00, 0x40, 0xff, 0xc3,
+  0x00, 0x00, 0x93, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x20, 0xff, 0x87, 0x00,
+  0xff, 0xc2, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x93, 0x00, 0xff, 0xd3, 0x00, 0x00, 0x87, 0x00, 0xff,
+  0xc2, 0x00, 0x00, 0x94, 0x00, 0xff, 0xd3, 0x00, 0x00, 0x87, 0x00, 0xff, 0x00, 0xa0, 0xfe, 0xc1,
+  0x00, 0x00, 0x93, 0x00, 0xff, 0x00, 0x60, 0xfe, 0xd3, 0x00, 0x00, 0x00, 0xa0, 0xfe, 0x87, 0x00,
+  0xff, 0xc0, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x93, 0x00, 0xff, 0xd5, 0x00, 0x00, 0x87, 0x00, 0xff,
+  0x85, 0x00, 0x00, 0x82, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x83, 0x00, 0xff, 0x02, 0x20, 0xff, 0x00,
+  0xff, 0xe0, 0xfe, 0x81, 0x00, 0xff, 0x01, 0xe0, 0xfe, 0xe0, 0xff, 0xab, 0x00, 0x00, 0x93, 0x00,
+  0xff, 0x00, 0x20, 0xff, 0xd5, 0x00, 0x00, 0x87, 0x00, 0xff, 0x00, 0xe0, 0xff, 0x83, 0x00, 0x00,
+  0x8f, 0x00, 0xff, 0xab, 0x00, 0x00, 0x93, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xd5, 0x00, 0x00, 0x00,
+  0x40, 0xff, 0x86, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x83, 0x00, 0x00, 0x8f, 0x00, 0xff, 0xaa, 0x00,
+  0x00, 0x00, 0xe0, 0xff, 0x93, 0x00, 0xff, 0xd7, 0x00, 0x00, 0x87, 0x00, 0xff, 0x83, 0x00, 0x00,
+  0x8f, 0x00, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x20, 0xff, 0x93, 0x00, 0xff, 0xd7, 0x00, 0x00, 0x00,
+  0x20, 0xff, 0x86, 0x00, 0xff, 0x83, 0x00, 0x00, 0x8f, 0x00, 0xff, 0xaa, 0x00, 0x00, 0x93, 0x00,
+  0xff, 0x00, 0xe0, 0xfe, 0xd7, 0x00, 0x00, 0x87, 0x00, 0xff, 0x83, 0x00, 0x00, 0x04, 0x40, 0xff,
+  0xe0, 0xfe, 0x00, 0xff, 0xe0, 0xfe, 0x00, 0xff, 0x81, 0xe0, 0xfe, 0x83, 0x00, 0xff, 0x81, 0xe0,
+  0xfe, 0x81, 0x00, 0xff, 0xab, 0x00, 0x00, 0x93, 0x00, 0xff, 0xd8, 0x00, 0x00, 0x00, 0xa0, 0xfe,
+  0x86, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xbc, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x93, 0x00, 0xff, 0xd8,
+  0x00, 0x00, 0x00, 0xe0, 0xff, 0x87, 0x00, 0xff, 0xbc, 0x00, 0x00, 0x93, 0x00, 0xff, 0x00, 0xe0,
+  0xfe, 0xd9, 0x00, 0x00, 0x87, 0x00, 0xff, 0xbc, 0x00, 0x00, 0x93, 0x00, 0xff, 0x00, 0xe0, 0xff,
+  0xd9, 0x00, 0x00, 0x87, 0x00, 0xff, 0xbb, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x93, 0x00, 0xff, 0xda,
+  0x00, 0x00, 0x00, 0xe0, 0xfe, 0x86, 0x00, 0xff, 0xbb, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x93, 0x00,
+  0xff, 0xda, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x86, 0x00, 0xff, 0x81, 0x00, 0x00, 0x02, 0xe0, 0xff,
+  0x00, 0xff, 0xa0, 0xfe, 0x81, 0x40, 0xff, 0x05, 0xa0, 0xfe, 0xe0, 0xfe, 0x00, 0xff, 0xe0, 0xfe,
+  0x40, 0xff, 0xe0, 0xff, 0xae, 0x00, 0x00, 0x94, 0x00, 0xff, 0xda, 0x00, 0x00, 0x00, 0xe0, 0xfe,
+  0x86, 0x00, 0xff, 0x01, 0xa0, 0xfe, 0xe0, 0xff, 0x8c, 0x00, 0xff, 0x00, 0xa0, 0xfe, 0xaa, 0x00,
+  0x00, 0x94, 0x00, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x20, 0xff, 0x96, 0x00, 0xff, 0xaa, 0x00, 0x00,
+  0x94, 0x00, 0xff, 0xdb, 0x00, 0x00, 0x97, 0x00, 0xff, 0xa8, 0x00, 0x00, 0x95, 0x00, 0xff, 0x00,
+  0x20, 0xff, 0xdb, 0x00, 0x00, 0x88, 0x00, 0xff, 0x00, 0xa0, 0xfe, 0x8d, 0x00, 0xff, 0xa5, 0x00,
+  0x00, 0x00, 0xe0, 0xff, 0x97, 0x00, 0xff, 0xdc, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x86, 0x00, 0xff,
+  0x01, 0xe0, 0xfe, 0x00, 0x00, 0x82, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x84, 0x00, 0xff, 0x00, 0x20,
+  0xff, 0x82, 0x00, 0xff, 0x00, 0x60, 0xfe, 0xa3, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x97, 0x00, 0xff,
+  0x00, 0xe0, 0xfe, 0xdd, 0x00, 0x00, 0x87, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xaf, 0x00, 0x00, 0x01,
+  0xe0, 0xff, 0xe0, 0xfe, 0x97, 0x00, 0xff, 0x00, 0x20, 0xff, 0xdf, 0x00, 0x00, 0x88, 0x00, 0xff,
+  0xad, 0x00, 0x00, 0x00, 0xa0, 0xfe, 0x98, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xe1, 0x00, 0x00, 0x88,
+  0x00, 0xff, 0xaa, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x98, 0x00, 0xff, 0x00, 0x40, 0xff, 0xe3, 0x00,
+  0x00, 0x00, 0x60, 0xfe, 0x88, 0x00, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x98, 0x00, 0xff,
+  0xe6, 0x00, 0x00, 0x89, 0x00, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x20, 0xff, 0x96, 0x00, 0xff, 0x01,
+  0x20, 0xff, 0x00, 0xfe, 0xe6, 0x00, 0x00, 0x00, 0xa0, 0xfe, 0x8a, 0x00, 0xff, 0xa3, 0x00, 0x00,
+  0x01, 0xe0, 0xff, 0xe0, 0xfe, 0x96, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xe6, 0x00, 0x00, 0x00, 0xe0,
+  0xff, 0x8d, 0x00, 0xff, 0x88, 0x20, 0xff, 0x8d, 0x00, 0xff, 0x8b, 0xe0, 0xfe, 0x00, 0x00, 0xff,
+  0x94, 0x20, 0xff, 0x81, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xe5, 0x00, 0xff, 0x00, 0x20, 0xff, 0x90,
+  0x00, 0xff, 0x00, 0xe0, 0xfe, 0xa3, 0x00, 0xff, 0x00, 0xc0, 0xfe, 0x93, 0x00, 0x00, 0x00, 0x20,
+  0xff, 0xff, 0x00, 0xff, 0x9f, 0x00, 0xff, 0x00, 0xe0, 0xff, 0x93, 0x00, 0x00, 0x00, 0xc0, 0xfe,
+  0xff, 0x00, 0xff, 0x9f, 0x00, 0xff, 0x00, 0x20, 0xff, 0x93, 0x00, 0x00, 0x01, 0xa0, 0xfe, 0xe0,
+  0xfe, 0xf3, 0x00, 0xff, 0x00, 0x40, 0xff, 0xaa, 0x00, 0xff, 0x00, 0xe0, 0xff, 0x92, 0x00, 0x00,
+  0x00, 0x00, 0xfe, 0xf2, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xac, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x93,
+  0x00, 0x00, 0xf0, 0x00, 0xff, 0x00, 0x00, 0x00, 0xae, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x93, 0x00,
+  0x00, 0x00, 0x20, 0xff, 0xed, 0x00, 0xff, 0x00, 0x00, 0x00, 0xb2, 0x00, 0xff, 0x92, 0x00, 0x00,
+  0xeb, 0x00, 0xff, 0x01, 0xe0, 0xfe, 0x00, 0x00, 0xb4, 0x00, 0xff, 0x92, 0x00, 0x00, 0x00, 0xe0,
+  0xff, 0xe8, 0x00, 0xff, 0x02, 0xe0, 0xfe, 0x00, 0x00, 0xc0, 0xfe, 0xb5, 0x00, 0xff, 0x00, 0x00,
+  0xfe, 0x92, 0x00, 0x00, 0xe6, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x81, 0x00, 0x00, 0xb6, 0x00, 0xff,
+  0x01, 0xe0, 0xfe, 0xe0, 0xff, 0x91, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xe5, 0x00, 0xff, 0x81, 0x00,
+  0x00, 0xb8, 0x00, 0xff, 0x91, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xe4, 0x00, 0xff, 0x00, 0x20, 0xff,
+  0x81, 0x00, 0x00, 0xb8, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x91, 0x00, 0x00, 0xe5, 0x00, 0xff, 0x81,
+  0x00, 0x00, 0xb9, 0x00, 0xff, 0x91, 0x00, 0x00, 0xe4, 0x00, 0xff, 0x82, 0x00, 0x00, 0x00, 0xe0,
+  0xff, 0xb8, 0x00, 0xff, 0x91, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe3, 0x00, 0xff, 0x83, 0x00, 0x00,
+  0xb8, 0x00, 0xff, 0x00, 0x20, 0xff, 0x91, 0x00, 0x00, 0xe3, 0x00, 0xff, 0x83, 0x00, 0x00, 0xb9,
+  0x00, 0xff, 0x91, 0x00, 0x00, 0xe3, 0x00, 0xff, 0x83, 0x00, 0x00, 0xb9, 0x00, 0xff, 0x91, 0x00,
+  0x00, 0x00, 0x00, 0xfe, 0xe2, 0x00, 0xff, 0x83, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xb8, 0x00, 0xff,
+  0x00, 0xe0, 0xfe, 0x91, 0x00, 0x00, 0xe2, 0x00, 0xff, 0x84, 0x00, 0x00, 0xb9, 0x00, 0xff, 0x91,
+  0x00, 0x00, 0x00, 0x20, 0xff, 0xe0, 0x00, 0xff, 0x85, 0x00, 0x00, 0xb9, 0x00, 0xff, 0x91, 0x00,
+  0x00, 0xe1, 0x00, 0xff, 0x85, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xb8, 0x00, 0xff, 0x00, 0x00, 0xfe,
+  0x90, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xe0, 0x00, 0xff, 0x85, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xb9,
+  0x00, 0xff, 0x91, 0x00, 0x00, 0xdf, 0x00, 0xff, 0x00, 0x20, 0xff, 0x86, 0x00, 0x00, 0xb9, 0x00,
+  0xff, 0x91, 0x00, 0x00, 0x00, 0x20, 0xff, 0xde, 0x00, 0xff, 0x00, 0xe0, 0xff, 0x86, 0x00, 0x00,
+  0xb9, 0x00, 0xff, 0x92, 0x00, 0x00, 0xde, 0x00, 0xff, 0x87, 0x00, 0x00, 0xb9, 0x00, 0xff, 0x00,
+  0x20, 0xff, 0x91, 0x00, 0x00, 0xde, 0x00, 0xff, 0x87, 0x00, 0x00, 0x00, 0x20, 0xff, 0xb9, 0x00,
+  0xff, 0x91, 0x00, 0x00, 0xdd, 0x00, 0xff, 0x00, 0x20, 0xff, 0x87, 0x00, 0x00, 0x00, 0xe0, 0xff,
+  0xb9, 0x00, 0xff, 0x91, 0x00, 0x00, 0x00, 0x60, 0xfe, 0xdc, 0x00, 0xff, 0x89, 0x00, 0x00, 0xb9,
+  0x00, 0xff, 0x00, 0xc0, 0xfe, 0x91, 0x00, 0x00, 0xdc, 0x00, 0xff, 0x89, 0x00, 0x00, 0x00, 0xe0,
+  0xfe, 0xb9, 0x00, 0xff, 0x91, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xda, 0x00, 0xff, 0x00, 0x20, 0xff,
+  0x89, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xb9, 0x00, 0xff, 0x91, 0x00, 0x00, 0xdb, 0x00, 0xff, 0x8b,
+  0x00, 0x00, 0xb9, 0x00, 0xff, 0x00, 0x40, 0xff, 0x91, 0x00, 0x00, 0xd9, 0x00, 0xff, 0x00, 0x20,
+  0xff, 0x8b, 0x00, 0x00, 0xba, 0x00, 0xff, 0x91, 0x00, 0x00, 0xd9, 0x00, 0xff, 0x00, 0x40, 0xff,
+  0x8b, 0x00, 0x00, 0xba, 0x00, 0xff, 0x91, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xd8, 0x00, 0xff, 0x8c,
+  0x00, 0x00, 0x00, 0xe0, 0xfe, 0xb9, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x90, 0x00, 0x00, 0x00, 0xe0,
+  0xff, 0xd7, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x8d, 0x00, 0x00, 0xbb, 0x00, 0xff, 0x00, 0xe0, 0xff,
+  0x8f, 0x00, 0x00, 0xd7, 0x00, 0xff, 0x8e, 0x00, 0x00, 0xbc, 0x00, 0xff, 0x00, 0xc0, 0xfe, 0x8e,
+  0x00, 0x00, 0xd6, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x8e, 0x00, 0x00, 0xbd, 0x00, 0xff, 0x00, 0xe0,
+  0xfe, 0x8d, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xd5, 0x00, 0xff, 0x00, 0xe0, 0xff, 0x8e, 0x00, 0x00,
+  0x00, 0xe0, 0xff, 0xbd, 0x00, 0xff, 0x8e, 0x00, 0x00, 0xd5, 0x00, 0xff, 0x90, 0x00, 0x00, 0x9d,
+  0x00, 0xff, 0x00, 0x20, 0xff, 0x9f, 0x00, 0xff, 0x8d, 0x00, 0x00, 0xd4, 0x00, 0xff, 0x00, 0xe0,
+  0xff, 0x90, 0x00, 0x00, 0x00, 0x60, 0xfe, 0xbd, 0x00, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0xfe,
+  0xd3, 0x00, 0xff, 0x92, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x9c, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x9e,
+  0x00, 0xff, 0x8e, 0x00, 0x00, 0xd2, 0x00, 0xff, 0x00, 0xe0, 0xff, 0x94, 0x00, 0x00, 0x00, 0xe0,
+  0xff, 0x81, 0xe0, 0xfe, 0x82, 0x00, 0xff, 0x8a, 0xe0, 0xfe, 0x85, 0x00, 0xff, 0x82, 0xe0, 0xfe,
+  0x02, 0x00, 0xff, 0xe0, 0xff, 0x00, 0x00, 0x9e, 0x00, 0xff, 0x00, 0xa0, 0xfe, 0x8e, 0x00, 0x00,
+  0xd0, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xb2, 0x00, 0x00, 0x9f, 0x00, 0xff, 0x8f, 0x00, 0x00, 0x00,
+  0x20, 0xff, 0xce, 0x00, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x60, 0xfe, 0x9e, 0x00, 0xff, 0x90, 0x00,
+  0x00, 0xcd, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xb4, 0x00, 0x00, 0x9f, 0x00, 0xff, 0x90, 0x00, 0x00,
+  0xcc, 0x00, 0xff, 0xb5, 0x00, 0x00, 0x9f, 0x00, 0xff, 0x90, 0x00, 0x00, 0xcb, 0x00, 0xff, 0x00,
+  0xe0, 0xff, 0xb6, 0x00, 0x00, 0x9e, 0x00, 0xff, 0x90, 0x00, 0x00, 0xca, 0x00, 0xff, 0x00, 0xc0,
+  0xfe, 0xb7, 0x00, 0x00, 0x9e, 0x00, 0xff, 0x00, 0xe0, 0xff, 0x90, 0x00, 0x00, 0xc9, 0x00, 0xff,
+  0xb8, 0x00, 0x00, 0x9f, 0x00, 0xff, 0x90, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xc7, 0x00, 0xff, 0xba,
+  0x00, 0x00, 0x9e, 0x00, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc6, 0x00, 0xff, 0x00, 0xa0,
+  0xfe, 0xba, 0x00, 0x00, 0x9e, 0x00, 0xff, 0x00, 0xe0, 0xff, 0x90, 0x00, 0x00, 0xc5, 0x00, 0xff,
+  0x00, 0xe0, 0xfe, 0xbb, 0x00, 0x00, 0x01, 0xe0, 0xff, 0xe0, 0xfe, 0x9d, 0x00, 0xff, 0x90, 0x00,
+  0x00, 0xc5, 0x00, 0xff, 0xbd, 0x00, 0x00, 0x9e, 0x00, 0xff, 0x90, 0x00, 0x00, 0x00, 0xe0, 0xfe,
+  0xc3, 0x00, 0xff, 0xbe, 0x00, 0x00, 0x00, 0x40, 0xff, 0x9e, 0x00, 0xff, 0x90, 0x00, 0x00, 0xc2,
+  0x00, 0xff, 0x00, 0xe0, 0xff, 0xbf, 0x00, 0x00, 0x9f, 0x00, 0xff, 0x00, 0x00, 0xfe, 0x8e, 0x00,
+  0x00, 0xc1, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xc0, 0x00, 0x00, 0xa1, 0x00, 0xff, 0x8d, 0x00, 0x00,
+  0x00, 0xa0, 0xfe, 0xbe, 0x00, 0xff, 0x01, 0xe0, 0xfe, 0xe0, 0xff, 0xc1, 0x00, 0x00, 0x00, 0xe0,
+  0xff, 0xa1, 0x00, 0xff, 0x00, 0x40, 0xff, 0x8c, 0x00, 0x00, 0xbd, 0x00, 0xff, 0x01, 0xe0, 0xfe,
+  0xe0, 0xff, 0xc3, 0x00, 0x00, 0xa3, 0x00, 0xff, 0x00, 0xe0, 0xff, 0x8a, 0x00, 0x00, 0xbd, 0x00,
+  0xff, 0x00, 0xe0, 0xff, 0xc4, 0x00, 0x00, 0xa5, 0x00, 0xff, 0x89, 0x00, 0x00, 0x00, 0xe0, 0xfe,
+  0xbb, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xc6, 0x00, 0x00, 0xa5, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x88,
+  0x00, 0x00, 0xba, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xc7, 0x00, 0x00, 0xa7, 0x00, 0xff, 0x00, 0xe0,
+  0xfe, 0x86, 0x00, 0x00, 0xb8, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xc9, 0x00, 0x00, 0x00, 0xa0, 0xfe,
+  0xa8, 0x00, 0xff, 0x00, 0xc0, 0xfe, 0x84, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xb6, 0x00, 0xff, 0x00,
+  0xe0, 0xfe, 0xcb, 0x00, 0x00, 0xaa, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x83, 0x00, 0x00, 0xb5, 0x00,
+  0xff, 0x00, 0x00, 0xfe, 0xcc, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xab, 0x00, 0xff, 0x82, 0x00, 0x00,
+  0xb4, 0x00, 0xff, 0xce, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xac, 0x00, 0xff, 0x01, 0x20, 0xff, 0x00,
+  0x00, 0xb2, 0x00, 0xff, 0x00, 0x60, 0xff, 0xd0, 0x00, 0x00, 0xae, 0x00, 0xff, 0x00, 0xe0, 0xfe,
+  0xb0, 0x00, 0xff, 0xd2, 0x00, 0x00, 0xde, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xd4, 0x00, 0x00, 0xdb,
+  0x00, 0xff, 0x00, 0xc0, 0xfe, 0xd6, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0xd8, 0x00, 0xff, 0x00, 0xe0,
+  0xfe, 0xd9, 0x00, 0x00, 0xd6, 0x00, 0xff, 0x00, 0x20, 0xff, 0xdb, 0x00, 0x00, 0x00, 0xa0, 0xfe,
+  0xd3, 0x00, 0xff, 0x00, 0xe0, 0xff, 0xde, 0x00, 0x00, 0xd0, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0xe2,
+  0x00, 0x00, 0xcd, 0x00, 0xff, 0xe6, 0x00, 0x00, 0xc6, 0x00, 0xff, 0x01, 0xe0, 0xfe, 0x20, 0xff,
+  0xeb, 0x00, 0x00, 0x88, 0x00, 0xff, 0x00, 0x20, 0xff, 0xb3, 0x00, 0xff, 0x00, 0x20, 0xff, 0x82,
+  0x00, 0xff, 0x01, 0x40, 0xff, 0xe0, 0xff, 0xb7, 0x00, 0x00, 0xb6, 0x00, 0x10, 0x02, 0x35, 0x7f,
+  0x94, 0x96, 0x95, 0x94, 0x93, 0x92, 0x91, 0x90, 0x8f, 0x8e, 0x8d, 0x8c, 0x8b, 0x8a, 0x8f, 0x89,
+  0x85, 0x88, 0x91, 0x87, 0x0a, 0x86, 0x84, 0x7d, 0x73, 0x66, 0x59, 0x41, 0x29, 0x16, 0x07, 0x01,
+  0xee, 0x00, 0x02, 0x13, 0xa7, 0xfb, 0xbe, 0xff, 0x06, 0xf4, 0xe4, 0xc3, 0x99, 0x6c, 0x3a, 0x0f,
+  0xe9, 0x00, 0x01, 0x1f, 0xd2, 0xc5, 0xff, 0x06, 0xfe, 0xf2, 0xc6, 0x86, 0x46, 0x0f, 0x01, 0xe3,
+  0x00, 0x01, 0x0e, 0xd0, 0xcb, 0xff, 0x03, 0xf0, 0xb6, 0x65, 0x1b, 0xe1, 0x00, 0x00, 0x88, 0xcf,
+  0xff, 0x03, 0xf6, 0xb4, 0x56, 0x0d, 0xdd, 0x00, 0x01, 0x1b, 0xf4, 0xd2, 0xff, 0x02, 0xe8, 0x93,
+  0x2a, 0xdb, 0x00, 0x00, 0x29, 0xbc, 0x70, 0x07, 0x71, 0x78, 0x85, 0x96, 0xae, 0xce, 0xef, 0xfc,
+  0x90, 0xff, 0x03, 0xf9, 0xb1, 0x39, 0x02, 0xff, 0x00, 0x9c, 0x00, 0x06, 0x04, 0x21, 0x4e, 0x80,
+  0xb7, 0xe8, 0xfd, 0x8d, 0xff, 0x03, 0xfe, 0xbd, 0x42, 0x02, 0xff, 0x00, 0x9f, 0x00, 0x04, 0x0b,
+  0x36, 0x77, 0xbb, 0xf7, 0x8c, 0xff, 0x02, 0xfc, 0xb6, 0x2c, 0xff, 0x00, 0x83, 0x00, 0x01, 0x0d,
+  0x02, 0x9c, 0x00, 0x03, 0x13, 0x61, 0xbb, 0xf6, 0x8b, 0xff, 0x02, 0xf9, 0x96, 0x17, 0xff, 0x00,
+  0x03, 0x0e, 0x85, 0xd9, 0x0c, 0x9f, 0x00, 0x02, 0x22, 0x7c, 0xd9, 0x8b, 0xff, 0x02, 0xe6, 0x5d,
+  0x02, 0xfb, 0x00, 0x04, 0x01, 0x49, 0xdc, 0xff, 0xd2, 0xa2, 0x00, 0x03, 0x05, 0x4c, 0xc0, 0xfc,
+  0x89, 0xff, 0x02, 0xfe, 0xb1, 0x1e, 0xf9, 0x00, 0x02, 0x19, 0xa0, 0xfb, 0x81, 0xff, 0x00, 0x98,
+  0xa4, 0x00, 0x03, 0x02, 0x40, 0xb9, 0xfd, 0x89, 0xff, 0x01, 0xe9, 0x54, 0xf6, 0x00, 0x02, 0x0d,
+  0x78, 0xee, 0x83, 0xff, 0x00, 0x51, 0xa6, 0x00, 0x03, 0x01, 0x3f, 0xc5, 0xfe, 0x88, 0xff, 0x02,
+  0xfd, 0x8f, 0x0a, 0xf2, 0x00, 0x02, 0x04, 0x5f, 0xdd, 0x84, 0xff, 0x01, 0xf1, 0x13, 0xa8, 0x00,
+  0x02, 0x05, 0x5e, 0xe2, 0x89, 0xff, 0x01, 0xc3, 0x19, 0xef, 0x00, 0x03, 0x04, 0x4d, 0xcd, 0xfe,
+  0x85, 0xff, 0x00, 0xb3, 0xab, 0x00, 0x02, 0x11, 0x91, 0xfa, 0x88, 0xff, 0x01, 0xe0, 0x35, 0xec,
+  0x00, 0x03, 0x01, 0x43, 0xc3, 0xfe, 0x87, 0xff, 0x00, 0x5f, 0xad, 0x00, 0x01, 0x42, 0xd9, 0x88,
+  0xff, 0x01, 0xf0, 0x4f, 0xea, 0x00, 0x02, 0x2f, 0xb3, 0xfc, 0x88, 0xff, 0x01, 0xf5, 0x16, 0xae,
+  0x00, 0x02, 0x10, 0x9d, 0xfd, 0x87, 0xff, 0x02, 0xf8, 0x61, 0x01, 0xe6, 0x00, 0x02, 0x18, 0x98,
+  0xf8, 0x8a, 0xff, 0x01, 0xb7, 0x01, 0xaf, 0x00, 0x02, 0x02, 0x61, 0xf2, 0x87, 0xff, 0x02, 0xfb,
+  0x6a, 0x01, 0xe3, 0x00, 0x02, 0x04, 0x61, 0xe8, 0x8c, 0xff, 0x00, 0x64, 0xb2, 0x00, 0x01, 0x35,
+  0xdc, 0x87, 0xff, 0x02, 0xfc, 0x6b, 0x01, 0xe1, 0x00, 0x01, 0x2b, 0xbe, 0x8d, 0xff, 0x01, 0xf8,
+  0x18, 0xb3, 0x00, 0x01, 0x17, 0xc5, 0x87, 0xff, 0x01, 0xfb, 0x65, 0xdf, 0x00, 0x02, 0x01, 0x67,
+  0xf2, 0x8e, 0xff, 0x01, 0xc2, 0x01, 0xb4, 0x00, 0x01, 0x0e, 0xaf, 0x87, 0xff, 0x01, 0xf9, 0x56,
+  0xdd, 0x00, 0x02, 0x03, 0x96, 0xfe, 0x8f, 0xff, 0x00, 0x71, 0xb6, 0x00, 0x01, 0x05, 0xa3, 0x87,
+  0xff, 0x01, 0xf4, 0x3f, 0xdc, 0x00, 0x00, 0x6a, 0x90, 0xff, 0x01, 0xf8, 0x25, 0xb7, 0x00, 0x01,
+  0x07, 0x9d, 0x87, 0xff, 0x01, 0xe8, 0x24, 0xda, 0x00, 0x01, 0x05, 0xdb, 0x90, 0xff, 0x00, 0xc8,
+  0xb9, 0x00, 0x01, 0x04, 0xa2, 0x87, 0xff, 0x01, 0xd0, 0x10, 0xd9, 0x00, 0x01, 0x3a, 0xfd, 0x90,
+  0xff, 0x00, 0x76, 0xba, 0x00, 0x01, 0x09, 0xb2, 0x87, 0xff, 0x01, 0xa6, 0x01, 0xd8, 0x00, 0x00,
+  0x8b, 0x90, 0xff, 0x01, 0xfc, 0x22, 0xbb, 0x00, 0x01, 0x0c, 0xc6, 0x87, 0xff, 0x00, 0x6c, 0xd7,
+  0x00, 0x01, 0x02, 0xd8, 0x90, 0xff, 0x01, 0xcc, 0x01, 0xbc, 0x00, 0x01, 0x1b, 0xde, 0x86, 0xff,
+  0x01, 0xf4, 0x35, 0xd6, 0x00, 0x01, 0x28, 0xfc, 0x90, 0xff, 0x00, 0x7e, 0xbe, 0x00, 0x01, 0x33,
+  0xf2, 0x86, 0xff, 0x01, 0xd0, 0x0a, 0xd5, 0x00, 0x00, 0x77, 0x90, 0xff, 0x01, 0xfc, 0x2f, 0xbf,
+  0x00, 0x01, 0x5f, 0xfd, 0x86, 0xff, 0x00, 0x89, 0x94, 0x00, 0x01, 0x55, 0xcc, 0x95, 0xd3, 0x03,
+  0xd5, 0xc2, 0x8f, 0x2f, 0xa4, 0x00, 0x00, 0xc4, 0x90, 0xff, 0x01, 0xd5, 0x04, 0xbf, 0x00, 0x01,
+  0x01, 0x9c, 0x86, 0xff, 0x01, 0xf9, 0x3a, 0x92, 0x00, 0x01, 0x01, 0xd1, 0x99, 0xff, 0x00, 0xc3,
+  0xa3, 0x00, 0x01, 0x1d, 0xf6, 0x90, 0xff, 0x00, 0x86, 0xc1, 0x00, 0x01, 0x0e, 0xd5, 0x86, 0xff,
+  0x01, 0xcd, 0x06, 0x91, 0x00, 0x01, 0x0f, 0xf0, 0x99, 0xff, 0x01, 0xdb, 0x03, 0xa2, 0x00, 0x00,
+  0x61, 0x90, 0xff, 0x01, 0xf5, 0x25, 0xc2, 0x00, 0x01, 0x35, 0xf8, 0x86, 0xff, 0x00, 0x6e, 0x91,
+  0x00, 0x01, 0x2a, 0xfc, 0x99, 0xff, 0x00, 0x9b, 0xa2, 0x00, 0x01, 0x01, 0xaf, 0x8f, 0xff, 0x01,
+  0xfa, 0x60, 0xc4, 0x00, 0x00, 0x87, 0x86, 0xff, 0x01, 0xec, 0x1b, 0x90, 0x00, 0x08, 0x1b, 0xd8,
+  0xdf, 0xcb, 0xb9, 0xaf, 0xab, 0xa5, 0xa1, 0x81, 0x9f, 0x04, 0xa0, 0xa2, 0xa5, 0xa8, 0xac, 0x87,
+  0xaf, 0x04, 0xac, 0xa3, 0x97, 0x73, 0x0c, 0xa2, 0x00, 0x01, 0x0e, 0xef, 0x8e, 0xff, 0x01, 0xf1,
+  0x53, 0xc5, 0x00, 0x01, 0x0b, 0xd4, 0x86, 0xff, 0x01, 0x97, 0x01, 0xcf, 0x00, 0x00, 0x4c, 0x8e,
+  0xff, 0x01, 0xed, 0x3a, 0xc7, 0x00, 0x01, 0x3f, 0xfc, 0x85, 0xff, 0x01, 0xf8, 0x29, 0xcf, 0x00,
+  0x00, 0xa0, 0x8d, 0xff, 0x01, 0xfe, 0x55, 0xc8, 0x00, 0x01, 0x01, 0xa2, 0x86, 0xff, 0x00, 0xa6,
+  0xce, 0x00, 0x01, 0x0e, 0xee, 0x8d, 0xff, 0x01, 0xda, 0x02, 0xc9, 0x00, 0x01, 0x1d, 0xed, 0x85,
+  0xff, 0x01, 0xfa, 0x32, 0xcd, 0x00, 0x00, 0x5a, 0x8e, 0xff, 0x00, 0x8c, 0xcb, 0x00, 0x00, 0x76,
+  0x86, 0xff, 0x01, 0xa9, 0x01, 0xcb, 0x00, 0x01, 0x20, 0xde, 0x8e, 0xff, 0x00, 0x41, 0xcb, 0x00,
+  0x01, 0x08, 0xdb, 0x85, 0xff, 0x01, 0xf8, 0x28, 0x8c, 0x00, 0x00, 0x03, 0x88, 0x00, 0x82, 0x01,
+  0xb0, 0x00, 0x01, 0x46, 0xe2, 0x8e, 0xff, 0x01, 0xe8, 0x0d, 0xcc, 0x00, 0x01, 0x5e, 0xfe, 0x85,
+  0xff, 0x00, 0x92, 0x8b, 0x00, 0x01, 0x0e, 0xce, 0x87, 0xd7, 0x03, 0xd9, 0xda, 0xdb, 0xda, 0x82,
+  0xd7, 0x02, 0xd1, 0xc5, 0x6d, 0xa8, 0x00, 0x02, 0x0b, 0x95, 0xfc, 0x8f, 0xff, 0x00, 0xa6, 0xcd,
+  0x00, 0x01, 0x07, 0xd0, 0x85, 0xff, 0x01, 0xf0, 0x15, 0x8a, 0x00, 0x01, 0x3d, 0xfe, 0x90, 0xff,
+  0x01, 0xfb, 0x2d, 0xa6, 0x00, 0x01, 0x06, 0xb4, 0x91, 0xff, 0x00, 0x58, 0xce, 0x00, 0x00, 0x54,
+  0x86, 0xff, 0x00, 0x73, 0x8a, 0x00, 0x00, 0x67, 0x91, 0xff, 0x01, 0xfe, 0x48, 0xa6, 0x00, 0x00,
+  0x50, 0x91, 0xff, 0x01, 0xf3, 0x13, 0xce, 0x00, 0x01, 0x04, 0xd0, 0x85, 0xff, 0x01, 0xd4, 0x05,
+  0x89, 0x00, 0x00, 0x8b, 0x91, 0xff, 0x01, 0xe6, 0x12, 0xa6, 0x00, 0x00, 0xa5, 0x91, 0xff, 0x00,
+  0xb8, 0xd0, 0x00, 0x00, 0x61, 0x85, 0xff, 0x01, 0xfe, 0x3d, 0x89, 0x00, 0x13, 0xa0, 0xe0, 0xc3,
+  0xb0, 0xa0, 0x95, 0x90, 0x8d, 0x93, 0x99, 0x9f, 0xa5, 0xaa, 0xad, 0xae, 0xaa, 0xa1, 0x91, 0x82,
+  0x27, 0xa6, 0x00, 0x01, 0x0c, 0xef, 0x91, 0xff, 0x00, 0x68, 0xd0, 0x00, 0x01, 0x0c, 0xe2, 0x85,
+  0xff, 0x00, 0x98, 0x89, 0x00, 0x01, 0x07, 0x03, 0xb8, 0x00, 0x00, 0x51, 0x91, 0xff, 0x01, 0xfa,
+  0x23, 0xd1, 0x00, 0x00, 0x7e, 0x85, 0xff, 0x01, 0xea, 0x0b, 0xc3, 0x00, 0x00, 0xa5, 0x91, 0xff,
+  0x01, 0xce, 0x02, 0xd1, 0x00, 0x01, 0x1a, 0xf6, 0x85, 0xff, 0x00, 0x50, 0xc2, 0x00, 0x01, 0x0d,
+  0xe9, 0x91, 0xff, 0x00, 0x84, 0xd3, 0x00, 0x00, 0xa9, 0x85, 0xff, 0x00, 0xa5, 0xc2, 0x00, 0x01,
+  0x48, 0xfe, 0x90, 0xff, 0x01, 0xfd, 0x38, 0xd3, 0x00, 0x00, 0x4d, 0x85, 0xff, 0x01, 0xe8, 0x0c,
+  0xc1, 0x00, 0x00, 0x94, 0x91, 0xff, 0x01, 0xe0, 0x05, 0xd3, 0x00, 0x01, 0x0c, 0xe5, 0x85, 0xff,
+  0x00, 0x42, 0xc0, 0x00, 0x01, 0x03, 0xda, 0x91, 0xff, 0x00, 0x97, 0xd5, 0x00, 0x00, 0x9b, 0x85,
+  0xff, 0x00, 0x88, 0x85, 0x00, 0x06, 0x32, 0x56, 0x4e, 0x4c, 0x50, 0x56, 0x5d, 0x82, 0x62, 0x04,
+  0x5a, 0x48, 0x2f, 0x15, 0x02, 0xab, 0x00, 0x00, 0x2f, 0x92, 0xff, 0x00, 0x47, 0xd5, 0x00, 0x01,
+  0x46, 0xfe, 0x84, 0xff, 0x01, 0xcb, 0x01, 0x83, 0x00, 0x01, 0x2a, 0xf9, 0x8b, 0xff, 0x01, 0xf5,
+  0x7f, 0xab, 0x00, 0x00, 0x7e, 0x91, 0xff, 0x01, 0xee, 0x0f, 0xd5, 0x00, 0x01, 0x0a, 0xee, 0x84,
+  0xff, 0x01, 0xfa, 0x15, 0x83, 0x00, 0x00, 0x72, 0x8d, 0xff, 0x00, 0xc6, 0xaa, 0x00, 0x01, 0x01,
+  0xcc, 0x91, 0xff, 0x00, 0xb1, 0xd7, 0x00, 0x00, 0xad, 0x85, 0xff, 0x00, 0x51, 0x83, 0x00, 0x00,
+  0xa3, 0x8d, 0xff, 0x00, 0xbe, 0xaa, 0x00, 0x01, 0x23, 0xf9, 0x91, 0xff, 0x00, 0x65, 0xd7, 0x00,
+  0x00, 0x6a, 0x85, 0xff, 0x00, 0x8e, 0x83, 0x00, 0x01, 0xb0, 0xfb, 0x82, 0xfc, 0x00, 0xfd, 0x81,
+  0xfe, 0x82, 0xff, 0x04, 0xfe, 0xfd, 0xfc, 0xef, 0x4d, 0xaa, 0x00, 0x00, 0x6a, 0x91, 0xff, 0x01,
+  0xf7, 0x1d, 0xd7, 0x00, 0x01, 0x31, 0xfe, 0x84, 0xff, 0x00, 0xc7, 0x83, 0x00, 0x0e, 0x0a, 0x25,
+  0x29, 0x2c, 0x30, 0x35, 0x39, 0x3d, 0x3f, 0x40, 0x3f, 0x3b, 0x34, 0x29, 0x11, 0xab, 0x00, 0x00,
+  0xb5, 0x91, 0xff, 0x00, 0xc5, 0xd8, 0x00, 0x01, 0x0c, 0xec, 0x84, 0xff, 0x01, 0xed, 0x0e, 0xbc,
+  0x00, 0x01, 0x0f, 0xf1, 0x91, 0xff, 0x00, 0x74, 0xd8, 0x00, 0x01, 0x01, 0xc4, 0x84, 0xff, 0x01,
+  0xfc, 0x31, 0xbc, 0x00, 0x00, 0x52, 0x91, 0xff, 0x01, 0xfd, 0x26, 0xd9, 0x00, 0x00, 0x98, 0x85,
+  0xff, 0x00, 0x5b, 0xbc, 0x00, 0x00, 0xa6, 0x91, 0xff, 0x01, 0xd3, 0x03, 0xd9, 0x00, 0x00, 0x71,
+  0x85, 0xff, 0x00, 0x84, 0xbb, 0x00, 0x01, 0x0d, 0xea, 0x91, 0xff, 0x00, 0x8a, 0xda, 0x00, 0x00,
+  0x4c, 0x85, 0xff, 0x00, 0xac, 0xbb, 0x00, 0x00, 0x4c, 0x91, 0xff, 0x01, 0xfd, 0x3c, 0xda, 0x00,
+  0x01, 0x35, 0xfe, 0x84, 0xff, 0x00, 0xcc, 0x81, 0x00, 0x02, 0x02, 0x10, 0x0c, 0x81, 0x0a, 0x05,
+  0x0c, 0x0e, 0x10, 0x0f, 0x0b, 0x03, 0xae, 0x00, 0x00, 0x9f, 0x91, 0xff, 0x01, 0xe2, 0x08, 0xda,
+  0x00, 0x01, 0x1c, 0xfc, 0x84, 0xff, 0x05, 0xe6, 0x06, 0x02, 0xb4, 0xf0, 0xed, 0x81, 0xec, 0x00,
+  0xed, 0x82, 0xef, 0x04, 0xec, 0xe8, 0xde, 0x94, 0x06, 0xaa, 0x00, 0x01, 0x08, 0xe9, 0x91, 0xff,
+  0x00, 0x99, 0xdb, 0x00, 0x01, 0x13, 0xfb, 0x84, 0xff, 0x03, 0xfc, 0x11, 0x08, 0xea, 0x8b, 0xff,
+  0x00, 0x5e, 0xaa, 0x00, 0x00, 0x61, 0x92, 0xff, 0x00, 0x47, 0xdb, 0x00, 0x01, 0x11, 0xf7, 0x85,
+  0xff, 0x02, 0x2a, 0x08, 0xeb, 0x8b, 0xff, 0x00, 0x84, 0xa8, 0x00, 0x02, 0x18, 0x8d, 0xf7, 0x91,
+  0xff, 0x01, 0xe0, 0x09, 0xdb, 0x00, 0x01, 0x11, 0xf8, 0x85, 0xff, 0x02, 0x45, 0x06, 0xe4, 0x8a,
+  0xff, 0x01, 0xfe, 0x56, 0xa5, 0x00, 0x03, 0x03, 0x3e, 0xa2, 0xf4, 0x92, 0xff, 0x01, 0xe3, 0x39,
+  0xdc, 0x00, 0x01, 0x14, 0xfb, 0x85, 0xff, 0x0f, 0x5a, 0x00, 0x55, 0x8d, 0x8a, 0x88, 0x8c, 0x8e,
+  0x91, 0x98, 0x99, 0x93, 0x8b, 0x6f, 0x49, 0x05, 0xa3, 0x00, 0x03, 0x0d, 0x65, 0xcd, 0xfd, 0x92,
+  0xff, 0x02, 0xe2, 0x81, 0x15, 0xdd, 0x00, 0x01, 0x27, 0xfd, 0x85, 0xff, 0x00, 0x72, 0xaf, 0x00,
+  0x03, 0x01, 0x2c, 0x8f, 0xea, 0x92, 0xff, 0x03, 0xfb, 0xc3, 0x57, 0x09, 0xdf, 0x00, 0x00, 0x45,
+  0x86, 0xff, 0x00, 0x81, 0xad, 0x00, 0x03, 0x06, 0x51, 0xbc, 0xf9, 0x92, 0xff, 0x03, 0xe8, 0x93,
+  0x30, 0x02, 0xe1, 0x00, 0x00, 0x6d, 0x86, 0xff, 0x00, 0x90, 0xaa, 0x00, 0x03, 0x01, 0x1f, 0x79,
+  0xde, 0x92, 0xff, 0x03, 0xf7, 0xb6, 0x53, 0x0b, 0xe3, 0x00, 0x01, 0x05, 0xc8, 0x86, 0xff, 0x00,
+  0x9f, 0xa8, 0x00, 0x03, 0x04, 0x45, 0xac, 0xf5, 0x91, 0xff, 0x03, 0xfe, 0xd2, 0x77, 0x21, 0xe6,
+  0x00, 0x01, 0x77, 0xfe, 0x86, 0xff, 0x00, 0xaa, 0xa6, 0x00, 0x03, 0x1b, 0x73, 0xd6, 0xfe, 0x91,
+  0xff, 0x03, 0xec, 0x94, 0x35, 0x04, 0xe6, 0x00, 0x02, 0x0c, 0x88, 0xfc, 0x87, 0xff, 0x00, 0xb2,
+  0xa3, 0x00, 0x03, 0x02, 0x3c, 0xac, 0xf5, 0x91, 0xff, 0x03, 0xfc, 0xc8, 0x63, 0x0f, 0xe6, 0x00,
+  0x03, 0x02, 0x20, 0x73, 0xdc, 0x89, 0xff, 0x01, 0xb7, 0x5a, 0x9d, 0x62, 0x83, 0x61, 0x02, 0x5b,
+  0x69, 0x9b, 0x92, 0x9d, 0x02, 0xa1, 0x8e, 0x61, 0x86, 0x5e, 0x88, 0x5d, 0x88, 0x5c, 0x89, 0x5b,
+  0x88, 0x5a, 0x89, 0x59, 0x88, 0x58, 0x89, 0x57, 0x88, 0x56, 0x88, 0x55, 0x89, 0x54, 0x05, 0x5a,
+  0x63, 0x7d, 0xa3, 0xd3, 0xfa, 0x8b, 0xff, 0x01, 0xb8, 0xbe, 0xa1, 0xff, 0x02, 0xfe, 0xcd, 0x14,
+  0x93, 0x00, 0x02, 0x23, 0x90, 0xed, 0xf5, 0xff, 0x01, 0xb7, 0x85, 0xa3, 0xff, 0x02, 0xd1, 0x33,
+  0x02, 0x93, 0x00, 0x02, 0x14, 0x73, 0xdb, 0xf3, 0xff, 0x01, 0xb4, 0x4b, 0xa4, 0xff, 0x03, 0xfd,
+  0xc9, 0x69, 0x13, 0x93, 0x00, 0x03, 0x06, 0x59, 0xc9, 0xfd, 0xf0, 0xff, 0x02, 0xad, 0x15, 0xfb,
+  0xa6, 0xff, 0x03, 0xed, 0x9a, 0x30, 0x01, 0x92, 0x00, 0x03, 0x04, 0x42, 0xad, 0xfb, 0xee, 0xff,
+  0x02, 0xa3, 0x03, 0xd8, 0xa8, 0xff, 0x03, 0xfd, 0xc6, 0x62, 0x0f, 0x93, 0x00, 0x02, 0x27, 0x97,
+  0xf0, 0xec, 0xff, 0x02, 0x96, 0x00, 0xa5, 0xab, 0xff, 0x02, 0xe8, 0x8e, 0x25, 0x93, 0x00, 0x02,
+  0x1a, 0x7c, 0xe0, 0xea, 0xff, 0x02, 0x85, 0x00, 0x6c, 0xad, 0xff, 0x03, 0xf9, 0xb5, 0x4f, 0x08,
+  0x92, 0x00, 0x03, 0x08, 0x5b, 0xca, 0xfd, 0xe7, 0xff, 0x03, 0x78, 0x00, 0x36, 0xfd, 0xae, 0xff,
+  0x03, 0xfe, 0xdb, 0x77, 0x18, 0x92, 0x00, 0x03, 0x03, 0x41, 0xae, 0xfa, 0xe5, 0xff, 0x03, 0x61,
+  0x00, 0x0d, 0xec, 0xb1, 0xff, 0x03, 0xf3, 0x9f, 0x3d, 0x04, 0x92, 0x00, 0x01, 0x3a, 0xe2, 0xe4,
+  0xff, 0x00, 0x4a, 0x81, 0x00, 0x00, 0xbf, 0xb3, 0xff, 0x03, 0xfd, 0xc9, 0x53, 0x02, 0x91, 0x00,
+  0x01, 0x34, 0xfb, 0xe3, 0xff, 0x00, 0x30, 0x81, 0x00, 0x00, 0x83, 0xb5, 0xff, 0x01, 0xfe, 0x81,
+  0x91, 0x00, 0x01, 0x01, 0xc3, 0xe2, 0xff, 0x01, 0xfe, 0x13, 0x81, 0x00, 0x00, 0x49, 0xb6, 0xff,
+  0x01, 0xf2, 0x0f, 0x91, 0x00, 0x00, 0x7a, 0xe2, 0xff, 0x01, 0xea, 0x08, 0x81, 0x00, 0x01, 0x11,
+  0xf9, 0xb6, 0xff, 0x00, 0x5a, 0x91, 0x00, 0x01, 0x2e, 0xfc, 0xe1, 0xff, 0x00, 0xcf, 0x82, 0x00,
+  0x01, 0x01, 0xd1, 0xb6, 0xff, 0x00, 0xb0, 0x91, 0x00, 0x01, 0x04, 0xd7, 0xe1, 0xff, 0x00, 0xaf,
+  0x83, 0x00, 0x00, 0x9a, 0xb6, 0xff, 0x01, 0xef, 0x13, 0x91, 0x00, 0x00, 0x8a, 0xe1, 0xff, 0x00,
+  0x87, 0x83, 0x00, 0x00, 0x60, 0xb7, 0xff, 0x00, 0x56, 0x91, 0x00, 0x01, 0x3b, 0xfe, 0xe0, 0xff,
+  0x00, 0x5d, 0x83, 0x00, 0x01, 0x29, 0xfc, 0xb6, 0xff, 0x00, 0xa1, 0x91, 0x00, 0x01, 0x04, 0xe3,
+  0xdf, 0xff, 0x01, 0xfd, 0x33, 0x83, 0x00, 0x01, 0x07, 0xe2, 0xb6, 0xff, 0x01, 0xe7, 0x07, 0x91,
+  0x00, 0x00, 0x99, 0xdf, 0xff, 0x01, 0xef, 0x10, 0x84, 0x00, 0x00, 0xad, 0xb7, 0xff, 0x00, 0x40,
+  0x91, 0x00, 0x00, 0x4e, 0xdf, 0xff, 0x00, 0xcb, 0x85, 0x00, 0x00, 0x70, 0xb7, 0xff, 0x00, 0x92,
+  0x91, 0x00, 0x01, 0x11, 0xf0, 0xde, 0xff, 0x00, 0x92, 0x85, 0x00, 0x00, 0x34, 0xb7, 0xff, 0x01,
+  0xda, 0x04, 0x90, 0x00, 0x01, 0x01, 0xb1, 0xde, 0xff, 0x00, 0x57, 0x85, 0x00, 0x01, 0x07, 0xec,
+  0xb6, 0xff, 0x01, 0xfc, 0x32, 0x91, 0x00, 0x00, 0x63, 0xdd, 0xff, 0x01, 0xfc, 0x1b, 0x86, 0x00,
+  0x00, 0xb9, 0xb7, 0xff, 0x00, 0x7b, 0x91, 0x00, 0x01, 0x1b, 0xf8, 0xdc, 0xff, 0x01, 0xd2, 0x01,
+  0x86, 0x00, 0x00, 0x7d, 0xb7, 0xff, 0x00, 0xc6, 0x92, 0x00, 0x00, 0xc2, 0xdc, 0xff, 0x00, 0x90,
+  0x87, 0x00, 0x01, 0x43, 0xfe, 0xb6, 0xff, 0x01, 0xf8, 0x1a, 0x91, 0x00, 0x00, 0x76, 0xdc, 0xff,
+  0x00, 0x4c, 0x87, 0x00, 0x01, 0x12, 0xf1, 0xb7, 0xff, 0x00, 0x64, 0x91, 0x00, 0x01, 0x2e, 0xfc,
+  0xda, 0xff, 0x01, 0xef, 0x12, 0x87, 0x00, 0x01, 0x01, 0xc4, 0xb7, 0xff, 0x00, 0xb4, 0x91, 0x00,
+  0x01, 0x05, 0xda, 0xda, 0xff, 0x00, 0xb1, 0x89, 0x00, 0x00, 0x85, 0xb7, 0xff, 0x01, 0xf0, 0x14,
+  0x91, 0x00, 0x00, 0x90, 0xda, 0xff, 0x00, 0x5f, 0x89, 0x00, 0x00, 0x44, 0xb8, 0xff, 0x00, 0x56,
+  0x91, 0x00, 0x01, 0x44, 0xfe, 0xd8, 0xff, 0x01, 0xf3, 0x12, 0x89, 0x00, 0x01, 0x0e, 0xf4, 0xb7,
+  0xff, 0x00, 0xa7, 0x91, 0x00, 0x01, 0x08, 0xea, 0xd8, 0xff, 0x00, 0xa9, 0x8b, 0x00, 0x00, 0xc0,
+  0xb7, 0xff, 0x01, 0xee, 0x0a, 0x91, 0x00, 0x00, 0xa2, 0xd7, 0xff, 0x01, 0xfe, 0x4e, 0x8b, 0x00,
+  0x00, 0x7f, 0xb8, 0xff, 0x00, 0x4d, 0x91, 0x00, 0x00, 0x54, 0xd7, 0xff, 0x01, 0xe4, 0x0b, 0x8b,
+  0x00, 0x00, 0x41, 0xb8, 0xff, 0x00, 0xa7, 0x91, 0x00, 0x01, 0x16, 0xf4, 0xd6, 0xff, 0x00, 0x88,
+  0x8c, 0x00, 0x01, 0x0f, 0xed, 0xb7, 0xff, 0x01, 0xf6, 0x35, 0x90, 0x00, 0x01, 0x01, 0xbd, 0xd5,
+  0xff, 0x01, 0xf9, 0x24, 0x8d, 0x00, 0x00, 0xb7, 0xb8, 0xff, 0x02, 0xe8, 0x4a, 0x01, 0x8f, 0x00,
+  0x00, 0x6f, 0xd5, 0xff, 0x00, 0xa9, 0x8e, 0x00, 0x00, 0x71, 0x9c, 0xff, 0x01, 0xfe, 0xf9, 0x9a,
+  0xff, 0x02, 0xfb, 0x99, 0x0d, 0x8e, 0x00, 0x01, 0x27, 0xfa, 0xd3, 0xff, 0x01, 0xfd, 0x3c, 0x8e,
+  0x00, 0x01, 0x29, 0xfc, 0x9c, 0xff, 0x00, 0xb2, 0x9c, 0xff, 0x01, 0xcb, 0x16, 0x8d, 0x00, 0x01,
+  0x01, 0xcf, 0xd3, 0xff, 0x01, 0xc1, 0x03, 0x8e, 0x00, 0x01, 0x02, 0xdf, 0x9c, 0xff, 0x01, 0x5e,
+  0xfd, 0x9c, 0xff, 0x00, 0x9c, 0x8e, 0x00, 0x00, 0x80, 0xd2, 0xff, 0x01, 0xfd, 0x4a, 0x90, 0x00,
+  0x00, 0x75, 0x9c, 0xff, 0x01, 0x30, 0xcc, 0x9c, 0xff, 0x01, 0xed, 0x10, 0x8d, 0x00, 0x01, 0x30,
+  0xfe, 0xd1, 0xff, 0x01, 0xc1, 0x01, 0x90, 0x00, 0x02, 0x05, 0x99, 0xfe, 0x9a, 0xff, 0x01, 0x29,
+  0x6c, 0x9d, 0xff, 0x00, 0x53, 0x8d, 0x00, 0x01, 0x04, 0xc7, 0xd0, 0xff, 0x01, 0xfd, 0x3e, 0x92,
+  0x00, 0x03, 0x02, 0x4c, 0xc5, 0xf8, 0x81, 0xfc, 0x82, 0xfd, 0x86, 0xfe, 0x86, 0xfd, 0x84, 0xfc,
+  0x03, 0xf4, 0x18, 0x15, 0xf1, 0x9c, 0xff, 0x00, 0xa4, 0x8e, 0x00, 0x01, 0x27, 0xe0, 0xcf, 0xff,
+  0x01, 0xb0, 0x02, 0x94, 0x00, 0x07, 0x01, 0x15, 0x26, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x85, 0x2d,
+  0x00, 0x2c, 0x81, 0x2b, 0x00, 0x2a, 0x81, 0x29, 0x00, 0x28, 0x81, 0x27, 0x82, 0x26, 0x03, 0x21,
+  0x01, 0x00, 0xa0, 0x9c, 0xff, 0x01, 0xee, 0x0c, 0x8e, 0x00, 0x01, 0x1f, 0xd0, 0xcd, 0xff, 0x01,
+  0xf6, 0x2d, 0xb2, 0x00, 0x01, 0x3e, 0xfe, 0x9b, 0xff, 0x01, 0xfe, 0x4b, 0x8f, 0x00, 0x01, 0x12,
+  0xc1, 0xcc, 0xff, 0x00, 0x89, 0xb3, 0x00, 0x01, 0x05, 0xd7, 0x9c, 0xff, 0x00, 0x9b, 0x90, 0x00,
+  0x01, 0x17, 0xe8, 0xca, 0xff, 0x01, 0xe0, 0x0e, 0xb4, 0x00, 0x00, 0x7b, 0x9c, 0xff, 0x01, 0xe0,
+  0x08, 0x90, 0x00, 0x00, 0x8e, 0xc9, 0xff, 0x01, 0xfd, 0x52, 0xb5, 0x00, 0x01, 0x1f, 0xf6, 0x9b,
+  0xff, 0x01, 0xfd, 0x37, 0x90, 0x00, 0x01, 0x3d, 0xfd, 0xc8, 0xff, 0x01, 0xa4, 0x01, 0xb6, 0x00,
+  0x00, 0xb0, 0x9c, 0xff, 0x00, 0x7e, 0x90, 0x00, 0x01, 0x08, 0xe2, 0xc7, 0xff, 0x01, 0xe2, 0x14,
+  0xb7, 0x00, 0x00, 0x4b, 0x9c, 0xff, 0x01, 0xc9, 0x01, 0x90, 0x00, 0x00, 0x96, 0xc6, 0xff, 0x01,
+  0xfa, 0x4a, 0xb8, 0x00, 0x01, 0x08, 0xe1, 0x9b, 0xff, 0x01, 0xfc, 0x1f, 0x90, 0x00, 0x01, 0x44,
+  0xfe, 0xc5, 0xff, 0x00, 0x8a, 0xba, 0x00, 0x00, 0x88, 0x9c, 0xff, 0x00, 0x70, 0x90, 0x00, 0x01,
+  0x04, 0xe6, 0xc4, 0xff, 0x01, 0xbd, 0x06, 0xba, 0x00, 0x01, 0x2a, 0xfa, 0x9b, 0xff, 0x01, 0xc3,
+  0x01, 0x90, 0x00, 0x00, 0x9b, 0xc3, 0xff, 0x01, 0xe1, 0x1e, 0xbb, 0x00, 0x01, 0x01, 0xbe, 0x9b,
+  0xff, 0x01, 0xf7, 0x22, 0x90, 0x00, 0x00, 0x4a, 0xc2, 0xff, 0x01, 0xf2, 0x36, 0xbd, 0x00, 0x00,
+  0x5a, 0x9c, 0xff, 0x00, 0x82, 0x90, 0x00, 0x01, 0x0e, 0xea, 0xc0, 0xff, 0x01, 0xfb, 0x59, 0xbe,
+  0x00, 0x01, 0x0a, 0xea, 0x9b, 0xff, 0x01, 0xf6, 0x49, 0x90, 0x00, 0x00, 0xa5, 0xbf, 0xff, 0x02,
+  0xfd, 0x72, 0x01, 0xbf, 0x00, 0x00, 0x96, 0x9c, 0xff, 0x02, 0xf7, 0x78, 0x04, 0x8e, 0x00, 0x00,
+  0x51, 0xbe, 0xff, 0x02, 0xfe, 0x86, 0x01, 0xc0, 0x00, 0x01, 0x36, 0xfc, 0x9d, 0xff, 0x01, 0xbb,
+  0x27, 0x8d, 0x00, 0x01, 0x0c, 0xef, 0xbc, 0xff, 0x02, 0xfe, 0x8f, 0x02, 0xc1, 0x00, 0x01, 0x03,
+  0xcc, 0x9e, 0xff, 0x02, 0xf3, 0x7b, 0x0a, 0x8c, 0x00, 0x00, 0xa8, 0xbb, 0xff, 0x02, 0xfe, 0x8f,
+  0x03, 0xc3, 0x00, 0x00, 0x6a, 0xa0, 0xff, 0x02, 0xd3, 0x43, 0x02, 0x8a, 0x00, 0x00, 0x5b, 0xba,
+  0xff, 0x02, 0xfd, 0x86, 0x02, 0xc4, 0x00, 0x01, 0x11, 0xf1, 0xa0, 0xff, 0x02, 0xfd, 0xb4, 0x2f,
+  0x89, 0x00, 0x01, 0x16, 0xf3, 0xb8, 0xff, 0x02, 0xfb, 0x71, 0x01, 0xc6, 0x00, 0x00, 0xa2, 0xa2,
+  0xff, 0x02, 0xf8, 0x9d, 0x1e, 0x88, 0x00, 0x00, 0xb8, 0xb7, 0xff, 0x02, 0xf2, 0x57, 0x01, 0xc7,
+  0x00, 0x01, 0x42, 0xfd, 0xa3, 0xff, 0x02, 0xf4, 0x91, 0x1c, 0x86, 0x00, 0x00, 0x62, 0xb6, 0xff,
+  0x01, 0xe0, 0x34, 0xc9, 0x00, 0x01, 0x06, 0xd7, 0xa5, 0xff, 0x02, 0xef, 0x7f, 0x0d, 0x84, 0x00,
+  0x01, 0x16, 0xf6, 0xb4, 0xff, 0x01, 0xb8, 0x1c, 0xcb, 0x00, 0x00, 0x79, 0xa7, 0xff, 0x02, 0xe3,
+  0x65, 0x07, 0x83, 0x00, 0x00, 0xb8, 0xb2, 0xff, 0x02, 0xf8, 0x7e, 0x04, 0xcc, 0x00, 0x01, 0x23,
+  0xfe, 0xa8, 0xff, 0x01, 0xcc, 0x3f, 0x82, 0x00, 0x00, 0x73, 0xb1, 0xff, 0x01, 0xd7, 0x3e, 0xce,
+  0x00, 0x01, 0x02, 0xcd, 0xa9, 0xff, 0x04, 0xfb, 0x97, 0x12, 0x00, 0x39, 0xaf, 0xff, 0x02, 0xf8,
+  0x8c, 0x0c, 0xd0, 0x00, 0x00, 0x73, 0xab, 0xff, 0x03, 0xde, 0x59, 0x1d, 0xf6, 0xac, 0xff, 0x02,
+  0xfe, 0xc5, 0x36, 0xd2, 0x00, 0x01, 0x17, 0xee, 0xac, 0xff, 0x01, 0xe1, 0xfc, 0xab, 0xff, 0x02,
+  0xdf, 0x5a, 0x04, 0xd4, 0x00, 0x00, 0x89, 0xd8, 0xff, 0x02, 0xe6, 0x75, 0x0d, 0xd6, 0x00, 0x01,
+  0x14, 0xe9, 0xd5, 0xff, 0x02, 0xdf, 0x6d, 0x0f, 0xd9, 0x00, 0x00, 0x69, 0xd2, 0xff, 0x03, 0xfb,
+  0xc6, 0x5c, 0x09, 0xdb, 0x00, 0x01, 0x06, 0xc3, 0xcf, 0xff, 0x03, 0xe3, 0x8c, 0x30, 0x03, 0xde,
+  0x00, 0x01, 0x29, 0xed, 0xca, 0xff, 0x04, 0xfe, 0xe2, 0x9a, 0x47, 0x07, 0xe2, 0x00, 0x01, 0x49,
+  0xf4, 0xc5, 0xff, 0x05, 0xfe, 0xef, 0xb8, 0x78, 0x37, 0x08, 0xe6, 0x00, 0x01, 0x40, 0xe0, 0xbf,
+  0xff, 0x06, 0xfa, 0xeb, 0xca, 0x9d, 0x6a, 0x35, 0x09, 0xeb, 0x00, 0x0a, 0x11, 0x71, 0xb7, 0xce,
+  0xcc, 0xcb, 0xca, 0xc9, 0xc8, 0xc7, 0xc5, 0x89, 0xc4, 0x81, 0xc3, 0x81, 0xc2, 0x82, 0xc1, 0x83,
+  0xc0, 0x85, 0xbf, 0x91, 0xbe, 0x0b, 0xbd, 0xb9, 0xb2, 0xa7, 0x9b, 0x8b, 0x71, 0x5c, 0x3b, 0x22,
+  0x0a, 0x01, 0xb7, 0x00,
+};
+
+IMAGE_ASSET_DECLARE(jake);
+const ImageAsset jake_asset = {
+  .name = "jake",
+  .data = jake_rle,
+  .data_size = sizeof(jake_rle),
+  .raw_size = 81540,
+  .crc32 = 0x0b2bed03,
+  .w = 180,
+  .h = 151,
+  .codec = IMAGE_CODEC_RLE_PLANAR,
+};
@@ -0,0 +1,177 @@
+// Generated by tools/compress_images.py from images/tcs.h - do not edit.
+// 48x48 RGB565A8, palette + RLE: 6912 -> 2523 bytes. Decoded on first use by ImageCache.
+#pragma once
+#include "../ImageCodec.h"
+
+static const uint8_t tcs_rle[] = {
+  0xca, 0x00, 0x00, 0xff, 0x01, 0x00, 0xff, 0x20, 0x00, 0xff, 0x21, 0x00, 0xff, 0x22, 0x00, 0xff,
+  0x41, 0x00, 0xff, 0x42, 0x00, 0xff, 0x00, 0x08, 0xff, 0x01, 0x08, 0xff, 0x20, 0x08, 0xff, 0x21,
+  0x08, 0xff, 0x42, 0x08, 0xff, 0x00, 0x10, 0xff, 0x20, 0x10, 0xff, 0x21, 0x10, 0xff, 0x40, 0x10,
+  0xff, 0x20, 0x18, 0xff, 0x40, 0x18, 0xff, 0x81, 0x18, 0xff, 0x40, 0x20, 0xff, 0x60, 0x20, 0xff,
+  0x81, 0x20, 0xff, 0x60, 0x28, 0xff, 0x80, 0x28, 0xff, 0xa1, 0x28, 0xff, 0xe2, 0x28, 0xff, 0xc0,
+  0x30, 0xff, 0xc1, 0x30, 0xff, 0xa0, 0x38, 0xff, 0xc2, 0x38, 0xff, 0xe0, 0x38, 0xff, 0xe1, 0x38,
+  0xff, 0x02, 0x39, 0xff, 0x45, 0x39, 0xff, 0xc0, 0x40, 0xff, 0x21, 0x41, 0xff, 0x01, 0x49, 0xff,
+  0x21, 0x49, 0xff, 0x43, 0x49, 0xff, 0xe0, 0x50, 0xff, 0x42, 0x51, 0xff, 0x61, 0x51, 0xff, 0x62,
+  0x51, 0xff, 0x82, 0x51, 0xff, 0x20, 0x59, 0xff, 0x41, 0x59, 0xff, 0x61, 0x59, 0xff, 0x62, 0x59,
+  0xff, 0x83, 0x59, 0xff, 0xa2, 0x59, 0xff, 0xa3, 0x59, 0xff, 0x81, 0x61, 0xff, 0xa1, 0x61, 0xff,
+  0xa2, 0x61, 0xff, 0xc2, 0x61, 0xff, 0xa1, 0x69, 0xff, 0xc2, 0x69, 0xff, 0x81, 0x71, 0xff, 0xa0,
+  0x71, 0xff, 0xa1, 0x71, 0xff, 0xc1, 0x71, 0xff, 0xc2, 0x71, 0xff, 0xe1, 0x71, 0xff, 0xe2, 0x71,
+  0xff, 0xe3, 0x71, 0xff, 0x03, 0x72, 0xff, 0xa1, 0x79, 0xff, 0xe1, 0x79, 0xff, 0xe2, 0x79, 0xff,
+  0x02, 0x7a, 0xff, 0x04, 0x7a, 0xff, 0x21, 0x7a, 0xff, 0x02, 0x82, 0xff, 0x22, 0x82, 0xff, 0x42,
+  0x82, 0xff, 0x43, 0x82, 0xff, 0x01, 0x8a, 0xff, 0x02, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x22, 0x8a,
+  0xff, 0x42, 0x8a, 0xff, 0x01, 0x92, 0xff, 0x21, 0x92, 0xff, 0x41, 0x92, 0xff, 0x42, 0x92, 0xff,
+  0x83, 0x92, 0xff, 0x84, 0x92, 0xff, 0x85, 0x92, 0xff, 0x63, 0x9a, 0xff, 0x83, 0x9a, 0xff, 0x84,
+  0x9a, 0xff, 0x61, 0xa2, 0xff, 0x82, 0xa2, 0xff, 0x83, 0xa2, 0xff, 0xa1, 0xa2, 0xff, 0xa2, 0xa2,
+  0xff, 0xa3, 0xa2, 0xff, 0xa4, 0xa2, 0xff, 0xc3, 0xa2, 0xff, 0x81, 0xaa, 0xff, 0x82, 0xaa, 0xff,
+  0xa1, 0xaa, 0xff, 0xa2, 0xaa, 0xff, 0xa3, 0xaa, 0xff, 0xc2, 0xaa, 0xff, 0xc3, 0xaa, 0xff, 0xa3,
+  0xb2, 0xff, 0xc2, 0xb2, 0xff, 0xc3, 0xb2, 0xff, 0xe3, 0xb2, 0xff, 0x03, 0xb3, 0xff, 0x04, 0xb3,
+  0xff, 0xe2, 0xba, 0xff, 0xe3, 0xba, 0xff, 0xe4, 0xba, 0xff, 0x03, 0xbb, 0xff, 0x04, 0xbb, 0xff,
+  0x23, 0xbb, 0xff, 0x24, 0xbb, 0xff, 0x02, 0xc3, 0xff, 0x03, 0xc3, 0xff, 0x04, 0xc3, 0xff, 0x23,
+  0xc3, 0xff, 0x24, 0xc3, 0xff, 0x44, 0xc3, 0xff, 0x45, 0xc3, 0xff, 0xe1, 0xca, 0xff, 0x02, 0xcb,
+  0xff, 0x03, 0xcb, 0xff, 0x04, 0xcb, 0xff, 0x22, 0xcb, 0xff, 0x23, 0xcb, 0xff, 0x24, 0xcb, 0xff,
+  0x42, 0xcb, 0xff, 0x43, 0xcb, 0xff, 0x44, 0xcb, 0xff, 0x63, 0xcb, 0xff, 0x65, 0xcb, 0xff, 0x01,
+  0xd3, 0xff, 0x02, 0xd3, 0xff, 0x22, 0xd3, 0xff, 0x23, 0xd3, 0xff, 0x42, 0xd3, 0xff, 0x43, 0xd3,
+  0xff, 0x44, 0xd3, 0xff, 0x63, 0xd3, 0xff, 0x64, 0xd3, 0xff, 0x65, 0xd3, 0xff, 0x84, 0xd3, 0xff,
+  0x42, 0xdb, 0xff, 0x43, 0xdb, 0xff, 0x63, 0xdb, 0xff, 0x83, 0xdb, 0xff, 0x84, 0xdb, 0xff, 0xa2,
+  0xdb, 0xff, 0xa4, 0xdb, 0xff, 0xa5, 0xdb, 0xff, 0x41, 0xe3, 0xff, 0x82, 0xe3, 0xff, 0x83, 0xe3,
+  0xff, 0xa3, 0xe3, 0xff, 0xa4, 0xe3, 0xff, 0xa5, 0xe3, 0xff, 0xc3, 0xe3, 0xff, 0xc4, 0xe3, 0xff,
+  0xc5, 0xe3, 0xff, 0xe4, 0xe3, 0xff, 0x82, 0xeb, 0xff, 0xa3, 0xeb, 0xff, 0xa4, 0xeb, 0xff, 0xc3,
+  0xeb, 0xff, 0xc4, 0xeb, 0xff, 0xc5, 0xeb, 0xff, 0xe4, 0xeb, 0xff, 0xe5, 0xeb, 0xff, 0x04, 0xec,
+  0xff, 0xa3, 0xf3, 0xff, 0xa4, 0xf3, 0xff, 0xc3, 0xf3, 0xff, 0xc5, 0xf3, 0xff, 0xe3, 0xf3, 0xff,
+  0xe4, 0xf3, 0xff, 0xe5, 0xf3, 0xff, 0x03, 0xf4, 0xff, 0x04, 0xf4, 0xff, 0x05, 0xf4, 0xff, 0x24,
+  0xf4, 0xff, 0xc3, 0xfb, 0xff, 0xc4, 0xfb, 0xff, 0xe2, 0xfb, 0xff, 0xe3, 0xfb, 0xff, 0xe4, 0xfb,
+  0xff, 0xe5, 0xfb, 0xff, 0x02, 0xfc, 0xff, 0x03, 0xfc, 0xff, 0x04, 0xfc, 0xff, 0x05, 0xfc, 0xff,
+  0x23, 0xfc, 0xff, 0x24, 0xfc, 0xff, 0x25, 0xfc, 0xff, 0x26, 0xfc, 0xff, 0x44, 0xfc, 0xff, 0x45,
+  0xfc, 0xff, 0x01, 0x00, 0x01, 0x81, 0x00, 0x03, 0x03, 0x00, 0x03, 0x07, 0x81, 0x00, 0x02, 0x07,
+  0x02, 0x01, 0xa2, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x03, 0x82, 0x00, 0x08, 0x03, 0x07, 0x06,
+  0x00, 0x07, 0x01, 0x02, 0x01, 0x02, 0x9f, 0x00, 0x06, 0x03, 0x07, 0x02, 0x03, 0x07, 0x00, 0x0a,
+  0x81, 0x07, 0x81, 0x03, 0x03, 0x07, 0x0a, 0x00, 0x01, 0xa1, 0x00, 0x08, 0x03, 0x00, 0x07, 0x00,
+  0x03, 0x35, 0x20, 0x07, 0x05, 0x82, 0x00, 0x00, 0x01, 0xa3, 0x00, 0x00, 0x04, 0x81, 0x00, 0x03,
+  0x86, 0xc3, 0xbe, 0x40, 0x81, 0x00, 0x03, 0x03, 0x07, 0x01, 0x02, 0xa0, 0x00, 0x81, 0x01, 0x0d,
+  0x00, 0x01, 0x73, 0xbd, 0xb9, 0xc6, 0xa4, 0x0c, 0x02, 0x00, 0x07, 0x00, 0x07, 0x01, 0xa0, 0x00,
+  0x0a, 0x03, 0x07, 0x4a, 0xc2, 0xbf, 0xc2, 0xc3, 0xc2, 0x57, 0x02, 0x07, 0xa4, 0x00, 0x0e, 0x01,
+  0x24, 0xad, 0xc6, 0xc2, 0xc3, 0xc2, 0xc3, 0x9f, 0x07, 0x00, 0x03, 0x01, 0x00, 0x07, 0xa0, 0x00,
+  0x09, 0x02, 0x84, 0xbe, 0xc5, 0xc3, 0xc7, 0xc1, 0xc6, 0xc3, 0x3b, 0x81, 0x00, 0x02, 0x03, 0x00,
+  0x02, 0x81, 0x00, 0x03, 0x02, 0x07, 0x00, 0x03, 0x81, 0x00, 0x81, 0x07, 0x10, 0x0d, 0x0c, 0x09,
+  0x07, 0x01, 0x00, 0x07, 0x94, 0xb2, 0x6d, 0x07, 0x03, 0x01, 0x00, 0x03, 0x00, 0x01, 0x81, 0x00,
+  0x09, 0x01, 0x00, 0x07, 0x01, 0x47, 0xc3, 0xc2, 0xc6, 0xa9, 0x62, 0x81, 0xc2, 0x02, 0xc3, 0x7b,
+  0x02, 0x82, 0x00, 0x17, 0x02, 0x00, 0x07, 0x01, 0x16, 0x56, 0x70, 0x92, 0xa2, 0xb0, 0xc4, 0xc3,
+  0xc2, 0xc3, 0xab, 0x7b, 0x4e, 0x02, 0x9f, 0xc3, 0xc7, 0x43, 0x07, 0x01, 0x82, 0x00, 0x07, 0x05,
+  0x00, 0x01, 0x03, 0x07, 0x01, 0x07, 0x84, 0x81, 0xc3, 0x0b, 0xb3, 0x2d, 0x03, 0x87, 0xc4, 0xbe,
+  0xb2, 0x0e, 0x08, 0x09, 0x04, 0x08, 0x81, 0x02, 0x12, 0x00, 0x7a, 0xbe, 0xc6, 0xc5, 0xbe, 0xc6,
+  0xc3, 0xc2, 0xc6, 0xc3, 0xb5, 0xc6, 0xc3, 0xab, 0xbe, 0xc5, 0xc2, 0x49, 0x81, 0x07, 0x00, 0x09,
+  0x82, 0x00, 0x0d, 0x07, 0x03, 0x01, 0x00, 0x01, 0x02, 0x8b, 0xca, 0xc2, 0x58, 0x07, 0x01, 0x42,
+  0xc2, 0x81, 0xc6, 0x0c, 0x4b, 0x00, 0x05, 0x07, 0x02, 0x01, 0x27, 0x03, 0x8f, 0xc3, 0xc4, 0xbe,
+  0xca, 0x81, 0xc3, 0x00, 0xc6, 0x81, 0xc2, 0x03, 0xc6, 0xc5, 0xc3, 0xc7, 0x82, 0xc3, 0x08, 0x49,
+  0x03, 0x07, 0x03, 0x00, 0x0a, 0x00, 0x07, 0x09, 0x82, 0x00, 0x0c, 0x02, 0x8d, 0xc2, 0x91, 0x00,
+  0x02, 0x00, 0x03, 0xaa, 0xc1, 0xc6, 0x83, 0x00, 0x82, 0x02, 0x03, 0x26, 0x78, 0x00, 0x97, 0x81,
+  0xc3, 0x81, 0xc2, 0x0e, 0xc7, 0x70, 0x2b, 0x32, 0x8e, 0xc3, 0xbe, 0xc6, 0xc2, 0xc6, 0xbe, 0xc2,
+  0x73, 0x07, 0x06, 0x81, 0x07, 0x00, 0x00, 0x81, 0x01, 0x09, 0x00, 0x09, 0x01, 0x00, 0x07, 0x90,
+  0xc3, 0x2e, 0x00, 0x01, 0x81, 0x00, 0x05, 0x72, 0xc7, 0xc2, 0xbc, 0x0e, 0x00, 0x81, 0x07, 0x81,
+  0x86, 0x18, 0x01, 0x92, 0xc2, 0xc5, 0xb8, 0xc2, 0xc3, 0x5f, 0x00, 0x0a, 0x77, 0xc6, 0xc4, 0x98,
+  0x99, 0xc3, 0xc1, 0xc2, 0xc6, 0x9f, 0x38, 0x00, 0x04, 0x03, 0x00, 0x81, 0x03, 0x82, 0x00, 0x15,
+  0x07, 0x85, 0x6d, 0x03, 0x07, 0x00, 0x03, 0x02, 0x2e, 0xc8, 0xbd, 0xc2, 0x4b, 0x00, 0x07, 0x50,
+  0xc2, 0x8c, 0x07, 0x5a, 0xbf, 0xc2, 0x81, 0xc3, 0x1c, 0xbe, 0x68, 0x00, 0x03, 0x77, 0xc3, 0xc4,
+  0x83, 0x00, 0xab, 0xc6, 0xc2, 0xc3, 0xc6, 0xb9, 0x70, 0x10, 0x03, 0x00, 0x07, 0x02, 0x00, 0x09,
+  0x02, 0x07, 0x6f, 0x1d, 0x01, 0x03, 0x81, 0x07, 0x0f, 0x01, 0x07, 0x9c, 0xc2, 0xc6, 0x86, 0x00,
+  0x1f, 0xad, 0xc3, 0x7a, 0x02, 0x00, 0x0f, 0x14, 0x8f, 0x81, 0xc6, 0x03, 0x67, 0x00, 0x02, 0x7f,
+  0x81, 0xc3, 0x03, 0x8d, 0x00, 0xa8, 0xc4, 0x81, 0xc3, 0x00, 0xc2, 0x81, 0xc3, 0x0a, 0x80, 0x07,
+  0x04, 0x07, 0x00, 0x02, 0x00, 0x01, 0x07, 0x21, 0x07, 0x81, 0x00, 0x00, 0x02, 0x81, 0x00, 0x06,
+  0x07, 0x5f, 0xc2, 0xc6, 0xc3, 0x50, 0x9f, 0x81, 0xc3, 0x10, 0x5d, 0x00, 0x03, 0x07, 0x01, 0x8f,
+  0xc6, 0xc2, 0x68, 0x00, 0x03, 0x7a, 0xbe, 0xc2, 0x87, 0x00, 0xa4, 0x81, 0xc2, 0x08, 0x79, 0xad,
+  0xc2, 0xc3, 0xc7, 0x3a, 0x01, 0x00, 0x03, 0x81, 0x07, 0x00, 0x00, 0x81, 0x07, 0x85, 0x00, 0x01,
+  0x01, 0x23, 0x81, 0xc2, 0x07, 0xc6, 0xbe, 0xc2, 0xc7, 0xb2, 0x12, 0x00, 0x09, 0x81, 0x00, 0x17,
+  0x92, 0xc2, 0xc3, 0x65, 0x03, 0x01, 0x70, 0xc6, 0xb2, 0x37, 0x01, 0xa8, 0xbe, 0xc5, 0x4f, 0x22,
+  0xab, 0xc5, 0xc6, 0x62, 0x07, 0x00, 0x03, 0x07, 0x81, 0x00, 0x02, 0x02, 0x00, 0x02, 0x85, 0x00,
+  0x09, 0x01, 0x83, 0xc3, 0xc5, 0xc6, 0xbd, 0xc3, 0x59, 0x03, 0x01, 0x81, 0x00, 0x01, 0x07, 0x92,
+  0x81, 0xc2, 0x0d, 0x6a, 0x02, 0x01, 0x18, 0x3e, 0x0c, 0x03, 0x09, 0x9e, 0xc7, 0xc9, 0x48, 0x01,
+  0x83, 0x81, 0xc2, 0x01, 0x7d, 0x07, 0x81, 0x00, 0x04, 0x07, 0x02, 0x01, 0x00, 0x03, 0x82, 0x00,
+  0x00, 0x03, 0x81, 0x00, 0x02, 0x07, 0x00, 0x34, 0x82, 0xc3, 0x01, 0xc7, 0x98, 0x81, 0x07, 0x01,
+  0x02, 0x03, 0x81, 0x00, 0x14, 0x8f, 0xc6, 0xc3, 0x65, 0x01, 0x09, 0x07, 0x00, 0x03, 0x07, 0x00,
+  0xa6, 0xc3, 0xc6, 0x52, 0x0a, 0x82, 0xc3, 0xc2, 0x79, 0x07, 0x82, 0x00, 0x00, 0x02, 0x83, 0x00,
+  0x00, 0x02, 0x81, 0x00, 0x82, 0x02, 0x07, 0x07, 0x01, 0x74, 0xc3, 0xbd, 0xb5, 0x2d, 0x03, 0x84,
+  0x00, 0x1b, 0x99, 0xc3, 0xc2, 0x64, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0xa4, 0xbd, 0xc2,
+  0x4d, 0x07, 0x86, 0xc3, 0xc6, 0x74, 0x02, 0x00, 0x07, 0x00, 0x02, 0x00, 0x09, 0x00, 0x81, 0x09,
+  0x84, 0x00, 0x81, 0x02, 0x08, 0x00, 0x66, 0x87, 0x2a, 0x07, 0x03, 0x01, 0x00, 0x03, 0x81, 0x07,
+  0x00, 0x91, 0x81, 0xc6, 0x12, 0x5e, 0x08, 0x00, 0x02, 0x07, 0x02, 0x00, 0x02, 0x9e, 0xc3, 0xc5,
+  0x4f, 0x03, 0x7a, 0xc2, 0xc3, 0x7d, 0x00, 0x01, 0x85, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02,
+  0x81, 0x00, 0x01, 0x03, 0x01, 0x81, 0x07, 0x81, 0x00, 0x00, 0x02, 0x81, 0x00, 0x05, 0x09, 0x00,
+  0x03, 0x07, 0x09, 0x8f, 0x81, 0xc3, 0x00, 0x67, 0x81, 0x00, 0x0f, 0x07, 0x04, 0x00, 0x03, 0x07,
+  0xab, 0xc0, 0xc5, 0x4d, 0x01, 0x7a, 0xc6, 0xc2, 0x7c, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82,
+  0x02, 0x82, 0x00, 0x00, 0x02, 0x84, 0x00, 0x08, 0x01, 0x00, 0x01, 0x00, 0x02, 0x07, 0x03, 0x07,
+  0x00, 0x81, 0x01, 0x10, 0x94, 0xc1, 0xc2, 0x69, 0x00, 0x07, 0x03, 0x07, 0x01, 0x00, 0x07, 0xa4,
+  0xc3, 0xc2, 0x51, 0x00, 0x82, 0x81, 0xc2, 0x02, 0x7a, 0x02, 0x01, 0x81, 0x00, 0x03, 0x01, 0x00,
+  0x01, 0x07, 0x81, 0x00, 0x02, 0x03, 0x00, 0x07, 0x82, 0x00, 0x01, 0x09, 0x01, 0x82, 0x00, 0x00,
+  0x03, 0x85, 0x00, 0x03, 0x97, 0xc3, 0xc2, 0x67, 0x81, 0x01, 0x81, 0x02, 0x81, 0x00, 0x06, 0x01,
+  0xa0, 0xc2, 0xc3, 0x4c, 0x01, 0x82, 0x81, 0xc2, 0x00, 0x7d, 0x85, 0x00, 0x0b, 0x07, 0x03, 0x09,
+  0x07, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x07, 0x01, 0x89, 0x00, 0x03, 0x97, 0xc3, 0xc6, 0x69,
+  0x81, 0x07, 0x81, 0x00, 0x81, 0x01, 0x09, 0x00, 0xa8, 0xc2, 0xc6, 0x4f, 0x00, 0x7f, 0xc6, 0xc3,
+  0x7b, 0x85, 0x00, 0x81, 0x03, 0x0c, 0x07, 0x00, 0x01, 0x07, 0x11, 0x03, 0x07, 0x00, 0x01, 0x0a,
+  0x07, 0x00, 0x03, 0x86, 0x00, 0x05, 0x97, 0xc3, 0xc1, 0x5f, 0x01, 0x07, 0x81, 0x00, 0x03, 0x01,
+  0x07, 0x00, 0xa3, 0x81, 0xc2, 0x07, 0x48, 0x0b, 0x7a, 0xc5, 0xc3, 0x76, 0x00, 0x09, 0x84, 0x00,
+  0x01, 0x02, 0x00, 0x81, 0x01, 0x08, 0x69, 0xc2, 0xab, 0x33, 0x03, 0x02, 0x01, 0x00, 0x02, 0x87,
+  0x00, 0x0b, 0x97, 0xc3, 0xc4, 0x6c, 0x09, 0x00, 0x03, 0x07, 0x00, 0x02, 0x01, 0xab, 0x81, 0xc2,
+  0x05, 0x50, 0x01, 0x85, 0xc2, 0xc3, 0x7b, 0x85, 0x00, 0x00, 0x03, 0x81, 0x07, 0x0c, 0x09, 0x62,
+  0xbe, 0xca, 0xc2, 0x9b, 0x00, 0x07, 0x03, 0x02, 0x01, 0x07, 0x03, 0x85, 0x00, 0x00, 0x97, 0x81,
+  0xc3, 0x00, 0x66, 0x81, 0x01, 0x81, 0x03, 0x0b, 0x01, 0x02, 0x00, 0xa8, 0xc2, 0xc3, 0x52, 0x00,
+  0x8a, 0xc3, 0xbe, 0x7d, 0x84, 0x00, 0x07, 0x02, 0x00, 0x03, 0x00, 0x44, 0xbe, 0xc6, 0xbe, 0x81,
+  0xc6, 0x04, 0x49, 0x03, 0x02, 0x01, 0x03, 0x87, 0x00, 0x05, 0x97, 0xc3, 0xc6, 0x5e, 0x07, 0x0a,
+  0x82, 0x07, 0x0a, 0x00, 0x03, 0xab, 0xc2, 0xc6, 0x4c, 0x04, 0x7a, 0xc6, 0xc3, 0x7d, 0x81, 0x00,
+  0x00, 0x03, 0x84, 0x00, 0x03, 0x19, 0xaa, 0xc2, 0xc3, 0x81, 0xc2, 0x02, 0xc7, 0x9d, 0x09, 0x82,
+  0x00, 0x00, 0x01, 0x86, 0x00, 0x08, 0x97, 0xc3, 0xc2, 0x69, 0x07, 0x01, 0x43, 0x83, 0x54, 0x81,
+  0x01, 0x0b, 0xa1, 0xbe, 0xc2, 0x4f, 0x07, 0x89, 0xc2, 0xc6, 0x71, 0x02, 0x00, 0x03, 0x84, 0x00,
+  0x00, 0x73, 0x84, 0xc3, 0x05, 0xc2, 0xc7, 0x2e, 0x01, 0x03, 0x07, 0x87, 0x00, 0x03, 0x97, 0xc3,
+  0xc2, 0x60, 0x81, 0x07, 0x0a, 0x76, 0xc5, 0xc2, 0x67, 0x07, 0xa7, 0xc6, 0xc3, 0x4f, 0x5b, 0xbf,
+  0x81, 0xc2, 0x00, 0x63, 0x84, 0x00, 0x02, 0x02, 0x00, 0x3c, 0x81, 0xc2, 0x0c, 0xc6, 0xb2, 0x7b,
+  0xc3, 0xc2, 0xbe, 0x73, 0x01, 0x07, 0x03, 0x09, 0x00, 0x07, 0x81, 0x00, 0x18, 0x02, 0x08, 0x01,
+  0x98, 0xc3, 0xc2, 0x65, 0x07, 0x04, 0x7a, 0xc3, 0xbe, 0x87, 0x00, 0xa8, 0xc2, 0xc5, 0xac, 0xc3,
+  0xc2, 0xc3, 0xb8, 0x1a, 0x01, 0x07, 0x84, 0x00, 0x09, 0x7a, 0xc6, 0xc3, 0xbe, 0x3f, 0x07, 0x96,
+  0xc6, 0xc5, 0xa5, 0x81, 0x07, 0x06, 0x03, 0x00, 0x01, 0x00, 0x02, 0x06, 0x1a, 0x81, 0x67, 0x0d,
+  0xab, 0xc3, 0xb8, 0x69, 0x00, 0x01, 0x7f, 0xc2, 0xc3, 0x80, 0x07, 0xab, 0xc5, 0xbf, 0x81, 0xc6,
+  0x06, 0xbe, 0xb8, 0x45, 0x09, 0x01, 0x00, 0x03, 0x81, 0x00, 0x05, 0x01, 0x03, 0x90, 0xc2, 0xc3,
+  0x69, 0x81, 0x00, 0x0c, 0x49, 0xc2, 0xc1, 0xc9, 0x45, 0x00, 0x01, 0x07, 0x00, 0x03, 0x1c, 0x07,
+  0x78, 0x83, 0xc2, 0x01, 0xc6, 0x67, 0x81, 0x00, 0x17, 0x83, 0xc3, 0xc6, 0x87, 0x3d, 0xb6, 0xc2,
+  0xc3, 0xc6, 0xbe, 0x9a, 0x35, 0x09, 0x01, 0x02, 0x00, 0x01, 0x07, 0x09, 0x01, 0x02, 0x8e, 0xc2,
+  0x99, 0x82, 0x01, 0x04, 0x03, 0xab, 0xc3, 0xc2, 0x7a, 0x81, 0x03, 0x0b, 0x00, 0x02, 0x1e, 0x6e,
+  0x03, 0x90, 0xc5, 0xc2, 0xc3, 0xc7, 0xc1, 0x5c, 0x81, 0x00, 0x0d, 0x7a, 0xc5, 0xc2, 0xae, 0xc6,
+  0xb7, 0xc5, 0xc6, 0xbb, 0x61, 0x08, 0x07, 0x01, 0x00, 0x81, 0x02, 0x00, 0x03, 0x81, 0x00, 0x06,
+  0x02, 0x07, 0x8d, 0xbe, 0x40, 0x01, 0x07, 0x81, 0x02, 0x05, 0x7b, 0xc7, 0xc2, 0xb4, 0x09, 0x07,
+  0x81, 0x00, 0x0d, 0x81, 0x8b, 0x01, 0x93, 0xba, 0xc2, 0xc6, 0xbd, 0xc6, 0xa0, 0x7b, 0x76, 0xaa,
+  0xc3, 0x81, 0xc2, 0x07, 0xc7, 0xc1, 0xc6, 0xc2, 0x50, 0x00, 0x07, 0x03, 0x81, 0x07, 0x82, 0x00,
+  0x01, 0x01, 0x00, 0x81, 0x02, 0x01, 0x88, 0x7a, 0x81, 0x00, 0x0f, 0x03, 0x07, 0x01, 0x39, 0xc6,
+  0xc5, 0xbd, 0x46, 0x07, 0x00, 0x3f, 0xc3, 0x83, 0x00, 0x95, 0xc5, 0x83, 0xc3, 0x81, 0xc2, 0x12,
+  0xbe, 0xc5, 0xc6, 0xbe, 0xc5, 0xc2, 0xc4, 0xc1, 0xc2, 0x4f, 0x07, 0x03, 0x00, 0x01, 0x00, 0x03,
+  0x00, 0x07, 0x03, 0x81, 0x00, 0x15, 0x01, 0x7e, 0x25, 0x00, 0x09, 0x01, 0x03, 0x00, 0x02, 0xaa,
+  0xc6, 0xc3, 0x77, 0x00, 0x17, 0xb1, 0xc3, 0x8f, 0x01, 0x53, 0xc3, 0xc6, 0x81, 0xc2, 0x04, 0xc3,
+  0xc6, 0xc5, 0xc6, 0xc7, 0x81, 0xc3, 0x09, 0xaa, 0x6a, 0xa1, 0xc6, 0xc2, 0x4e, 0x07, 0x00, 0x02,
+  0x03, 0x81, 0x01, 0x07, 0x07, 0x02, 0x01, 0x00, 0x01, 0x07, 0x2f, 0x03, 0x81, 0x00, 0x09, 0x03,
+  0x01, 0x07, 0x01, 0x6d, 0xc2, 0xc3, 0xb6, 0x31, 0x8e, 0x81, 0xc3, 0x1d, 0x69, 0x00, 0x02, 0x08,
+  0x28, 0x41, 0x5f, 0x6b, 0x7a, 0x85, 0x82, 0x78, 0x64, 0x36, 0x00, 0x02, 0xa8, 0xc3, 0xaf, 0x30,
+  0x01, 0x03, 0x07, 0x00, 0x07, 0x00, 0x07, 0x02, 0x03, 0x07, 0x88, 0x00, 0x01, 0x01, 0x2c, 0x81,
+  0xc3, 0x06, 0xc7, 0xc2, 0xc7, 0xc2, 0xb4, 0x1b, 0x03, 0x81, 0x00, 0x01, 0x07, 0x01, 0x88, 0x00,
+  0x03, 0x07, 0x55, 0x75, 0x29, 0x81, 0x01, 0x00, 0x09, 0x90, 0x00, 0x81, 0x02, 0x0c, 0x94, 0xbd,
+  0xc3, 0xbe, 0xc3, 0xc2, 0x60, 0x07, 0x00, 0x09, 0x01, 0x00, 0x03, 0x88, 0x00, 0x00, 0x03, 0x81,
+  0x00, 0x01, 0x07, 0x09, 0x93, 0x00, 0x0b, 0x07, 0x3f, 0xb8, 0xca, 0xc1, 0xc3, 0xa4, 0x13, 0x01,
+  0x09, 0x00, 0x01, 0x81, 0x02, 0x00, 0x09, 0x8c, 0x00, 0x02, 0x01, 0x03, 0x07, 0x8f, 0x00, 0x0f,
+  0x01, 0x07, 0x03, 0x86, 0xbe, 0xc6, 0xb5, 0x37, 0x01, 0x03, 0x07, 0x00, 0x01, 0x02, 0x01, 0x07,
+  0x8a, 0x00, 0x03, 0x03, 0x01, 0x00, 0x07, 0x90, 0x00, 0x81, 0x01, 0x09, 0x07, 0x15, 0x7b, 0x99,
+  0x45, 0x00, 0x05, 0x00, 0x07, 0x03, 0x81, 0x00, 0x00, 0x03, 0x89, 0x00, 0x81, 0x03, 0x00, 0x01,
+  0x82, 0x00, 0x00, 0x01, 0x8f, 0x00, 0x02, 0x02, 0x03, 0x07, 0x81, 0x00, 0x03, 0x04, 0x00, 0x03,
+  0x00, 0x81, 0x07, 0x82, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x81, 0x07, 0x01, 0x09, 0x02, 0x81, 0x01,
+  0x92, 0x00, 0x81, 0x07, 0x00, 0x0c, 0x81, 0x00, 0x00, 0x09, 0x84, 0x00, 0x01, 0x07, 0x03, 0x87,
+  0x00, 0x03, 0x01, 0x02, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x91, 0x00, 0x00, 0x04, 0x81, 0x02,
+  0x03, 0x03, 0x02, 0x00, 0x01, 0x81, 0x02, 0x04, 0x00, 0x01, 0x00, 0x07, 0x01, 0x87, 0x00, 0x03,
+  0x02, 0x00, 0x07, 0x00, 0x81, 0x01, 0x01, 0x00, 0x07, 0x87, 0x00,
+};
+
+IMAGE_ASSET_DECLARE(tcs);
+const ImageAsset tcs_asset = {
+  .name = "tcs",
+  .data = tcs_rle,
+  .data_size = sizeof(tcs_rle),
+  .raw_size = 6912,
+  .crc32 = 0x03d6ca81,
+  .w = 48,
+  .h = 48,
+  .codec = IMAGE_CODEC_RLE_PALETTE,
+};
@@ -0,0 +1,397 @@
+/*****************************************************************************
+  | File        :   can_replay.cpp
+
+  | help        :
+    Host-side replay of a recorded CAN log through the gauge's frame decoder
+    (CAN_Decoder.cpp), so decode cost can be measured and decode bugs can be
+    reproduced without sitting in the car.
+
+    Build (from the repository root):
+      g++ -O2 -std=c++17 -I. -Itools/can_replay \
+          tools/can_replay/can_replay.cpp CAN_Decoder.cpp FixedFormat.cpp -o can_replay
+
+    Usage:
+      can_replay [--speed N] [--repeat N] [--queue N] [--batch N] [--window N] [--accept-all]
+                 [--dump | --expect CSV] <log>
+
+      --speed N   Replay at N x real time (1-100). 0 = as fast as possible,
+                  which is what you want for frames/sec benchmarks. Default 0.
+      --repeat N  Replay the log N times back to back (benchmarking).
+      --queue N   Size of the stand-in TWAI RX queue. Default 64 (as canbus_init).
+      --batch N   Frames drained per RX wakeup and decoded in one seqlock write.
+                  Default 16 (CAN_RX_BATCH_MAX).
+      --window N  Milliseconds of log time queued before each simulated RX
+                  wakeup. Default 50 (CAN_RX_WAIT_MS, the longest the RX task
+                  blocks). 0 wakes once per log timestamp.
+      --accept-all  Bypass the acceptance filter canbus_init installs
+                    (CAN_RX_FILTER), to compare with the old accept-all setup.
+      --dump      Print the scaled value of every gauge channel as CSV every
+                  100 ms of log time. Diff two runs to catch scaling regressions.
+      --expect CSV  As --dump, but compare each row with CSV instead of
+                  printing it; exit status 1 on any difference. The summary
+                  goes to stdout.
+
+    Regression check (fixture.log exercises every gauge channel over its
+    whole raw range plus one queue overflow; fixture_dump.csv is its --dump
+    output with the default options):
+      ./can_replay --expect tools/can_replay/fixture_dump.csv tools/can_replay/fixture.log
+
+    Accepted log formats (auto-detected per line):
+      candump -l   (1620000000.123456) can0 640#0102030405060708
+      candump -ta  (1620000000.123456)  can0  640   [8]  01 02 03 04 05 06 07 08
+      Vector ASC   0.012345 1  640             Rx   d 8 01 02 03 04 05 06 07 08
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "twai_host.h"
+#include "CAN_Decoder.h"
+
+// Mirrors CAN_RX_QUEUE_LEN / CAN_RX_BATCH_MAX / CAN_RX_WAIT_MS in CANBus_Driver.h, which needs the IDF
+#define REPLAY_RX_BATCH_MAX 16
+#define REPLAY_RX_WAIT_MS   50
+
+std::deque<twai_message_t> twai_host_rx_queue;
+uint32_t twai_host_rx_queue_len = 64;
+uint32_t twai_host_rx_overruns = 0;
+const CanFilterPlan *twai_host_filter = &CAN_RX_FILTER;
+uint32_t twai_host_rx_filtered = 0;
+uint32_t twai_host_alerts = 0;
+
+static int hex_nibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// candump -l: "(sec.usec) iface ID#DATA"
+static bool parse_candump_compact(const char *line, replay_frame_t *out) {
+  double ts;
+  char iface[32], frame[64];
+  if (sscanf(line, " (%lf) %31s %63s", &ts, iface, frame) != 3) return false;
+  char *hash = strchr(frame, '#');
+  if (hash == NULL) return false;
+  *hash = '\0';
+  out->time_us = (uint64_t)(ts * 1e6);
+  out->message.identifier = (uint32_t)strtoul(frame, NULL, 16);
+  uint8_t dlc = 0;
+  for (const char *p = hash + 1; p[0] && p[1] && dlc < 8; p += 2) {
+    int hi = hex_nibble(p[0]), lo = hex_nibble(p[1]);
+    if (hi < 0 || lo < 0) break;
+    out->message.data[dlc++] = (uint8_t)((hi << 4) | lo);
+  }
+  out->message.data_length_code = dlc;
+  return true;
+}
+
+// candump -ta: "(sec.usec)  iface  ID   [dlc]  b0 b1 ..."
+static bool parse_candump_verbose(const char *line, replay_frame_t *out) {
+  double ts;
+  char iface[32];
+  unsigned id, dlc;
+  int consumed = 0;
+  if (sscanf(line, " (%lf) %31s %x [%u]%n", &ts, iface, &id, &dlc, &consumed) != 4) return false;
+  out->time_us = (uint64_t)(ts * 1e6);
+  out->message.identifier = id;
+  out->message.data_length_code = (uint8_t)(dlc > 8 ? 8 : dlc);
+  const char *p = line + consumed;
+  for (unsigned i = 0; i < out->message.data_length_code; i++) {
+    unsigned b;
+    int n = 0;
+    if (sscanf(p, " %2x%n", &b, &n) != 1) return false;
+    out->message.data[i] = (uint8_t)b;
+    p += n;
+  }
+  return true;
+}
+
+// Vector ASC: "time channel ID Rx d dlc b0 b1 ..."
+static bool parse_asc(const char *line, replay_frame_t *out) {
+  double ts;
+  int channel;
+  char id_str[16], dir[8], type[4];
+  unsigned dlc;
+  int consumed = 0;
+  if (sscanf(line, " %lf %d %15s %7s %3s %u%n", &ts, &channel, id_str, dir, type, &dlc, &consumed) != 6) return false;
+  if (strcmp(dir, "Rx") != 0 && strcmp(dir, "Tx") != 0) return false;
+  if (type[0] != 'd') return false;
+  size_t len = strlen(id_str);
+  if (len > 0 && (id_str[len - 1] == 'x' || id_str[len - 1] == 'X')) id_str[len - 1] = '\0'; // Extended ID marker
+  out->time_us = (uint64_t)(ts * 1e6);
+  out->message.identifier = (uint32_t)strtoul(id_str, NULL, 16);
+  out->message.data_length_code = (uint8_t)(dlc > 8 ? 8 : dlc);
+  const char *p = line + consumed;
+  for (unsigned i = 0; i < out->message.data_length_code; i++) {
+    unsigned b;
+    int n = 0;
+    if (sscanf(p, " %2x%n", &b, &n) != 1) return false;
+    out->message.data[i] = (uint8_t)b;
+    p += n;
+  }
+  return true;
+}
+
+static bool load_log(const char *path, std::vector<replay_frame_t> *frames) {
+  FILE *f = fopen(path, "r");
+  if (f == NULL) {
+    fprintf(stderr, "Cannot open %s\n", path);
+    return false;
+  }
+  char line[512];
+  while (fgets(line, sizeof(line), f)) {
+    replay_frame_t frame = {};
+    if (parse_candump_compact(line, &frame) ||
+        parse_candump_verbose(line, &frame) ||
+        parse_asc(line, &frame)) {
+      frames->push_back(frame);
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+// --expect: rows are compared with this file instead of printed
+static FILE *expect_file = NULL;
+static uint32_t expect_rows = 0, expect_diffs = 0;
+
+static void dump_row(const char *row) {
+  if (expect_file == NULL) {
+    fputs(row, stdout);
+    return;
+  }
+  char want[256];
+  if (fgets(want, sizeof(want), expect_file) == NULL) want[0] = '\0';
+  expect_rows++;
+  if (strcmp(row, want) != 0 && expect_diffs++ < 5) {
+    fprintf(stderr, "Row %u differs:\n  got  %s  want %s%s", expect_rows, row, want[0] ? want : "(end of file)",
+            want[0] ? "" : "\n");
+  }
+}
+
+static void dump_header(void) {
+  dump_row("time_s,ect_f,oil_psi,afr_b1,afr_b2,map_psi,speed_mph,ls_fuel_psi,inj_duty_pct,ethanol_pct,battery_v\n");
+}
+
+static void dump_values(double time_s) {
+  DisplayData data = {};
+  MaxValues max = {};
+  can_state_snapshot(&data, &max);
+  char row[256];
+  int len = snprintf(row, sizeof(row), "%.3f", time_s);
+  for (uint8_t mode = 0; mode < 5; mode++) {
+    uint16_t left_raw = 0, right_raw = 0;
+    can_screen_raw_values(mode, &data, &left_raw, &right_raw);
+    float left = left_raw, right = right_raw;
+    can_scale_screen_values(mode, &left, &right);
+    len += snprintf(row + len, sizeof(row) - len, ",%.2f,%.2f", left, right);
+  }
+  snprintf(row + len, sizeof(row) - len, "\n");
+  dump_row(row);
+}
+
+int main(int argc, char **argv) {
+  double speed = 0.0;
+  int repeat = 1;
+  int batch_max = REPLAY_RX_BATCH_MAX;
+  int window_ms = REPLAY_RX_WAIT_MS;
+  bool dump = false;
+  const char *path = NULL, *expect_path = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--speed") == 0 && i + 1 < argc) {
+      speed = atof(argv[++i]);
+      if (speed > 100.0) speed = 100.0;
+    } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+      repeat = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--queue") == 0 && i + 1 < argc) {
+      twai_host_rx_queue_len = (uint32_t)atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+      batch_max = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--window") == 0 && i + 1 < argc) {
+      window_ms = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--accept-all") == 0) {
+      twai_host_filter = NULL;
+    } else if (strcmp(argv[i], "--dump") == 0) {
+      dump = true;
+    } else if (strcmp(argv[i], "--expect") == 0 && i + 1 < argc) {
+      expect_path = argv[++i];
+      dump = true;
+    } else {
+      path = argv[i];
+    }
+  }
+  if (path == NULL || repeat < 1 || speed < 0.0 || batch_max < 1 || window_ms < 0) {
+    fprintf(stderr, "usage: %s [--speed N] [--repeat N] [--queue N] [--batch N] [--window N] [--accept-all] "
+            "[--dump | --expect CSV] <log>\n", argv[0]);
+    return 2;
+  }
+  if (expect_path != NULL && (expect_file = fopen(expect_path, "r")) == NULL) {
+    fprintf(stderr, "Cannot open %s\n", expect_path);
+    return 1;
+  }
+
+  std::vector<replay_frame_t> frames;
+  if (!load_log(path, &frames)) return 1;
+  if (frames.empty()) {
+    fprintf(stderr, "No CAN frames recognised in %s\n", path);
+    return 1;
+  }
+
+  std::map<uint32_t, uint32_t> id_counts;
+  uint64_t handled = 0, unhandled = 0;
+  uint64_t wakeups = 0, batches = 0, overflows = 0, overflow_frames = 0, coalesced = 0;
+  uint64_t ui_wakes = 0, ui_value_wakes = 0;
+  uint32_t max_batch = 0;
+  double decode_ns = 0.0, batch_ns = 0.0, max_batch_ns = 0.0, max_overflow_ns = 0.0;
+  std::vector<twai_message_t> batch(batch_max);
+  CanFrameSlots overflow_slots = {};
+  const uint64_t first_us = frames.front().time_us;
+  const uint64_t log_span_us = frames.back().time_us > first_us ? frames.back().time_us - first_us : 0;
+  const uint64_t window_us = (uint64_t)window_ms * 1000;
+
+  // Timing, stats and UI notification for one batch or overflow drain, as
+  // rx_record_batch() / rx_record_overflow() and rx_notify_ui()
+  auto finish_batch = [&](uint32_t count, double ns, bool overflow) {
+    decode_ns += ns;
+    if (overflow) {
+      overflows++;
+      overflow_frames += count;
+      if (ns > max_overflow_ns) max_overflow_ns = ns;
+    } else {
+      batches++;
+      batch_ns += ns;
+      if (count > max_batch) max_batch = count;
+      if (ns > max_batch_ns) max_batch_ns = ns;
+    }
+    uint32_t changes = can_take_changes();
+    if (changes) ui_wakes++;
+    if (changes & can_screen_changed_bits(0)) ui_value_wakes++;
+  };
+
+  if (dump) dump_header();
+
+  auto wall_start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < repeat; pass++) {
+    uint64_t pass_offset_us = (uint64_t)pass * (log_span_us + 1000);
+    uint64_t next_dump_us = 0;
+    auto pass_start = std::chrono::steady_clock::now();
+
+    size_t next = 0;
+    while (next < frames.size()) {
+      // Everything that arrives within one RX wait lands in the queue before
+      // the task runs; frames past --queue are lost and raise the queue-full alert
+      uint64_t window_start_us = frames[next].time_us > first_us ? frames[next].time_us - first_us : 0;
+      uint64_t wake_us = window_start_us + window_us;
+      while (next < frames.size()) {
+        uint64_t log_us = frames[next].time_us > first_us ? frames[next].time_us - first_us : 0;
+        if (log_us > wake_us) break;
+        twai_host_push(frames[next].message);
+        next++;
+      }
+
+      if (speed > 0.0) {
+        std::this_thread::sleep_until(pass_start + std::chrono::microseconds((uint64_t)(wake_us / speed)));
+      }
+      unsigned long now_ms = (unsigned long)((pass_offset_us + wake_us) / 1000) + 1;
+      wakeups++;
+
+      // Drain the stand-in queue the way receive_can_task does
+      uint32_t alerts = 0;
+      twai_read_alerts(&alerts, 0);
+      if (alerts & TWAI_ALERT_RX_QUEUE_FULL) {
+        // Overload: keep the newest frame per ID, then decode each ID once
+        uint32_t drained = 0;
+        twai_message_t message;
+        while (drained < 2 * twai_host_rx_queue_len && twai_receive(&message, 0) == ESP_OK) {
+          drained++;
+          id_counts[message.identifier]++;
+          int index = can_handled_index(message.identifier);
+          if (index < 0) {
+            unhandled++;
+            continue;
+          }
+          handled++;
+          if (can_slots_put(&overflow_slots, index, message.data)) coalesced++;
+        }
+        auto t0 = std::chrono::steady_clock::now();
+        can_state_write_begin();
+        can_slots_decode(&overflow_slots, now_ms, 0);
+        can_state_write_end();
+        auto t1 = std::chrono::steady_clock::now();
+        finish_batch(drained, std::chrono::duration<double, std::nano>(t1 - t0).count(), true);
+      }
+
+      // Up to batch_max frames per pass, each pass decoded inside one seqlock write
+      while (!twai_host_rx_queue.empty()) {
+        uint32_t count = 0;
+        while (count < (uint32_t)batch_max && twai_receive(&batch[count], 0) == ESP_OK) count++;
+
+        auto t0 = std::chrono::steady_clock::now();
+        can_state_write_begin();
+        for (uint32_t i = 0; i < count; i++) {
+          if (can_decode_frame(batch[i].identifier, batch[i].data, now_ms, 0)) handled++; else unhandled++;
+        }
+        can_state_write_end();
+        auto t1 = std::chrono::steady_clock::now();
+        finish_batch(count, std::chrono::duration<double, std::nano>(t1 - t0).count(), false);
+        for (uint32_t i = 0; i < count; i++) id_counts[batch[i].identifier]++;
+      }
+
+      if (dump && wake_us >= next_dump_us) {
+        dump_values((pass_offset_us + wake_us) / 1e6);
+        next_dump_us = wake_us + 100000;
+      }
+    }
+  }
+  double wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+
+  uint64_t total = handled + unhandled;
+  FILE *out = dump && expect_file == NULL ? stderr : stdout;
+  fprintf(out, "Replayed %zu frames x %d from %s (%.2f s of log)\n",
+          frames.size(), repeat, path, log_span_us / 1e6);
+  fprintf(out, "Decoded: %llu handled, %llu unhandled, %u dropped by RX queue\n",
+          (unsigned long long)handled, (unsigned long long)unhandled, twai_host_rx_overruns);
+  uint64_t offered = (uint64_t)frames.size() * repeat;
+  if (twai_host_filter != NULL) {
+    fprintf(out, "Filter: %s, %u/%u IDs accepted; rejected %u of %llu frames (%.1f%%)\n",
+            twai_host_filter->single_filter ? "single" : "dual", twai_host_filter->accepted_ids, CAN_STD_ID_COUNT,
+            twai_host_rx_filtered, (unsigned long long)offered, 100.0 * twai_host_rx_filtered / offered);
+  } else {
+    fprintf(out, "Filter: accept all\n");
+  }
+  fprintf(out, "Decode: %.1f ns/frame, %.0f frames/s through can_decode_frame\n",
+          total ? decode_ns / total : 0.0, decode_ns > 0 ? total / (decode_ns / 1e9) : 0.0);
+  fprintf(out, "Batch:  %llu wakeups (%d ms window), %llu batches, avg %.2f frames, max %u; %.1f ns/batch avg, %.1f ns max\n",
+          (unsigned long long)wakeups, window_ms, (unsigned long long)batches,
+          batches ? (double)(total - overflow_frames) / batches : 0.0, max_batch,
+          batches ? batch_ns / batches : 0.0, max_batch_ns);
+  fprintf(out, "Overflow: %llu queue-full drains of %llu frames, %.1f ns max; %llu frames superseded by a newer one of the same ID\n",
+          (unsigned long long)overflows, (unsigned long long)overflow_frames, max_overflow_ns,
+          (unsigned long long)coalesced);
+  fprintf(out, "UI:     %llu of %llu batches and drains notify the UI, %llu of them change a screen 0 value\n",
+          (unsigned long long)ui_wakes, (unsigned long long)(batches + overflows), (unsigned long long)ui_value_wakes);
+  fprintf(out, "Wall:   %.3f s (%.0f frames/s end to end)\n", wall_s, wall_s > 0 ? total / wall_s : 0.0);
+  fprintf(out, "Per ID:\n");
+  for (const auto &entry : id_counts) {
+    fprintf(out, "  0x%03X %8u\n", entry.first, entry.second);
+  }
+
+  if (expect_file != NULL) {
+    char extra[256];
+    uint32_t missing = 0;
+    while (fgets(extra, sizeof(extra), expect_file)) missing++;
+    fclose(expect_file);
+    if (missing) fprintf(stderr, "%u expected rows not produced\n", missing);
+    fprintf(out, "Expect: %u rows compared with %s, %u differ, %u missing\n", expect_rows, expect_path,
+            expect_diffs, missing);
+    fprintf(out, "%s\n", expect_diffs || missing ? "FAIL" : "PASS");
+    if (expect_diffs || missing) return 1;
+  }
+  return 0;
+}
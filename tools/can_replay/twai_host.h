@@ -0,0 +1,65 @@
+#pragma once
+// Host stand-in for the slice of driver/twai.h that receive_can_task uses.
+// Frames come from a replay log instead of the TWAI controller; the queue is
+// filled by the replay loop and drained through twai_receive() exactly like
+// on the gauge.
+#include <stdint.h>
+#include <deque>
+#include "CAN_Filter.h"
+
+typedef int esp_err_t;
+#define ESP_OK          0
+#define ESP_ERR_TIMEOUT 0x107
+
+#define TWAI_ALERT_RX_QUEUE_FULL 0x00000800
+
+typedef struct {
+  uint32_t identifier;
+  uint8_t  data_length_code;
+  uint8_t  data[8];
+} twai_message_t;
+
+// Timestamped frame as read from a candump / ASC log (log time in µs)
+typedef struct {
+  uint64_t       time_us;
+  twai_message_t message;
+} replay_frame_t;
+
+extern std::deque<twai_message_t> twai_host_rx_queue;
+extern uint32_t twai_host_rx_queue_len;
+extern uint32_t twai_host_rx_overruns;
+extern const CanFilterPlan *twai_host_filter; // NULL = accept all
+extern uint32_t twai_host_rx_filtered;
+extern uint32_t twai_host_alerts;             // Raised, not yet read by twai_read_alerts()
+
+// Push a frame into the RX queue. Frames the acceptance filter rejects never
+// reach the queue, as on the controller; a full queue counts an overrun.
+inline void twai_host_push(const twai_message_t &message) {
+  if (twai_host_filter != NULL && !can_filter_accepts(*twai_host_filter, message.identifier)) {
+    twai_host_rx_filtered++;
+    return;
+  }
+  if (twai_host_rx_queue.size() >= twai_host_rx_queue_len) {
+    twai_host_rx_overruns++;
+    twai_host_alerts |= TWAI_ALERT_RX_QUEUE_FULL;
+    return;
+  }
+  twai_host_rx_queue.push_back(message);
+}
+
+// Non-blocking on the host: ticks_to_wait is ignored, an empty queue times out
+inline esp_err_t twai_receive(twai_message_t *message, uint32_t ticks_to_wait) {
+  (void)ticks_to_wait;
+  if (twai_host_rx_queue.empty()) return ESP_ERR_TIMEOUT;
+  *message = twai_host_rx_queue.front();
+  twai_host_rx_queue.pop_front();
+  return ESP_OK;
+}
+
+// Return and clear the raised alerts; ticks_to_wait is ignored
+inline esp_err_t twai_read_alerts(uint32_t *alerts, uint32_t ticks_to_wait) {
+  (void)ticks_to_wait;
+  *alerts = twai_host_alerts;
+  twai_host_alerts = 0;
+  return *alerts ? ESP_OK : ESP_ERR_TIMEOUT;
+}
@@ -0,0 +1,232 @@
+#!/usr/bin/env python3
+"""Compress the images/ assets into run-length coded tables for ImageCache.
+
+The logos and status icons were stored as raw RGB565A8 arrays straight from
+the LVGL image converter: 3 bytes a pixel, 90 KB for the Aston logo alone.
+This reads those arrays (images/<name>.h, the converter's output for the PNG
+and JPG next to it, so the pixels stay exactly what the screens showed) and
+writes images/<name>_rle.h with one of two lossless encodings, whichever is
+smaller:
+
+  palette  up to 256 distinct (colour, alpha) pixels: a 3-byte palette entry
+           per pixel value, then the RLE coded 1-byte indices
+  planar   the RLE coded RGB565 plane (2-byte tokens), then the RLE coded
+           alpha plane (1-byte tokens)
+
+RLE packets start with a control byte c: c & 0x80 is a run of (c & 0x7F) + 1
+copies of the one token that follows, otherwise c + 1 literal tokens follow.
+ImageCodec.cpp decodes both back to RGB565A8 on first use; the CRC-32 of the
+decoded image is stored with each asset so tools/image_codec_check can verify
+the round trip and time the decoder on the host.
+
+The Arduino IDE has no pre-build hook, so the generated headers are committed.
+Re-run this after converting a new image with the LVGL image converter:
+
+    python3 tools/compress_images.py             # regenerate images/*_rle.h
+    python3 tools/compress_images.py --check     # fail if a header is stale
+"""
+import argparse
+import os
+import re
+import sys
+import time
+import zlib
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Assets to compress (images/<name>.h → images/<name>_rle.h)
+ASSETS = [
+    "AstonLogo",
+    "MotecLogo",
+    "jake",
+    "CruiseControl",
+    "tcs",
+    "flag",
+    "TwoStep",
+    "ExhaustBypass",
+    "PeakRecall",
+    "ClearPeakRecall",
+]
+
+CODEC_PALETTE = 1
+CODEC_PLANAR = 2
+CODEC_NAMES = {CODEC_PALETTE: "IMAGE_CODEC_RLE_PALETTE", CODEC_PLANAR: "IMAGE_CODEC_RLE_PLANAR"}
+MAX_RUN = 128
+
+
+def parse_image(path):
+    with open(path) as f:
+        text = f.read()
+    m = re.search(r"\b(\w+)_map\[\]\s*=\s*\{(.*?)\};", text, re.S)
+    if not m:
+        raise ValueError("%s: no _map[] array" % path)
+    data = bytes(int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", m.group(2)))
+    if "LV_COLOR_FORMAT_RGB565A8" not in text:
+        raise ValueError("%s: only RGB565A8 images are supported" % path)
+    w = int(re.search(r"\.w\s*=\s*(\d+)", text).group(1))
+    h = int(re.search(r"\.h\s*=\s*(\d+)", text).group(1))
+    if len(data) != w * h * 3:
+        raise ValueError("%s: %d bytes of data for %dx%d RGB565A8" % (path, len(data), w, h))
+    return w, h, data
+
+
+def rle_encode(tokens, size):
+    """tokens: list of ints, each written as `size` little-endian bytes."""
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(len(chunk) - 1)
+            for t in chunk:
+                out.extend(t.to_bytes(size, "little"))
+
+    i = 0
+    while i < len(tokens):
+        j = i
+        while j < len(tokens) and j - i < MAX_RUN and tokens[j] == tokens[i]:
+            j += 1
+        if j - i >= 2:
+            flush()
+            out.append(0x80 | (j - i - 1))
+            out += tokens[i].to_bytes(size, "little")
+            i = j
+        else:
+            literal.append(tokens[i])
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def rle_decode(data, pos, count, size):
+    tokens = []
+    while len(tokens) < count:
+        c = data[pos]
+        pos += 1
+        n = (c & 0x7F) + 1
+        if c & 0x80:
+            tokens += [int.from_bytes(data[pos:pos + size], "little")] * n
+            pos += size
+        else:
+            for _ in range(n):
+                tokens.append(int.from_bytes(data[pos:pos + size], "little"))
+                pos += size
+    if len(tokens) != count:
+        raise ValueError("RLE overrun")
+    return tokens, pos
+
+
+def encode(w, h, data):
+    n = w * h
+    colors = [data[2 * i] | data[2 * i + 1] << 8 for i in range(n)]
+    alpha = list(data[2 * n:])
+
+    candidates = []
+    pixels = list(zip(colors, alpha))
+    palette = sorted(set(pixels))
+    if len(palette) <= 256:
+        index = {p: i for i, p in enumerate(palette)}
+        out = bytearray([len(palette) - 1])
+        for c, a in palette:
+            out += bytes([c & 0xFF, c >> 8, a])
+        out += rle_encode([index[p] for p in pixels], 1)
+        candidates.append((len(out), CODEC_PALETTE, bytes(out)))
+    out = rle_encode(colors, 2) + rle_encode(alpha, 1)
+    candidates.append((len(out), CODEC_PLANAR, out))
+    _, codec, stream = min(candidates)
+    return codec, stream
+
+
+def decode(codec, stream, w, h):
+    """Reference decoder, kept in step with ImageCodec.cpp."""
+    n = w * h
+    if codec == CODEC_PALETTE:
+        count = stream[0] + 1
+        palette = [stream[1 + 3 * i:4 + 3 * i] for i in range(count)]
+        indices, pos = rle_decode(stream, 1 + 3 * count, n, 1)
+        colors = b"".join(palette[i][:2] for i in indices)
+        alpha = bytes(palette[i][2] for i in indices)
+    else:
+        tokens, pos = rle_decode(stream, 0, n, 2)
+        colors = b"".join(t.to_bytes(2, "little") for t in tokens)
+        tokens, pos = rle_decode(stream, pos, n, 1)
+        alpha = bytes(tokens)
+    if pos != len(stream):
+        raise ValueError("trailing data")
+    return colors + alpha
+
+
+def generate(name, source, w, h, codec, stream, raw):
+    kind = "palette + RLE" if codec == CODEC_PALETTE else "planar RLE"
+    out = []
+    out.append("// Generated by tools/compress_images.py from %s - do not edit." % source)
+    out.append("// %dx%d RGB565A8, %s: %d -> %d bytes. Decoded on first use by ImageCache." % (
+        w, h, kind, len(raw), len(stream)))
+    out.append("#pragma once")
+    out.append('#include "../ImageCodec.h"')
+    out.append("")
+    out.append("static const uint8_t %s_rle[] = {" % name)
+    for i in range(0, len(stream), 16):
+        out.append("  " + ", ".join("0x%02x" % b for b in stream[i:i + 16]) + ",")
+    out.append("};")
+    out.append("")
+    out.append("IMAGE_ASSET_DECLARE(%s);" % name)
+    out.append("const ImageAsset %s_asset = {" % name)
+    out.append('  .name = "%s",' % name)
+    out.append("  .data = %s_rle," % name)
+    out.append("  .data_size = sizeof(%s_rle)," % name)
+    out.append("  .raw_size = %d," % len(raw))
+    out.append("  .crc32 = 0x%08x," % zlib.crc32(raw))
+    out.append("  .w = %d," % w)
+    out.append("  .h = %d," % h)
+    out.append("  .codec = %s," % CODEC_NAMES[codec])
+    out.append("};")
+    out.append("")
+    return "\n".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--check", action="store_true", help="exit 1 if an output file is out of date")
+    args = parser.parse_args()
+
+    stale = False
+    total_raw = total_packed = 0
+    for name in ASSETS:
+        source = "images/%s.h" % name
+        dest = "images/%s_rle.h" % name
+        w, h, raw = parse_image(os.path.join(ROOT, source))
+        codec, stream = encode(w, h, raw)
+        start = time.perf_counter()
+        if decode(codec, stream, w, h) != raw:
+            raise ValueError("%s: round trip failed" % source)
+        decode_ms = (time.perf_counter() - start) * 1000
+        text = generate(name, source, w, h, codec, stream, raw)
+        path = os.path.join(ROOT, dest)
+        total_raw += len(raw)
+        total_packed += len(stream)
+        if args.check:
+            try:
+                with open(path) as f:
+                    current = f.read()
+            except OSError:
+                current = None
+            if current != text:
+                print("%s is out of date; run tools/compress_images.py" % dest, file=sys.stderr)
+                stale = True
+            continue
+        with open(path, "w") as f:
+            f.write(text)
+        print("Wrote %-26s %3dx%-3d %-8s %6d -> %5d bytes (%4.1f%%), Python decode %.1f ms" % (
+            dest + ":", w, h, "palette" if codec == CODEC_PALETTE else "planar",
+            len(raw), len(stream), 100.0 * len(stream) / len(raw), decode_ms))
+    if not args.check:
+        print("Total %d -> %d bytes (%.1f%%); time the C decoder with tools/image_codec_check" % (
+            total_raw, total_packed, 100.0 * total_packed / total_raw))
+    return 1 if stale else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
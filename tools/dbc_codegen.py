@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+"""Generate M1_Signals.h from the M1 DBC.
+
+Every signal becomes a constexpr, branch-free extractor that reads only the
+payload bytes it spans and reduces to a few shifts and masks. Messages are
+emitted in ID order together with a sorted ID table, so callers can map an
+identifier to a dense index (m1::message_index) for per-message arrays.
+
+The Arduino IDE has no pre-build hook, so the generated header is committed.
+Re-run this after editing the DBC:
+
+    python3 tools/dbc_codegen.py                 # regenerate M1_Signals.h
+    python3 tools/dbc_codegen.py --check         # fail if M1_Signals.h is stale
+"""
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_DBC = os.path.join(ROOT, "M1 General 0x640 0x650 0x670 Ver5.dbc")
+DEFAULT_OUT = os.path.join(ROOT, "M1_Signals.h")
+
+BO_RE = re.compile(r"^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+(\w+)")
+SG_RE = re.compile(
+    r"^\s*SG_\s+(\w+)\s*(?:M|m\d+)?\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*"
+    r"\(([^,]+),([^)]+)\)\s*\[([^|]*)\|([^\]]*)\]\s*\"([^\"]*)\"")
+
+EXTENDED_FLAG = 0x80000000
+
+
+class Signal:
+    def __init__(self, name, start, length, little_endian, signed, scale, offset, minimum, maximum, unit):
+        self.name = name
+        self.start = start
+        self.length = length
+        self.little_endian = little_endian
+        self.signed = signed
+        self.scale = scale
+        self.offset = offset
+        self.minimum = minimum
+        self.maximum = maximum
+        self.unit = unit
+
+
+class Message:
+    def __init__(self, can_id, name, dlc):
+        self.can_id = can_id
+        self.name = name
+        self.dlc = dlc
+        self.signals = []
+
+
+def parse_dbc(path):
+    messages = []
+    current = None
+    with open(path, encoding="latin-1") as f:
+        for line in f:
+            m = BO_RE.match(line)
+            if m:
+                raw_id = int(m.group(1))
+                current = Message(raw_id & ~EXTENDED_FLAG if raw_id & EXTENDED_FLAG else raw_id, m.group(2), int(m.group(3)))
+                # Vector's placeholder message for unassigned signals has no payload
+                if raw_id & EXTENDED_FLAG and current.dlc == 0:
+                    current = None
+                else:
+                    messages.append(current)
+                continue
+            m = SG_RE.match(line)
+            if m and current is not None:
+                current.signals.append(Signal(
+                    name=m.group(1),
+                    start=int(m.group(2)),
+                    length=int(m.group(3)),
+                    little_endian=m.group(4) == "1",
+                    signed=m.group(5) == "-",
+                    scale=float(m.group(6)),
+                    offset=float(m.group(7)),
+                    minimum=m.group(8),
+                    maximum=m.group(9),
+                    unit=m.group(10)))
+            elif not line.strip():
+                current = None
+    return sorted((msg for msg in messages if msg.signals), key=lambda msg: msg.can_id)
+
+
+def raw_type(length, signed):
+    for bits in (8, 16, 32):
+        if length <= bits:
+            return ("int%d_t" if signed else "uint%d_t") % bits
+    return "int64_t" if signed else "uint64_t"
+
+
+def extract_expr(sig):
+    """Build a shift/mask expression over only the bytes the signal spans."""
+    if sig.little_endian:
+        first = sig.start // 8
+        last = (sig.start + sig.length - 1) // 8
+        shift = sig.start - 8 * first
+        terms = [(b, 8 * (b - first)) for b in range(first, last + 1)]
+    else:
+        # Motorola: start is the MSB in sawtooth numbering; walk to a linear
+        # big-endian bit position where 0 is the MSB of byte 0.
+        msb = (sig.start // 8) * 8 + (7 - sig.start % 8)
+        lsb = msb + sig.length - 1
+        first = msb // 8
+        last = lsb // 8
+        shift = 8 * (last + 1) - 1 - lsb
+        terms = [(b, 8 * (last - b)) for b in range(first, last + 1)]
+
+    span_bits = 8 * len(terms)
+    word = "uint32_t" if span_bits <= 32 else "uint64_t"
+    parts = []
+    for byte, pos in terms:
+        if pos == 0:
+            parts.append("d[%d]" % byte)
+        else:
+            parts.append("((%s)d[%d] << %d)" % (word, byte, pos))
+    expr = " | ".join(parts)
+    if len(parts) > 1:
+        expr = "(%s)" % expr
+    if shift:
+        expr = "(%s >> %d)" % (expr, shift)
+    if sig.length < span_bits - shift:
+        expr = "(%s & 0x%X)" % (expr, (1 << sig.length) - 1)
+
+    rtype = raw_type(sig.length, sig.signed)
+    if sig.signed:
+        wide = 32 if sig.length <= 32 else 64
+        if sig.length in (8, 16, 32, 64):
+            return rtype, "(%s)%s" % (rtype, expr)
+        return rtype, "(%s)((int%d_t)((uint%d_t)%s << %d) >> %d)" % (
+            rtype, wide, wide, expr, wide - sig.length, wide - sig.length)
+    return rtype, "(%s)%s" % (rtype, expr)
+
+
+def float_literal(value):
+    text = repr(float(value))
+    if "e" not in text and "." not in text:
+        text += ".0"
+    return text + "f"
+
+
+def generate(messages, dbc_name):
+    out = []
+    w = out.append
+    w("// AUTO-GENERATED by tools/dbc_codegen.py from \"%s\" - do not edit." % dbc_name)
+    w("// Regenerate with: python3 tools/dbc_codegen.py")
+    w("#pragma once")
+    w("#include <stdint.h>")
+    w("")
+    w("// Each signal X of message 0xNNN is m1::msg_NNN::X(data), returning the raw")
+    w("// (unscaled) value. Physical value = raw * X_scale + X_offset.")
+    w("namespace m1 {")
+    w("")
+    total = 0
+    for msg in messages:
+        w("// ---- 0x%03X %s (%d signals) ----" % (msg.can_id, msg.name, len(msg.signals)))
+        w("namespace msg_%03X {" % msg.can_id)
+        w("constexpr uint32_t ID = 0x%03X;" % msg.can_id)
+        w("constexpr uint8_t DLC = %d;" % msg.dlc)
+        for sig in msg.signals:
+            rtype, expr = extract_expr(sig)
+            w("// %s: %d|%d@%d%s (%g,%g) [%s|%s] \"%s\"" % (
+                sig.name, sig.start, sig.length, 1 if sig.little_endian else 0,
+                "-" if sig.signed else "+", sig.scale, sig.offset, sig.minimum, sig.maximum, sig.unit))
+            w("constexpr %s %s(const uint8_t *d) { return %s; }" % (rtype, sig.name, expr))
+            w("constexpr float %s_scale = %s;" % (sig.name, float_literal(sig.scale)))
+            w("constexpr float %s_offset = %s;" % (sig.name, float_literal(sig.offset)))
+            total += 1
+        w("}  // namespace msg_%03X" % msg.can_id)
+        w("")
+
+    w("// Sorted ID dispatch table: message_index() maps an ID to 0..MESSAGE_COUNT-1")
+    w("constexpr uint32_t MESSAGE_IDS[] = {")
+    ids = [msg.can_id for msg in messages]
+    for i in range(0, len(ids), 8):
+        w("  " + ", ".join("0x%03X" % can_id for can_id in ids[i:i + 8]) + ",")
+    w("};")
+    w("constexpr int MESSAGE_COUNT = %d;" % len(ids))
+    w("constexpr int SIGNAL_COUNT = %d;" % total)
+    w("")
+    w("// Binary search over MESSAGE_IDS; -1 when the ID is not in the DBC")
+    w("constexpr int message_index(uint32_t id) {")
+    w("  int lo = 0, hi = MESSAGE_COUNT - 1;")
+    w("  while (lo <= hi) {")
+    w("    int mid = (lo + hi) / 2;")
+    w("    if (MESSAGE_IDS[mid] == id) return mid;")
+    w("    if (MESSAGE_IDS[mid] < id) lo = mid + 1; else hi = mid - 1;")
+    w("  }")
+    w("  return -1;")
+    w("}")
+    w("")
+    w("}  // namespace m1")
+    w("")
+    return "\n".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--dbc", default=DEFAULT_DBC)
+    parser.add_argument("--out", default=DEFAULT_OUT)
+    parser.add_argument("--check", action="store_true", help="exit 1 if the output file is out of date")
+    args = parser.parse_args()
+
+    messages = parse_dbc(args.dbc)
+    text = generate(messages, os.path.basename(args.dbc))
+
+    if args.check:
+        try:
+            with open(args.out) as f:
+                current = f.read()
+        except OSError:
+            current = None
+        if current != text:
+            print("%s is out of date; run tools/dbc_codegen.py" % args.out, file=sys.stderr)
+            return 1
+        return 0
+
+    with open(args.out, "w") as f:
+        f.write(text)
+    print("Wrote %s: %d messages, %d signals" % (
+        args.out, len(messages), sum(len(msg.signals) for msg in messages)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
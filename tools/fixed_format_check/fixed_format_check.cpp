@@ -0,0 +1,260 @@
+/*****************************************************************************
+  | File        :   fixed_format_check.cpp
+
+  | help        :
+    Host check and benchmark for FixedFormat.cpp against the float + sprintf
+    display path it replaced.
+
+    Build (from the repository root):
+      g++ -O2 -std=c++17 -I. tools/fixed_format_check/fixed_format_check.cpp \
+          FixedFormat.cpp CAN_Decoder.cpp -o fixed_format_check
+
+    Checks, all exhaustive:
+      - fx_format_int / fx_format_tenths against snprintf over 7 digits
+      - every screen channel converter (LUT or multiply-shift, imperial and
+        metric) against the exact integer division of its descriptor
+      - label text for every raw value of every gauge channel against
+        can_scale_screen_values() + the old sprintf code
+      - odometer/trip text for 0.00 - 200000.00 miles against sprintf("%.1f")
+    A difference is accepted only when the exact value sits on a rounding
+    boundary (within float error), where the float path's answer depended on
+    representation error, or when the old path printed "-0.0". Anything else
+    fails the run. Exit status 0 = pass.
+******************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "CAN_Decoder.h"
+#include "FixedFormat.h"
+
+// ---- The code FixedFormat replaced (from the sketch, verbatim) ----
+
+static void format_float_value(char *buffer, float value) {
+  char temp[10];
+  sprintf(temp, "%.1f", value);
+  int len = strlen(temp);
+  int padding = 5 - len;
+  if (padding < 0) padding = 0;
+  int i;
+  for (i = 0; i < padding; i++) buffer[i] = ' ';
+  strcpy(buffer + padding, temp);
+}
+
+static void format_value_with_padding(char *buffer, int value) {
+  char temp[8];
+  sprintf(temp, "%d", value);
+  int len = strlen(temp);
+  int padding = 4 - len;
+  if (padding < 0) padding = 0;
+  int i;
+  for (i = 0; i < padding; i++) buffer[i] = ' ';
+  strcpy(buffer + padding, temp);
+}
+
+static bool legacy_is_int(uint8_t mode, int side) {
+  return side == 0 ? (mode == 0 || mode == 3 || mode == 4) : (mode == 0 || mode == 2 || mode == 3);
+}
+
+static void legacy_text(uint8_t mode, int side, uint16_t raw, char *out) {
+  float l = side == 0 ? raw : 0, r = side == 1 ? raw : 0;
+  can_scale_screen_values(mode, &l, &r);
+  float v = side == 0 ? l : r;
+  if (legacy_is_int(mode, side)) format_value_with_padding(out, (int)v);
+  else format_float_value(out, v);
+}
+
+static void fixed_text(uint8_t mode, int side, uint16_t raw, char *out) {
+  // Goes through the descriptor table, as update_display_from_can_data() does
+  FixedValue l, r;
+  can_screen_fixed_values(mode, side == 0 ? raw : 0, side == 1 ? raw : 0, &l, &r);
+  fx_format_value(out, side == 0 ? l : r);
+}
+
+// ---- Exact reference values ----
+
+typedef struct {
+  const char *name;
+  uint8_t mode;
+  int side;
+  uint32_t raw_max;               // Raw type range
+  long double (*exact)(uint16_t); // Display units, exact decimal constants
+} Channel;
+
+static long double ect(uint16_t r)   { return (r - 40.0L) * 9.0L / 5.0L + 32.0L; }
+static long double psi(uint16_t r)   { return r * 0.1L / 6.895L; }
+static long double afr(uint16_t r)   { return r * 0.01L * 14.7L; }
+static long double map_(uint16_t r)  { return (r * 0.1L - 105.0L) / 6.895L; }
+static long double mph(uint16_t r)   { return r * 0.1L / 1.60934L; }
+static long double ident(uint16_t r) { return r; }
+static long double volts(uint16_t r) { return r * 0.1L; }
+
+static const Channel channels[] = {
+  { "coolant F",    0, 0, 0xFF,   ect   },
+  { "oil PSI",      0, 1, 0xFFFF, psi   },
+  { "AFR bank 1",   1, 0, 0xFF,   afr   },
+  { "AFR bank 2",   1, 1, 0xFF,   afr   },
+  { "MAP PSI",      2, 0, 0xFFFF, map_  },
+  { "speed MPH",    2, 1, 0xFFFF, mph   },
+  { "LS fuel PSI",  3, 0, 0xFFFF, psi   },
+  { "inj duty %",   3, 1, 0xFF,   ident },
+  { "ethanol %",    4, 0, 0xFF,   ident },
+  { "battery V",    4, 1, 0xFF,   volts },
+};
+
+// Is x within float error of a point where the displayed text changes?
+// Integer labels truncate (boundary at integers), one-decimal labels round
+// (boundary at x.x5).
+static bool on_boundary(long double x, bool integer) {
+  long double scaled = integer ? x : x * 10.0L;
+  long double boundary = integer ? roundl(scaled) : floorl(scaled) + 0.5L;
+  long double tol = fabsl(scaled) * 4e-7L + 1e-6L;
+  return fabsl(scaled - boundary) <= tol;
+}
+
+static int failures = 0;
+
+static void report(const char *what, uint32_t checked, uint32_t boundary, uint32_t neg_zero, uint32_t bad) {
+  printf("%-14s %8u values: %u identical, %u float-boundary, %u \"-0.0\", %u FAIL\n",
+         what, checked, checked - boundary - neg_zero - bad, boundary, neg_zero, bad);
+  if (bad) failures++;
+}
+
+static void check_formatters(void) {
+  char a[32], b[32];
+  uint32_t bad = 0, checked = 0;
+  for (int32_t v = -999999; v <= 9999999; v++) {
+    snprintf(a, sizeof(a), "%4d", (int)v);
+    fx_format_int(b, v, 4);
+    if (strcmp(a, b) != 0 && bad++ < 5) printf("  int %d: \"%s\" vs \"%s\"\n", (int)v, a, b);
+    checked++;
+  }
+  report("fx_format_int", checked, 0, 0, bad);
+
+  bad = checked = 0;
+  for (int32_t t = -999999; t <= 9999999; t++) {
+    snprintf(a, sizeof(a), "%5.1f", t / 10.0);
+    fx_format_tenths(b, t, 5);
+    checked++;
+    if (strcmp(a, b) == 0) continue;
+    if (bad++ < 5) printf("  tenths %d: \"%s\" vs \"%s\"\n", (int)t, a, b);
+  }
+  report("fx_format_tenths", checked, 0, 0, bad);
+}
+
+static void check_converters(void) {
+  static const char *unit_names[DISPLAY_UNITS_COUNT] = { "imperial", "metric" };
+  for (int u = 0; u < DISPLAY_UNITS_COUNT; u++) {
+    uint32_t checked = 0, bad = 0;
+    for (uint8_t mode = 0; mode < CAN_SCREEN_MODES; mode++) {
+      for (uint8_t side = 0; side < 2; side++) {
+        const ScreenChannel *ch = can_screen_channel((DisplayUnits)u, mode, side);
+        for (uint32_t raw = 0; raw <= ch->scale->raw_max; raw++) {
+          FixedValue v = ch->convert((uint16_t)raw);
+          int32_t exact = channel_scale_exact(*ch->scale, raw);
+          checked++;
+          if (v.value == exact && v.decimals == ch->scale->decimals) continue;
+          if (bad++ < 5) printf("  %s raw %u: %d vs exact %d\n", ch->title, raw, (int)v.value, (int)exact);
+        }
+      }
+    }
+    char what[32];
+    snprintf(what, sizeof(what), "%s conv", unit_names[u]);
+    report(what, checked, 0, 0, bad);
+  }
+}
+
+static void check_channels(void) {
+  for (const Channel &ch : channels) {
+    uint32_t boundary = 0, neg_zero = 0, bad = 0;
+    bool integer = legacy_is_int(ch.mode, ch.side);
+    for (uint32_t raw = 0; raw <= ch.raw_max; raw++) {
+      char a[32], b[32];
+      legacy_text(ch.mode, ch.side, (uint16_t)raw, a);
+      fixed_text(ch.mode, ch.side, (uint16_t)raw, b);
+      if (strcmp(a, b) == 0) continue;
+      if (strstr(a, "-0.0") != NULL && strstr(b, "0.0") != NULL) {
+        neg_zero++;
+      } else if (on_boundary(ch.exact((uint16_t)raw), integer)) {
+        boundary++;
+      } else {
+        if (bad < 5) printf("  %s raw %u: \"%s\" vs \"%s\"\n", ch.name, raw, a, b);
+        bad++;
+      }
+    }
+    report(ch.name, ch.raw_max + 1, boundary, neg_zero, bad);
+  }
+}
+
+static void check_miles(void) {
+  uint32_t boundary = 0, bad = 0;
+  const uint32_t max_hundredths = 20000000;
+  for (uint32_t h = 0; h <= max_hundredths; h++) {
+    char a[32], b[32];
+    float miles = h / 100.0;
+    sprintf(a, "%.1f", miles);
+    fx_format_miles(b, h);
+    if (strcmp(a, b) == 0) continue;
+    if (on_boundary(h / 100.0L, false)) {
+      boundary++;
+    } else {
+      if (bad < 5) printf("  miles %u: \"%s\" vs \"%s\"\n", h, a, b);
+      bad++;
+    }
+  }
+  report("miles", max_hundredths + 1, boundary, 0, bad);
+}
+
+// ---- Benchmark ----
+
+static volatile uint32_t sink;
+
+template <typename F>
+static double ns_per_call(F fn, uint32_t calls) {
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < calls; i++) fn(i);
+  auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(t1 - t0).count() / calls;
+}
+
+static void benchmark(void) {
+  const uint32_t calls = 5000000;
+  char buf[32];
+  double legacy = ns_per_call([&](uint32_t i) {
+    uint8_t mode = i % 5;
+    legacy_text(mode, i & 1, (uint16_t)(i * 7), buf);
+    sink += buf[0];
+  }, calls);
+  double fixed = ns_per_call([&](uint32_t i) {
+    uint8_t mode = i % 5;
+    fixed_text(mode, i & 1, (uint16_t)(i * 7), buf);
+    sink += buf[0];
+  }, calls);
+  printf("value label:   float+sprintf %.1f ns, fixed %.1f ns (%.1fx)\n", legacy, fixed, legacy / fixed);
+
+  legacy = ns_per_call([&](uint32_t i) {
+    float miles = (5862500u + i) / 100.0;
+    sprintf(buf, "%.1f", miles);
+    sink += buf[0];
+  }, calls);
+  fixed = ns_per_call([&](uint32_t i) {
+    fx_format_miles(buf, 5862500u + i);
+    sink += buf[0];
+  }, calls);
+  printf("odometer text: float+sprintf %.1f ns, fixed %.1f ns (%.1fx)\n", legacy, fixed, legacy / fixed);
+}
+
+int main(int argc, char **argv) {
+  bool bench_only = argc > 1 && strcmp(argv[1], "--bench") == 0;
+  if (!bench_only) {
+    check_formatters();
+    check_converters();
+    can_set_display_units(DISPLAY_UNITS_IMPERIAL); // The old path was imperial only
+    check_channels();
+    check_miles();
+    printf(failures ? "FAIL\n" : "PASS\n");
+  }
+  benchmark();
+  return failures ? 1 : 0;
+}
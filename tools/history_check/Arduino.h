@@ -0,0 +1,22 @@
+#pragma once
+// Host stand-in for the slice of Arduino.h that History.cpp uses; Serial
+// output goes to stdout.
+#include <stdint.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include "freertos/FreeRTOS.h"
+
+extern unsigned long host_millis;
+inline unsigned long millis(void) { return host_millis; }
+
+struct HostSerial {
+  int printf(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    int n = vprintf(format, args);
+    va_end(args);
+    return n;
+  }
+  void println(const char *text) { puts(text); }
+};
+extern HostSerial Serial;
@@ -0,0 +1,25 @@
+#pragma once
+// Host stand-in for heap_caps_malloc(): malloc with a live-allocation count
+// and an injected failure of the Nth call, for history_init()'s error path.
+#include <stdlib.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_SPIRAM (1 << 10)
+
+extern int heap_host_live;        // Allocations not yet freed
+extern int heap_host_fail_at;     // Fail the call with this number (1-based), 0 = never
+extern int heap_host_calls;
+
+inline void *heap_caps_malloc(size_t size, uint32_t caps) {
+  (void)caps;
+  if (++heap_host_calls == heap_host_fail_at) return NULL;
+  void *p = malloc(size);
+  if (p != NULL) heap_host_live++;
+  return p;
+}
+
+inline void heap_caps_free(void *p) {
+  if (p == NULL) return;
+  heap_host_live--;
+  free(p);
+}
@@ -0,0 +1,14 @@
+#pragma once
+// Host stand-in for the FreeRTOS types and macros History.cpp and TaskMonitor.h use
+#include <stdint.h>
+
+typedef int32_t BaseType_t;
+typedef uint32_t UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define ARDUINO_RUNNING_CORE 1
+#define portMAX_DELAY        0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms)    ((TickType_t)(ms))
+#define pdTRUE               1
@@ -0,0 +1,35 @@
+#pragma once
+// Host stand-in mutex: counts live handles, checks take/give pairing and that
+// nobody takes a NULL handle, and can be made to fail creation.
+#include <stdio.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+
+typedef struct { int held; } HostMutex;
+typedef HostMutex *SemaphoreHandle_t;
+
+extern int semphr_host_live;
+extern bool semphr_host_fail;     // Next xSemaphoreCreateMutex() returns NULL
+extern int semphr_host_errors;    // NULL takes, double takes, unpaired gives
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+  if (semphr_host_fail) return NULL;
+  semphr_host_live++;
+  return (HostMutex *)calloc(1, sizeof(HostMutex));
+}
+
+inline void vSemaphoreDelete(SemaphoreHandle_t mutex) {
+  semphr_host_live--;
+  free(mutex);
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t ticks) {
+  (void)ticks;
+  if (mutex == NULL || mutex->held++) semphr_host_errors++;
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex) {
+  if (mutex == NULL || mutex->held-- != 1) semphr_host_errors++;
+  return pdTRUE;
+}
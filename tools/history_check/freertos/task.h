@@ -0,0 +1,6 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+
+inline TickType_t xTaskGetTickCount(void) { return 0; }
+inline void vTaskDelayUntil(TickType_t *last_wake, TickType_t ticks) { *last_wake += ticks; }
+inline void vTaskDelete(TaskHandle_t task) { (void)task; }
@@ -0,0 +1,203 @@
+/*****************************************************************************
+  | File        :   history_check.cpp
+
+  | help        :
+    Host check of the signal history (History.cpp): the base + shifted int8
+    delta block codec, the ring and query API, and history_init()'s failure
+    path, with stand-in Arduino, heap_caps and FreeRTOS headers
+    (tools/history_check/).
+
+    Build (from the repository root):
+      g++ -O2 -std=c++17 -I. -Itools/history_check tools/history_check/history_check.cpp \
+          CAN_Decoder.cpp FixedFormat.cpp -o history_check
+
+    Checks:
+      - history_init() failing at each of its allocations, or at the mutex,
+        leaves nothing allocated, and recording and queries then do nothing
+        (no NULL mutex taken)
+      - codec: 20000 random blocks (slow, stepped, full-range, pinned at 0
+        and 0xFFFF) decode within 2^(shift-1) of the input, never wrap past
+        0 or 0xFFFF, and blocks with steps within +-127 decode exactly with
+        shift 0
+      - a single step of every size picks the smallest shift whose rounded
+        deltas fit in int8
+      - after more samples than the ring holds: history_read() returns the
+        last samples (exact for slow signals, within the codec bound for
+        fast ones), and history_stats() / history_percentile() match a
+        reference over the same window
+    Exit status 0 = pass.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <random>
+#include <vector>
+
+// The codec is static to History.cpp
+#include "History.cpp"
+
+HostSerial Serial;
+unsigned long host_millis = 0;
+int heap_host_live = 0, heap_host_fail_at = 0, heap_host_calls = 0;
+int semphr_host_live = 0, semphr_host_errors = 0;
+bool semphr_host_fail = false;
+
+void task_monitor_exit(void) {}
+
+static int failures = 0;
+
+static void expect(bool ok, const char *what) {
+  if (!ok && failures++ < 20) fprintf(stderr, "FAIL: %s\n", what);
+}
+
+static void init_failure_check(void) {
+  DisplayData data = {};
+  HistoryStats stats;
+  // HIST_SIGNAL_COUNT rings, then the scratch buffer, then the mutex
+  for (int fail_at = 1; fail_at <= HIST_SIGNAL_COUNT + 2; fail_at++) {
+    heap_host_calls = 0;
+    heap_host_fail_at = fail_at <= HIST_SIGNAL_COUNT + 1 ? fail_at : 0;
+    semphr_host_fail = fail_at == HIST_SIGNAL_COUNT + 2;
+    expect(!history_init(), "history_init succeeds despite a failed allocation");
+    expect(heap_host_live == 0, "history_init leaks PSRAM after a failure");
+    expect(semphr_host_live == 0, "history_init leaks the mutex after a failure");
+    history_record(&data);
+    expect(!history_stats(HIST_MAP, 60, &stats), "history_stats answers without history");
+    expect(semphr_host_errors == 0, "NULL mutex taken after a failed history_init");
+  }
+  heap_host_fail_at = 0;
+  semphr_host_fail = false;
+}
+
+// Round one block trip through the codec; returns the largest error
+static int32_t round_trip(const uint16_t *raw, HistoryBlock *block) {
+  uint16_t out[HISTORY_BLOCK_SAMPLES];
+  encode_block(block, raw);
+  decode_block(block, out);
+  int32_t worst = 0;
+  for (int i = 0; i < HISTORY_BLOCK_SAMPLES; i++) {
+    int32_t err = abs((int32_t)out[i] - raw[i]);
+    if (err > worst) worst = err;
+  }
+  return worst;
+}
+
+static void codec_check(void) {
+  std::mt19937 rng(4242);
+  uint16_t raw[HISTORY_BLOCK_SAMPLES];
+  HistoryBlock block;
+  uint32_t shift_counts[17] = {};
+
+  for (int trial = 0; trial < 20000; trial++) {
+    int kind = trial % 4;
+    int32_t v = (int32_t)(rng() & 0xFFFF);
+    for (int i = 0; i < HISTORY_BLOCK_SAMPLES; i++) {
+      if (kind == 0) v += (int32_t)(rng() % 255) - 127;                        // Slow: fits int8
+      else if (kind == 1) v += rng() % 8 == 0 ? (int32_t)(rng() % 4001) - 2000 : 0;  // Occasional steps
+      else if (kind == 2) v = (int32_t)(rng() & 0xFFFF);                        // Full-range noise
+      else v = rng() % 2 ? 0 : 0xFFFF;                                           // Pinned at the limits
+      v = clamp_u16(v);
+      raw[i] = (uint16_t)v;
+    }
+    int32_t err = round_trip(raw, &block);
+    shift_counts[block.shift]++;
+    int32_t bound = block.shift ? 1 << (block.shift - 1) : 0;
+    expect(block.base == raw[0], "block base is not the first sample");
+    expect(err <= bound, "decoded sample further than 2^(shift-1) from the input");
+    if (kind == 0) expect(block.shift == 0 && err == 0, "slow block not stored exactly");
+  }
+
+  // Flat, one step of size s, flat: the shift must be the smallest that fits
+  for (int32_t step = -65535; step <= 65535; step += 7) {
+    int32_t low = step < 0 ? -step : 0;
+    for (int i = 0; i < HISTORY_BLOCK_SAMPLES; i++) raw[i] = (uint16_t)(low + (i >= 10 ? step : 0));
+    round_trip(raw, &block);
+    uint8_t want = 0;
+    int32_t mag = abs(step);
+    while (want < 16 && (mag + (want ? 1 << (want - 1) : 0)) / (1 << want) > 127) want++;
+    expect(block.shift == want, "step block does not use the smallest shift");
+  }
+
+  printf("Codec: 20000 blocks, shifts used:");
+  for (int s = 0; s <= 16; s++) {
+    if (shift_counts[s]) printf(" %d:%u", s, shift_counts[s]);
+  }
+  printf("\n");
+}
+
+static void ring_check(void) {
+  expect(history_init(), "history_init fails with memory available");
+  if (scratch == NULL) return;
+
+  // Slow signal in oil pressure, a full-range one in MAP
+  std::mt19937 rng(99);
+  std::vector<uint16_t> slow, fast;
+  DisplayData data = {};
+  int32_t v = 30000;
+  const uint32_t total = HISTORY_CAPACITY + HISTORY_CAPACITY / 6 + 5;  // Wrapped, open block part filled
+  for (uint32_t i = 0; i < total; i++) {
+    v = clamp_u16(v + (int32_t)(rng() % 201) - 100);
+    data.oil_press_raw = (uint16_t)v;
+    data.map_raw = (uint16_t)(rng() & 0xFFFF);
+    slow.push_back(data.oil_press_raw);
+    fast.push_back(data.map_raw);
+    history_record(&data);
+  }
+
+  uint32_t held = history_seconds_available();
+  expect(held >= HISTORY_MINUTES * 60 && held <= HISTORY_MINUTES * 60 + HISTORY_BLOCK_SAMPLES / HISTORY_SAMPLE_HZ + 1,
+         "seconds available does not cap at HISTORY_MINUTES");
+
+  static uint16_t out[HISTORY_CAPACITY + HISTORY_BLOCK_SAMPLES];
+  uint32_t n = history_read(HIST_OIL_PRESS, HISTORY_MINUTES * 60, out, HISTORY_CAPACITY);
+  expect(n == HISTORY_CAPACITY, "history_read returns fewer samples than asked for");
+  bool exact = true;
+  for (uint32_t i = 0; i < n; i++) exact = exact && out[i] == slow[total - n + i];
+  expect(exact, "slow signal does not read back exactly");
+
+  n = history_read(HIST_MAP, HISTORY_MINUTES * 60, out, HISTORY_CAPACITY);
+  int32_t worst = 0;
+  for (uint32_t i = 0; i < n; i++) worst = std::max(worst, abs((int32_t)out[i] - fast[total - n + i]));
+  expect(worst <= 1 << 9, "fast signal reads back further than the largest shift allows");
+  expect(out[n - 1] == fast[total - 1], "open block is not kept raw");
+
+  // Queries over the last minute of the slow signal against a reference
+  const uint32_t window = 60 * HISTORY_SAMPLE_HZ;
+  std::vector<uint16_t> ref(slow.end() - window, slow.end());
+  HistoryStats stats;
+  expect(history_stats(HIST_OIL_PRESS, 60, &stats), "history_stats fails");
+  uint64_t sum = 0;
+  for (uint16_t x : ref) sum += x;
+  expect(stats.samples == window, "history_stats sample count");
+  expect(stats.min == *std::min_element(ref.begin(), ref.end()), "history_stats min");
+  expect(stats.max == *std::max_element(ref.begin(), ref.end()), "history_stats max");
+  expect(fabsf(stats.avg - (float)sum / window) < 0.01f, "history_stats average");
+
+  std::vector<uint16_t> sorted = ref;
+  std::sort(sorted.begin(), sorted.end());
+  for (uint8_t pct = 0; pct <= 100; pct += 5) {
+    uint16_t got = 0;
+    expect(history_percentile(HIST_OIL_PRESS, 60, pct, &got), "history_percentile fails");
+    expect(got == sorted[((window - 1) * pct + 50) / 100], "history_percentile differs from the sorted window");
+  }
+
+  // Averaged read: 60 buckets of 10 samples
+  n = history_read(HIST_OIL_PRESS, 60, out, 60);
+  bool averaged = n == 60;
+  for (uint32_t p = 0; averaged && p < n; p++) {
+    uint32_t bucket = 0;
+    for (uint32_t i = 0; i < 10; i++) bucket += ref[p * 10 + i];
+    averaged = out[p] == (bucket + 5) / 10;
+  }
+  expect(averaged, "history_read bucket averages");
+  expect(semphr_host_errors == 0, "mutex take/give unpaired");
+
+  printf("Ring: %u samples recorded, %u s held, fast signal worst error %d\n", total, held, worst);
+}
+
+int main(void) {
+  init_failure_check();
+  codec_check();
+  ring_check();
+  printf("%s\n", failures ? "FAIL" : "PASS");
+  return failures ? 1 : 0;
+}
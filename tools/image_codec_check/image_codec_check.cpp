@@ -0,0 +1,101 @@
+/*****************************************************************************
+  | File        :   image_codec_check.cpp
+
+  | help        :
+    Host check and benchmark for ImageCodec.cpp over every asset generated by
+    tools/compress_images.py.
+
+    Build (from the repository root):
+      g++ -O2 -std=c++17 -I. tools/image_codec_check/image_codec_check.cpp \
+          ImageCodec.cpp -o image_codec_check
+
+    For each asset:
+      - decodes it and compares the CRC-32 of the result with the one the
+        generator stored from the original RGB565A8 array
+      - checks that every truncation of the stream is rejected rather than
+        read past its end
+      - times the decode against a memcpy of the raw image (the cost of
+        copying it out of an uncompressed array) and prints the ratio
+    Host times only rank the two; on the ESP32-S3 the decode runs from flash
+    into PSRAM, and ImageCache logs the measured time of each decode.
+    Exit status 0 = pass.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "ImageCodec.h"
+#include "images/AstonLogo_rle.h"
+#include "images/MotecLogo_rle.h"
+#include "images/jake_rle.h"
+#include "images/CruiseControl_rle.h"
+#include "images/tcs_rle.h"
+#include "images/flag_rle.h"
+#include "images/TwoStep_rle.h"
+#include "images/ExhaustBypass_rle.h"
+#include "images/PeakRecall_rle.h"
+#include "images/ClearPeakRecall_rle.h"
+
+static const ImageAsset *const assets[] = {
+  &AstonLogo_asset, &MotecLogo_asset, &jake_asset, &CruiseControl_asset, &tcs_asset,
+  &flag_asset, &TwoStep_asset, &ExhaustBypass_asset, &PeakRecall_asset, &ClearPeakRecall_asset,
+};
+
+static int failures = 0;
+static volatile uint32_t sink;
+
+static uint32_t crc32(const uint8_t *p, uint32_t n) {
+  uint32_t crc = 0xFFFFFFFF;
+  while (n--) {
+    crc ^= *p++;
+    for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320 & (0u - (crc & 1)));
+  }
+  return ~crc;
+}
+
+template <typename F>
+static double us_per_call(F fn, uint32_t calls) {
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < calls; i++) fn();
+  auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(t1 - t0).count() / calls;
+}
+
+static void check_asset(const ImageAsset *a) {
+  uint8_t *dst = (uint8_t *)malloc(a->raw_size);
+  uint8_t *raw = (uint8_t *)malloc(a->raw_size);
+  bool ok = image_decode(a, dst) && crc32(dst, a->raw_size) == a->crc32;
+
+  // Every truncation must fail cleanly (run under ASan to catch overreads)
+  uint32_t accepted = 0;
+  for (uint32_t len = 0; len < a->data_size; len++) {
+    ImageAsset cut = *a;
+    cut.data_size = len;
+    if (image_decode(&cut, dst)) accepted++;
+  }
+  if (!ok || accepted) failures++;
+
+  memcpy(raw, dst, a->raw_size);
+  uint32_t calls = 20000000 / a->raw_size + 10;
+  double decode_us = us_per_call([&] { image_decode(a, dst); sink += dst[a->raw_size - 1]; }, calls);
+  double copy_us = us_per_call([&] { memcpy(dst, raw, a->raw_size); sink += dst[a->raw_size - 1]; }, calls);
+
+  printf("%-16s %3ux%-3u %6u -> %5u bytes (%4.1f%%)  decode %7.1f us, memcpy %6.1f us  %s%s\n",
+         a->name, a->w, a->h, a->raw_size, a->data_size, 100.0 * a->data_size / a->raw_size,
+         decode_us, copy_us, ok ? "ok" : "CRC MISMATCH", accepted ? ", truncation accepted" : "");
+  free(dst);
+  free(raw);
+}
+
+int main() {
+  uint32_t raw = 0, packed = 0;
+  for (const ImageAsset *a : assets) {
+    check_asset(a);
+    raw += a->raw_size;
+    packed += a->data_size;
+  }
+  printf("total %u -> %u bytes (%.1f%%)\n", raw, packed, 100.0 * packed / raw);
+  printf(failures ? "FAIL\n" : "PASS\n");
+  return failures ? 1 : 0;
+}
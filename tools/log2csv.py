@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""Convert a gauge session log (/logs/NNNN.m1l, see DataLogger.h) to CSV.
+
+Copy the file off the LittleFS partition (e.g. with a LittleFS image tool or a
+serial dump), then:
+
+    python3 tools/log2csv.py 0001.m1l > session.csv
+    python3 tools/log2csv.py --raw 0001.m1l > session_raw.csv   # unscaled values
+
+Each 4 KB block is a keyframe, so a file cut off by a power loss still decodes
+up to its last complete block; damaged blocks are skipped and reported.
+"""
+import argparse
+import struct
+import sys
+
+BLOCK_BYTES = 4096
+HEADER = struct.Struct("<4sBBHII")
+MAGIC = b"M1LB"
+
+# Same order as encode_record() in DataLogger.cpp; scale/offset match can_scale_screen_values()
+CHANNELS = [
+    ("ect_f",        lambda r: (r - 40) * 9.0 / 5.0 + 32.0),
+    ("oil_psi",      lambda r: r * 0.1 / 6.895),
+    ("afr_b1",       lambda r: r * 0.01 * 14.7),
+    ("afr_b2",       lambda r: r * 0.01 * 14.7),
+    ("map_psi",      lambda r: (r * 0.1 - 105.0) / 6.895),
+    ("speed_mph",    lambda r: r * 0.1 / 1.60934),
+    ("ls_fuel_psi",  lambda r: r * 0.1 / 6.895),
+    ("inj_duty_pct", lambda r: float(r)),
+    ("ethanol_pct",  lambda r: float(r)),
+    ("battery_v",    lambda r: r * 0.1),
+    ("warnings",     lambda r: r),
+]
+
+
+def read_varint(buf, pos):
+    value = shift = 0
+    while True:
+        b = buf[pos]
+        pos += 1
+        value |= (b & 0x7F) << shift
+        if b < 0x80:
+            return value, pos
+        shift += 7
+
+
+def unzigzag(v):
+    return (v >> 1) ^ -(v & 1)
+
+
+def decode_blocks(data):
+    """Yield (time_ms, [raw values]) for every record; report bad blocks on stderr."""
+    for offset in range(0, len(data) - BLOCK_BYTES + 1, BLOCK_BYTES):
+        block = data[offset:offset + BLOCK_BYTES]
+        magic, version, channels, used, seq, start_ms = HEADER.unpack_from(block)
+        if magic != MAGIC or version != 1 or channels != len(CHANNELS) or used > BLOCK_BYTES:
+            print("skipping bad block at offset %d" % offset, file=sys.stderr)
+            continue
+        pos = HEADER.size
+        time_ms = start_ms
+        values = [0] * channels
+        try:
+            while pos < used:
+                dt, pos = read_varint(block, pos)
+                time_ms += dt
+                for c in range(channels):
+                    delta, pos = read_varint(block, pos)
+                    values[c] += unzigzag(delta)
+                yield seq, time_ms, list(values)
+        except IndexError:
+            print("truncated record in block %d" % seq, file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("log")
+    parser.add_argument("--raw", action="store_true", help="print raw DisplayData values instead of display units")
+    args = parser.parse_args()
+
+    with open(args.log, "rb") as f:
+        data = f.read()
+    if len(data) % BLOCK_BYTES:
+        print("ignoring %d trailing bytes (partial block)" % (len(data) % BLOCK_BYTES), file=sys.stderr)
+
+    out = sys.stdout
+    out.write("time_s," + ",".join(name for name, _ in CHANNELS) + "\n")
+    first_ms = None
+    records = 0
+    for _, time_ms, values in decode_blocks(data):
+        if first_ms is None:
+            first_ms = time_ms
+        cols = values if args.raw else [conv(v) for (_, conv), v in zip(CHANNELS, values)]
+        out.write("%.3f," % ((time_ms - first_ms) / 1000.0))
+        out.write(",".join(("%d" % c) if isinstance(c, int) else ("%.2f" % c) for c in cols) + "\n")
+        records += 1
+    print("%d records" % records, file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
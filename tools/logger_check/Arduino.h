@@ -0,0 +1,21 @@
+#pragma once
+// Host stand-in for the slice of Arduino.h that DataLogger.cpp uses
+#include <stdint.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+
+inline unsigned long millis(void) { return 0; }
+
+struct HostSerial {
+  int printf(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    int n = vprintf(format, args);
+    va_end(args);
+    return n;
+  }
+  void println(const char *text) { puts(text); }
+};
+extern HostSerial Serial;
@@ -0,0 +1,28 @@
+#pragma once
+// Host stand-in for the LittleFS calls in DataLogger.cpp. tools/logger_check
+// drives the encoder directly, so the filesystem is never touched; only the
+// mount is tracked, for logger_init()'s error path.
+#include <stddef.h>
+#include <stdint.h>
+
+struct File {
+  operator bool() const { return false; }
+  size_t write(const uint8_t *buf, size_t len) { (void)buf; (void)len; return 0; }
+  void flush(void) {}
+  void close(void) {}
+  File openNextFile(void) { return File(); }
+  const char *name(void) { return ""; }
+};
+
+struct HostLittleFS {
+  bool mounted = false;
+  bool begin(bool format_on_fail) { (void)format_on_fail; mounted = true; return true; }
+  void end(void) { mounted = false; }
+  File open(const char *path, const char *mode = "r") { (void)path; (void)mode; return File(); }
+  bool exists(const char *path) { (void)path; return false; }
+  bool mkdir(const char *path) { (void)path; return false; }
+  bool remove(const char *path) { (void)path; return false; }
+  size_t totalBytes(void) { return 0; }
+  size_t usedBytes(void) { return 0; }
+};
+extern HostLittleFS LittleFS;
@@ -0,0 +1,3 @@
+#pragma once
+// Host stand-in: CANBus_Driver.h only needs the gpio type from the TWAI driver
+typedef int gpio_num_t;
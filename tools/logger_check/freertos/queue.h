@@ -0,0 +1,35 @@
+#pragma once
+// Host stand-in: the write queue holds at most one handed-off block index,
+// which tools/logger_check takes instead of the writer task
+#include "freertos/FreeRTOS.h"
+
+typedef int *QueueHandle_t;
+
+extern int queue_host_block;  // Last block index sent, -1 = none
+extern int queue_host_live;   // Queues created and not deleted
+extern bool queue_host_fail;  // Next xQueueCreate() returns NULL
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+  (void)length; (void)item_size;
+  if (queue_host_fail) return NULL;
+  queue_host_live++;
+  return &queue_host_block;
+}
+
+inline void vQueueDelete(QueueHandle_t queue) {
+  (void)queue;
+  queue_host_live--;
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks) {
+  (void)ticks;
+  *queue = *(const uint8_t *)item;
+  return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks) {
+  (void)ticks;
+  *(uint8_t *)item = (uint8_t)*queue;
+  *queue = -1;
+  return pdTRUE;
+}
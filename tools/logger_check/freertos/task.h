@@ -0,0 +1,7 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+
+inline TickType_t xTaskGetTickCount(void) { return 0; }
+inline void vTaskDelayUntil(TickType_t *last_wake, TickType_t ticks) { *last_wake += ticks; }
+inline void vTaskDelay(TickType_t ticks) { (void)ticks; }
+inline void vTaskDelete(TaskHandle_t task) { (void)task; }
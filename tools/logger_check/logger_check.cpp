@@ -0,0 +1,280 @@
+/*****************************************************************************
+  | File        :   logger_check.cpp
+
+  | help        :
+    Host round trip of the session log format: records are encoded with the
+    DataLogger.cpp encoder (behind stand-in Arduino, LittleFS and FreeRTOS
+    headers in tools/logger_check/), written out as a .m1l file and decoded
+    with tools/log2csv.py --raw, which must give back every record.
+
+    Build and run (from the repository root; needs python3):
+      g++ -O2 -std=c++17 -I. -Itools/logger_check tools/logger_check/logger_check.cpp \
+          CAN_Decoder.cpp FixedFormat.cpp -o logger_check
+      ./logger_check [path/to/log2csv.py]
+
+    Checks:
+      - a 20000-record session (slow and jumping channels, full-range uint16
+        values, warning bits, 50 ms ticks with jitter and long gaps) decodes
+        to the same time and raw values, record for record, with no block
+        skipped or cut short
+      - LOG_MAX_RECORD covers the largest record: a 32-bit time step with
+        every channel swinging end to end
+      - the same file cut off partway through its last block decodes every
+        record of the complete blocks
+      - the session again with blocks handed off at LOGGER_FLUSH_MS age
+        (padded, partly filled) decodes record for record
+      - logger_init() failing at each allocation or task start frees its
+        blocks and queue, unmounts LittleFS, and tells a started sampler
+        to exit
+    Exit status 0 = pass.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <random>
+#include <string>
+#include <vector>
+
+// The encoder is static to DataLogger.cpp
+#include "DataLogger.cpp"
+
+HostSerial Serial;
+HostLittleFS LittleFS;
+CanRxStats can_rx_stats;
+int queue_host_block = -1;
+int queue_host_live = 0;
+bool queue_host_fail = false;
+int heap_host_live = 0, heap_host_fail_at = 0, heap_host_calls = 0;
+int task_host_fail_at = 0, task_host_calls = 0;
+
+// Tasks are never run: the check drives the encoder and writer half itself
+bool task_start(TaskFunction_t fn, const char *name, uint32_t stack_bytes, UBaseType_t priority, BaseType_t core,
+                TaskHandle_t *handle_out) {
+  (void)fn; (void)name; (void)stack_bytes; (void)priority; (void)core; (void)handle_out;
+  return ++task_host_calls != task_host_fail_at;
+}
+
+void task_monitor_exit(void) {}
+
+typedef struct {
+  uint32_t time_ms;
+  int32_t values[LOG_CHANNELS];
+} Record;
+
+static int failures = 0;
+
+static void expect(bool ok, const char *what) {
+  if (!ok && failures++ < 20) fprintf(stderr, "FAIL: %s\n", what);
+}
+
+static void init_failure_check(void) {
+  // Both blocks, then the queue, then the sampler and writer tasks
+  for (int fail_at = 1; fail_at <= 5; fail_at++) {
+    heap_host_calls = task_host_calls = 0;
+    heap_host_fail_at = fail_at <= 2 ? fail_at : 0;
+    queue_host_fail = fail_at == 3;
+    task_host_fail_at = fail_at > 3 ? fail_at - 3 : 0;
+    session_state = 0;
+    expect(!logger_init(), "logger_init succeeds despite a failed allocation or task start");
+    expect(heap_host_live == 0, "logger_init leaks a block after a failure");
+    expect(queue_host_live == 0, "logger_init leaks the write queue after a failure");
+    expect(!LittleFS.mounted, "logger_init leaves LittleFS mounted after a failure");
+    expect(task_host_fail_at != 2 || session_state < 0, "sampler not told to exit when the writer fails");
+  }
+  heap_host_fail_at = task_host_fail_at = 0;
+  queue_host_fail = false;
+  session_state = 0;
+}
+
+// The writer task's half: take the handed-off block and append it to the file
+static void write_block(std::vector<uint8_t> *file) {
+  expect(queue_host_block >= 0, "hand_off_block queued nothing");
+  if (queue_host_block < 0) return;
+  uint8_t index = (uint8_t)queue_host_block;
+  file->insert(file->end(), blocks[index], blocks[index] + LOG_BLOCK_BYTES);
+  block_busy[index] = false;
+  queue_host_block = -1;
+}
+
+// Encode a session the way logger_sample_task does; records_per_block gets
+// the record count of each block written. Without age_flush blocks are only
+// handed off full, as with LOGGER_FLUSH_MS 0.
+static void encode_session(std::vector<uint8_t> *file, std::vector<Record> *records,
+                           std::vector<uint32_t> *records_per_block, bool age_flush) {
+  std::mt19937 rng(2024);
+  DisplayData d = {};
+  uint32_t now = 1000;
+  uint32_t in_block = 0;
+  begin_block(now);
+
+  for (uint32_t i = 0; i < 20000; i++) {
+    now += 50 + rng() % 3;
+    if (rng() % 2000 == 0) now += 70000 + rng() % 100000;  // Long gap: multi-byte dt
+    bool full = used + LOG_MAX_RECORD > LOG_BLOCK_BYTES;
+    if (age_flush ? block_due(now) : full) {
+      expect(hand_off_block(), "writer never busy here, hand-off must succeed");
+      write_block(file);
+      records_per_block->push_back(in_block);
+      in_block = 0;
+      begin_block(now);
+    }
+
+    bool swing = i % 500 < 20;  // Worst case: every channel end to end
+    d.coolant_temp_raw = swing ? (i & 1 ? 0xFF : 0) : (uint8_t)(90 + rng() % 3);
+    d.oil_press_raw = swing ? (i & 1 ? 0xFFFF : 0) : (uint16_t)(d.oil_press_raw + rng() % 41 - 20);
+    d.lambda_bank1_raw = swing ? (i & 1 ? 0xFF : 0) : (uint8_t)(95 + rng() % 10);
+    d.lambda_bank2_raw = swing ? (i & 1 ? 0 : 0xFF) : (uint8_t)(95 + rng() % 10);
+    d.map_raw = swing ? (i & 1 ? 0xFFFF : 0) : (uint16_t)(rng() & 0xFFFF);
+    d.speed_raw = swing ? (i & 1 ? 0 : 0xFFFF) : (uint16_t)(rng() % 8 == 0 ? rng() % 3000 : d.speed_raw);
+    d.ls_fuel_press_raw = swing ? (i & 1 ? 0xFFFF : 0) : (uint16_t)(3500 + rng() % 50);
+    d.inj_duty_cycle_raw = swing ? (i & 1 ? 0xFF : 0) : (uint8_t)(rng() % 101);
+    d.ethanol_pct_raw = swing ? (i & 1 ? 0 : 0xFF) : 85;
+    d.battery_volts_raw = swing ? (i & 1 ? 0xFF : 0) : (uint8_t)(138 + rng() % 3);
+    uint8_t warnings = swing ? (i & 1 ? 0xFF : 0) : (uint8_t)(rng() % 50 == 0 ? rng() & 0xFF : 0);
+
+    encode_record(&d, warnings, now);
+    expect(used <= LOG_BLOCK_BYTES, "record ran past the end of the block");
+    in_block++;
+
+    Record r = { now, { d.coolant_temp_raw, d.oil_press_raw, d.lambda_bank1_raw, d.lambda_bank2_raw, d.map_raw,
+                        d.speed_raw, d.ls_fuel_press_raw, d.inj_duty_cycle_raw, d.ethanol_pct_raw,
+                        d.battery_volts_raw, warnings } };
+    records->push_back(r);
+  }
+  // logger_flush(): the partly filled block
+  expect(hand_off_block(), "final hand-off failed");
+  write_block(file);
+  records_per_block->push_back(in_block);
+}
+
+// Run log2csv.py --raw on file; rows get the decoded records, messages its stderr
+static bool decode_with_log2csv(const char *script, const std::vector<uint8_t> &file,
+                                std::vector<Record> *rows, std::string *messages) {
+  char log_path[] = "/tmp/logger_check_XXXXXX";
+  int fd = mkstemp(log_path);
+  if (fd < 0) return false;
+  bool ok = write(fd, file.data(), file.size()) == (ssize_t)file.size();
+  close(fd);
+  std::string err_path = std::string(log_path) + ".err";
+  std::string cmd = std::string("python3 ") + script + " --raw " + log_path + " 2>" + err_path;
+
+  FILE *p = ok ? popen(cmd.c_str(), "r") : NULL;
+  if (p != NULL) {
+    char line[512];
+    bool header = true;
+    while (fgets(line, sizeof(line), p)) {
+      if (header) {
+        header = false;
+        continue;
+      }
+      Record r = {};
+      char *s = line;
+      double t = strtod(s, &s);
+      r.time_ms = (uint32_t)llround(t * 1000.0);  // Relative to the first record
+      for (int c = 0; c < LOG_CHANNELS && *s == ','; c++) r.values[c] = (int32_t)strtol(s + 1, &s, 10);
+      rows->push_back(r);
+    }
+    ok = pclose(p) == 0;
+  } else {
+    ok = false;
+  }
+
+  FILE *e = fopen(err_path.c_str(), "r");
+  if (e != NULL) {
+    char line[256];
+    while (fgets(line, sizeof(line), e)) *messages += line;
+    fclose(e);
+  }
+  unlink(log_path);
+  unlink(err_path.c_str());
+  return ok;
+}
+
+// Compare the first count records; returns how many matched before the first difference
+static size_t compare(const std::vector<Record> &want, const std::vector<Record> &got, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    if (i >= got.size()) return i;
+    if (got[i].time_ms != want[i].time_ms - want[0].time_ms) return i;
+    if (memcmp(got[i].values, want[i].values, sizeof(want[i].values)) != 0) return i;
+  }
+  return count;
+}
+
+// Largest record: dt needing a 5-byte varint, every channel from 0 to its maximum
+static void max_record_check(void) {
+  DisplayData zero = {}, full = {};
+  full.coolant_temp_raw = full.lambda_bank1_raw = full.lambda_bank2_raw = 0xFF;
+  full.inj_duty_cycle_raw = full.ethanol_pct_raw = full.battery_volts_raw = 0xFF;
+  full.oil_press_raw = full.map_raw = full.speed_raw = full.ls_fuel_press_raw = 0xFFFF;
+  begin_block(0);
+  encode_record(&zero, 0, 0);
+  uint16_t before = used;
+  encode_record(&full, 0xFF, 0xFFFFFFFFu);
+  uint16_t up = used - before;
+  before = used;
+  encode_record(&zero, 0, 0xFFFFFFFFu);  // dt 0, all deltas negative
+  uint16_t down = used - before;
+  printf("Largest record: %u bytes rising, %u falling, LOG_MAX_RECORD %d\n", up, down, LOG_MAX_RECORD);
+  expect(up <= LOG_MAX_RECORD && down <= LOG_MAX_RECORD, "record larger than LOG_MAX_RECORD");
+}
+
+int main(int argc, char **argv) {
+  const char *script = argc > 1 ? argv[1] : "tools/log2csv.py";
+  init_failure_check();
+  blocks[0] = (uint8_t *)malloc(LOG_BLOCK_BYTES);
+  blocks[1] = (uint8_t *)malloc(LOG_BLOCK_BYTES);
+  write_queue = xQueueCreate(2, sizeof(uint8_t));
+
+  max_record_check();
+
+  std::vector<uint8_t> file;
+  std::vector<Record> records;
+  std::vector<uint32_t> per_block;
+  encode_session(&file, &records, &per_block, false);
+  printf("Encoded: %zu records in %zu blocks (%.2f bytes/record)\n", records.size(), per_block.size(),
+         (double)file.size() / records.size());
+
+  // Whole file
+  std::vector<Record> rows;
+  std::string messages;
+  bool ran = decode_with_log2csv(script, file, &rows, &messages);
+  expect(ran, "log2csv.py did not run (python3 and the script path needed)");
+  size_t matched = compare(records, rows, records.size());
+  printf("Decoded: %zu records, %zu match\n", rows.size(), matched);
+  expect(rows.size() == records.size(), "log2csv.py decoded a different number of records");
+  expect(matched == records.size(), "decoded record differs from the one encoded");
+  expect(messages.find("truncated") == std::string::npos, "log2csv.py reports a block cut short");
+  expect(messages.find("skipping") == std::string::npos, "log2csv.py skipped a block");
+
+  // Cut off partway through the last block, as by a power loss during the write
+  std::vector<Record> cut_rows;
+  std::string cut_messages;
+  std::vector<uint8_t> cut(file.begin(), file.end() - LOG_BLOCK_BYTES / 3);
+  size_t complete = records.size() - per_block.back();
+  decode_with_log2csv(script, cut, &cut_rows, &cut_messages);
+  size_t cut_matched = compare(records, cut_rows, complete);
+  printf("Cut file: %zu records of the %zu in complete blocks decoded\n", cut_rows.size(), complete);
+  expect(cut_rows.size() == complete && cut_matched == complete, "cut file lost records of complete blocks");
+  expect(cut_messages.find("trailing bytes") != std::string::npos, "cut file: partial block not reported");
+
+  // Blocks handed off at LOGGER_FLUSH_MS age: padded, but every record decodes
+  std::vector<uint8_t> aged_file;
+  std::vector<Record> aged_records, aged_rows;
+  std::vector<uint32_t> aged_per_block;
+  std::string aged_messages;
+  logger_stats = {};
+  encode_session(&aged_file, &aged_records, &aged_per_block, true);
+  decode_with_log2csv(script, aged_file, &aged_rows, &aged_messages);
+  size_t aged_matched = compare(aged_records, aged_rows, aged_records.size());
+  printf("Aged blocks: %zu records in %zu blocks (%lu partial), %zu match\n", aged_records.size(),
+         aged_per_block.size(), (unsigned long)logger_stats.blocks_partial, aged_matched);
+  expect(logger_stats.blocks_partial > 0, "no block handed off at LOGGER_FLUSH_MS");
+  expect(aged_rows.size() == aged_records.size() && aged_matched == aged_records.size(),
+         "aged blocks: decoded records differ from the ones encoded");
+
+  if (failures && !messages.empty()) fprintf(stderr, "log2csv.py: %s", messages.c_str());
+  printf("%s\n", failures ? "FAIL" : "PASS");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,236 @@
+/*****************************************************************************
+  | File        :   odometer_journal_check.cpp
+
+  | help        :
+    Host check for OdometerJournal.cpp on a NOR flash model with power cuts.
+
+    Build (from the repository root):
+      g++ -O2 -std=c++17 -I. tools/odometer_journal_check/odometer_journal_check.cpp \
+          OdometerJournal.cpp -o odometer_journal_check
+
+    The model is an 8-sector (32 KB) partition, as in the README: erased
+    bytes read 0xFF, a write can only clear bits, an erase sets a whole
+    sector back to 0xFF. A power cut stops the write or erase in progress
+    partway through (the byte being programmed or erased gets a random subset
+    of its bits) and fails everything after it until the next boot.
+
+    Power cuts: one flash is carried through many boots. Each boot mounts
+    the journal, commits a random run of records and is cut at a random byte
+    of programming or erasing, so about half the cuts land in a sector
+    erase. After every cut the remount must return either the last record
+    whose commit returned true or the one in flight, never an older one or
+    a mix of fields, and never nothing once a record was committed.
+
+    Wear: a million commits without cuts give the erases per sector per
+    record. The estimate for 200,000 miles assumes one record every
+    ODO_JOURNAL_COMMIT_MS while driving, at several average speeds, against
+    100,000 erase cycles per sector.
+    Exit status 0 = pass.
+******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <random>
+#include <vector>
+
+#include "OdometerJournal.h"
+
+#define SECTORS           8
+#define TRIALS            20000
+#define ENDURANCE_CYCLES  100000
+#define LIFETIME_MILES    200000
+
+typedef struct {
+  std::vector<uint8_t> mem;
+  std::vector<uint32_t> erases;   // Per sector
+  int64_t cut_after;              // Bytes programmed or erased until the cut, -1 = none
+  bool dead;                      // Cut happened: every call fails until reboot
+  bool cut_in_erase;
+  std::mt19937 rng;
+} NorFlash;
+
+// True when the byte about to be changed is the one the power cut hits
+static bool cut_now(NorFlash *f) {
+  if (f->cut_after < 0) return false;
+  return f->cut_after-- == 0;
+}
+
+static bool nor_read(void *ctx, uint32_t offset, void *dst, uint32_t len) {
+  NorFlash *f = (NorFlash *)ctx;
+  if (f->dead || offset + len > f->mem.size()) return false;
+  memcpy(dst, &f->mem[offset], len);
+  return true;
+}
+
+static bool nor_write(void *ctx, uint32_t offset, const void *src, uint32_t len) {
+  NorFlash *f = (NorFlash *)ctx;
+  if (f->dead || offset + len > f->mem.size()) return false;
+  const uint8_t *s = (const uint8_t *)src;
+  for (uint32_t i = 0; i < len; i++) {
+    if (cut_now(f)) {
+      // Only some of the bits that were to be cleared made it
+      f->mem[offset + i] &= (uint8_t)(s[i] | f->rng());
+      f->dead = true;
+      f->cut_in_erase = false;
+      return false;
+    }
+    f->mem[offset + i] &= s[i];
+  }
+  return true;
+}
+
+static bool nor_erase(void *ctx, uint32_t offset) {
+  NorFlash *f = (NorFlash *)ctx;
+  if (f->dead || offset % ODO_SECTOR_BYTES || offset >= f->mem.size()) return false;
+  f->erases[offset / ODO_SECTOR_BYTES]++;
+  for (uint32_t i = 0; i < ODO_SECTOR_BYTES; i++) {
+    if (cut_now(f)) {
+      // Erased up to here, this byte partly, the rest still holds old data
+      f->mem[offset + i] |= (uint8_t)f->rng();
+      f->dead = true;
+      f->cut_in_erase = true;
+      return false;
+    }
+    f->mem[offset + i] = 0xFF;
+  }
+  return true;
+}
+
+static void nor_init(NorFlash *f, uint32_t seed) {
+  f->mem.assign(SECTORS * ODO_SECTOR_BYTES, 0);  // Never erased: must not mount as a record
+  f->erases.assign(SECTORS, 0);
+  f->cut_after = -1;
+  f->dead = false;
+  f->cut_in_erase = false;
+  f->rng.seed(seed);
+}
+
+static OdoFlash nor_flash(NorFlash *f) {
+  OdoFlash flash = { nor_read, nor_write, nor_erase, f, (uint32_t)f->mem.size() };
+  return flash;
+}
+
+// Every field follows from the odometer, so a record mixing two commits is caught
+static OdoState state_for(uint32_t odometer) {
+  OdoState s = { odometer, odometer / 3, odometer / 7 + 11, (uint8_t)(odometer % 5) };
+  return s;
+}
+
+static bool same_state(const OdoState *a, const OdoState *b) {
+  return a->odometer == b->odometer && a->trip == b->trip && a->trip2 == b->trip2 &&
+         a->screen_mode == b->screen_mode;
+}
+
+static bool power_cut_check(void) {
+  NorFlash f;
+  nor_init(&f, 12345);
+  std::mt19937 rng(777);
+  OdoFlash flash = nor_flash(&f);
+
+  bool have_acked = false;
+  uint32_t acked = 0, in_flight = 0;
+  bool have_in_flight = false;
+  uint32_t cuts = 0, cuts_in_erase = 0, recovered_in_flight = 0, records = 0, failures = 0;
+
+  for (uint32_t trial = 0; trial < TRIALS; trial++) {
+    f.dead = false;
+    f.cut_after = -1;
+    OdoJournal j;
+    OdoState got;
+    bool mounted = odo_journal_mount(&j, &flash, &got);
+
+    if (!have_acked && !mounted) {
+      // Nothing committed yet (or only the in-flight record was lost)
+    } else if (!mounted) {
+      if (failures++ < 5) printf("trial %u: committed %u lost, journal mounted empty\n", trial, acked);
+    } else {
+      OdoState want_acked = state_for(acked), want_flight = state_for(in_flight);
+      if (have_in_flight && same_state(&got, &want_flight)) {
+        recovered_in_flight++;
+        acked = in_flight;
+        have_acked = true;
+      } else if (!have_acked || !same_state(&got, &want_acked)) {
+        if (failures++ < 5) {
+          printf("trial %u: mounted odometer %u, expected %u%s\n", trial, got.odometer, acked,
+                 have_in_flight ? " or the record in flight" : "");
+        }
+        acked = got.odometer;  // Carry on from what the journal holds
+        have_acked = true;
+      }
+    }
+    have_in_flight = false;
+
+    // Drive: a run of commits, cut at a random byte of programming or erasing
+    uint32_t run = 1 + rng() % 300;
+    f.cut_after = rng() % (run * ODO_RECORD_BYTES + 2 * ODO_SECTOR_BYTES);
+    uint32_t odometer = acked;
+    for (uint32_t i = 0; i < run; i++) {
+      odometer += 1 + rng() % 4;
+      OdoState s = state_for(odometer);
+      in_flight = odometer;
+      have_in_flight = true;
+      if (!odo_journal_commit(&j, &s)) {
+        if (!f.dead && failures++ < 5) printf("trial %u: commit of %u failed without a power cut\n", trial, odometer);
+        break;
+      }
+      acked = odometer;
+      have_acked = true;
+      have_in_flight = false;
+      records++;
+    }
+    if (f.dead) {
+      cuts++;
+      if (f.cut_in_erase) cuts_in_erase++;
+    }
+  }
+
+  printf("Power cuts: %u boots, %u records, %u cuts (%u during an erase), in-flight record survived %u times, %u failures\n",
+         TRIALS, records, cuts, cuts_in_erase, recovered_in_flight, failures);
+  return failures == 0 && cuts > TRIALS / 2 && cuts_in_erase > 0;
+}
+
+static bool wear_check(void) {
+  NorFlash f;
+  nor_init(&f, 1);
+  OdoFlash flash = nor_flash(&f);
+  OdoJournal j;
+  OdoState s;
+  odo_journal_mount(&j, &flash, &s);
+
+  const uint32_t commits = 1000000;
+  for (uint32_t i = 0; i < commits; i++) {
+    s = state_for(i);
+    if (!odo_journal_commit(&j, &s)) {
+      printf("Wear: commit %u failed\n", i);
+      return false;
+    }
+  }
+  uint32_t min_erases = UINT32_MAX, max_erases = 0, total = 0;
+  for (uint32_t e : f.erases) {
+    if (e < min_erases) min_erases = e;
+    if (e > max_erases) max_erases = e;
+    total += e;
+  }
+  double per_record = (double)total / commits / SECTORS;  // Erases per sector per record
+  printf("Wear: %u commits, %u erases, %u-%u per sector (%d sectors, %d records each)\n",
+         commits, total, min_erases, max_erases, SECTORS, ODO_RECORDS_PER_SECTOR);
+
+  bool ok = max_erases - min_erases <= 1;
+  static const uint32_t avg_mph[] = { 10, 20, 30, 45, 60 };
+  for (uint32_t mph : avg_mph) {
+    double hours = (double)LIFETIME_MILES / mph;
+    double records = hours * 3600.0 * 1000.0 / ODO_JOURNAL_COMMIT_MS;
+    double cycles = records * per_record;
+    printf("Wear: %u miles at %2u mph average: %6.0f h, %5.1fM records, %6.0f erases per sector (%4.1f%% of %d)\n",
+           LIFETIME_MILES, mph, hours, records / 1e6, cycles, 100.0 * cycles / ENDURANCE_CYCLES, ENDURANCE_CYCLES);
+    if (cycles >= ENDURANCE_CYCLES) ok = false;
+  }
+  return ok;
+}
+
+int main(void) {
+  bool ok = power_cut_check();
+  ok = wear_check() && ok;
+  printf("%s\n", ok ? "PASS" : "FAIL");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,259 @@
+#!/usr/bin/env python3
+"""Generate 90-degree pre-rotated glyph tables from lv_font_conv fonts.
+
+The gauge text is laid out along the 960 px axis of the panel, which LVGL used
+to do with transform_angle 900 on every label: each redraw rendered the text
+into a layer and rotated it in software. This reads an uncompressed
+lv_font_conv C file (fonts/aston_28.c, fonts/aston_48.c), rotates every glyph
+90 degrees clockwise into an A8 image and writes a header of RotatedFont
+tables for RotatedLabel.cpp, which places the images directly. Advances,
+offsets and kerning are carried over, so the layout matches the old
+transformed label pixel for pixel.
+
+The fonts have no space or minus glyph (lv_label fell back to Montserrat for
+those), so both are synthesised: a space of 0.27 em and a bar the width of
+half a digit at the digits' mid height.
+
+The Arduino IDE has no pre-build hook, so the generated headers are committed.
+Re-run this after regenerating a font with lv_font_conv:
+
+    python3 tools/rotate_font.py                 # regenerate fonts/*_r90.h
+    python3 tools/rotate_font.py --check         # fail if a header is stale
+"""
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Font, output, glyphs to keep (None = all). The 48 px font only draws values.
+FONTS = [
+    ("fonts/aston_28.c", "fonts/aston_28_r90.h", None),
+    ("fonts/aston_48.c", "fonts/aston_48_r90.h", "0123456789.- "),
+]
+
+GLYPH_DSC_RE = re.compile(
+    r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+    r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}")
+CMAP_RE = re.compile(
+    r"\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*"
+    r"\.unicode_list = (\w+), \.glyph_id_ofs_list = (\w+), \.list_length = (\d+), \.type = (\w+)")
+
+
+class Glyph:
+    def __init__(self, codepoint, adv16, box_w, box_h, ofs_x, ofs_y, pixels):
+        self.codepoint = codepoint
+        self.adv16 = adv16      # Advance in 1/16 px
+        self.box_w = box_w
+        self.box_h = box_h
+        self.ofs_x = ofs_x      # Pen → box left
+        self.ofs_y = ofs_y      # Baseline → box bottom, up positive
+        self.pixels = pixels    # box_h rows of box_w alpha values
+
+
+def c_array(text, name):
+    m = re.search(r"\b%s\[\]\s*=\s*\{(.*?)\};" % re.escape(name), text, re.S)
+    if not m:
+        return None
+    body = re.sub(r"/\*.*?\*/", "", m.group(1), flags=re.S)
+    return [int(v, 0) for v in re.findall(r"-?(?:0x[0-9a-fA-F]+|\d+)", body)]
+
+
+def c_field(text, name):
+    m = re.search(r"\.%s\s*=\s*(-?\d+)" % name, text)
+    if not m:
+        raise ValueError("no .%s in font" % name)
+    return int(m.group(1))
+
+
+def parse_font(path):
+    with open(path) as f:
+        text = f.read()
+    name = re.search(r"\blv_font_t\s+(\w+)\s*=", text).group(1)
+    bpp = c_field(text, "bpp")
+    if c_field(text, "bitmap_format") != 0:
+        raise ValueError("%s: compressed fonts are not supported (use --no-compress)" % path)
+    if c_field(text, "kern_classes") != 0:
+        raise ValueError("%s: class kerning is not supported" % path)
+
+    bitmap = c_array(text, "glyph_bitmap")
+    dscs = [tuple(int(v) for v in m.groups()) for m in GLYPH_DSC_RE.finditer(text)]
+
+    # Glyph id → codepoint
+    codepoints = {}
+    for start, length, gid_start, unicode_list, ofs_list, list_length, kind in CMAP_RE.findall(text):
+        start, length, gid_start = int(start), int(length), int(gid_start)
+        if unicode_list != "NULL":
+            raise ValueError("%s: sparse cmaps are not supported" % path)
+        if kind.endswith("TINY"):
+            for i in range(length):
+                codepoints[gid_start + i] = start + i
+        else:
+            offsets = c_array(text, ofs_list)
+            for i, ofs in enumerate(offsets):
+                if i == 0 or ofs != 0:
+                    codepoints[gid_start + ofs] = start + i
+
+    glyphs = {}
+    for gid, (index, adv16, box_w, box_h, ofs_x, ofs_y) in enumerate(dscs):
+        if gid == 0 or gid not in codepoints:
+            continue
+        # lv_font_conv packs the bits of a glyph contiguously, MSB first
+        pixels = []
+        bit = index * 8
+        max_val = (1 << bpp) - 1
+        for _ in range(box_h):
+            row = []
+            for _ in range(box_w):
+                byte = bitmap[bit // 8]
+                v = (byte >> (8 - bpp - bit % 8)) & max_val
+                row.append(v * 255 // max_val)
+                bit += bpp
+            pixels.append(row)
+        glyphs[codepoints[gid]] = Glyph(codepoints[gid], adv16, box_w, box_h, ofs_x, ofs_y, pixels)
+
+    kerning = {}
+    ids = c_array(text, "kern_pair_glyph_ids") or []
+    values = c_array(text, "kern_pair_values") or []
+    kern_scale = c_field(text, "kern_scale")
+    for i, value in enumerate(values):
+        left, right = codepoints.get(ids[2 * i]), codepoints.get(ids[2 * i + 1])
+        if left is not None and right is not None:
+            kerning[(left, right)] = (value * kern_scale) >> 4  # 1/16 px, as lv_font_fmt_txt
+
+    return {
+        "name": name,
+        "line_height": c_field(text, "line_height"),
+        "base_line": c_field(text, "base_line"),
+        "size": int(re.search(r"Size: (\d+) px", text).group(1)),
+        "glyphs": glyphs,
+        "kerning": kerning,
+    }
+
+
+def add_missing_glyphs(font):
+    glyphs = font["glyphs"]
+    size = font["size"]
+    if 0x20 not in glyphs:
+        glyphs[0x20] = Glyph(0x20, round(size * 0.27 * 16), 0, 0, 0, 0, [])
+    if 0x2D not in glyphs and 0x30 in glyphs:
+        zero = glyphs[0x30]
+        width = max(2, zero.box_w // 2)
+        thick = max(2, round(size / 14))
+        side = max(1, (zero.adv16 // 16 - width) // 3)
+        ofs_y = zero.ofs_y + (zero.box_h - thick) // 2
+        glyphs[0x2D] = Glyph(0x2D, (width + 2 * side) * 16, width, thick, side, ofs_y,
+                             [[255] * width for _ in range(thick)])
+
+
+def rotate_cw(glyph):
+    """Rotated image: width box_h, height box_w; new[c][box_h-1-r] = old[r][c]."""
+    w, h = glyph.box_h, glyph.box_w
+    return [[glyph.pixels[glyph.box_h - 1 - col][row] for col in range(w)] for row in range(h)]
+
+
+def generate(font, source, keep):
+    name = font["name"] + "_r90"
+    glyphs = [g for cp, g in sorted(font["glyphs"].items()) if keep is None or chr(cp) in keep]
+    kept = set(g.codepoint for g in glyphs)
+    kerning = sorted((l, r, v) for (l, r), v in font["kerning"].items() if l in kept and r in kept and v)
+
+    out = []
+    out.append("// Generated by tools/rotate_font.py from %s - do not edit." % source)
+    out.append("// Glyphs rotated 90 degrees clockwise as A8 images for RotatedLabel.")
+    out.append("#pragma once")
+    out.append('#include "../RotatedLabel.h"')
+    out.append("")
+    out.append("#if !ROTATED_LABEL_PREROTATED")
+    out.append("LV_FONT_DECLARE(%s);" % font["name"])
+    out.append("#endif")
+    out.append("")
+
+    out.append("static const uint8_t %s_bitmap[] = {" % name)
+    offsets = []
+    offset = 0
+    for g in glyphs:
+        offsets.append(offset)
+        rows = rotate_cw(g)
+        if not rows:
+            continue
+        out.append("  /* U+%04X */" % g.codepoint)
+        for row in rows:
+            out.append("  " + ", ".join("0x%02x" % v for v in row) + ",")
+        offset += g.box_w * g.box_h
+    out.append("};")
+    out.append("")
+
+    image_index = {}
+    out.append("static const lv_image_dsc_t %s_images[] = {" % name)
+    for g, ofs in zip(glyphs, offsets):
+        if g.box_w == 0 or g.box_h == 0:
+            continue
+        image_index[g.codepoint] = len(image_index)
+        w, h = g.box_h, g.box_w
+        out.append("  { .header = { .magic = LV_IMAGE_HEADER_MAGIC, .cf = LV_COLOR_FORMAT_A8, .flags = 0, "
+                   ".w = %d, .h = %d, .stride = %d, .reserved_2 = 0 }, .data_size = %d, .data = %s_bitmap + %d, "
+                   ".reserved = NULL }," % (w, h, w, w * h, name, ofs))
+    out.append("};")
+    out.append("")
+
+    out.append("static const RotatedGlyph %s_glyphs[] = {" % name)
+    out.append("  // codepoint, advance (1/16 px), x, y, image")
+    for g in glyphs:
+        x = font["base_line"] + g.ofs_y  # Box column from the bottom of the line
+        image = "&%s_images[%d]" % (name, image_index[g.codepoint]) if g.codepoint in image_index else "NULL"
+        label = chr(g.codepoint) if 0x20 < g.codepoint < 0x7F else "U+%04X" % g.codepoint
+        out.append("  { 0x%04X, %4d, %3d, %3d, %s }, // %s" % (g.codepoint, g.adv16, x, g.ofs_x, image, label))
+    out.append("};")
+    out.append("")
+
+    if kerning:
+        out.append("static const RotatedKern %s_kerning[] = {" % name)
+        for left, right, value in kerning:
+            out.append("  { 0x%04X, 0x%04X, %d }," % (left, right, value))
+        out.append("};")
+    out.append("")
+
+    out.append("static const RotatedFont %s = {" % name)
+    out.append("  .glyphs = %s_glyphs," % name)
+    out.append("  .glyph_count = %d," % len(glyphs))
+    out.append("  .kerning = %s," % ("%s_kerning" % name if kerning else "NULL"))
+    out.append("  .kern_count = %d," % len(kerning))
+    out.append("  .line_height = %d," % font["line_height"])
+    out.append("  .source = ROTATED_LABEL_SOURCE(%s)," % font["name"])
+    out.append("};")
+    out.append("")
+    return "\n".join(out), offset
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--check", action="store_true", help="exit 1 if an output file is out of date")
+    args = parser.parse_args()
+
+    stale = False
+    for source, dest, keep in FONTS:
+        font = parse_font(os.path.join(ROOT, source))
+        add_missing_glyphs(font)
+        text, size = generate(font, source, keep)
+        path = os.path.join(ROOT, dest)
+        if args.check:
+            try:
+                with open(path) as f:
+                    current = f.read()
+            except OSError:
+                current = None
+            if current != text:
+                print("%s is out of date; run tools/rotate_font.py" % dest, file=sys.stderr)
+                stale = True
+            continue
+        with open(path, "w") as f:
+            f.write(text)
+        print("Wrote %s: %d glyphs, %d bytes of A8 bitmap" % (
+            dest, len([g for g in font["glyphs"] if keep is None or chr(g) in keep]), size))
+    return 1 if stale else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,15 @@
+#pragma once
+// Host stand-in for the slice of Arduino.h that Display_ST7701.cpp uses.
+// delay() is recorded by tools/st7701_init_check.
+#include <stdint.h>
+#include <stdio.h>
+
+void delay(uint32_t ms);
+inline bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution) {
+  (void)pin; (void)freq; (void)resolution;
+  return true;
+}
+inline bool ledcWrite(uint8_t pin, uint32_t duty) {
+  (void)pin; (void)duty;
+  return true;
+}
@@ -0,0 +1,4 @@
+#pragma once
+// Host stand-in: I2C_Driver.h only needs the include; the expander calls
+// Display_ST7701.cpp makes (set_exio) are recorded by tools/st7701_init_check
+#include "Arduino.h"
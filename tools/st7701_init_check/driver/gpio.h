@@ -0,0 +1,2 @@
+#pragma once
+// Host stand-in: Display_ST7701.cpp drives no GPIO directly (CS is on the expander)
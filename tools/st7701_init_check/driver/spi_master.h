@@ -0,0 +1,69 @@
+#pragma once
+// Host stand-in for the SPI master API Display_ST7701.cpp uses. Transfers
+// are handed to spi_host_transfer(), defined by tools/st7701_init_check.
+#include <stdint.h>
+#include <stddef.h>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+
+typedef struct spi_device_t *spi_device_handle_t;
+typedef enum { SPI1_HOST, SPI2_HOST, SPI3_HOST } spi_host_device_t;
+#define SPI_DMA_CH_AUTO 3
+#define SPI_MODE0       0
+
+typedef struct {
+  int mosi_io_num;
+  int miso_io_num;
+  int sclk_io_num;
+  int quadwp_io_num;
+  int quadhd_io_num;
+  int max_transfer_sz;
+} spi_bus_config_t;
+
+typedef struct {
+  uint8_t command_bits;
+  uint8_t address_bits;
+  uint8_t mode;
+  int clock_speed_hz;
+  int spics_io_num;
+  int queue_size;
+} spi_device_interface_config_t;
+
+typedef struct {
+  uint32_t flags;
+  uint16_t cmd;
+  uint64_t addr;
+  size_t length;       // Bits
+  size_t rxlength;
+  void *user;
+  const void *tx_buffer;
+  void *rx_buffer;
+} spi_transaction_t;
+
+// polling: sent with spi_device_polling_transmit() rather than spi_device_transmit()
+void spi_host_transfer(const spi_transaction_t *trans, bool polling);
+
+extern int spi_host_max_transfer_bytes;
+
+inline esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t *config, int dma) {
+  (void)host; (void)dma;
+  spi_host_max_transfer_bytes = config->max_transfer_sz;
+  return ESP_OK;
+}
+inline esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *config,
+                                    spi_device_handle_t *handle) {
+  (void)host; (void)config;
+  *handle = (spi_device_handle_t)1;
+  return ESP_OK;
+}
+inline esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans) {
+  (void)handle;
+  spi_host_transfer(trans, true);
+  return ESP_OK;
+}
+inline esp_err_t spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans) {
+  (void)handle;
+  spi_host_transfer(trans, false);
+  return ESP_OK;
+}
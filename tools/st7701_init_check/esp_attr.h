@@ -0,0 +1,4 @@
+#pragma once
+// Host stand-in: placement attributes are no-ops
+#define DMA_ATTR
+#define IRAM_ATTR
@@ -0,0 +1,12 @@
+#pragma once
+// Host stand-in for heap_caps: plain malloc, capabilities ignored
+#include <stdlib.h>
+
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DMA      (1 << 3)
+
+inline void *heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+  (void)caps;
+  return calloc(n, size);
+}
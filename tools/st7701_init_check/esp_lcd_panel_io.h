@@ -0,0 +1,2 @@
+#pragma once
+// Host stand-in: Display_ST7701.h includes it, the panel IO API is not used
@@ -0,0 +1,6 @@
+#pragma once
+// Host stand-in: a clock that only moves when delay() is called
+#include <stdint.h>
+
+extern int64_t esp_timer_host_us;
+inline int64_t esp_timer_get_time(void) { return esp_timer_host_us; }
@@ -0,0 +1,10 @@
+#pragma once
+// Host stand-in for the FreeRTOS types and macros Display_ST7701.cpp uses
+#include <stdint.h>
+
+typedef int32_t BaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE              0
+#define pdTRUE               1
+#define pdMS_TO_TICKS(ms)    ((TickType_t)(ms))
@@ -0,0 +1,3 @@
+#pragma once
+// Host stand-in: Display_ST7701.h includes it, no task calls are made
+#include "freertos/FreeRTOS.h"
@@ -0,0 +1,8 @@
+#pragma once
+// Host stand-in for the LVGL types LVGL_Driver.h declares its callbacks with
+#include <stdint.h>
+
+typedef struct _lv_display_t lv_display_t;
+typedef struct {
+  int32_t x1, y1, x2, y2;
+} lv_area_t;
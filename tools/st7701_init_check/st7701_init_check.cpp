@@ -0,0 +1,144 @@
+/*****************************************************************************
+  | File        :   st7701_init_check.cpp
+
+  | help        :
+    Host check of the ST7701 register setup (st7701_init_cmds and
+    st7701_put() in Display_ST7701.cpp): st7701_init() runs behind stand-in
+    SPI, esp_lcd, FreeRTOS and Arduino headers (tools/st7701_init_check/),
+    every transfer is unpacked back into 9-bit words, and the result is
+    compared with the vendor sequence the table replaced.
+
+    Build (from the repository root):
+      g++ -O2 -std=c++17 -I. -Itools/st7701_init_check tools/st7701_init_check/st7701_init_check.cpp \
+          -o st7701_init_check
+
+    Checks:
+      - the words on the bus, D/C bit included, are the vendor's 230
+        st7701_write_command() / st7701_write_data() calls, in order
+      - each wait comes after the same word as in the vendor sequence, and
+        everything before it has been sent when it starts
+      - every transfer is a whole number of words, fits ST7701_BATCH_BYTES
+        and the bus's max_transfer_sz, and is made with CS (EXIO3) low;
+        CS is high again when st7701_init() returns
+      - st7701_words / st7701_transfers, which the boot report prints,
+        match what was sent
+    Exit status 0 = pass.
+******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+// The table and packing are static to Display_ST7701.cpp
+#include "Display_ST7701.cpp"
+
+int64_t esp_timer_host_us = 0;
+int spi_host_max_transfer_bytes = 0;
+
+void boot_mark(const char *phase) { (void)phase; }
+
+// The vendor setup as it was sent before the table: one transfer per call,
+// a 1-bit command phase (0 = command, 1 = parameter) then the byte
+static const uint16_t vendor_words[] = {
+  0x0FF, 0x177, 0x101, 0x100, 0x100, 0x113, 0x0EF, 0x108, 0x0FF, 0x177, 0x101, 0x100,
+  0x100, 0x110, 0x0C0, 0x177, 0x100, 0x0C1, 0x111, 0x10C, 0x0C2, 0x107, 0x102, 0x0CC,
+  0x130, 0x0B0, 0x106, 0x1CF, 0x114, 0x10C, 0x10F, 0x103, 0x100, 0x10A, 0x107, 0x11B,
+  0x103, 0x112, 0x110, 0x125, 0x136, 0x11E, 0x0B1, 0x10C, 0x1D4, 0x118, 0x10C, 0x10E,
+  0x106, 0x103, 0x106, 0x108, 0x123, 0x106, 0x112, 0x110, 0x130, 0x12F, 0x11F, 0x0FF,
+  0x177, 0x101, 0x100, 0x100, 0x111, 0x0B0, 0x173, 0x0B1, 0x17C, 0x0B2, 0x183, 0x0B3,
+  0x180, 0x0B5, 0x149, 0x0B7, 0x187, 0x0B8, 0x133, 0x0B9, 0x110, 0x11F, 0x0BB, 0x103,
+  0x0C1, 0x108, 0x0C2, 0x108, 0x0D0, 0x188, 0x0E0, 0x100, 0x100, 0x102, 0x100, 0x100,
+  0x10C, 0x0E1, 0x105, 0x196, 0x107, 0x196, 0x106, 0x196, 0x108, 0x196, 0x100, 0x144,
+  0x144, 0x0E2, 0x100, 0x100, 0x103, 0x103, 0x100, 0x100, 0x102, 0x100, 0x100, 0x100,
+  0x102, 0x100, 0x0E3, 0x100, 0x100, 0x133, 0x133, 0x0E4, 0x144, 0x144, 0x0E5, 0x10D,
+  0x1D4, 0x128, 0x18C, 0x10F, 0x1D6, 0x128, 0x18C, 0x109, 0x1D0, 0x128, 0x18C, 0x10B,
+  0x1D2, 0x128, 0x18C, 0x0E6, 0x100, 0x100, 0x133, 0x133, 0x0E7, 0x144, 0x144, 0x0E8,
+  0x10E, 0x1D5, 0x128, 0x18C, 0x110, 0x1D7, 0x128, 0x18C, 0x10A, 0x1D1, 0x128, 0x18C,
+  0x10C, 0x1D3, 0x128, 0x18C, 0x0EB, 0x100, 0x101, 0x1E4, 0x1E4, 0x144, 0x100, 0x0ED,
+  0x1F3, 0x1C1, 0x1BA, 0x10F, 0x166, 0x177, 0x144, 0x155, 0x155, 0x144, 0x177, 0x166,
+  0x1F0, 0x1AB, 0x11C, 0x13F, 0x0EF, 0x110, 0x10D, 0x104, 0x108, 0x13F, 0x11F, 0x0FF,
+  0x177, 0x101, 0x100, 0x100, 0x113, 0x0E8, 0x100, 0x10E, 0x011, 0x0E8, 0x100, 0x10C,
+  0x0E8, 0x140, 0x100, 0x0FF, 0x177, 0x101, 0x100, 0x100, 0x100, 0x036, 0x100, 0x03A,
+  0x166, 0x029,
+};
+
+typedef struct {
+  size_t after_words;  // Words sent before the wait
+  uint32_t ms;
+} Wait;
+
+// Sleep out, the second 0xE8, display on
+static const Wait vendor_waits[] = { { 213, 120 }, { 216, 10 }, { 230, 20 } };
+
+static std::vector<uint16_t> sent;
+static std::vector<Wait> waits;
+static uint32_t transfers = 0, polled = 0;
+static bool cs_low = false;
+
+static int failures = 0;
+
+static void expect(bool ok, const char *what) {
+  if (!ok && failures++ < 20) fprintf(stderr, "FAIL: %s\n", what);
+}
+
+void set_exio(uint8_t Pin, uint8_t State) {
+  if (Pin == EXIO_PIN3) cs_low = State == Low;
+}
+
+void delay(uint32_t ms) {
+  if (cs_low) waits.push_back({ sent.size(), ms });  // Waits inside the register setup
+  esp_timer_host_us += (int64_t)ms * 1000;
+}
+
+// Unpack the transfer MSB first, 9 bits a word, as the panel shifts it in
+void spi_host_transfer(const spi_transaction_t *trans, bool polling) {
+  const uint8_t *bytes = (const uint8_t *)trans->tx_buffer;
+  size_t bits = trans->length;
+  transfers++;
+  polled += polling;
+  expect(cs_low, "transfer made with CS high");
+  expect(bits > 0 && bits % 9 == 0, "transfer is not a whole number of 9-bit words");
+  expect(bits <= ST7701_BATCH_BYTES * 8, "transfer longer than ST7701_BATCH_BYTES");
+  expect(bits <= (size_t)spi_host_max_transfer_bytes * 8, "transfer longer than the bus max_transfer_sz");
+  for (size_t w = 0; w + 9 <= bits; w += 9) {
+    uint16_t word = 0;
+    for (size_t b = w; b < w + 9; b++) word = (uint16_t)(word << 1 | ((bytes[b >> 3] >> (7 - (b & 7))) & 1));
+    sent.push_back(word);
+  }
+}
+
+int main(void) {
+  st7701_cs_dis();
+  st7701_init();
+
+  const size_t count = sizeof(vendor_words) / sizeof(vendor_words[0]);
+  size_t matched = 0;
+  while (matched < count && matched < sent.size() && sent[matched] == vendor_words[matched]) matched++;
+  printf("Words: %zu sent, %zu of the vendor's %zu match\n", sent.size(), matched, count);
+  if (matched < count && matched < sent.size()) {
+    fprintf(stderr, "First difference at word %zu: sent 0x%03X, vendor 0x%03X\n", matched, sent[matched],
+            vendor_words[matched]);
+  }
+  expect(sent.size() == count && matched == count, "words on the bus differ from the vendor sequence");
+
+  const size_t wait_count = sizeof(vendor_waits) / sizeof(vendor_waits[0]);
+  bool same_waits = waits.size() == wait_count;
+  for (size_t i = 0; same_waits && i < wait_count; i++) {
+    same_waits = waits[i].after_words == vendor_waits[i].after_words && waits[i].ms == vendor_waits[i].ms;
+  }
+  for (const Wait &w : waits) printf("Wait: %u ms after word %zu\n", w.ms, w.after_words);
+  expect(same_waits, "waits differ from the vendor sequence, or start before the words ahead of them are sent");
+
+  expect(!cs_low, "CS still low after st7701_init()");
+  expect(st7701_words == sent.size(), "st7701_words differs from the words sent");
+  expect(st7701_transfers == transfers, "st7701_transfers differs from the transfers made");
+#if ST7701_INIT_BATCHED
+  expect(polled == transfers, "batched transfer not sent by polling");
+#else
+  expect(transfers == sent.size(), "unbatched setup does not send one word per transfer");
+#endif
+  printf("Transfers: %u (%u polled), %s, ST7701_BATCH_BYTES %d\n", transfers, polled,
+         ST7701_INIT_BATCHED ? "batched" : "one word each", ST7701_BATCH_BYTES);
+
+  printf("%s\n", failures ? "FAIL" : "PASS");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,76 @@
+#pragma once
+// Host stand-in for the slice of the Arduino Wire library that I2C_Driver.cpp
+// uses, with a TCA9554 register file behind address 0x20. Every
+// endTransmission() and requestFrom() is one bus transaction and is counted,
+// so tools/tca9554_check can compare drivers by I2C traffic.
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+inline unsigned long millis(void) { return 0; }
+inline void delay(uint32_t ms) { (void)ms; }
+
+typedef struct {
+  uint8_t regs[4];          // Input, output, polarity, config
+  uint8_t pointer;          // Command byte; does not auto-increment
+  uint32_t transactions;    // endTransmission() + requestFrom() calls
+  uint32_t writes;          // Register writes (address + command + data)
+  uint32_t reads;           // requestFrom() calls
+  uint32_t nack_writes;     // NACK this many of the next register writes
+} Tca9554Model;
+
+extern Tca9554Model tca_model;
+
+class TwoWire {
+ public:
+  void begin(int sda, int scl) { (void)sda; (void)scl; }
+  void setTimeOut(uint16_t ms) { (void)ms; }
+
+  void beginTransmission(uint8_t address) {
+    address_ = address;
+    length_ = 0;
+  }
+
+  size_t write(uint8_t data) {
+    if (length_ < sizeof(buffer_)) buffer_[length_++] = data;
+    return 1;
+  }
+
+  uint8_t endTransmission(bool stop = true) {
+    (void)stop;
+    tca_model.transactions++;
+    if (address_ != 0x20) return 2;  // Address NACK
+    if (length_ >= 1) tca_model.pointer = buffer_[0] & 0x03;
+    if (length_ >= 2) {
+      if (tca_model.nack_writes > 0) {
+        tca_model.nack_writes--;
+        return 3;                    // Data NACK, register unchanged
+      }
+      tca_model.writes++;
+      if (tca_model.pointer != 0) tca_model.regs[tca_model.pointer] = buffer_[1];  // Input is read-only
+    }
+    return 0;
+  }
+
+  size_t requestFrom(uint8_t address, size_t length) {
+    tca_model.transactions++;
+    tca_model.reads++;
+    rx_length_ = rx_pos_ = 0;
+    if (address != 0x20) return 0;
+    // Every byte comes from the same register (no auto-increment)
+    for (size_t i = 0; i < length && i < sizeof(rx_); i++) rx_[rx_length_++] = tca_model.regs[tca_model.pointer];
+    return rx_length_;
+  }
+
+  int available(void) { return (int)(rx_length_ - rx_pos_); }
+  int read(void) { return rx_pos_ < rx_length_ ? rx_[rx_pos_++] : -1; }
+
+ private:
+  uint8_t address_ = 0;
+  uint8_t buffer_[8] = {};
+  size_t length_ = 0;
+  uint8_t rx_[8] = {};
+  size_t rx_length_ = 0, rx_pos_ = 0;
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,183 @@
+/*****************************************************************************
+  | File        :   tca9554_check.cpp
+
+  | help        :
+    Host check of the shadow-register TCA9554 driver (TCA9554PWR.cpp) against
+    a register-level model of the expander behind a stand-in Wire library
+    (tools/tca9554_check/Wire.h), with I2C transaction counting.
+
+    Build (from the repository root):
+      g++ -O2 -std=c++17 -I. -Itools/tca9554_check tools/tca9554_check/tca9554_check.cpp \
+          TCA9554PWR.cpp I2C_Driver.cpp -o tca9554_check
+
+    Checks:
+      - init seeds the shadow from the chip (registers survive an ESP32 reset)
+      - 20000 random set_exio / set_exios / set_exios_masked / set_toggle /
+        mode_exio / mode_exios calls leave the chip equal to a reference model,
+        read_exios() of the shadowed registers never touches the bus, and a
+        call costs at most one write, none if it changes nothing
+      - a NACKed write leaves the shadow unchanged and the next call retries
+      - nothing is printed on the success path
+    and prints the transactions of the boot sequence (expander init, panel
+    reset, CS, setup()) next to what the read-modify-write driver needed.
+    Exit status 0 = pass.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "TCA9554PWR.h"
+
+Tca9554Model tca_model;
+TwoWire Wire;
+
+static int failures = 0;
+
+static void expect(bool ok, const char *what) {
+  if (!ok) {
+    fprintf(stderr, "FAIL: %s\n", what);
+    failures++;
+  }
+}
+
+// Run fn with stdout captured; returns the number of bytes it printed
+template <typename F>
+static long printed_by(F fn) {
+  fflush(stdout);
+  int saved = dup(1);
+  FILE *capture = tmpfile();
+  dup2(fileno(capture), 1);
+  fn();
+  fflush(stdout);
+  long bytes = ftell(capture);
+  dup2(saved, 1);
+  close(saved);
+  fclose(capture);
+  return bytes;
+}
+
+static void reset_chip(uint8_t output, uint8_t polarity, uint8_t config) {
+  tca_model = {};
+  tca_model.regs[TCA9554_INPUT_REG] = 0xFF;
+  tca_model.regs[TCA9554_OUTPUT_REG] = output;
+  tca_model.regs[TCA9554_Polarity_REG] = polarity;
+  tca_model.regs[TCA9554_CONFIG_REG] = config;
+}
+
+static bool chip_is(uint8_t output, uint8_t config) {
+  return tca_model.regs[TCA9554_OUTPUT_REG] == output && tca_model.regs[TCA9554_CONFIG_REG] == config;
+}
+
+static void check_boot_sequence(void) {
+  // Registers left over from before a soft reset, not the power-on values
+  reset_chip(0x5A, 0x00, 0xFF);
+  tca9554pwr_init(0xF0);
+  expect(read_exios(TCA9554_OUTPUT_REG) == 0x5A, "init seeds the output shadow from the chip");
+  expect(chip_is(0x5A, 0xF0), "init writes the configuration");
+  set_exio(EXIO_PIN1, High);
+  expect(chip_is(0x5B, 0xF0), "a pin write after seeding keeps the other outputs");
+
+  // From power-on: drivers_init(), then lcd_init(): st7701_reset(),
+  // st7701_cs_en() ... st7701_cs_dis(); then setup(): EXIO4 low
+  reset_chip(0xFF, 0x00, 0xFF);
+  uint32_t t0 = tca_model.transactions;
+  tca9554pwr_init(0xF0);
+  uint32_t init = tca_model.transactions - t0;
+  t0 = tca_model.transactions;
+  set_exio(EXIO_PIN1, Low);
+  set_exio(EXIO_PIN1, High);
+  set_exio(EXIO_PIN3, Low);
+  set_exio(EXIO_PIN3, High);
+  set_exio(EXIO_PIN4, Low);
+  uint32_t pins = tca_model.transactions - t0;
+  expect(chip_is(0xF7, 0xF0), "boot pin sequence leaves the expected outputs");
+
+  // Old driver: mode_exios = 1 write; set_exio = output register read (2) + write (1)
+  printf("boot: init %u transactions (old 1; 3 register reads seed the shadow), "
+         "5 pin writes %u transactions (old 15)\n", init, pins);
+}
+
+static void check_random(void) {
+  reset_chip(0xFF, 0x00, 0xFF);
+  tca9554pwr_init(0xFF);
+  uint8_t output = 0xFF, config = 0xFF;
+  uint32_t max_per_call = 0, bus_reads = 0, calls_written = 0;
+  srand(1);
+
+  for (int i = 0; i < 20000; i++) {
+    uint8_t pin = 1 + rand() % 8;
+    uint8_t state = rand() % 2;
+    uint8_t value = rand() & 0xFF;
+    uint8_t mask = rand() & 0xFF;
+    uint8_t bit = 1 << (pin - 1);
+    uint8_t before_output = output, before_config = config;
+    uint32_t t0 = tca_model.transactions;
+    switch (rand() % 6) {
+      case 0: set_exio(pin, state); output = state ? output | bit : output & ~bit; break;
+      case 1: set_exios(value); output = value; break;
+      case 2: set_exios_masked(mask, value); output = (output & ~mask) | (value & mask); break;
+      case 3: set_toggle(pin); output ^= bit; break;
+      case 4: mode_exio(pin, state); config = state ? config | bit : config & ~bit; break;
+      case 5: mode_exios(value); config = value; break;
+    }
+    uint32_t spent = tca_model.transactions - t0;
+    if (spent > max_per_call) max_per_call = spent;
+    if (spent) calls_written++;
+    bool changed = output != before_output || config != before_config;
+    if (spent != (changed ? 1u : 0u)) {
+      expect(false, "a call costs one write if it changes something, none otherwise");
+      break;
+    }
+    if (!chip_is(output, config)) {
+      expect(false, "chip registers follow the reference model");
+      break;
+    }
+
+    t0 = tca_model.transactions;
+    bool shadow_ok = read_exios(TCA9554_OUTPUT_REG) == output && read_exios(TCA9554_CONFIG_REG) == config &&
+                     read_exios(TCA9554_Polarity_REG) == 0x00;
+    bus_reads += tca_model.transactions - t0;
+    if (!shadow_ok) {
+      expect(false, "read_exios returns the shadowed registers");
+      break;
+    }
+  }
+  expect(bus_reads == 0, "reading shadowed registers does not touch the bus");
+  printf("random: 20000 calls, %u wrote, max %u transaction per call, %u bus reads for shadow reads\n",
+         calls_written, max_per_call, bus_reads);
+}
+
+static void check_nack(void) {
+  reset_chip(0xFF, 0x00, 0xFF);
+  tca9554pwr_init(0xF0);
+  tca_model.nack_writes = 1;
+  printed_by([] { set_exio(EXIO_PIN2, Low); });  // Failure messages are expected here
+  expect(chip_is(0xFF, 0xF0), "NACKed write leaves the chip unchanged");
+  expect(read_exios(TCA9554_OUTPUT_REG) == 0xFF, "NACKed write leaves the shadow unchanged");
+  set_exio(EXIO_PIN2, Low);
+  expect(chip_is(0xFD, 0xF0), "the next call retries the write");
+}
+
+static void check_quiet(void) {
+  reset_chip(0xFF, 0x00, 0xFF);
+  long bytes = printed_by([] {
+    tca9554pwr_init(0xF0);
+    for (int i = 0; i < 100; i++) {
+      set_exio(EXIO_PIN1, i & 1);
+      set_exios_masked(0x0C, i & 1 ? 0x04 : 0x08);
+      mode_exio(EXIO_PIN2, Low);
+      read_exios(TCA9554_OUTPUT_REG);
+      read_exio(EXIO_PIN5);
+    }
+  });
+  expect(bytes == 0, "nothing is printed on the success path");
+}
+
+int main() {
+  check_boot_sequence();
+  check_random();
+  check_nack();
+  check_quiet();
+  printf(failures ? "FAIL\n" : "PASS\n");
+  return failures ? 1 : 0;
+}